@@ -0,0 +1,10778 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SarInfo.proto
+
+#include "SarInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR SarInfo_SarDiskInfo::SarInfo_SarDiskInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dev_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tps_)*/0
+  , /*decltype(_impl_.rd_sec_)*/0
+  , /*decltype(_impl_.wr_sec_)*/0
+  , /*decltype(_impl_.avgrq_sz_)*/0
+  , /*decltype(_impl_.avgqu_sz_)*/0
+  , /*decltype(_impl_.await_)*/0
+  , /*decltype(_impl_.svctm_)*/0
+  , /*decltype(_impl_.util_)*/0} {}
+struct SarInfo_SarDiskInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarDiskInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarDiskInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarDiskInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarDiskInfoDefaultTypeInternal _SarInfo_SarDiskInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarNetProtoInfo::SarInfo_SarNetProtoInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tcp_active_opens_)*/0
+  , /*decltype(_impl_.tcp_passive_opens_)*/0
+  , /*decltype(_impl_.tcp_attempt_fails_)*/0
+  , /*decltype(_impl_.tcp_estab_resets_)*/0
+  , /*decltype(_impl_.tcp_in_segs_)*/0
+  , /*decltype(_impl_.tcp_out_segs_)*/0
+  , /*decltype(_impl_.tcp_retrans_segs_)*/0
+  , /*decltype(_impl_.tcp_retrans_pct_)*/0
+  , /*decltype(_impl_.tcp_in_errs_)*/0
+  , /*decltype(_impl_.tcp_out_rsts_)*/0
+  , /*decltype(_impl_.tcp_timeouts_)*/0
+  , /*decltype(_impl_.tcp_syn_retrans_)*/0
+  , /*decltype(_impl_.listen_overflows_)*/0
+  , /*decltype(_impl_.listen_drops_)*/0
+  , /*decltype(_impl_.syn_drops_)*/0
+  , /*decltype(_impl_.syncookies_sent_)*/0
+  , /*decltype(_impl_.tcp_memory_pressures_)*/0
+  , /*decltype(_impl_.tcp_abort_on_memory_)*/0
+  , /*decltype(_impl_.tcp_prune_called_)*/0
+  , /*decltype(_impl_.tcp_rcv_pruned_)*/0
+  , /*decltype(_impl_.udp_in_datagrams_)*/0
+  , /*decltype(_impl_.udp_out_datagrams_)*/0
+  , /*decltype(_impl_.udp_no_ports_)*/0
+  , /*decltype(_impl_.udp_in_errors_)*/0
+  , /*decltype(_impl_.udp_rcvbuf_errors_)*/0
+  , /*decltype(_impl_.udp_sndbuf_errors_)*/0} {}
+struct SarInfo_SarNetProtoInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarNetProtoInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarNetProtoInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarNetProtoInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarNetProtoInfoDefaultTypeInternal _SarInfo_SarNetProtoInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarCpuInfo::SarInfo_SarCpuInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.softnet_processed_)*/0
+  , /*decltype(_impl_.softnet_dropped_)*/0
+  , /*decltype(_impl_.softnet_time_squeeze_)*/0
+  , /*decltype(_impl_.cpu_)*/0
+  , /*decltype(_impl_.softnet_squeezed_)*/false
+  , /*decltype(_impl_.softnet_received_rps_)*/0
+  , /*decltype(_impl_.softnet_flow_limit_)*/0
+  , /*decltype(_impl_.sched_run_time_)*/0
+  , /*decltype(_impl_.sched_run_delay_)*/0
+  , /*decltype(_impl_.sched_timeslices_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_nice_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.cpu_iowait_)*/0
+  , /*decltype(_impl_.cpu_steal_)*/0
+  , /*decltype(_impl_.cpu_idle_)*/0
+  , /*decltype(_impl_.core_id_)*/0
+  , /*decltype(_impl_.package_id_)*/0
+  , /*decltype(_impl_.cur_freq_)*/0
+  , /*decltype(_impl_.max_freq_)*/0
+  , /*decltype(_impl_.core_throttle_)*/0
+  , /*decltype(_impl_.package_throttle_)*/0
+  , /*decltype(_impl_.node_)*/0} {}
+struct SarInfo_SarCpuInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarCpuInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarCpuInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarCpuInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarCpuInfoDefaultTypeInternal _SarInfo_SarCpuInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarTaskSchedInfo::SarInfo_SarTaskSchedInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.comm_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.run_time_)*/0
+  , /*decltype(_impl_.run_delay_)*/0
+  , /*decltype(_impl_.timeslices_)*/0
+  , /*decltype(_impl_.avg_delay_)*/0
+  , /*decltype(_impl_.pid_)*/0} {}
+struct SarInfo_SarTaskSchedInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarTaskSchedInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarTaskSchedInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarTaskSchedInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarTaskSchedInfoDefaultTypeInternal _SarInfo_SarTaskSchedInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarPsiInfo::SarInfo_SarPsiInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.some_avg10_)*/0
+  , /*decltype(_impl_.some_avg60_)*/0
+  , /*decltype(_impl_.some_avg300_)*/0
+  , /*decltype(_impl_.full_avg10_)*/0
+  , /*decltype(_impl_.full_avg60_)*/0
+  , /*decltype(_impl_.full_avg300_)*/0
+  , /*decltype(_impl_.some_stall_)*/0
+  , /*decltype(_impl_.full_stall_)*/0} {}
+struct SarInfo_SarPsiInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarPsiInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarPsiInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarPsiInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarPsiInfoDefaultTypeInternal _SarInfo_SarPsiInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarCgroupInfo::SarInfo_SarCgroupInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.psi_cpu_)*/nullptr
+  , /*decltype(_impl_.psi_memory_)*/nullptr
+  , /*decltype(_impl_.psi_io_)*/nullptr
+  , /*decltype(_impl_.inode_)*/uint64_t{0u}
+  , /*decltype(_impl_.cpu_usage_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.nr_throttled_)*/0
+  , /*decltype(_impl_.throttled_time_)*/0
+  , /*decltype(_impl_.memory_current_)*/uint64_t{0u}
+  , /*decltype(_impl_.memory_anon_)*/uint64_t{0u}
+  , /*decltype(_impl_.memory_file_)*/uint64_t{0u}
+  , /*decltype(_impl_.pgfault_)*/0
+  , /*decltype(_impl_.pgmajfault_)*/0
+  , /*decltype(_impl_.io_rbytes_)*/0
+  , /*decltype(_impl_.io_wbytes_)*/0
+  , /*decltype(_impl_.io_rios_)*/0
+  , /*decltype(_impl_.io_wios_)*/0} {}
+struct SarInfo_SarCgroupInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarCgroupInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarCgroupInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarCgroupInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarCgroupInfoDefaultTypeInternal _SarInfo_SarCgroupInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarProcessInfo::SarInfo_SarProcessInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.comm_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cpu_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.rss_)*/uint64_t{0u}
+  , /*decltype(_impl_.shared_)*/uint64_t{0u}
+  , /*decltype(_impl_.minflt_)*/0
+  , /*decltype(_impl_.majflt_)*/0
+  , /*decltype(_impl_.read_bytes_)*/0
+  , /*decltype(_impl_.write_bytes_)*/0
+  , /*decltype(_impl_.pid_)*/0} {}
+struct SarInfo_SarProcessInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarProcessInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarProcessInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarProcessInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarProcessInfoDefaultTypeInternal _SarInfo_SarProcessInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarIfaceInfo::SarInfo_SarIfaceInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rxpck_)*/0
+  , /*decltype(_impl_.txpck_)*/0
+  , /*decltype(_impl_.rxbyt_)*/0
+  , /*decltype(_impl_.txbyt_)*/0
+  , /*decltype(_impl_.rxerr_)*/0
+  , /*decltype(_impl_.txerr_)*/0
+  , /*decltype(_impl_.rxdrop_)*/0
+  , /*decltype(_impl_.txdrop_)*/0} {}
+struct SarInfo_SarIfaceInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarIfaceInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarIfaceInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarIfaceInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarIfaceInfoDefaultTypeInternal _SarInfo_SarIfaceInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarNetnsInfo::SarInfo_SarNetnsInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.iface_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.inode_)*/uint64_t{0u}
+  , /*decltype(_impl_.rxpck_)*/0
+  , /*decltype(_impl_.txpck_)*/0
+  , /*decltype(_impl_.rxbyt_)*/0
+  , /*decltype(_impl_.txbyt_)*/0
+  , /*decltype(_impl_.rxerr_)*/0
+  , /*decltype(_impl_.txerr_)*/0
+  , /*decltype(_impl_.rxdrop_)*/0
+  , /*decltype(_impl_.txdrop_)*/0
+  , /*decltype(_impl_.pid_)*/0} {}
+struct SarInfo_SarNetnsInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarNetnsInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarNetnsInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarNetnsInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarNetnsInfoDefaultTypeInternal _SarInfo_SarNetnsInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarFsInfo::SarInfo_SarFsInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.mount_point_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.fs_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.source_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.used_)*/uint64_t{0u}
+  , /*decltype(_impl_.avail_)*/uint64_t{0u}
+  , /*decltype(_impl_.used_pct_)*/0
+  , /*decltype(_impl_.free_pct_)*/0
+  , /*decltype(_impl_.inode_used_pct_)*/0
+  , /*decltype(_impl_.growth_)*/0
+  , /*decltype(_impl_.time_to_full_)*/0} {}
+struct SarInfo_SarFsInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarFsInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarFsInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarFsInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarFsInfoDefaultTypeInternal _SarInfo_SarFsInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarCpuGroupInfo::SarInfo_SarCpuGroupInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.package_id_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_nice_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.cpu_iowait_)*/0
+  , /*decltype(_impl_.cpu_steal_)*/0
+  , /*decltype(_impl_.cpu_idle_)*/0
+  , /*decltype(_impl_.nr_cpus_)*/0} {}
+struct SarInfo_SarCpuGroupInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarCpuGroupInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarCpuGroupInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarCpuGroupInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarCpuGroupInfoDefaultTypeInternal _SarInfo_SarCpuGroupInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarNodeInfo::SarInfo_SarNodeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.node_)*/0
+  , /*decltype(_impl_.nr_cpus_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_nice_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.cpu_iowait_)*/0
+  , /*decltype(_impl_.cpu_steal_)*/0
+  , /*decltype(_impl_.cpu_idle_)*/0
+  , /*decltype(_impl_.mem_total_)*/uint64_t{0u}
+  , /*decltype(_impl_.mem_free_)*/uint64_t{0u}
+  , /*decltype(_impl_.numa_hit_)*/0
+  , /*decltype(_impl_.numa_miss_)*/0
+  , /*decltype(_impl_.numa_foreign_)*/0
+  , /*decltype(_impl_.local_node_)*/0
+  , /*decltype(_impl_.other_node_)*/0} {}
+struct SarInfo_SarNodeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarNodeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarNodeInfoDefaultTypeInternal() {}
+  union {
+    SarInfo_SarNodeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarNodeInfoDefaultTypeInternal _SarInfo_SarNodeInfo_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo_SarSketch::SarInfo_SarSketch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.counts_)*/{}
+  , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.negative_counts_)*/{}
+  , /*decltype(_impl_._negative_counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.relative_accuracy_)*/0
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.sum_)*/0
+  , /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0
+  , /*decltype(_impl_.zero_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.offset_)*/0
+  , /*decltype(_impl_.negative_offset_)*/0} {}
+struct SarInfo_SarSketchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfo_SarSketchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfo_SarSketchDefaultTypeInternal() {}
+  union {
+    SarInfo_SarSketch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfo_SarSketchDefaultTypeInternal _SarInfo_SarSketch_default_instance_;
+PROTOBUF_CONSTEXPR SarInfo::SarInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sar_disk_info_)*/{}
+  , /*decltype(_impl_.sar_cpu_info_)*/{}
+  , /*decltype(_impl_.sar_task_sched_info_)*/{}
+  , /*decltype(_impl_.sar_cgroup_info_)*/{}
+  , /*decltype(_impl_.sar_process_info_)*/{}
+  , /*decltype(_impl_.sar_netns_info_)*/{}
+  , /*decltype(_impl_.sar_fs_info_)*/{}
+  , /*decltype(_impl_.sar_core_info_)*/{}
+  , /*decltype(_impl_.sar_socket_info_)*/{}
+  , /*decltype(_impl_.sar_node_info_)*/{}
+  , /*decltype(_impl_.sar_sketch_)*/{}
+  , /*decltype(_impl_.net_proto_)*/nullptr
+  , /*decltype(_impl_.psi_cpu_)*/nullptr
+  , /*decltype(_impl_.psi_memory_)*/nullptr
+  , /*decltype(_impl_.psi_io_)*/nullptr
+  , /*decltype(_impl_.rxpck_)*/0
+  , /*decltype(_impl_.txpck_)*/0
+  , /*decltype(_impl_.rxbyt_)*/0
+  , /*decltype(_impl_.txbyt_)*/0
+  , /*decltype(_impl_.rxcmp_)*/0
+  , /*decltype(_impl_.txcmp_)*/0
+  , /*decltype(_impl_.rxmcst_)*/0
+  , /*decltype(_impl_.rxerr_)*/0
+  , /*decltype(_impl_.txerr_)*/0
+  , /*decltype(_impl_.coll_)*/0
+  , /*decltype(_impl_.rxdrop_)*/0
+  , /*decltype(_impl_.txdrop_)*/0
+  , /*decltype(_impl_.txcarr_)*/0
+  , /*decltype(_impl_.rxfram_)*/0
+  , /*decltype(_impl_.rxfifo_)*/0
+  , /*decltype(_impl_.txfifo_)*/0
+  , /*decltype(_impl_.nr_processes_)*/0
+  , /*decltype(_impl_.cpu_user_)*/0
+  , /*decltype(_impl_.cpu_nice_)*/0
+  , /*decltype(_impl_.cpu_system_)*/0
+  , /*decltype(_impl_.cpu_iowait_)*/0
+  , /*decltype(_impl_.cpu_steal_)*/0
+  , /*decltype(_impl_.cpu_idle_)*/0
+  , /*decltype(_impl_.pgpgin_)*/0
+  , /*decltype(_impl_.pgpgout_)*/0
+  , /*decltype(_impl_.pgfault_)*/0
+  , /*decltype(_impl_.pgmajfault_)*/0
+  , /*decltype(_impl_.pswpin_)*/0
+  , /*decltype(_impl_.pswpout_)*/0
+  , /*decltype(_impl_.tps_)*/0
+  , /*decltype(_impl_.rtps_)*/0
+  , /*decltype(_impl_.wtps_)*/0
+  , /*decltype(_impl_.bread_)*/0
+  , /*decltype(_impl_.bwrtn_)*/0
+  , /*decltype(_impl_.frmpg_)*/0
+  , /*decltype(_impl_.bufpg_)*/0
+  , /*decltype(_impl_.campg_)*/0
+  , /*decltype(_impl_.softnet_processed_)*/0
+  , /*decltype(_impl_.softnet_dropped_)*/0
+  , /*decltype(_impl_.softnet_time_squeeze_)*/0
+  , /*decltype(_impl_.sched_run_delay_)*/0
+  , /*decltype(_impl_.softnet_squeezed_cpus_)*/0} {}
+struct SarInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SarInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SarInfoDefaultTypeInternal() {}
+  union {
+    SarInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SarInfoDefaultTypeInternal _SarInfo_default_instance_;
+static ::_pb::Metadata file_level_metadata_SarInfo_2eproto[14];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SarInfo_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SarInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_SarInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.tps_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.rd_sec_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.wr_sec_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.avgrq_sz_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.avgqu_sz_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.await_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.svctm_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.util_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarDiskInfo, _impl_.dev_name_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  0,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_active_opens_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_passive_opens_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_attempt_fails_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_estab_resets_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_in_segs_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_out_segs_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_retrans_segs_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_retrans_pct_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_in_errs_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_out_rsts_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_timeouts_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_syn_retrans_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.listen_overflows_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.listen_drops_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.syn_drops_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.syncookies_sent_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_memory_pressures_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_abort_on_memory_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_prune_called_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.tcp_rcv_pruned_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_in_datagrams_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_out_datagrams_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_no_ports_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_in_errors_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_rcvbuf_errors_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetProtoInfo, _impl_.udp_sndbuf_errors_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  19,
+  20,
+  21,
+  22,
+  23,
+  24,
+  25,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_processed_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_dropped_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_time_squeeze_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_received_rps_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_flow_limit_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.softnet_squeezed_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.sched_run_time_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.sched_run_delay_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.sched_timeslices_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_nice_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_iowait_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_steal_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cpu_idle_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.core_id_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.package_id_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.cur_freq_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.max_freq_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.core_throttle_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuInfo, _impl_.package_throttle_),
+  3,
+  0,
+  1,
+  2,
+  5,
+  6,
+  4,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  22,
+  18,
+  19,
+  20,
+  21,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.comm_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.run_time_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.run_delay_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.timeslices_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarTaskSchedInfo, _impl_.avg_delay_),
+  5,
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.some_avg10_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.some_avg60_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.some_avg300_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.full_avg10_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.full_avg60_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.full_avg300_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.some_stall_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarPsiInfo, _impl_.full_stall_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.inode_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.cpu_usage_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.nr_throttled_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.throttled_time_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.memory_current_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.memory_anon_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.memory_file_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.pgfault_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.pgmajfault_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.io_rbytes_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.io_wbytes_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.io_rios_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.io_wios_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.psi_cpu_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.psi_memory_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCgroupInfo, _impl_.psi_io_),
+  0,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.comm_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.cpu_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.rss_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.shared_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.minflt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.majflt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.read_bytes_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarProcessInfo, _impl_.write_bytes_),
+  10,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.rxpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.txpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.rxbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.txbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.rxerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.txerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.rxdrop_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarIfaceInfo, _impl_.txdrop_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.inode_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.rxpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.txpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.rxbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.txbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.rxerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.txerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.rxdrop_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.txdrop_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNetnsInfo, _impl_.iface_),
+  0,
+  1,
+  10,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.mount_point_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.fs_type_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.used_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.avail_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.used_pct_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.free_pct_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.inode_used_pct_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.growth_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarFsInfo, _impl_.time_to_full_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.package_id_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.nr_cpus_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_nice_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_iowait_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_steal_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarCpuGroupInfo, _impl_.cpu_idle_),
+  0,
+  1,
+  8,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.nr_cpus_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_nice_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_iowait_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_steal_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.cpu_idle_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.mem_total_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.mem_free_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.numa_hit_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.numa_miss_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.numa_foreign_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.local_node_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarNodeInfo, _impl_.other_node_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.relative_accuracy_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.sum_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.zero_count_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.counts_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.negative_offset_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo_SarSketch, _impl_.negative_counts_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  ~0u,
+  8,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txpck_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txbyt_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxcmp_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txcmp_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxmcst_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txerr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.coll_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxdrop_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txdrop_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txcarr_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxfram_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rxfifo_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.txfifo_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.nr_processes_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_user_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_nice_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_system_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_iowait_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_steal_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.cpu_idle_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pgpgin_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pgpgout_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pgfault_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pgmajfault_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pswpin_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.pswpout_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.tps_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.rtps_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.wtps_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.bread_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.bwrtn_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.frmpg_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.bufpg_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.campg_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_disk_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.net_proto_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_cpu_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.softnet_processed_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.softnet_dropped_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.softnet_time_squeeze_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.softnet_squeezed_cpus_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sched_run_delay_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_task_sched_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.psi_cpu_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.psi_memory_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.psi_io_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_cgroup_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_process_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_netns_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_fs_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_core_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_socket_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_node_info_),
+  PROTOBUF_FIELD_OFFSET(::SarInfo, _impl_.sar_sketch_),
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  19,
+  20,
+  21,
+  22,
+  23,
+  24,
+  25,
+  26,
+  27,
+  28,
+  29,
+  30,
+  31,
+  32,
+  33,
+  34,
+  35,
+  36,
+  37,
+  38,
+  39,
+  40,
+  ~0u,
+  0,
+  ~0u,
+  41,
+  42,
+  43,
+  45,
+  44,
+  ~0u,
+  1,
+  2,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::SarInfo_SarDiskInfo)},
+  { 24, 56, -1, sizeof(::SarInfo_SarNetProtoInfo)},
+  { 82, 111, -1, sizeof(::SarInfo_SarCpuInfo)},
+  { 134, 146, -1, sizeof(::SarInfo_SarTaskSchedInfo)},
+  { 152, 166, -1, sizeof(::SarInfo_SarPsiInfo)},
+  { 174, 199, -1, sizeof(::SarInfo_SarCgroupInfo)},
+  { 218, 235, -1, sizeof(::SarInfo_SarProcessInfo)},
+  { 246, 261, -1, sizeof(::SarInfo_SarIfaceInfo)},
+  { 270, 288, -1, sizeof(::SarInfo_SarNetnsInfo)},
+  { 300, 317, -1, sizeof(::SarInfo_SarFsInfo)},
+  { 328, 343, -1, sizeof(::SarInfo_SarCpuGroupInfo)},
+  { 352, 373, -1, sizeof(::SarInfo_SarNodeInfo)},
+  { 388, 405, -1, sizeof(::SarInfo_SarSketch)},
+  { 416, 479, -1, sizeof(::SarInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_SarInfo_SarDiskInfo_default_instance_._instance,
+  &::_SarInfo_SarNetProtoInfo_default_instance_._instance,
+  &::_SarInfo_SarCpuInfo_default_instance_._instance,
+  &::_SarInfo_SarTaskSchedInfo_default_instance_._instance,
+  &::_SarInfo_SarPsiInfo_default_instance_._instance,
+  &::_SarInfo_SarCgroupInfo_default_instance_._instance,
+  &::_SarInfo_SarProcessInfo_default_instance_._instance,
+  &::_SarInfo_SarIfaceInfo_default_instance_._instance,
+  &::_SarInfo_SarNetnsInfo_default_instance_._instance,
+  &::_SarInfo_SarFsInfo_default_instance_._instance,
+  &::_SarInfo_SarCpuGroupInfo_default_instance_._instance,
+  &::_SarInfo_SarNodeInfo_default_instance_._instance,
+  &::_SarInfo_SarSketch_default_instance_._instance,
+  &::_SarInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SarInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rSarInfo.proto\"\367&\n\007SarInfo\022\r\n\005rxpck\030\001 \001"
+  "(\001\022\r\n\005txpck\030\002 \001(\001\022\r\n\005rxbyt\030\003 \001(\001\022\r\n\005txby"
+  "t\030\004 \001(\001\022\r\n\005rxcmp\030\005 \001(\001\022\r\n\005txcmp\030\006 \001(\001\022\016\n"
+  "\006rxmcst\030\007 \001(\001\022\r\n\005rxerr\030\010 \001(\001\022\r\n\005txerr\030\t "
+  "\001(\001\022\014\n\004coll\030\n \001(\001\022\016\n\006rxdrop\030\013 \001(\001\022\016\n\006txd"
+  "rop\030\014 \001(\001\022\016\n\006txcarr\030\r \001(\001\022\016\n\006rxfram\030\016 \001("
+  "\001\022\016\n\006rxfifo\030\017 \001(\001\022\016\n\006txfifo\030\020 \001(\001\022\024\n\014nr_"
+  "processes\030\021 \001(\001\022\020\n\010cpu_user\030\022 \001(\001\022\020\n\010cpu"
+  "_nice\030\023 \001(\001\022\022\n\ncpu_system\030\024 \001(\001\022\022\n\ncpu_i"
+  "owait\030\025 \001(\001\022\021\n\tcpu_steal\030\026 \001(\001\022\020\n\010cpu_id"
+  "le\030\027 \001(\001\022\016\n\006pgpgin\030\030 \001(\001\022\017\n\007pgpgout\030\031 \001("
+  "\001\022\017\n\007pgfault\030\032 \001(\001\022\022\n\npgmajfault\030\033 \001(\001\022\016"
+  "\n\006pswpin\030\034 \001(\001\022\017\n\007pswpout\030\035 \001(\001\022\013\n\003tps\030\036"
+  " \001(\001\022\014\n\004rtps\030\037 \001(\001\022\014\n\004wtps\030  \001(\001\022\r\n\005brea"
+  "d\030! \001(\001\022\r\n\005bwrtn\030\" \001(\001\022\r\n\005frmpg\030# \001(\001\022\r\n"
+  "\005bufpg\030$ \001(\001\022\r\n\005campg\030% \001(\001\022+\n\rsar_disk_"
+  "info\030& \003(\0132\024.SarInfo.SarDiskInfo\022+\n\tnet_"
+  "proto\030\' \001(\0132\030.SarInfo.SarNetProtoInfo\022)\n"
+  "\014sar_cpu_info\030( \003(\0132\023.SarInfo.SarCpuInfo"
+  "\022\031\n\021softnet_processed\030) \001(\001\022\027\n\017softnet_d"
+  "ropped\030* \001(\001\022\034\n\024softnet_time_squeeze\030+ \001"
+  "(\001\022\035\n\025softnet_squeezed_cpus\030, \001(\005\022\027\n\017sch"
+  "ed_run_delay\030- \001(\001\0226\n\023sar_task_sched_inf"
+  "o\030. \003(\0132\031.SarInfo.SarTaskSchedInfo\022$\n\007ps"
+  "i_cpu\030/ \001(\0132\023.SarInfo.SarPsiInfo\022\'\n\npsi_"
+  "memory\0300 \001(\0132\023.SarInfo.SarPsiInfo\022#\n\006psi"
+  "_io\0301 \001(\0132\023.SarInfo.SarPsiInfo\022/\n\017sar_cg"
+  "roup_info\0302 \003(\0132\026.SarInfo.SarCgroupInfo\022"
+  "1\n\020sar_process_info\0303 \003(\0132\027.SarInfo.SarP"
+  "rocessInfo\022-\n\016sar_netns_info\0304 \003(\0132\025.Sar"
+  "Info.SarNetnsInfo\022\'\n\013sar_fs_info\0305 \003(\0132\022"
+  ".SarInfo.SarFsInfo\022/\n\rsar_core_info\0306 \003("
+  "\0132\030.SarInfo.SarCpuGroupInfo\0221\n\017sar_socke"
+  "t_info\0307 \003(\0132\030.SarInfo.SarCpuGroupInfo\022+"
+  "\n\rsar_node_info\0308 \003(\0132\024.SarInfo.SarNodeI"
+  "nfo\022&\n\nsar_sketch\0309 \003(\0132\022.SarInfo.SarSke"
+  "tch\032\234\001\n\013SarDiskInfo\022\013\n\003tps\030\001 \001(\001\022\016\n\006rd_s"
+  "ec\030\002 \001(\001\022\016\n\006wr_sec\030\003 \001(\001\022\020\n\010avgrq_sz\030\004 \001"
+  "(\001\022\020\n\010avgqu_sz\030\005 \001(\001\022\r\n\005await\030\006 \001(\001\022\r\n\005s"
+  "vctm\030\007 \001(\001\022\014\n\004util\030\010 \001(\001\022\020\n\010dev_name\030\t \001"
+  "(\t\032\224\005\n\017SarNetProtoInfo\022\030\n\020tcp_active_ope"
+  "ns\030\001 \001(\001\022\031\n\021tcp_passive_opens\030\002 \001(\001\022\031\n\021t"
+  "cp_attempt_fails\030\003 \001(\001\022\030\n\020tcp_estab_rese"
+  "ts\030\004 \001(\001\022\023\n\013tcp_in_segs\030\005 \001(\001\022\024\n\014tcp_out"
+  "_segs\030\006 \001(\001\022\030\n\020tcp_retrans_segs\030\007 \001(\001\022\027\n"
+  "\017tcp_retrans_pct\030\010 \001(\001\022\023\n\013tcp_in_errs\030\t "
+  "\001(\001\022\024\n\014tcp_out_rsts\030\n \001(\001\022\024\n\014tcp_timeout"
+  "s\030\013 \001(\001\022\027\n\017tcp_syn_retrans\030\014 \001(\001\022\030\n\020list"
+  "en_overflows\030\r \001(\001\022\024\n\014listen_drops\030\016 \001(\001"
+  "\022\021\n\tsyn_drops\030\017 \001(\001\022\027\n\017syncookies_sent\030\020"
+  " \001(\001\022\034\n\024tcp_memory_pressures\030\021 \001(\001\022\033\n\023tc"
+  "p_abort_on_memory\030\022 \001(\001\022\030\n\020tcp_prune_cal"
+  "led\030\023 \001(\001\022\026\n\016tcp_rcv_pruned\030\024 \001(\001\022\030\n\020udp"
+  "_in_datagrams\030\025 \001(\001\022\031\n\021udp_out_datagrams"
+  "\030\026 \001(\001\022\024\n\014udp_no_ports\030\027 \001(\001\022\025\n\rudp_in_e"
+  "rrors\030\030 \001(\001\022\031\n\021udp_rcvbuf_errors\030\031 \001(\001\022\031"
+  "\n\021udp_sndbuf_errors\030\032 \001(\001\032\203\004\n\nSarCpuInfo"
+  "\022\013\n\003cpu\030\001 \001(\005\022\031\n\021softnet_processed\030\002 \001(\001"
+  "\022\027\n\017softnet_dropped\030\003 \001(\001\022\034\n\024softnet_tim"
+  "e_squeeze\030\004 \001(\001\022\034\n\024softnet_received_rps\030"
+  "\005 \001(\001\022\032\n\022softnet_flow_limit\030\006 \001(\001\022\030\n\020sof"
+  "tnet_squeezed\030\007 \001(\010\022\026\n\016sched_run_time\030\010 "
+  "\001(\001\022\027\n\017sched_run_delay\030\t \001(\001\022\030\n\020sched_ti"
+  "meslices\030\n \001(\001\022\020\n\010cpu_user\030\013 \001(\001\022\020\n\010cpu_"
+  "nice\030\014 \001(\001\022\022\n\ncpu_system\030\r \001(\001\022\022\n\ncpu_io"
+  "wait\030\016 \001(\001\022\021\n\tcpu_steal\030\017 \001(\001\022\020\n\010cpu_idl"
+  "e\030\020 \001(\001\022\017\n\007core_id\030\021 \001(\005\022\022\n\npackage_id\030\022"
+  " \001(\005\022\014\n\004node\030\023 \001(\005\022\020\n\010cur_freq\030\024 \001(\001\022\020\n\010"
+  "max_freq\030\025 \001(\001\022\025\n\rcore_throttle\030\026 \001(\001\022\030\n"
+  "\020package_throttle\030\027 \001(\001\032y\n\020SarTaskSchedI"
+  "nfo\022\013\n\003pid\030\001 \001(\005\022\014\n\004comm\030\002 \001(\t\022\020\n\010run_ti"
+  "me\030\003 \001(\001\022\021\n\trun_delay\030\004 \001(\001\022\022\n\ntimeslice"
+  "s\030\005 \001(\001\022\021\n\tavg_delay\030\006 \001(\001\032\256\001\n\nSarPsiInf"
+  "o\022\022\n\nsome_avg10\030\001 \001(\001\022\022\n\nsome_avg60\030\002 \001("
+  "\001\022\023\n\013some_avg300\030\003 \001(\001\022\022\n\nfull_avg10\030\004 \001"
+  "(\001\022\022\n\nfull_avg60\030\005 \001(\001\022\023\n\013full_avg300\030\006 "
+  "\001(\001\022\022\n\nsome_stall\030\007 \001(\001\022\022\n\nfull_stall\030\010 "
+  "\001(\001\032\266\003\n\rSarCgroupInfo\022\014\n\004path\030\001 \001(\t\022\r\n\005i"
+  "node\030\002 \001(\004\022\021\n\tcpu_usage\030\003 \001(\001\022\020\n\010cpu_use"
+  "r\030\004 \001(\001\022\022\n\ncpu_system\030\005 \001(\001\022\024\n\014nr_thrott"
+  "led\030\006 \001(\001\022\026\n\016throttled_time\030\007 \001(\001\022\026\n\016mem"
+  "ory_current\030\010 \001(\004\022\023\n\013memory_anon\030\t \001(\004\022\023"
+  "\n\013memory_file\030\n \001(\004\022\017\n\007pgfault\030\013 \001(\001\022\022\n\n"
+  "pgmajfault\030\014 \001(\001\022\021\n\tio_rbytes\030\r \001(\001\022\021\n\ti"
+  "o_wbytes\030\016 \001(\001\022\017\n\007io_rios\030\017 \001(\001\022\017\n\007io_wi"
+  "os\030\020 \001(\001\022$\n\007psi_cpu\030\021 \001(\0132\023.SarInfo.SarP"
+  "siInfo\022\'\n\npsi_memory\030\022 \001(\0132\023.SarInfo.Sar"
+  "PsiInfo\022#\n\006psi_io\030\023 \001(\0132\023.SarInfo.SarPsi"
+  "Info\032\304\001\n\016SarProcessInfo\022\013\n\003pid\030\001 \001(\005\022\014\n\004"
+  "comm\030\002 \001(\t\022\013\n\003cpu\030\003 \001(\001\022\020\n\010cpu_user\030\004 \001("
+  "\001\022\022\n\ncpu_system\030\005 \001(\001\022\013\n\003rss\030\006 \001(\004\022\016\n\006sh"
+  "ared\030\007 \001(\004\022\016\n\006minflt\030\010 \001(\001\022\016\n\006majflt\030\t \001"
+  "(\001\022\022\n\nread_bytes\030\n \001(\001\022\023\n\013write_bytes\030\013 "
+  "\001(\001\032\226\001\n\014SarIfaceInfo\022\014\n\004name\030\001 \001(\t\022\r\n\005rx"
+  "pck\030\002 \001(\001\022\r\n\005txpck\030\003 \001(\001\022\r\n\005rxbyt\030\004 \001(\001\022"
+  "\r\n\005txbyt\030\005 \001(\001\022\r\n\005rxerr\030\006 \001(\001\022\r\n\005txerr\030\007"
+  " \001(\001\022\016\n\006rxdrop\030\010 \001(\001\022\016\n\006txdrop\030\t \001(\001\032\330\001\n"
+  "\014SarNetnsInfo\022\014\n\004name\030\001 \001(\t\022\r\n\005inode\030\002 \001"
+  "(\004\022\013\n\003pid\030\003 \001(\005\022\r\n\005rxpck\030\004 \001(\001\022\r\n\005txpck\030"
+  "\005 \001(\001\022\r\n\005rxbyt\030\006 \001(\001\022\r\n\005txbyt\030\007 \001(\001\022\r\n\005r"
+  "xerr\030\010 \001(\001\022\r\n\005txerr\030\t \001(\001\022\016\n\006rxdrop\030\n \001("
+  "\001\022\016\n\006txdrop\030\013 \001(\001\022$\n\005iface\030\014 \003(\0132\025.SarIn"
+  "fo.SarIfaceInfo\032\316\001\n\tSarFsInfo\022\023\n\013mount_p"
+  "oint\030\001 \001(\t\022\017\n\007fs_type\030\002 \001(\t\022\016\n\006source\030\003 "
+  "\001(\t\022\014\n\004size\030\004 \001(\004\022\014\n\004used\030\005 \001(\004\022\r\n\005avail"
+  "\030\006 \001(\004\022\020\n\010used_pct\030\007 \001(\001\022\020\n\010free_pct\030\010 \001"
+  "(\001\022\026\n\016inode_used_pct\030\t \001(\001\022\016\n\006growth\030\n \001"
+  "(\001\022\024\n\014time_to_full\030\013 \001(\001\032\263\001\n\017SarCpuGroup"
+  "Info\022\n\n\002id\030\001 \001(\005\022\022\n\npackage_id\030\002 \001(\005\022\017\n\007"
+  "nr_cpus\030\003 \001(\005\022\020\n\010cpu_user\030\004 \001(\001\022\020\n\010cpu_n"
+  "ice\030\005 \001(\001\022\022\n\ncpu_system\030\006 \001(\001\022\022\n\ncpu_iow"
+  "ait\030\007 \001(\001\022\021\n\tcpu_steal\030\010 \001(\001\022\020\n\010cpu_idle"
+  "\030\t \001(\001\032\245\002\n\013SarNodeInfo\022\014\n\004node\030\001 \001(\005\022\017\n\007"
+  "nr_cpus\030\002 \001(\005\022\020\n\010cpu_user\030\003 \001(\001\022\020\n\010cpu_n"
+  "ice\030\004 \001(\001\022\022\n\ncpu_system\030\005 \001(\001\022\022\n\ncpu_iow"
+  "ait\030\006 \001(\001\022\021\n\tcpu_steal\030\007 \001(\001\022\020\n\010cpu_idle"
+  "\030\010 \001(\001\022\021\n\tmem_total\030\t \001(\004\022\020\n\010mem_free\030\n "
+  "\001(\004\022\020\n\010numa_hit\030\013 \001(\001\022\021\n\tnuma_miss\030\014 \001(\001"
+  "\022\024\n\014numa_foreign\030\r \001(\001\022\022\n\nlocal_node\030\016 \001"
+  "(\001\022\022\n\nother_node\030\017 \001(\001\032\330\001\n\tSarSketch\022\014\n\004"
+  "name\030\001 \001(\t\022\031\n\021relative_accuracy\030\002 \001(\001\022\r\n"
+  "\005count\030\003 \001(\004\022\013\n\003sum\030\004 \001(\001\022\013\n\003min\030\005 \001(\001\022\013"
+  "\n\003max\030\006 \001(\001\022\022\n\nzero_count\030\007 \001(\004\022\016\n\006offse"
+  "t\030\010 \001(\021\022\022\n\006counts\030\t \003(\004B\002\020\001\022\027\n\017negative_"
+  "offset\030\n \001(\021\022\033\n\017negative_counts\030\013 \003(\004B\002\020"
+  "\001"
+  ;
+static ::_pbi::once_flag descriptor_table_SarInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SarInfo_2eproto = {
+    false, false, 5001, descriptor_table_protodef_SarInfo_2eproto,
+    "SarInfo.proto",
+    &descriptor_table_SarInfo_2eproto_once, nullptr, 0, 14,
+    schemas, file_default_instances, TableStruct_SarInfo_2eproto::offsets,
+    file_level_metadata_SarInfo_2eproto, file_level_enum_descriptors_SarInfo_2eproto,
+    file_level_service_descriptors_SarInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SarInfo_2eproto_getter() {
+  return &descriptor_table_SarInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SarInfo_2eproto(&descriptor_table_SarInfo_2eproto);
+
+// ===================================================================
+
+class SarInfo_SarDiskInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarDiskInfo>()._impl_._has_bits_);
+  static void set_has_tps(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_rd_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_wr_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_avgrq_sz(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_avgqu_sz(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_await(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_svctm(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_util(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_dev_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SarInfo_SarDiskInfo::SarInfo_SarDiskInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarDiskInfo)
+}
+SarInfo_SarDiskInfo::SarInfo_SarDiskInfo(const SarInfo_SarDiskInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarDiskInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dev_name_){}
+    , decltype(_impl_.tps_){}
+    , decltype(_impl_.rd_sec_){}
+    , decltype(_impl_.wr_sec_){}
+    , decltype(_impl_.avgrq_sz_){}
+    , decltype(_impl_.avgqu_sz_){}
+    , decltype(_impl_.await_){}
+    , decltype(_impl_.svctm_){}
+    , decltype(_impl_.util_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.dev_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dev_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_dev_name()) {
+    _this->_impl_.dev_name_.Set(from._internal_dev_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.tps_, &from._impl_.tps_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.util_) -
+    reinterpret_cast<char*>(&_impl_.tps_)) + sizeof(_impl_.util_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarDiskInfo)
+}
+
+inline void SarInfo_SarDiskInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dev_name_){}
+    , decltype(_impl_.tps_){0}
+    , decltype(_impl_.rd_sec_){0}
+    , decltype(_impl_.wr_sec_){0}
+    , decltype(_impl_.avgrq_sz_){0}
+    , decltype(_impl_.avgqu_sz_){0}
+    , decltype(_impl_.await_){0}
+    , decltype(_impl_.svctm_){0}
+    , decltype(_impl_.util_){0}
+  };
+  _impl_.dev_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dev_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarDiskInfo::~SarInfo_SarDiskInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarDiskInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarDiskInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dev_name_.Destroy();
+}
+
+void SarInfo_SarDiskInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarDiskInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarDiskInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.dev_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.tps_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.svctm_) -
+        reinterpret_cast<char*>(&_impl_.tps_)) + sizeof(_impl_.svctm_));
+  }
+  _impl_.util_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarDiskInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double tps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_tps(&has_bits);
+          _impl_.tps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rd_sec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_rd_sec(&has_bits);
+          _impl_.rd_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double wr_sec = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_wr_sec(&has_bits);
+          _impl_.wr_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double avgrq_sz = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_avgrq_sz(&has_bits);
+          _impl_.avgrq_sz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double avgqu_sz = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_avgqu_sz(&has_bits);
+          _impl_.avgqu_sz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double await = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_await(&has_bits);
+          _impl_.await_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double svctm = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_svctm(&has_bits);
+          _impl_.svctm_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double util = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_util(&has_bits);
+          _impl_.util_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string dev_name = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_dev_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarDiskInfo.dev_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarDiskInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarDiskInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double tps = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_tps(), target);
+  }
+
+  // optional double rd_sec = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rd_sec(), target);
+  }
+
+  // optional double wr_sec = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_wr_sec(), target);
+  }
+
+  // optional double avgrq_sz = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_avgrq_sz(), target);
+  }
+
+  // optional double avgqu_sz = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_avgqu_sz(), target);
+  }
+
+  // optional double await = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_await(), target);
+  }
+
+  // optional double svctm = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_svctm(), target);
+  }
+
+  // optional double util = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_util(), target);
+  }
+
+  // optional string dev_name = 9;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_dev_name().data(), static_cast<int>(this->_internal_dev_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarDiskInfo.dev_name");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_dev_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarDiskInfo)
+  return target;
+}
+
+size_t SarInfo_SarDiskInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarDiskInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string dev_name = 9;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_dev_name());
+    }
+
+    // optional double tps = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rd_sec = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double wr_sec = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double avgrq_sz = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double avgqu_sz = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double await = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double svctm = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // optional double util = 8;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarDiskInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarDiskInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarDiskInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarDiskInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarDiskInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarDiskInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarDiskInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_dev_name(from._internal_dev_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tps_ = from._impl_.tps_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.rd_sec_ = from._impl_.rd_sec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.wr_sec_ = from._impl_.wr_sec_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.avgrq_sz_ = from._impl_.avgrq_sz_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.avgqu_sz_ = from._impl_.avgqu_sz_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.await_ = from._impl_.await_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.svctm_ = from._impl_.svctm_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_util(from._internal_util());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarDiskInfo::CopyFrom(const SarInfo_SarDiskInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarDiskInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarDiskInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarDiskInfo::InternalSwap(SarInfo_SarDiskInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dev_name_, lhs_arena,
+      &other->_impl_.dev_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarDiskInfo, _impl_.util_)
+      + sizeof(SarInfo_SarDiskInfo::_impl_.util_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarDiskInfo, _impl_.tps_)>(
+          reinterpret_cast<char*>(&_impl_.tps_),
+          reinterpret_cast<char*>(&other->_impl_.tps_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarDiskInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class SarInfo_SarNetProtoInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarNetProtoInfo>()._impl_._has_bits_);
+  static void set_has_tcp_active_opens(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_tcp_passive_opens(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_tcp_attempt_fails(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_tcp_estab_resets(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_tcp_in_segs(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_tcp_out_segs(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_tcp_retrans_segs(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_tcp_retrans_pct(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_tcp_in_errs(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_tcp_out_rsts(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_tcp_timeouts(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_tcp_syn_retrans(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_listen_overflows(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_listen_drops(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_syn_drops(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_syncookies_sent(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_tcp_memory_pressures(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_tcp_abort_on_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_tcp_prune_called(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_tcp_rcv_pruned(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_udp_in_datagrams(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_udp_out_datagrams(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_udp_no_ports(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_udp_in_errors(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_udp_rcvbuf_errors(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_udp_sndbuf_errors(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+};
+
+SarInfo_SarNetProtoInfo::SarInfo_SarNetProtoInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarNetProtoInfo)
+}
+SarInfo_SarNetProtoInfo::SarInfo_SarNetProtoInfo(const SarInfo_SarNetProtoInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarNetProtoInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tcp_active_opens_){}
+    , decltype(_impl_.tcp_passive_opens_){}
+    , decltype(_impl_.tcp_attempt_fails_){}
+    , decltype(_impl_.tcp_estab_resets_){}
+    , decltype(_impl_.tcp_in_segs_){}
+    , decltype(_impl_.tcp_out_segs_){}
+    , decltype(_impl_.tcp_retrans_segs_){}
+    , decltype(_impl_.tcp_retrans_pct_){}
+    , decltype(_impl_.tcp_in_errs_){}
+    , decltype(_impl_.tcp_out_rsts_){}
+    , decltype(_impl_.tcp_timeouts_){}
+    , decltype(_impl_.tcp_syn_retrans_){}
+    , decltype(_impl_.listen_overflows_){}
+    , decltype(_impl_.listen_drops_){}
+    , decltype(_impl_.syn_drops_){}
+    , decltype(_impl_.syncookies_sent_){}
+    , decltype(_impl_.tcp_memory_pressures_){}
+    , decltype(_impl_.tcp_abort_on_memory_){}
+    , decltype(_impl_.tcp_prune_called_){}
+    , decltype(_impl_.tcp_rcv_pruned_){}
+    , decltype(_impl_.udp_in_datagrams_){}
+    , decltype(_impl_.udp_out_datagrams_){}
+    , decltype(_impl_.udp_no_ports_){}
+    , decltype(_impl_.udp_in_errors_){}
+    , decltype(_impl_.udp_rcvbuf_errors_){}
+    , decltype(_impl_.udp_sndbuf_errors_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tcp_active_opens_, &from._impl_.tcp_active_opens_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.udp_sndbuf_errors_) -
+    reinterpret_cast<char*>(&_impl_.tcp_active_opens_)) + sizeof(_impl_.udp_sndbuf_errors_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarNetProtoInfo)
+}
+
+inline void SarInfo_SarNetProtoInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tcp_active_opens_){0}
+    , decltype(_impl_.tcp_passive_opens_){0}
+    , decltype(_impl_.tcp_attempt_fails_){0}
+    , decltype(_impl_.tcp_estab_resets_){0}
+    , decltype(_impl_.tcp_in_segs_){0}
+    , decltype(_impl_.tcp_out_segs_){0}
+    , decltype(_impl_.tcp_retrans_segs_){0}
+    , decltype(_impl_.tcp_retrans_pct_){0}
+    , decltype(_impl_.tcp_in_errs_){0}
+    , decltype(_impl_.tcp_out_rsts_){0}
+    , decltype(_impl_.tcp_timeouts_){0}
+    , decltype(_impl_.tcp_syn_retrans_){0}
+    , decltype(_impl_.listen_overflows_){0}
+    , decltype(_impl_.listen_drops_){0}
+    , decltype(_impl_.syn_drops_){0}
+    , decltype(_impl_.syncookies_sent_){0}
+    , decltype(_impl_.tcp_memory_pressures_){0}
+    , decltype(_impl_.tcp_abort_on_memory_){0}
+    , decltype(_impl_.tcp_prune_called_){0}
+    , decltype(_impl_.tcp_rcv_pruned_){0}
+    , decltype(_impl_.udp_in_datagrams_){0}
+    , decltype(_impl_.udp_out_datagrams_){0}
+    , decltype(_impl_.udp_no_ports_){0}
+    , decltype(_impl_.udp_in_errors_){0}
+    , decltype(_impl_.udp_rcvbuf_errors_){0}
+    , decltype(_impl_.udp_sndbuf_errors_){0}
+  };
+}
+
+SarInfo_SarNetProtoInfo::~SarInfo_SarNetProtoInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarNetProtoInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarNetProtoInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SarInfo_SarNetProtoInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarNetProtoInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarNetProtoInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.tcp_active_opens_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tcp_retrans_pct_) -
+        reinterpret_cast<char*>(&_impl_.tcp_active_opens_)) + sizeof(_impl_.tcp_retrans_pct_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.tcp_in_errs_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.syncookies_sent_) -
+        reinterpret_cast<char*>(&_impl_.tcp_in_errs_)) + sizeof(_impl_.syncookies_sent_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&_impl_.tcp_memory_pressures_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.udp_in_errors_) -
+        reinterpret_cast<char*>(&_impl_.tcp_memory_pressures_)) + sizeof(_impl_.udp_in_errors_));
+  }
+  if (cached_has_bits & 0x03000000u) {
+    ::memset(&_impl_.udp_rcvbuf_errors_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.udp_sndbuf_errors_) -
+        reinterpret_cast<char*>(&_impl_.udp_rcvbuf_errors_)) + sizeof(_impl_.udp_sndbuf_errors_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarNetProtoInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double tcp_active_opens = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_tcp_active_opens(&has_bits);
+          _impl_.tcp_active_opens_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_passive_opens = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_tcp_passive_opens(&has_bits);
+          _impl_.tcp_passive_opens_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_attempt_fails = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_tcp_attempt_fails(&has_bits);
+          _impl_.tcp_attempt_fails_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_estab_resets = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_tcp_estab_resets(&has_bits);
+          _impl_.tcp_estab_resets_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_in_segs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_tcp_in_segs(&has_bits);
+          _impl_.tcp_in_segs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_out_segs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_tcp_out_segs(&has_bits);
+          _impl_.tcp_out_segs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_retrans_segs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_tcp_retrans_segs(&has_bits);
+          _impl_.tcp_retrans_segs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_retrans_pct = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_tcp_retrans_pct(&has_bits);
+          _impl_.tcp_retrans_pct_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_in_errs = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_tcp_in_errs(&has_bits);
+          _impl_.tcp_in_errs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_out_rsts = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_tcp_out_rsts(&has_bits);
+          _impl_.tcp_out_rsts_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_timeouts = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_tcp_timeouts(&has_bits);
+          _impl_.tcp_timeouts_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_syn_retrans = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_tcp_syn_retrans(&has_bits);
+          _impl_.tcp_syn_retrans_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double listen_overflows = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_listen_overflows(&has_bits);
+          _impl_.listen_overflows_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double listen_drops = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_listen_drops(&has_bits);
+          _impl_.listen_drops_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double syn_drops = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_syn_drops(&has_bits);
+          _impl_.syn_drops_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double syncookies_sent = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_syncookies_sent(&has_bits);
+          _impl_.syncookies_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_memory_pressures = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_tcp_memory_pressures(&has_bits);
+          _impl_.tcp_memory_pressures_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_abort_on_memory = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 145)) {
+          _Internal::set_has_tcp_abort_on_memory(&has_bits);
+          _impl_.tcp_abort_on_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_prune_called = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 153)) {
+          _Internal::set_has_tcp_prune_called(&has_bits);
+          _impl_.tcp_prune_called_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tcp_rcv_pruned = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 161)) {
+          _Internal::set_has_tcp_rcv_pruned(&has_bits);
+          _impl_.tcp_rcv_pruned_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_in_datagrams = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 169)) {
+          _Internal::set_has_udp_in_datagrams(&has_bits);
+          _impl_.udp_in_datagrams_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_out_datagrams = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _Internal::set_has_udp_out_datagrams(&has_bits);
+          _impl_.udp_out_datagrams_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_no_ports = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
+          _Internal::set_has_udp_no_ports(&has_bits);
+          _impl_.udp_no_ports_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_in_errors = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 193)) {
+          _Internal::set_has_udp_in_errors(&has_bits);
+          _impl_.udp_in_errors_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_rcvbuf_errors = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 201)) {
+          _Internal::set_has_udp_rcvbuf_errors(&has_bits);
+          _impl_.udp_rcvbuf_errors_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double udp_sndbuf_errors = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
+          _Internal::set_has_udp_sndbuf_errors(&has_bits);
+          _impl_.udp_sndbuf_errors_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarNetProtoInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarNetProtoInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double tcp_active_opens = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_tcp_active_opens(), target);
+  }
+
+  // optional double tcp_passive_opens = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_tcp_passive_opens(), target);
+  }
+
+  // optional double tcp_attempt_fails = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_tcp_attempt_fails(), target);
+  }
+
+  // optional double tcp_estab_resets = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_tcp_estab_resets(), target);
+  }
+
+  // optional double tcp_in_segs = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_tcp_in_segs(), target);
+  }
+
+  // optional double tcp_out_segs = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_tcp_out_segs(), target);
+  }
+
+  // optional double tcp_retrans_segs = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_tcp_retrans_segs(), target);
+  }
+
+  // optional double tcp_retrans_pct = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_tcp_retrans_pct(), target);
+  }
+
+  // optional double tcp_in_errs = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_tcp_in_errs(), target);
+  }
+
+  // optional double tcp_out_rsts = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_tcp_out_rsts(), target);
+  }
+
+  // optional double tcp_timeouts = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_tcp_timeouts(), target);
+  }
+
+  // optional double tcp_syn_retrans = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_tcp_syn_retrans(), target);
+  }
+
+  // optional double listen_overflows = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_listen_overflows(), target);
+  }
+
+  // optional double listen_drops = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_listen_drops(), target);
+  }
+
+  // optional double syn_drops = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_syn_drops(), target);
+  }
+
+  // optional double syncookies_sent = 16;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_syncookies_sent(), target);
+  }
+
+  // optional double tcp_memory_pressures = 17;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(17, this->_internal_tcp_memory_pressures(), target);
+  }
+
+  // optional double tcp_abort_on_memory = 18;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(18, this->_internal_tcp_abort_on_memory(), target);
+  }
+
+  // optional double tcp_prune_called = 19;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(19, this->_internal_tcp_prune_called(), target);
+  }
+
+  // optional double tcp_rcv_pruned = 20;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(20, this->_internal_tcp_rcv_pruned(), target);
+  }
+
+  // optional double udp_in_datagrams = 21;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(21, this->_internal_udp_in_datagrams(), target);
+  }
+
+  // optional double udp_out_datagrams = 22;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_udp_out_datagrams(), target);
+  }
+
+  // optional double udp_no_ports = 23;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(23, this->_internal_udp_no_ports(), target);
+  }
+
+  // optional double udp_in_errors = 24;
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(24, this->_internal_udp_in_errors(), target);
+  }
+
+  // optional double udp_rcvbuf_errors = 25;
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(25, this->_internal_udp_rcvbuf_errors(), target);
+  }
+
+  // optional double udp_sndbuf_errors = 26;
+  if (cached_has_bits & 0x02000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_udp_sndbuf_errors(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarNetProtoInfo)
+  return target;
+}
+
+size_t SarInfo_SarNetProtoInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarNetProtoInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double tcp_active_opens = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_passive_opens = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_attempt_fails = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_estab_resets = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_in_segs = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_out_segs = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_retrans_segs = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_retrans_pct = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double tcp_in_errs = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_out_rsts = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_timeouts = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double tcp_syn_retrans = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double listen_overflows = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double listen_drops = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double syn_drops = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double syncookies_sent = 16;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional double tcp_memory_pressures = 17;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double tcp_abort_on_memory = 18;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double tcp_prune_called = 19;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double tcp_rcv_pruned = 20;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double udp_in_datagrams = 21;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double udp_out_datagrams = 22;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double udp_no_ports = 23;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double udp_in_errors = 24;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x03000000u) {
+    // optional double udp_rcvbuf_errors = 25;
+    if (cached_has_bits & 0x01000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double udp_sndbuf_errors = 26;
+    if (cached_has_bits & 0x02000000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarNetProtoInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarNetProtoInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarNetProtoInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarNetProtoInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarNetProtoInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarNetProtoInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarNetProtoInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tcp_active_opens_ = from._impl_.tcp_active_opens_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tcp_passive_opens_ = from._impl_.tcp_passive_opens_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.tcp_attempt_fails_ = from._impl_.tcp_attempt_fails_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.tcp_estab_resets_ = from._impl_.tcp_estab_resets_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.tcp_in_segs_ = from._impl_.tcp_in_segs_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.tcp_out_segs_ = from._impl_.tcp_out_segs_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.tcp_retrans_segs_ = from._impl_.tcp_retrans_segs_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.tcp_retrans_pct_ = from._impl_.tcp_retrans_pct_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.tcp_in_errs_ = from._impl_.tcp_in_errs_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.tcp_out_rsts_ = from._impl_.tcp_out_rsts_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.tcp_timeouts_ = from._impl_.tcp_timeouts_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.tcp_syn_retrans_ = from._impl_.tcp_syn_retrans_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.listen_overflows_ = from._impl_.listen_overflows_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.listen_drops_ = from._impl_.listen_drops_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.syn_drops_ = from._impl_.syn_drops_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.syncookies_sent_ = from._impl_.syncookies_sent_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.tcp_memory_pressures_ = from._impl_.tcp_memory_pressures_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.tcp_abort_on_memory_ = from._impl_.tcp_abort_on_memory_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.tcp_prune_called_ = from._impl_.tcp_prune_called_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.tcp_rcv_pruned_ = from._impl_.tcp_rcv_pruned_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.udp_in_datagrams_ = from._impl_.udp_in_datagrams_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.udp_out_datagrams_ = from._impl_.udp_out_datagrams_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.udp_no_ports_ = from._impl_.udp_no_ports_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.udp_in_errors_ = from._impl_.udp_in_errors_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x03000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      _this->_impl_.udp_rcvbuf_errors_ = from._impl_.udp_rcvbuf_errors_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      _this->_impl_.udp_sndbuf_errors_ = from._impl_.udp_sndbuf_errors_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarNetProtoInfo::CopyFrom(const SarInfo_SarNetProtoInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarNetProtoInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarNetProtoInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarNetProtoInfo::InternalSwap(SarInfo_SarNetProtoInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarNetProtoInfo, _impl_.udp_sndbuf_errors_)
+      + sizeof(SarInfo_SarNetProtoInfo::_impl_.udp_sndbuf_errors_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarNetProtoInfo, _impl_.tcp_active_opens_)>(
+          reinterpret_cast<char*>(&_impl_.tcp_active_opens_),
+          reinterpret_cast<char*>(&other->_impl_.tcp_active_opens_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarNetProtoInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[1]);
+}
+
+// ===================================================================
+
+class SarInfo_SarCpuInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarCpuInfo>()._impl_._has_bits_);
+  static void set_has_cpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_softnet_processed(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_softnet_dropped(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_softnet_time_squeeze(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_softnet_received_rps(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_softnet_flow_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_softnet_squeezed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sched_run_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_sched_run_delay(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_sched_timeslices(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_cpu_nice(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_cpu_iowait(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_cpu_steal(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_cpu_idle(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_core_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_package_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_cur_freq(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_max_freq(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_core_throttle(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_package_throttle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+};
+
+SarInfo_SarCpuInfo::SarInfo_SarCpuInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarCpuInfo)
+}
+SarInfo_SarCpuInfo::SarInfo_SarCpuInfo(const SarInfo_SarCpuInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarCpuInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.softnet_processed_){}
+    , decltype(_impl_.softnet_dropped_){}
+    , decltype(_impl_.softnet_time_squeeze_){}
+    , decltype(_impl_.cpu_){}
+    , decltype(_impl_.softnet_squeezed_){}
+    , decltype(_impl_.softnet_received_rps_){}
+    , decltype(_impl_.softnet_flow_limit_){}
+    , decltype(_impl_.sched_run_time_){}
+    , decltype(_impl_.sched_run_delay_){}
+    , decltype(_impl_.sched_timeslices_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_nice_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.cpu_iowait_){}
+    , decltype(_impl_.cpu_steal_){}
+    , decltype(_impl_.cpu_idle_){}
+    , decltype(_impl_.core_id_){}
+    , decltype(_impl_.package_id_){}
+    , decltype(_impl_.cur_freq_){}
+    , decltype(_impl_.max_freq_){}
+    , decltype(_impl_.core_throttle_){}
+    , decltype(_impl_.package_throttle_){}
+    , decltype(_impl_.node_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.softnet_processed_, &from._impl_.softnet_processed_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.node_) -
+    reinterpret_cast<char*>(&_impl_.softnet_processed_)) + sizeof(_impl_.node_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarCpuInfo)
+}
+
+inline void SarInfo_SarCpuInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.softnet_processed_){0}
+    , decltype(_impl_.softnet_dropped_){0}
+    , decltype(_impl_.softnet_time_squeeze_){0}
+    , decltype(_impl_.cpu_){0}
+    , decltype(_impl_.softnet_squeezed_){false}
+    , decltype(_impl_.softnet_received_rps_){0}
+    , decltype(_impl_.softnet_flow_limit_){0}
+    , decltype(_impl_.sched_run_time_){0}
+    , decltype(_impl_.sched_run_delay_){0}
+    , decltype(_impl_.sched_timeslices_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_nice_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.cpu_iowait_){0}
+    , decltype(_impl_.cpu_steal_){0}
+    , decltype(_impl_.cpu_idle_){0}
+    , decltype(_impl_.core_id_){0}
+    , decltype(_impl_.package_id_){0}
+    , decltype(_impl_.cur_freq_){0}
+    , decltype(_impl_.max_freq_){0}
+    , decltype(_impl_.core_throttle_){0}
+    , decltype(_impl_.package_throttle_){0}
+    , decltype(_impl_.node_){0}
+  };
+}
+
+SarInfo_SarCpuInfo::~SarInfo_SarCpuInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarCpuInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarCpuInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SarInfo_SarCpuInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarCpuInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarCpuInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.softnet_processed_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sched_run_time_) -
+        reinterpret_cast<char*>(&_impl_.softnet_processed_)) + sizeof(_impl_.sched_run_time_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.sched_run_delay_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cpu_idle_) -
+        reinterpret_cast<char*>(&_impl_.sched_run_delay_)) + sizeof(_impl_.cpu_idle_));
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    ::memset(&_impl_.core_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.node_) -
+        reinterpret_cast<char*>(&_impl_.core_id_)) + sizeof(_impl_.node_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarCpuInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 cpu = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_cpu(&has_bits);
+          _impl_.cpu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_processed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_softnet_processed(&has_bits);
+          _impl_.softnet_processed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_dropped = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_softnet_dropped(&has_bits);
+          _impl_.softnet_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_time_squeeze = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_softnet_time_squeeze(&has_bits);
+          _impl_.softnet_time_squeeze_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_received_rps = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_softnet_received_rps(&has_bits);
+          _impl_.softnet_received_rps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_flow_limit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_softnet_flow_limit(&has_bits);
+          _impl_.softnet_flow_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool softnet_squeezed = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_softnet_squeezed(&has_bits);
+          _impl_.softnet_squeezed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double sched_run_time = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_sched_run_time(&has_bits);
+          _impl_.sched_run_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double sched_run_delay = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_sched_run_delay(&has_bits);
+          _impl_.sched_run_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double sched_timeslices = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_sched_timeslices(&has_bits);
+          _impl_.sched_timeslices_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_cpu_user(&has_bits);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_nice = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_cpu_nice(&has_bits);
+          _impl_.cpu_nice_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_cpu_system(&has_bits);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_iowait = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_cpu_iowait(&has_bits);
+          _impl_.cpu_iowait_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_steal = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_cpu_steal(&has_bits);
+          _impl_.cpu_steal_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_idle = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_cpu_idle(&has_bits);
+          _impl_.cpu_idle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 core_id = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_core_id(&has_bits);
+          _impl_.core_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 package_id = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_package_id(&has_bits);
+          _impl_.package_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 node = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_node(&has_bits);
+          _impl_.node_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cur_freq = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 161)) {
+          _Internal::set_has_cur_freq(&has_bits);
+          _impl_.cur_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double max_freq = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 169)) {
+          _Internal::set_has_max_freq(&has_bits);
+          _impl_.max_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double core_throttle = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _Internal::set_has_core_throttle(&has_bits);
+          _impl_.core_throttle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double package_throttle = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
+          _Internal::set_has_package_throttle(&has_bits);
+          _impl_.package_throttle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarCpuInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarCpuInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 cpu = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_cpu(), target);
+  }
+
+  // optional double softnet_processed = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_softnet_processed(), target);
+  }
+
+  // optional double softnet_dropped = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_softnet_dropped(), target);
+  }
+
+  // optional double softnet_time_squeeze = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_softnet_time_squeeze(), target);
+  }
+
+  // optional double softnet_received_rps = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_softnet_received_rps(), target);
+  }
+
+  // optional double softnet_flow_limit = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_softnet_flow_limit(), target);
+  }
+
+  // optional bool softnet_squeezed = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_softnet_squeezed(), target);
+  }
+
+  // optional double sched_run_time = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_sched_run_time(), target);
+  }
+
+  // optional double sched_run_delay = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_sched_run_delay(), target);
+  }
+
+  // optional double sched_timeslices = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_sched_timeslices(), target);
+  }
+
+  // optional double cpu_user = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_nice = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_cpu_nice(), target);
+  }
+
+  // optional double cpu_system = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_cpu_system(), target);
+  }
+
+  // optional double cpu_iowait = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_cpu_iowait(), target);
+  }
+
+  // optional double cpu_steal = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_cpu_steal(), target);
+  }
+
+  // optional double cpu_idle = 16;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_cpu_idle(), target);
+  }
+
+  // optional int32 core_id = 17;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(17, this->_internal_core_id(), target);
+  }
+
+  // optional int32 package_id = 18;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_package_id(), target);
+  }
+
+  // optional int32 node = 19;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_node(), target);
+  }
+
+  // optional double cur_freq = 20;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(20, this->_internal_cur_freq(), target);
+  }
+
+  // optional double max_freq = 21;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(21, this->_internal_max_freq(), target);
+  }
+
+  // optional double core_throttle = 22;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_core_throttle(), target);
+  }
+
+  // optional double package_throttle = 23;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(23, this->_internal_package_throttle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarCpuInfo)
+  return target;
+}
+
+size_t SarInfo_SarCpuInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarCpuInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double softnet_processed = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double softnet_dropped = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double softnet_time_squeeze = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 cpu = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cpu());
+    }
+
+    // optional bool softnet_squeezed = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional double softnet_received_rps = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double softnet_flow_limit = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double sched_run_time = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double sched_run_delay = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double sched_timeslices = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_user = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_nice = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_system = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_iowait = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_steal = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_idle = 16;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    // optional int32 core_id = 17;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_core_id());
+    }
+
+    // optional int32 package_id = 18;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_package_id());
+    }
+
+    // optional double cur_freq = 20;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double max_freq = 21;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double core_throttle = 22;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double package_throttle = 23;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional int32 node = 19;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_node());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarCpuInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarCpuInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarCpuInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarCpuInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarCpuInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarCpuInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarCpuInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.softnet_processed_ = from._impl_.softnet_processed_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.softnet_dropped_ = from._impl_.softnet_dropped_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.softnet_time_squeeze_ = from._impl_.softnet_time_squeeze_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cpu_ = from._impl_.cpu_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.softnet_squeezed_ = from._impl_.softnet_squeezed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.softnet_received_rps_ = from._impl_.softnet_received_rps_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.softnet_flow_limit_ = from._impl_.softnet_flow_limit_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.sched_run_time_ = from._impl_.sched_run_time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.sched_run_delay_ = from._impl_.sched_run_delay_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.sched_timeslices_ = from._impl_.sched_timeslices_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.cpu_nice_ = from._impl_.cpu_nice_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.cpu_iowait_ = from._impl_.cpu_iowait_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.cpu_steal_ = from._impl_.cpu_steal_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.cpu_idle_ = from._impl_.cpu_idle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.core_id_ = from._impl_.core_id_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.package_id_ = from._impl_.package_id_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.cur_freq_ = from._impl_.cur_freq_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.max_freq_ = from._impl_.max_freq_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.core_throttle_ = from._impl_.core_throttle_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.package_throttle_ = from._impl_.package_throttle_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.node_ = from._impl_.node_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarCpuInfo::CopyFrom(const SarInfo_SarCpuInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarCpuInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarCpuInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarCpuInfo::InternalSwap(SarInfo_SarCpuInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarCpuInfo, _impl_.node_)
+      + sizeof(SarInfo_SarCpuInfo::_impl_.node_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarCpuInfo, _impl_.softnet_processed_)>(
+          reinterpret_cast<char*>(&_impl_.softnet_processed_),
+          reinterpret_cast<char*>(&other->_impl_.softnet_processed_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarCpuInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[2]);
+}
+
+// ===================================================================
+
+class SarInfo_SarTaskSchedInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarTaskSchedInfo>()._impl_._has_bits_);
+  static void set_has_pid(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_comm(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_run_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_run_delay(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_timeslices(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_avg_delay(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+SarInfo_SarTaskSchedInfo::SarInfo_SarTaskSchedInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarTaskSchedInfo)
+}
+SarInfo_SarTaskSchedInfo::SarInfo_SarTaskSchedInfo(const SarInfo_SarTaskSchedInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarTaskSchedInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.comm_){}
+    , decltype(_impl_.run_time_){}
+    , decltype(_impl_.run_delay_){}
+    , decltype(_impl_.timeslices_){}
+    , decltype(_impl_.avg_delay_){}
+    , decltype(_impl_.pid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.comm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_comm()) {
+    _this->_impl_.comm_.Set(from._internal_comm(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.run_time_, &from._impl_.run_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pid_) -
+    reinterpret_cast<char*>(&_impl_.run_time_)) + sizeof(_impl_.pid_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarTaskSchedInfo)
+}
+
+inline void SarInfo_SarTaskSchedInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.comm_){}
+    , decltype(_impl_.run_time_){0}
+    , decltype(_impl_.run_delay_){0}
+    , decltype(_impl_.timeslices_){0}
+    , decltype(_impl_.avg_delay_){0}
+    , decltype(_impl_.pid_){0}
+  };
+  _impl_.comm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarTaskSchedInfo::~SarInfo_SarTaskSchedInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarTaskSchedInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarTaskSchedInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.comm_.Destroy();
+}
+
+void SarInfo_SarTaskSchedInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarTaskSchedInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarTaskSchedInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.comm_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.run_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pid_) -
+        reinterpret_cast<char*>(&_impl_.run_time_)) + sizeof(_impl_.pid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarTaskSchedInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 pid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_pid(&has_bits);
+          _impl_.pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string comm = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_comm();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarTaskSchedInfo.comm");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double run_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_run_time(&has_bits);
+          _impl_.run_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double run_delay = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_run_delay(&has_bits);
+          _impl_.run_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double timeslices = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_timeslices(&has_bits);
+          _impl_.timeslices_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double avg_delay = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_avg_delay(&has_bits);
+          _impl_.avg_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarTaskSchedInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarTaskSchedInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 pid = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_pid(), target);
+  }
+
+  // optional string comm = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_comm().data(), static_cast<int>(this->_internal_comm().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarTaskSchedInfo.comm");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_comm(), target);
+  }
+
+  // optional double run_time = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_run_time(), target);
+  }
+
+  // optional double run_delay = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_run_delay(), target);
+  }
+
+  // optional double timeslices = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_timeslices(), target);
+  }
+
+  // optional double avg_delay = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_avg_delay(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarTaskSchedInfo)
+  return target;
+}
+
+size_t SarInfo_SarTaskSchedInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarTaskSchedInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string comm = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_comm());
+    }
+
+    // optional double run_time = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double run_delay = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double timeslices = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double avg_delay = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 pid = 1;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarTaskSchedInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarTaskSchedInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarTaskSchedInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarTaskSchedInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarTaskSchedInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarTaskSchedInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarTaskSchedInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_comm(from._internal_comm());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.run_time_ = from._impl_.run_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.run_delay_ = from._impl_.run_delay_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.timeslices_ = from._impl_.timeslices_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.avg_delay_ = from._impl_.avg_delay_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.pid_ = from._impl_.pid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarTaskSchedInfo::CopyFrom(const SarInfo_SarTaskSchedInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarTaskSchedInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarTaskSchedInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarTaskSchedInfo::InternalSwap(SarInfo_SarTaskSchedInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.comm_, lhs_arena,
+      &other->_impl_.comm_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarTaskSchedInfo, _impl_.pid_)
+      + sizeof(SarInfo_SarTaskSchedInfo::_impl_.pid_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarTaskSchedInfo, _impl_.run_time_)>(
+          reinterpret_cast<char*>(&_impl_.run_time_),
+          reinterpret_cast<char*>(&other->_impl_.run_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarTaskSchedInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[3]);
+}
+
+// ===================================================================
+
+class SarInfo_SarPsiInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarPsiInfo>()._impl_._has_bits_);
+  static void set_has_some_avg10(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_some_avg60(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_some_avg300(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_full_avg10(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_full_avg60(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_full_avg300(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_some_stall(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_full_stall(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+SarInfo_SarPsiInfo::SarInfo_SarPsiInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarPsiInfo)
+}
+SarInfo_SarPsiInfo::SarInfo_SarPsiInfo(const SarInfo_SarPsiInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarPsiInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.some_avg10_){}
+    , decltype(_impl_.some_avg60_){}
+    , decltype(_impl_.some_avg300_){}
+    , decltype(_impl_.full_avg10_){}
+    , decltype(_impl_.full_avg60_){}
+    , decltype(_impl_.full_avg300_){}
+    , decltype(_impl_.some_stall_){}
+    , decltype(_impl_.full_stall_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.some_avg10_, &from._impl_.some_avg10_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.full_stall_) -
+    reinterpret_cast<char*>(&_impl_.some_avg10_)) + sizeof(_impl_.full_stall_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarPsiInfo)
+}
+
+inline void SarInfo_SarPsiInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.some_avg10_){0}
+    , decltype(_impl_.some_avg60_){0}
+    , decltype(_impl_.some_avg300_){0}
+    , decltype(_impl_.full_avg10_){0}
+    , decltype(_impl_.full_avg60_){0}
+    , decltype(_impl_.full_avg300_){0}
+    , decltype(_impl_.some_stall_){0}
+    , decltype(_impl_.full_stall_){0}
+  };
+}
+
+SarInfo_SarPsiInfo::~SarInfo_SarPsiInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarPsiInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarPsiInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SarInfo_SarPsiInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarPsiInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarPsiInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.some_avg10_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.full_stall_) -
+        reinterpret_cast<char*>(&_impl_.some_avg10_)) + sizeof(_impl_.full_stall_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarPsiInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double some_avg10 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_some_avg10(&has_bits);
+          _impl_.some_avg10_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double some_avg60 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_some_avg60(&has_bits);
+          _impl_.some_avg60_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double some_avg300 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_some_avg300(&has_bits);
+          _impl_.some_avg300_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double full_avg10 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_full_avg10(&has_bits);
+          _impl_.full_avg10_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double full_avg60 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_full_avg60(&has_bits);
+          _impl_.full_avg60_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double full_avg300 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_full_avg300(&has_bits);
+          _impl_.full_avg300_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double some_stall = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_some_stall(&has_bits);
+          _impl_.some_stall_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double full_stall = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_full_stall(&has_bits);
+          _impl_.full_stall_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarPsiInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarPsiInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double some_avg10 = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_some_avg10(), target);
+  }
+
+  // optional double some_avg60 = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_some_avg60(), target);
+  }
+
+  // optional double some_avg300 = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_some_avg300(), target);
+  }
+
+  // optional double full_avg10 = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_full_avg10(), target);
+  }
+
+  // optional double full_avg60 = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_full_avg60(), target);
+  }
+
+  // optional double full_avg300 = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_full_avg300(), target);
+  }
+
+  // optional double some_stall = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_some_stall(), target);
+  }
+
+  // optional double full_stall = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_full_stall(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarPsiInfo)
+  return target;
+}
+
+size_t SarInfo_SarPsiInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarPsiInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double some_avg10 = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double some_avg60 = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double some_avg300 = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double full_avg10 = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double full_avg60 = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double full_avg300 = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double some_stall = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double full_stall = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarPsiInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarPsiInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarPsiInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarPsiInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarPsiInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarPsiInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarPsiInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.some_avg10_ = from._impl_.some_avg10_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.some_avg60_ = from._impl_.some_avg60_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.some_avg300_ = from._impl_.some_avg300_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.full_avg10_ = from._impl_.full_avg10_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.full_avg60_ = from._impl_.full_avg60_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.full_avg300_ = from._impl_.full_avg300_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.some_stall_ = from._impl_.some_stall_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.full_stall_ = from._impl_.full_stall_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarPsiInfo::CopyFrom(const SarInfo_SarPsiInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarPsiInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarPsiInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarPsiInfo::InternalSwap(SarInfo_SarPsiInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarPsiInfo, _impl_.full_stall_)
+      + sizeof(SarInfo_SarPsiInfo::_impl_.full_stall_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarPsiInfo, _impl_.some_avg10_)>(
+          reinterpret_cast<char*>(&_impl_.some_avg10_),
+          reinterpret_cast<char*>(&other->_impl_.some_avg10_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarPsiInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[4]);
+}
+
+// ===================================================================
+
+class SarInfo_SarCgroupInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarCgroupInfo>()._impl_._has_bits_);
+  static void set_has_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_inode(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cpu_usage(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_nr_throttled(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_throttled_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_memory_current(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_memory_anon(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_memory_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_pgfault(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_pgmajfault(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_io_rbytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_io_wbytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_io_rios(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_io_wios(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_cpu(const SarInfo_SarCgroupInfo* msg);
+  static void set_has_psi_cpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_memory(const SarInfo_SarCgroupInfo* msg);
+  static void set_has_psi_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_io(const SarInfo_SarCgroupInfo* msg);
+  static void set_has_psi_io(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::SarInfo_SarPsiInfo&
+SarInfo_SarCgroupInfo::_Internal::psi_cpu(const SarInfo_SarCgroupInfo* msg) {
+  return *msg->_impl_.psi_cpu_;
+}
+const ::SarInfo_SarPsiInfo&
+SarInfo_SarCgroupInfo::_Internal::psi_memory(const SarInfo_SarCgroupInfo* msg) {
+  return *msg->_impl_.psi_memory_;
+}
+const ::SarInfo_SarPsiInfo&
+SarInfo_SarCgroupInfo::_Internal::psi_io(const SarInfo_SarCgroupInfo* msg) {
+  return *msg->_impl_.psi_io_;
+}
+SarInfo_SarCgroupInfo::SarInfo_SarCgroupInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarCgroupInfo)
+}
+SarInfo_SarCgroupInfo::SarInfo_SarCgroupInfo(const SarInfo_SarCgroupInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarCgroupInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.psi_cpu_){nullptr}
+    , decltype(_impl_.psi_memory_){nullptr}
+    , decltype(_impl_.psi_io_){nullptr}
+    , decltype(_impl_.inode_){}
+    , decltype(_impl_.cpu_usage_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.nr_throttled_){}
+    , decltype(_impl_.throttled_time_){}
+    , decltype(_impl_.memory_current_){}
+    , decltype(_impl_.memory_anon_){}
+    , decltype(_impl_.memory_file_){}
+    , decltype(_impl_.pgfault_){}
+    , decltype(_impl_.pgmajfault_){}
+    , decltype(_impl_.io_rbytes_){}
+    , decltype(_impl_.io_wbytes_){}
+    , decltype(_impl_.io_rios_){}
+    , decltype(_impl_.io_wios_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_psi_cpu()) {
+    _this->_impl_.psi_cpu_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_cpu_);
+  }
+  if (from._internal_has_psi_memory()) {
+    _this->_impl_.psi_memory_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_memory_);
+  }
+  if (from._internal_has_psi_io()) {
+    _this->_impl_.psi_io_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_io_);
+  }
+  ::memcpy(&_impl_.inode_, &from._impl_.inode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.io_wios_) -
+    reinterpret_cast<char*>(&_impl_.inode_)) + sizeof(_impl_.io_wios_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarCgroupInfo)
+}
+
+inline void SarInfo_SarCgroupInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.psi_cpu_){nullptr}
+    , decltype(_impl_.psi_memory_){nullptr}
+    , decltype(_impl_.psi_io_){nullptr}
+    , decltype(_impl_.inode_){uint64_t{0u}}
+    , decltype(_impl_.cpu_usage_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.nr_throttled_){0}
+    , decltype(_impl_.throttled_time_){0}
+    , decltype(_impl_.memory_current_){uint64_t{0u}}
+    , decltype(_impl_.memory_anon_){uint64_t{0u}}
+    , decltype(_impl_.memory_file_){uint64_t{0u}}
+    , decltype(_impl_.pgfault_){0}
+    , decltype(_impl_.pgmajfault_){0}
+    , decltype(_impl_.io_rbytes_){0}
+    , decltype(_impl_.io_wbytes_){0}
+    , decltype(_impl_.io_rios_){0}
+    , decltype(_impl_.io_wios_){0}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarCgroupInfo::~SarInfo_SarCgroupInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarCgroupInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarCgroupInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.psi_cpu_;
+  if (this != internal_default_instance()) delete _impl_.psi_memory_;
+  if (this != internal_default_instance()) delete _impl_.psi_io_;
+}
+
+void SarInfo_SarCgroupInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarCgroupInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarCgroupInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.psi_cpu_ != nullptr);
+      _impl_.psi_cpu_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.psi_memory_ != nullptr);
+      _impl_.psi_memory_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.psi_io_ != nullptr);
+      _impl_.psi_io_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.inode_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cpu_system_) -
+        reinterpret_cast<char*>(&_impl_.inode_)) + sizeof(_impl_.cpu_system_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.nr_throttled_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.io_rbytes_) -
+        reinterpret_cast<char*>(&_impl_.nr_throttled_)) + sizeof(_impl_.io_rbytes_));
+  }
+  if (cached_has_bits & 0x00070000u) {
+    ::memset(&_impl_.io_wbytes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.io_wios_) -
+        reinterpret_cast<char*>(&_impl_.io_wbytes_)) + sizeof(_impl_.io_wios_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarCgroupInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarCgroupInfo.path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 inode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_inode(&has_bits);
+          _impl_.inode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_usage = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_cpu_usage(&has_bits);
+          _impl_.cpu_usage_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_cpu_user(&has_bits);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cpu_system(&has_bits);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double nr_throttled = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_nr_throttled(&has_bits);
+          _impl_.nr_throttled_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double throttled_time = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_throttled_time(&has_bits);
+          _impl_.throttled_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 memory_current = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_memory_current(&has_bits);
+          _impl_.memory_current_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 memory_anon = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_memory_anon(&has_bits);
+          _impl_.memory_anon_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 memory_file = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_memory_file(&has_bits);
+          _impl_.memory_file_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgfault = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_pgfault(&has_bits);
+          _impl_.pgfault_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgmajfault = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_pgmajfault(&has_bits);
+          _impl_.pgmajfault_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double io_rbytes = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_io_rbytes(&has_bits);
+          _impl_.io_rbytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double io_wbytes = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_io_wbytes(&has_bits);
+          _impl_.io_wbytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double io_rios = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_io_rios(&has_bits);
+          _impl_.io_rios_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double io_wios = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_io_wios(&has_bits);
+          _impl_.io_wios_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_cpu = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_cpu(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_memory = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_memory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_io = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_io(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarCgroupInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarCgroupInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string path = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarCgroupInfo.path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
+  }
+
+  // optional uint64 inode = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_inode(), target);
+  }
+
+  // optional double cpu_usage = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_cpu_usage(), target);
+  }
+
+  // optional double cpu_user = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_system = 5;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_cpu_system(), target);
+  }
+
+  // optional double nr_throttled = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_nr_throttled(), target);
+  }
+
+  // optional double throttled_time = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_throttled_time(), target);
+  }
+
+  // optional uint64 memory_current = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_memory_current(), target);
+  }
+
+  // optional uint64 memory_anon = 9;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_memory_anon(), target);
+  }
+
+  // optional uint64 memory_file = 10;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_memory_file(), target);
+  }
+
+  // optional double pgfault = 11;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_pgfault(), target);
+  }
+
+  // optional double pgmajfault = 12;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_pgmajfault(), target);
+  }
+
+  // optional double io_rbytes = 13;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_io_rbytes(), target);
+  }
+
+  // optional double io_wbytes = 14;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_io_wbytes(), target);
+  }
+
+  // optional double io_rios = 15;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_io_rios(), target);
+  }
+
+  // optional double io_wios = 16;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_io_wios(), target);
+  }
+
+  // optional .SarInfo.SarPsiInfo psi_cpu = 17;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::psi_cpu(this),
+        _Internal::psi_cpu(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .SarInfo.SarPsiInfo psi_memory = 18;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::psi_memory(this),
+        _Internal::psi_memory(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .SarInfo.SarPsiInfo psi_io = 19;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::psi_io(this),
+        _Internal::psi_io(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarCgroupInfo)
+  return target;
+}
+
+size_t SarInfo_SarCgroupInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarCgroupInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string path = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path());
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_cpu = 17;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_cpu_);
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_memory = 18;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_memory_);
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_io = 19;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_io_);
+    }
+
+    // optional uint64 inode = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_inode());
+    }
+
+    // optional double cpu_usage = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_user = 4;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_system = 5;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double nr_throttled = 6;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double throttled_time = 7;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint64 memory_current = 8;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_memory_current());
+    }
+
+    // optional uint64 memory_anon = 9;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_memory_anon());
+    }
+
+    // optional uint64 memory_file = 10;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_memory_file());
+    }
+
+    // optional double pgfault = 11;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double pgmajfault = 12;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double io_rbytes = 13;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00070000u) {
+    // optional double io_wbytes = 14;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double io_rios = 15;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double io_wios = 16;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarCgroupInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarCgroupInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarCgroupInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarCgroupInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarCgroupInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarCgroupInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarCgroupInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_path(from._internal_path());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_psi_cpu()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_cpu());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_psi_memory()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_memory());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_psi_io()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_io());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.inode_ = from._impl_.inode_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cpu_usage_ = from._impl_.cpu_usage_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.nr_throttled_ = from._impl_.nr_throttled_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.throttled_time_ = from._impl_.throttled_time_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.memory_current_ = from._impl_.memory_current_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.memory_anon_ = from._impl_.memory_anon_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.memory_file_ = from._impl_.memory_file_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.pgfault_ = from._impl_.pgfault_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.pgmajfault_ = from._impl_.pgmajfault_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.io_rbytes_ = from._impl_.io_rbytes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.io_wbytes_ = from._impl_.io_wbytes_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.io_rios_ = from._impl_.io_rios_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.io_wios_ = from._impl_.io_wios_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarCgroupInfo::CopyFrom(const SarInfo_SarCgroupInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarCgroupInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarCgroupInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarCgroupInfo::InternalSwap(SarInfo_SarCgroupInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarCgroupInfo, _impl_.io_wios_)
+      + sizeof(SarInfo_SarCgroupInfo::_impl_.io_wios_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarCgroupInfo, _impl_.psi_cpu_)>(
+          reinterpret_cast<char*>(&_impl_.psi_cpu_),
+          reinterpret_cast<char*>(&other->_impl_.psi_cpu_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarCgroupInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[5]);
+}
+
+// ===================================================================
+
+class SarInfo_SarProcessInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarProcessInfo>()._impl_._has_bits_);
+  static void set_has_pid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_comm(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_cpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_rss(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_shared(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_minflt(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_majflt(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_read_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_write_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
+
+SarInfo_SarProcessInfo::SarInfo_SarProcessInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarProcessInfo)
+}
+SarInfo_SarProcessInfo::SarInfo_SarProcessInfo(const SarInfo_SarProcessInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarProcessInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.comm_){}
+    , decltype(_impl_.cpu_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.rss_){}
+    , decltype(_impl_.shared_){}
+    , decltype(_impl_.minflt_){}
+    , decltype(_impl_.majflt_){}
+    , decltype(_impl_.read_bytes_){}
+    , decltype(_impl_.write_bytes_){}
+    , decltype(_impl_.pid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.comm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_comm()) {
+    _this->_impl_.comm_.Set(from._internal_comm(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cpu_, &from._impl_.cpu_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pid_) -
+    reinterpret_cast<char*>(&_impl_.cpu_)) + sizeof(_impl_.pid_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarProcessInfo)
+}
+
+inline void SarInfo_SarProcessInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.comm_){}
+    , decltype(_impl_.cpu_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.rss_){uint64_t{0u}}
+    , decltype(_impl_.shared_){uint64_t{0u}}
+    , decltype(_impl_.minflt_){0}
+    , decltype(_impl_.majflt_){0}
+    , decltype(_impl_.read_bytes_){0}
+    , decltype(_impl_.write_bytes_){0}
+    , decltype(_impl_.pid_){0}
+  };
+  _impl_.comm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarProcessInfo::~SarInfo_SarProcessInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarProcessInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarProcessInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.comm_.Destroy();
+}
+
+void SarInfo_SarProcessInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarProcessInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarProcessInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.comm_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.cpu_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.majflt_) -
+        reinterpret_cast<char*>(&_impl_.cpu_)) + sizeof(_impl_.majflt_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.read_bytes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pid_) -
+        reinterpret_cast<char*>(&_impl_.read_bytes_)) + sizeof(_impl_.pid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarProcessInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 pid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_pid(&has_bits);
+          _impl_.pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string comm = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_comm();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarProcessInfo.comm");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_cpu(&has_bits);
+          _impl_.cpu_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_cpu_user(&has_bits);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cpu_system(&has_bits);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 rss = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_rss(&has_bits);
+          _impl_.rss_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 shared = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_shared(&has_bits);
+          _impl_.shared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double minflt = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_minflt(&has_bits);
+          _impl_.minflt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double majflt = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_majflt(&has_bits);
+          _impl_.majflt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double read_bytes = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_read_bytes(&has_bits);
+          _impl_.read_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double write_bytes = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_write_bytes(&has_bits);
+          _impl_.write_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarProcessInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarProcessInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 pid = 1;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_pid(), target);
+  }
+
+  // optional string comm = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_comm().data(), static_cast<int>(this->_internal_comm().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarProcessInfo.comm");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_comm(), target);
+  }
+
+  // optional double cpu = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_cpu(), target);
+  }
+
+  // optional double cpu_user = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_system = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_cpu_system(), target);
+  }
+
+  // optional uint64 rss = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_rss(), target);
+  }
+
+  // optional uint64 shared = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_shared(), target);
+  }
+
+  // optional double minflt = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_minflt(), target);
+  }
+
+  // optional double majflt = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_majflt(), target);
+  }
+
+  // optional double read_bytes = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_read_bytes(), target);
+  }
+
+  // optional double write_bytes = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_write_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarProcessInfo)
+  return target;
+}
+
+size_t SarInfo_SarProcessInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarProcessInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string comm = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_comm());
+    }
+
+    // optional double cpu = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_user = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_system = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint64 rss = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_rss());
+    }
+
+    // optional uint64 shared = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_shared());
+    }
+
+    // optional double minflt = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double majflt = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional double read_bytes = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double write_bytes = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 pid = 1;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarProcessInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarProcessInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarProcessInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarProcessInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarProcessInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarProcessInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarProcessInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_comm(from._internal_comm());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.cpu_ = from._impl_.cpu_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.rss_ = from._impl_.rss_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.shared_ = from._impl_.shared_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.minflt_ = from._impl_.minflt_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.majflt_ = from._impl_.majflt_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.read_bytes_ = from._impl_.read_bytes_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.write_bytes_ = from._impl_.write_bytes_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.pid_ = from._impl_.pid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarProcessInfo::CopyFrom(const SarInfo_SarProcessInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarProcessInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarProcessInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarProcessInfo::InternalSwap(SarInfo_SarProcessInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.comm_, lhs_arena,
+      &other->_impl_.comm_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarProcessInfo, _impl_.pid_)
+      + sizeof(SarInfo_SarProcessInfo::_impl_.pid_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarProcessInfo, _impl_.cpu_)>(
+          reinterpret_cast<char*>(&_impl_.cpu_),
+          reinterpret_cast<char*>(&other->_impl_.cpu_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarProcessInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[6]);
+}
+
+// ===================================================================
+
+class SarInfo_SarIfaceInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarIfaceInfo>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_rxpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_txpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rxbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_txbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_rxerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_txerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_rxdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_txdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+SarInfo_SarIfaceInfo::SarInfo_SarIfaceInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarIfaceInfo)
+}
+SarInfo_SarIfaceInfo::SarInfo_SarIfaceInfo(const SarInfo_SarIfaceInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarIfaceInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.rxpck_){}
+    , decltype(_impl_.txpck_){}
+    , decltype(_impl_.rxbyt_){}
+    , decltype(_impl_.txbyt_){}
+    , decltype(_impl_.rxerr_){}
+    , decltype(_impl_.txerr_){}
+    , decltype(_impl_.rxdrop_){}
+    , decltype(_impl_.txdrop_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.rxpck_, &from._impl_.rxpck_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.txdrop_) -
+    reinterpret_cast<char*>(&_impl_.rxpck_)) + sizeof(_impl_.txdrop_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarIfaceInfo)
+}
+
+inline void SarInfo_SarIfaceInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.rxpck_){0}
+    , decltype(_impl_.txpck_){0}
+    , decltype(_impl_.rxbyt_){0}
+    , decltype(_impl_.txbyt_){0}
+    , decltype(_impl_.rxerr_){0}
+    , decltype(_impl_.txerr_){0}
+    , decltype(_impl_.rxdrop_){0}
+    , decltype(_impl_.txdrop_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarIfaceInfo::~SarInfo_SarIfaceInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarIfaceInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarIfaceInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void SarInfo_SarIfaceInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarIfaceInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarIfaceInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.rxpck_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.rxdrop_) -
+        reinterpret_cast<char*>(&_impl_.rxpck_)) + sizeof(_impl_.rxdrop_));
+  }
+  _impl_.txdrop_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarIfaceInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarIfaceInfo.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxpck = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_rxpck(&has_bits);
+          _impl_.rxpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txpck = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_txpck(&has_bits);
+          _impl_.txpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxbyt = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_rxbyt(&has_bits);
+          _impl_.rxbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txbyt = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_txbyt(&has_bits);
+          _impl_.txbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxerr = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_rxerr(&has_bits);
+          _impl_.rxerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txerr = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_txerr(&has_bits);
+          _impl_.txerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxdrop = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_rxdrop(&has_bits);
+          _impl_.rxdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txdrop = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_txdrop(&has_bits);
+          _impl_.txdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarIfaceInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarIfaceInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarIfaceInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional double rxpck = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rxpck(), target);
+  }
+
+  // optional double txpck = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_txpck(), target);
+  }
+
+  // optional double rxbyt = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_rxbyt(), target);
+  }
+
+  // optional double txbyt = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_txbyt(), target);
+  }
+
+  // optional double rxerr = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_rxerr(), target);
+  }
+
+  // optional double txerr = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_txerr(), target);
+  }
+
+  // optional double rxdrop = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_rxdrop(), target);
+  }
+
+  // optional double txdrop = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_txdrop(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarIfaceInfo)
+  return target;
+}
+
+size_t SarInfo_SarIfaceInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarIfaceInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional double rxpck = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txpck = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxbyt = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txbyt = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxerr = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txerr = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxdrop = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // optional double txdrop = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarIfaceInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarIfaceInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarIfaceInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarIfaceInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarIfaceInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarIfaceInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarIfaceInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.rxpck_ = from._impl_.rxpck_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.txpck_ = from._impl_.txpck_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.rxbyt_ = from._impl_.rxbyt_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.txbyt_ = from._impl_.txbyt_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.rxerr_ = from._impl_.rxerr_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.txerr_ = from._impl_.txerr_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.rxdrop_ = from._impl_.rxdrop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_txdrop(from._internal_txdrop());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarIfaceInfo::CopyFrom(const SarInfo_SarIfaceInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarIfaceInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarIfaceInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarIfaceInfo::InternalSwap(SarInfo_SarIfaceInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarIfaceInfo, _impl_.txdrop_)
+      + sizeof(SarInfo_SarIfaceInfo::_impl_.txdrop_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarIfaceInfo, _impl_.rxpck_)>(
+          reinterpret_cast<char*>(&_impl_.rxpck_),
+          reinterpret_cast<char*>(&other->_impl_.rxpck_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarIfaceInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[7]);
+}
+
+// ===================================================================
+
+class SarInfo_SarNetnsInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarNetnsInfo>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_inode(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_pid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_rxpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_txpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_rxbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_txbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_rxerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_txerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_rxdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_txdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
+
+SarInfo_SarNetnsInfo::SarInfo_SarNetnsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarNetnsInfo)
+}
+SarInfo_SarNetnsInfo::SarInfo_SarNetnsInfo(const SarInfo_SarNetnsInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarNetnsInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.iface_){from._impl_.iface_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.inode_){}
+    , decltype(_impl_.rxpck_){}
+    , decltype(_impl_.txpck_){}
+    , decltype(_impl_.rxbyt_){}
+    , decltype(_impl_.txbyt_){}
+    , decltype(_impl_.rxerr_){}
+    , decltype(_impl_.txerr_){}
+    , decltype(_impl_.rxdrop_){}
+    , decltype(_impl_.txdrop_){}
+    , decltype(_impl_.pid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.inode_, &from._impl_.inode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pid_) -
+    reinterpret_cast<char*>(&_impl_.inode_)) + sizeof(_impl_.pid_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarNetnsInfo)
+}
+
+inline void SarInfo_SarNetnsInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.iface_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.inode_){uint64_t{0u}}
+    , decltype(_impl_.rxpck_){0}
+    , decltype(_impl_.txpck_){0}
+    , decltype(_impl_.rxbyt_){0}
+    , decltype(_impl_.txbyt_){0}
+    , decltype(_impl_.rxerr_){0}
+    , decltype(_impl_.txerr_){0}
+    , decltype(_impl_.rxdrop_){0}
+    , decltype(_impl_.txdrop_){0}
+    , decltype(_impl_.pid_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarNetnsInfo::~SarInfo_SarNetnsInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarNetnsInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarNetnsInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.iface_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void SarInfo_SarNetnsInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarNetnsInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarNetnsInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.iface_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.inode_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.txerr_) -
+        reinterpret_cast<char*>(&_impl_.inode_)) + sizeof(_impl_.txerr_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.rxdrop_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pid_) -
+        reinterpret_cast<char*>(&_impl_.rxdrop_)) + sizeof(_impl_.pid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarNetnsInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarNetnsInfo.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 inode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_inode(&has_bits);
+          _impl_.inode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 pid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_pid(&has_bits);
+          _impl_.pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxpck = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_rxpck(&has_bits);
+          _impl_.rxpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txpck = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_txpck(&has_bits);
+          _impl_.txpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxbyt = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_rxbyt(&has_bits);
+          _impl_.rxbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txbyt = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_txbyt(&has_bits);
+          _impl_.txbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxerr = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_rxerr(&has_bits);
+          _impl_.rxerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txerr = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_txerr(&has_bits);
+          _impl_.txerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxdrop = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_rxdrop(&has_bits);
+          _impl_.rxdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txdrop = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_txdrop(&has_bits);
+          _impl_.txdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarIfaceInfo iface = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_iface(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarNetnsInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarNetnsInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarNetnsInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional uint64 inode = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_inode(), target);
+  }
+
+  // optional int32 pid = 3;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_pid(), target);
+  }
+
+  // optional double rxpck = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_rxpck(), target);
+  }
+
+  // optional double txpck = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_txpck(), target);
+  }
+
+  // optional double rxbyt = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_rxbyt(), target);
+  }
+
+  // optional double txbyt = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_txbyt(), target);
+  }
+
+  // optional double rxerr = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_rxerr(), target);
+  }
+
+  // optional double txerr = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_txerr(), target);
+  }
+
+  // optional double rxdrop = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_rxdrop(), target);
+  }
+
+  // optional double txdrop = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_txdrop(), target);
+  }
+
+  // repeated .SarInfo.SarIfaceInfo iface = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_iface_size()); i < n; i++) {
+    const auto& repfield = this->_internal_iface(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarNetnsInfo)
+  return target;
+}
+
+size_t SarInfo_SarNetnsInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarNetnsInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SarInfo.SarIfaceInfo iface = 12;
+  total_size += 1UL * this->_internal_iface_size();
+  for (const auto& msg : this->_impl_.iface_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional uint64 inode = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_inode());
+    }
+
+    // optional double rxpck = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txpck = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxbyt = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txbyt = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxerr = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txerr = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional double rxdrop = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txdrop = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 pid = 3;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarNetnsInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarNetnsInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarNetnsInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarNetnsInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarNetnsInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarNetnsInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarNetnsInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.iface_.MergeFrom(from._impl_.iface_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.inode_ = from._impl_.inode_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.rxpck_ = from._impl_.rxpck_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.txpck_ = from._impl_.txpck_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.rxbyt_ = from._impl_.rxbyt_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.txbyt_ = from._impl_.txbyt_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.rxerr_ = from._impl_.rxerr_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.txerr_ = from._impl_.txerr_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.rxdrop_ = from._impl_.rxdrop_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.txdrop_ = from._impl_.txdrop_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.pid_ = from._impl_.pid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarNetnsInfo::CopyFrom(const SarInfo_SarNetnsInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarNetnsInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarNetnsInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarNetnsInfo::InternalSwap(SarInfo_SarNetnsInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.iface_.InternalSwap(&other->_impl_.iface_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarNetnsInfo, _impl_.pid_)
+      + sizeof(SarInfo_SarNetnsInfo::_impl_.pid_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarNetnsInfo, _impl_.inode_)>(
+          reinterpret_cast<char*>(&_impl_.inode_),
+          reinterpret_cast<char*>(&other->_impl_.inode_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarNetnsInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[8]);
+}
+
+// ===================================================================
+
+class SarInfo_SarFsInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarFsInfo>()._impl_._has_bits_);
+  static void set_has_mount_point(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_fs_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_source(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_used(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_avail(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_used_pct(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_free_pct(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_inode_used_pct(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_growth(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_time_to_full(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+};
+
+SarInfo_SarFsInfo::SarInfo_SarFsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarFsInfo)
+}
+SarInfo_SarFsInfo::SarInfo_SarFsInfo(const SarInfo_SarFsInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarFsInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mount_point_){}
+    , decltype(_impl_.fs_type_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.used_){}
+    , decltype(_impl_.avail_){}
+    , decltype(_impl_.used_pct_){}
+    , decltype(_impl_.free_pct_){}
+    , decltype(_impl_.inode_used_pct_){}
+    , decltype(_impl_.growth_){}
+    , decltype(_impl_.time_to_full_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mount_point_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mount_point_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_mount_point()) {
+    _this->_impl_.mount_point_.Set(from._internal_mount_point(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.fs_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fs_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_fs_type()) {
+    _this->_impl_.fs_type_.Set(from._internal_fs_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_source()) {
+    _this->_impl_.source_.Set(from._internal_source(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_to_full_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.time_to_full_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarFsInfo)
+}
+
+inline void SarInfo_SarFsInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mount_point_){}
+    , decltype(_impl_.fs_type_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.used_){uint64_t{0u}}
+    , decltype(_impl_.avail_){uint64_t{0u}}
+    , decltype(_impl_.used_pct_){0}
+    , decltype(_impl_.free_pct_){0}
+    , decltype(_impl_.inode_used_pct_){0}
+    , decltype(_impl_.growth_){0}
+    , decltype(_impl_.time_to_full_){0}
+  };
+  _impl_.mount_point_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mount_point_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.fs_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fs_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarFsInfo::~SarInfo_SarFsInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarFsInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarFsInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mount_point_.Destroy();
+  _impl_.fs_type_.Destroy();
+  _impl_.source_.Destroy();
+}
+
+void SarInfo_SarFsInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarFsInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarFsInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.mount_point_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.fs_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.source_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.free_pct_) -
+        reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.free_pct_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.inode_used_pct_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.time_to_full_) -
+        reinterpret_cast<char*>(&_impl_.inode_used_pct_)) + sizeof(_impl_.time_to_full_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarFsInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string mount_point = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_mount_point();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarFsInfo.mount_point");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string fs_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_fs_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarFsInfo.fs_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string source = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_source();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarFsInfo.source");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 used = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_used(&has_bits);
+          _impl_.used_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 avail = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_avail(&has_bits);
+          _impl_.avail_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double used_pct = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_used_pct(&has_bits);
+          _impl_.used_pct_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double free_pct = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_free_pct(&has_bits);
+          _impl_.free_pct_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double inode_used_pct = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_inode_used_pct(&has_bits);
+          _impl_.inode_used_pct_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double growth = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_growth(&has_bits);
+          _impl_.growth_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double time_to_full = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_time_to_full(&has_bits);
+          _impl_.time_to_full_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarFsInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarFsInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string mount_point = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_mount_point().data(), static_cast<int>(this->_internal_mount_point().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarFsInfo.mount_point");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_mount_point(), target);
+  }
+
+  // optional string fs_type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_fs_type().data(), static_cast<int>(this->_internal_fs_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarFsInfo.fs_type");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_fs_type(), target);
+  }
+
+  // optional string source = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_source().data(), static_cast<int>(this->_internal_source().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarFsInfo.source");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_source(), target);
+  }
+
+  // optional uint64 size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_size(), target);
+  }
+
+  // optional uint64 used = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_used(), target);
+  }
+
+  // optional uint64 avail = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_avail(), target);
+  }
+
+  // optional double used_pct = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_used_pct(), target);
+  }
+
+  // optional double free_pct = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_free_pct(), target);
+  }
+
+  // optional double inode_used_pct = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_inode_used_pct(), target);
+  }
+
+  // optional double growth = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_growth(), target);
+  }
+
+  // optional double time_to_full = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_time_to_full(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarFsInfo)
+  return target;
+}
+
+size_t SarInfo_SarFsInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarFsInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string mount_point = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_mount_point());
+    }
+
+    // optional string fs_type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_fs_type());
+    }
+
+    // optional string source = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_source());
+    }
+
+    // optional uint64 size = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+    }
+
+    // optional uint64 used = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_used());
+    }
+
+    // optional uint64 avail = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_avail());
+    }
+
+    // optional double used_pct = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double free_pct = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional double inode_used_pct = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double growth = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double time_to_full = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarFsInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarFsInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarFsInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarFsInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarFsInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarFsInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarFsInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_mount_point(from._internal_mount_point());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_fs_type(from._internal_fs_type());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_source(from._internal_source());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.used_ = from._impl_.used_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.avail_ = from._impl_.avail_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.used_pct_ = from._impl_.used_pct_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.free_pct_ = from._impl_.free_pct_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.inode_used_pct_ = from._impl_.inode_used_pct_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.growth_ = from._impl_.growth_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.time_to_full_ = from._impl_.time_to_full_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarFsInfo::CopyFrom(const SarInfo_SarFsInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarFsInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarFsInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarFsInfo::InternalSwap(SarInfo_SarFsInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mount_point_, lhs_arena,
+      &other->_impl_.mount_point_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.fs_type_, lhs_arena,
+      &other->_impl_.fs_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.source_, lhs_arena,
+      &other->_impl_.source_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarFsInfo, _impl_.time_to_full_)
+      + sizeof(SarInfo_SarFsInfo::_impl_.time_to_full_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarFsInfo, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarFsInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[9]);
+}
+
+// ===================================================================
+
+class SarInfo_SarCpuGroupInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarCpuGroupInfo>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_package_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_nr_cpus(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_cpu_nice(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cpu_iowait(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_cpu_steal(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_cpu_idle(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+SarInfo_SarCpuGroupInfo::SarInfo_SarCpuGroupInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarCpuGroupInfo)
+}
+SarInfo_SarCpuGroupInfo::SarInfo_SarCpuGroupInfo(const SarInfo_SarCpuGroupInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarCpuGroupInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.package_id_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_nice_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.cpu_iowait_){}
+    , decltype(_impl_.cpu_steal_){}
+    , decltype(_impl_.cpu_idle_){}
+    , decltype(_impl_.nr_cpus_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.nr_cpus_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.nr_cpus_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarCpuGroupInfo)
+}
+
+inline void SarInfo_SarCpuGroupInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.package_id_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_nice_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.cpu_iowait_){0}
+    , decltype(_impl_.cpu_steal_){0}
+    , decltype(_impl_.cpu_idle_){0}
+    , decltype(_impl_.nr_cpus_){0}
+  };
+}
+
+SarInfo_SarCpuGroupInfo::~SarInfo_SarCpuGroupInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarCpuGroupInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarCpuGroupInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SarInfo_SarCpuGroupInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarCpuGroupInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarCpuGroupInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cpu_idle_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.cpu_idle_));
+  }
+  _impl_.nr_cpus_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarCpuGroupInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 package_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_package_id(&has_bits);
+          _impl_.package_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 nr_cpus = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_nr_cpus(&has_bits);
+          _impl_.nr_cpus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_cpu_user(&has_bits);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_nice = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cpu_nice(&has_bits);
+          _impl_.cpu_nice_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_cpu_system(&has_bits);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_iowait = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_cpu_iowait(&has_bits);
+          _impl_.cpu_iowait_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_steal = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_cpu_steal(&has_bits);
+          _impl_.cpu_steal_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_idle = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_cpu_idle(&has_bits);
+          _impl_.cpu_idle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarCpuGroupInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarCpuGroupInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // optional int32 package_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_package_id(), target);
+  }
+
+  // optional int32 nr_cpus = 3;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_nr_cpus(), target);
+  }
+
+  // optional double cpu_user = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_nice = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_cpu_nice(), target);
+  }
+
+  // optional double cpu_system = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_cpu_system(), target);
+  }
+
+  // optional double cpu_iowait = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_cpu_iowait(), target);
+  }
+
+  // optional double cpu_steal = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_cpu_steal(), target);
+  }
+
+  // optional double cpu_idle = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_cpu_idle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarCpuGroupInfo)
+  return target;
+}
+
+size_t SarInfo_SarCpuGroupInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarCpuGroupInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional int32 id = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 package_id = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_package_id());
+    }
+
+    // optional double cpu_user = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_nice = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_system = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_iowait = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_steal = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_idle = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // optional int32 nr_cpus = 3;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nr_cpus());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarCpuGroupInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarCpuGroupInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarCpuGroupInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarCpuGroupInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarCpuGroupInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarCpuGroupInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarCpuGroupInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.package_id_ = from._impl_.package_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cpu_nice_ = from._impl_.cpu_nice_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cpu_iowait_ = from._impl_.cpu_iowait_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.cpu_steal_ = from._impl_.cpu_steal_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.cpu_idle_ = from._impl_.cpu_idle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_nr_cpus(from._internal_nr_cpus());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarCpuGroupInfo::CopyFrom(const SarInfo_SarCpuGroupInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarCpuGroupInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarCpuGroupInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarCpuGroupInfo::InternalSwap(SarInfo_SarCpuGroupInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarCpuGroupInfo, _impl_.nr_cpus_)
+      + sizeof(SarInfo_SarCpuGroupInfo::_impl_.nr_cpus_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarCpuGroupInfo, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarCpuGroupInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[10]);
+}
+
+// ===================================================================
+
+class SarInfo_SarNodeInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarNodeInfo>()._impl_._has_bits_);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_nr_cpus(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_cpu_nice(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cpu_iowait(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_cpu_steal(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_cpu_idle(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_mem_total(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_mem_free(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_numa_hit(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_numa_miss(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_numa_foreign(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_local_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_other_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+};
+
+SarInfo_SarNodeInfo::SarInfo_SarNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarNodeInfo)
+}
+SarInfo_SarNodeInfo::SarInfo_SarNodeInfo(const SarInfo_SarNodeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarNodeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.nr_cpus_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_nice_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.cpu_iowait_){}
+    , decltype(_impl_.cpu_steal_){}
+    , decltype(_impl_.cpu_idle_){}
+    , decltype(_impl_.mem_total_){}
+    , decltype(_impl_.mem_free_){}
+    , decltype(_impl_.numa_hit_){}
+    , decltype(_impl_.numa_miss_){}
+    , decltype(_impl_.numa_foreign_){}
+    , decltype(_impl_.local_node_){}
+    , decltype(_impl_.other_node_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.node_, &from._impl_.node_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.other_node_) -
+    reinterpret_cast<char*>(&_impl_.node_)) + sizeof(_impl_.other_node_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarNodeInfo)
+}
+
+inline void SarInfo_SarNodeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){0}
+    , decltype(_impl_.nr_cpus_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_nice_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.cpu_iowait_){0}
+    , decltype(_impl_.cpu_steal_){0}
+    , decltype(_impl_.cpu_idle_){0}
+    , decltype(_impl_.mem_total_){uint64_t{0u}}
+    , decltype(_impl_.mem_free_){uint64_t{0u}}
+    , decltype(_impl_.numa_hit_){0}
+    , decltype(_impl_.numa_miss_){0}
+    , decltype(_impl_.numa_foreign_){0}
+    , decltype(_impl_.local_node_){0}
+    , decltype(_impl_.other_node_){0}
+  };
+}
+
+SarInfo_SarNodeInfo::~SarInfo_SarNodeInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarNodeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarNodeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SarInfo_SarNodeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarNodeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarNodeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.node_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cpu_idle_) -
+        reinterpret_cast<char*>(&_impl_.node_)) + sizeof(_impl_.cpu_idle_));
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    ::memset(&_impl_.mem_total_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.other_node_) -
+        reinterpret_cast<char*>(&_impl_.mem_total_)) + sizeof(_impl_.other_node_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarNodeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_node(&has_bits);
+          _impl_.node_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 nr_cpus = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_nr_cpus(&has_bits);
+          _impl_.nr_cpus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_cpu_user(&has_bits);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_nice = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_cpu_nice(&has_bits);
+          _impl_.cpu_nice_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_cpu_system(&has_bits);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_iowait = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_cpu_iowait(&has_bits);
+          _impl_.cpu_iowait_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_steal = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_cpu_steal(&has_bits);
+          _impl_.cpu_steal_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_idle = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_cpu_idle(&has_bits);
+          _impl_.cpu_idle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 mem_total = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_mem_total(&has_bits);
+          _impl_.mem_total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 mem_free = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_mem_free(&has_bits);
+          _impl_.mem_free_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double numa_hit = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_numa_hit(&has_bits);
+          _impl_.numa_hit_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double numa_miss = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_numa_miss(&has_bits);
+          _impl_.numa_miss_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double numa_foreign = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_numa_foreign(&has_bits);
+          _impl_.numa_foreign_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double local_node = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_local_node(&has_bits);
+          _impl_.local_node_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double other_node = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_other_node(&has_bits);
+          _impl_.other_node_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarNodeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarNodeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 node = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_node(), target);
+  }
+
+  // optional int32 nr_cpus = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_nr_cpus(), target);
+  }
+
+  // optional double cpu_user = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_nice = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_cpu_nice(), target);
+  }
+
+  // optional double cpu_system = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_cpu_system(), target);
+  }
+
+  // optional double cpu_iowait = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_cpu_iowait(), target);
+  }
+
+  // optional double cpu_steal = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_cpu_steal(), target);
+  }
+
+  // optional double cpu_idle = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_cpu_idle(), target);
+  }
+
+  // optional uint64 mem_total = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_mem_total(), target);
+  }
+
+  // optional uint64 mem_free = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_mem_free(), target);
+  }
+
+  // optional double numa_hit = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_numa_hit(), target);
+  }
+
+  // optional double numa_miss = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_numa_miss(), target);
+  }
+
+  // optional double numa_foreign = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_numa_foreign(), target);
+  }
+
+  // optional double local_node = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_local_node(), target);
+  }
+
+  // optional double other_node = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_other_node(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarNodeInfo)
+  return target;
+}
+
+size_t SarInfo_SarNodeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarNodeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional int32 node = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_node());
+    }
+
+    // optional int32 nr_cpus = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nr_cpus());
+    }
+
+    // optional double cpu_user = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_nice = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_system = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_iowait = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_steal = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double cpu_idle = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    // optional uint64 mem_total = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_mem_total());
+    }
+
+    // optional uint64 mem_free = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_mem_free());
+    }
+
+    // optional double numa_hit = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double numa_miss = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double numa_foreign = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double local_node = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double other_node = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarNodeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarNodeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarNodeInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarNodeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarNodeInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarNodeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarNodeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.node_ = from._impl_.node_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.nr_cpus_ = from._impl_.nr_cpus_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cpu_nice_ = from._impl_.cpu_nice_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cpu_iowait_ = from._impl_.cpu_iowait_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.cpu_steal_ = from._impl_.cpu_steal_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.cpu_idle_ = from._impl_.cpu_idle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.mem_total_ = from._impl_.mem_total_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.mem_free_ = from._impl_.mem_free_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.numa_hit_ = from._impl_.numa_hit_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.numa_miss_ = from._impl_.numa_miss_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.numa_foreign_ = from._impl_.numa_foreign_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.local_node_ = from._impl_.local_node_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.other_node_ = from._impl_.other_node_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarNodeInfo::CopyFrom(const SarInfo_SarNodeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarNodeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarNodeInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarNodeInfo::InternalSwap(SarInfo_SarNodeInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarNodeInfo, _impl_.other_node_)
+      + sizeof(SarInfo_SarNodeInfo::_impl_.other_node_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarNodeInfo, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarNodeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[11]);
+}
+
+// ===================================================================
+
+class SarInfo_SarSketch::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo_SarSketch>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_relative_accuracy(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sum(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_zero_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_negative_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+SarInfo_SarSketch::SarInfo_SarSketch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo.SarSketch)
+}
+SarInfo_SarSketch::SarInfo_SarSketch(const SarInfo_SarSketch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo_SarSketch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.counts_){from._impl_.counts_}
+    , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.negative_counts_){from._impl_.negative_counts_}
+    , /*decltype(_impl_._negative_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.relative_accuracy_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.zero_count_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.negative_offset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.relative_accuracy_, &from._impl_.relative_accuracy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.negative_offset_) -
+    reinterpret_cast<char*>(&_impl_.relative_accuracy_)) + sizeof(_impl_.negative_offset_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo.SarSketch)
+}
+
+inline void SarInfo_SarSketch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.counts_){arena}
+    , /*decltype(_impl_._counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.negative_counts_){arena}
+    , /*decltype(_impl_._negative_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.relative_accuracy_){0}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.sum_){0}
+    , decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+    , decltype(_impl_.zero_count_){uint64_t{0u}}
+    , decltype(_impl_.offset_){0}
+    , decltype(_impl_.negative_offset_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SarInfo_SarSketch::~SarInfo_SarSketch() {
+  // @@protoc_insertion_point(destructor:SarInfo.SarSketch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo_SarSketch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.counts_.~RepeatedField();
+  _impl_.negative_counts_.~RepeatedField();
+  _impl_.name_.Destroy();
+}
+
+void SarInfo_SarSketch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo_SarSketch::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo.SarSketch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.counts_.Clear();
+  _impl_.negative_counts_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.relative_accuracy_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.offset_) -
+        reinterpret_cast<char*>(&_impl_.relative_accuracy_)) + sizeof(_impl_.offset_));
+  }
+  _impl_.negative_offset_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo_SarSketch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "SarInfo.SarSketch.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double relative_accuracy = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_relative_accuracy(&has_bits);
+          _impl_.relative_accuracy_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double sum = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_sum(&has_bits);
+          _impl_.sum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double min = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_min(&has_bits);
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double max = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_max(&has_bits);
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 zero_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_zero_count(&has_bits);
+          _impl_.zero_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 offset = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 counts = 9 [packed = true];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 negative_offset = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_negative_offset(&has_bits);
+          _impl_.negative_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 negative_counts = 11 [packed = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_negative_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 88) {
+          _internal_add_negative_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo_SarSketch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo.SarSketch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "SarInfo.SarSketch.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional double relative_accuracy = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_relative_accuracy(), target);
+  }
+
+  // optional uint64 count = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_count(), target);
+  }
+
+  // optional double sum = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_sum(), target);
+  }
+
+  // optional double min = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_min(), target);
+  }
+
+  // optional double max = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_max(), target);
+  }
+
+  // optional uint64 zero_count = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_zero_count(), target);
+  }
+
+  // optional sint32 offset = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(8, this->_internal_offset(), target);
+  }
+
+  // repeated uint64 counts = 9 [packed = true];
+  {
+    int byte_size = _impl_._counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          9, _internal_counts(), byte_size, target);
+    }
+  }
+
+  // optional sint32 negative_offset = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(10, this->_internal_negative_offset(), target);
+  }
+
+  // repeated uint64 negative_counts = 11 [packed = true];
+  {
+    int byte_size = _impl_._negative_counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          11, _internal_negative_counts(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo.SarSketch)
+  return target;
+}
+
+size_t SarInfo_SarSketch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo.SarSketch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 counts = 9 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 negative_counts = 11 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.negative_counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._negative_counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional double relative_accuracy = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint64 count = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+    }
+
+    // optional double sum = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double min = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double max = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint64 zero_count = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_zero_count());
+    }
+
+    // optional sint32 offset = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_offset());
+    }
+
+  }
+  // optional sint32 negative_offset = 10;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_negative_offset());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo_SarSketch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo_SarSketch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo_SarSketch::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo_SarSketch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo_SarSketch*>(&to_msg);
+  auto& from = static_cast<const SarInfo_SarSketch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo.SarSketch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.counts_.MergeFrom(from._impl_.counts_);
+  _this->_impl_.negative_counts_.MergeFrom(from._impl_.negative_counts_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.relative_accuracy_ = from._impl_.relative_accuracy_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sum_ = from._impl_.sum_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.min_ = from._impl_.min_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.max_ = from._impl_.max_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.zero_count_ = from._impl_.zero_count_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_negative_offset(from._internal_negative_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo_SarSketch::CopyFrom(const SarInfo_SarSketch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo.SarSketch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo_SarSketch::IsInitialized() const {
+  return true;
+}
+
+void SarInfo_SarSketch::InternalSwap(SarInfo_SarSketch* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.counts_.InternalSwap(&other->_impl_.counts_);
+  _impl_.negative_counts_.InternalSwap(&other->_impl_.negative_counts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo_SarSketch, _impl_.negative_offset_)
+      + sizeof(SarInfo_SarSketch::_impl_.negative_offset_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo_SarSketch, _impl_.relative_accuracy_)>(
+          reinterpret_cast<char*>(&_impl_.relative_accuracy_),
+          reinterpret_cast<char*>(&other->_impl_.relative_accuracy_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo_SarSketch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[12]);
+}
+
+// ===================================================================
+
+class SarInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SarInfo>()._impl_._has_bits_);
+  static void set_has_rxpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_txpck(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_rxbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_txbyt(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_rxcmp(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_txcmp(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_rxmcst(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_rxerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_txerr(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_coll(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_rxdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_txdrop(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_txcarr(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_rxfram(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_rxfifo(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_txfifo(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_nr_processes(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_cpu_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_cpu_nice(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_cpu_system(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_cpu_iowait(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_cpu_steal(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+  static void set_has_cpu_idle(HasBits* has_bits) {
+    (*has_bits)[0] |= 67108864u;
+  }
+  static void set_has_pgpgin(HasBits* has_bits) {
+    (*has_bits)[0] |= 134217728u;
+  }
+  static void set_has_pgpgout(HasBits* has_bits) {
+    (*has_bits)[0] |= 268435456u;
+  }
+  static void set_has_pgfault(HasBits* has_bits) {
+    (*has_bits)[0] |= 536870912u;
+  }
+  static void set_has_pgmajfault(HasBits* has_bits) {
+    (*has_bits)[0] |= 1073741824u;
+  }
+  static void set_has_pswpin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2147483648u;
+  }
+  static void set_has_pswpout(HasBits* has_bits) {
+    (*has_bits)[1] |= 1u;
+  }
+  static void set_has_tps(HasBits* has_bits) {
+    (*has_bits)[1] |= 2u;
+  }
+  static void set_has_rtps(HasBits* has_bits) {
+    (*has_bits)[1] |= 4u;
+  }
+  static void set_has_wtps(HasBits* has_bits) {
+    (*has_bits)[1] |= 8u;
+  }
+  static void set_has_bread(HasBits* has_bits) {
+    (*has_bits)[1] |= 16u;
+  }
+  static void set_has_bwrtn(HasBits* has_bits) {
+    (*has_bits)[1] |= 32u;
+  }
+  static void set_has_frmpg(HasBits* has_bits) {
+    (*has_bits)[1] |= 64u;
+  }
+  static void set_has_bufpg(HasBits* has_bits) {
+    (*has_bits)[1] |= 128u;
+  }
+  static void set_has_campg(HasBits* has_bits) {
+    (*has_bits)[1] |= 256u;
+  }
+  static const ::SarInfo_SarNetProtoInfo& net_proto(const SarInfo* msg);
+  static void set_has_net_proto(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_softnet_processed(HasBits* has_bits) {
+    (*has_bits)[1] |= 512u;
+  }
+  static void set_has_softnet_dropped(HasBits* has_bits) {
+    (*has_bits)[1] |= 1024u;
+  }
+  static void set_has_softnet_time_squeeze(HasBits* has_bits) {
+    (*has_bits)[1] |= 2048u;
+  }
+  static void set_has_softnet_squeezed_cpus(HasBits* has_bits) {
+    (*has_bits)[1] |= 8192u;
+  }
+  static void set_has_sched_run_delay(HasBits* has_bits) {
+    (*has_bits)[1] |= 4096u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_cpu(const SarInfo* msg);
+  static void set_has_psi_cpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_memory(const SarInfo* msg);
+  static void set_has_psi_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::SarInfo_SarPsiInfo& psi_io(const SarInfo* msg);
+  static void set_has_psi_io(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::SarInfo_SarNetProtoInfo&
+SarInfo::_Internal::net_proto(const SarInfo* msg) {
+  return *msg->_impl_.net_proto_;
+}
+const ::SarInfo_SarPsiInfo&
+SarInfo::_Internal::psi_cpu(const SarInfo* msg) {
+  return *msg->_impl_.psi_cpu_;
+}
+const ::SarInfo_SarPsiInfo&
+SarInfo::_Internal::psi_memory(const SarInfo* msg) {
+  return *msg->_impl_.psi_memory_;
+}
+const ::SarInfo_SarPsiInfo&
+SarInfo::_Internal::psi_io(const SarInfo* msg) {
+  return *msg->_impl_.psi_io_;
+}
+SarInfo::SarInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SarInfo)
+}
+SarInfo::SarInfo(const SarInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SarInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sar_disk_info_){from._impl_.sar_disk_info_}
+    , decltype(_impl_.sar_cpu_info_){from._impl_.sar_cpu_info_}
+    , decltype(_impl_.sar_task_sched_info_){from._impl_.sar_task_sched_info_}
+    , decltype(_impl_.sar_cgroup_info_){from._impl_.sar_cgroup_info_}
+    , decltype(_impl_.sar_process_info_){from._impl_.sar_process_info_}
+    , decltype(_impl_.sar_netns_info_){from._impl_.sar_netns_info_}
+    , decltype(_impl_.sar_fs_info_){from._impl_.sar_fs_info_}
+    , decltype(_impl_.sar_core_info_){from._impl_.sar_core_info_}
+    , decltype(_impl_.sar_socket_info_){from._impl_.sar_socket_info_}
+    , decltype(_impl_.sar_node_info_){from._impl_.sar_node_info_}
+    , decltype(_impl_.sar_sketch_){from._impl_.sar_sketch_}
+    , decltype(_impl_.net_proto_){nullptr}
+    , decltype(_impl_.psi_cpu_){nullptr}
+    , decltype(_impl_.psi_memory_){nullptr}
+    , decltype(_impl_.psi_io_){nullptr}
+    , decltype(_impl_.rxpck_){}
+    , decltype(_impl_.txpck_){}
+    , decltype(_impl_.rxbyt_){}
+    , decltype(_impl_.txbyt_){}
+    , decltype(_impl_.rxcmp_){}
+    , decltype(_impl_.txcmp_){}
+    , decltype(_impl_.rxmcst_){}
+    , decltype(_impl_.rxerr_){}
+    , decltype(_impl_.txerr_){}
+    , decltype(_impl_.coll_){}
+    , decltype(_impl_.rxdrop_){}
+    , decltype(_impl_.txdrop_){}
+    , decltype(_impl_.txcarr_){}
+    , decltype(_impl_.rxfram_){}
+    , decltype(_impl_.rxfifo_){}
+    , decltype(_impl_.txfifo_){}
+    , decltype(_impl_.nr_processes_){}
+    , decltype(_impl_.cpu_user_){}
+    , decltype(_impl_.cpu_nice_){}
+    , decltype(_impl_.cpu_system_){}
+    , decltype(_impl_.cpu_iowait_){}
+    , decltype(_impl_.cpu_steal_){}
+    , decltype(_impl_.cpu_idle_){}
+    , decltype(_impl_.pgpgin_){}
+    , decltype(_impl_.pgpgout_){}
+    , decltype(_impl_.pgfault_){}
+    , decltype(_impl_.pgmajfault_){}
+    , decltype(_impl_.pswpin_){}
+    , decltype(_impl_.pswpout_){}
+    , decltype(_impl_.tps_){}
+    , decltype(_impl_.rtps_){}
+    , decltype(_impl_.wtps_){}
+    , decltype(_impl_.bread_){}
+    , decltype(_impl_.bwrtn_){}
+    , decltype(_impl_.frmpg_){}
+    , decltype(_impl_.bufpg_){}
+    , decltype(_impl_.campg_){}
+    , decltype(_impl_.softnet_processed_){}
+    , decltype(_impl_.softnet_dropped_){}
+    , decltype(_impl_.softnet_time_squeeze_){}
+    , decltype(_impl_.sched_run_delay_){}
+    , decltype(_impl_.softnet_squeezed_cpus_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_net_proto()) {
+    _this->_impl_.net_proto_ = new ::SarInfo_SarNetProtoInfo(*from._impl_.net_proto_);
+  }
+  if (from._internal_has_psi_cpu()) {
+    _this->_impl_.psi_cpu_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_cpu_);
+  }
+  if (from._internal_has_psi_memory()) {
+    _this->_impl_.psi_memory_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_memory_);
+  }
+  if (from._internal_has_psi_io()) {
+    _this->_impl_.psi_io_ = new ::SarInfo_SarPsiInfo(*from._impl_.psi_io_);
+  }
+  ::memcpy(&_impl_.rxpck_, &from._impl_.rxpck_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.softnet_squeezed_cpus_) -
+    reinterpret_cast<char*>(&_impl_.rxpck_)) + sizeof(_impl_.softnet_squeezed_cpus_));
+  // @@protoc_insertion_point(copy_constructor:SarInfo)
+}
+
+inline void SarInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sar_disk_info_){arena}
+    , decltype(_impl_.sar_cpu_info_){arena}
+    , decltype(_impl_.sar_task_sched_info_){arena}
+    , decltype(_impl_.sar_cgroup_info_){arena}
+    , decltype(_impl_.sar_process_info_){arena}
+    , decltype(_impl_.sar_netns_info_){arena}
+    , decltype(_impl_.sar_fs_info_){arena}
+    , decltype(_impl_.sar_core_info_){arena}
+    , decltype(_impl_.sar_socket_info_){arena}
+    , decltype(_impl_.sar_node_info_){arena}
+    , decltype(_impl_.sar_sketch_){arena}
+    , decltype(_impl_.net_proto_){nullptr}
+    , decltype(_impl_.psi_cpu_){nullptr}
+    , decltype(_impl_.psi_memory_){nullptr}
+    , decltype(_impl_.psi_io_){nullptr}
+    , decltype(_impl_.rxpck_){0}
+    , decltype(_impl_.txpck_){0}
+    , decltype(_impl_.rxbyt_){0}
+    , decltype(_impl_.txbyt_){0}
+    , decltype(_impl_.rxcmp_){0}
+    , decltype(_impl_.txcmp_){0}
+    , decltype(_impl_.rxmcst_){0}
+    , decltype(_impl_.rxerr_){0}
+    , decltype(_impl_.txerr_){0}
+    , decltype(_impl_.coll_){0}
+    , decltype(_impl_.rxdrop_){0}
+    , decltype(_impl_.txdrop_){0}
+    , decltype(_impl_.txcarr_){0}
+    , decltype(_impl_.rxfram_){0}
+    , decltype(_impl_.rxfifo_){0}
+    , decltype(_impl_.txfifo_){0}
+    , decltype(_impl_.nr_processes_){0}
+    , decltype(_impl_.cpu_user_){0}
+    , decltype(_impl_.cpu_nice_){0}
+    , decltype(_impl_.cpu_system_){0}
+    , decltype(_impl_.cpu_iowait_){0}
+    , decltype(_impl_.cpu_steal_){0}
+    , decltype(_impl_.cpu_idle_){0}
+    , decltype(_impl_.pgpgin_){0}
+    , decltype(_impl_.pgpgout_){0}
+    , decltype(_impl_.pgfault_){0}
+    , decltype(_impl_.pgmajfault_){0}
+    , decltype(_impl_.pswpin_){0}
+    , decltype(_impl_.pswpout_){0}
+    , decltype(_impl_.tps_){0}
+    , decltype(_impl_.rtps_){0}
+    , decltype(_impl_.wtps_){0}
+    , decltype(_impl_.bread_){0}
+    , decltype(_impl_.bwrtn_){0}
+    , decltype(_impl_.frmpg_){0}
+    , decltype(_impl_.bufpg_){0}
+    , decltype(_impl_.campg_){0}
+    , decltype(_impl_.softnet_processed_){0}
+    , decltype(_impl_.softnet_dropped_){0}
+    , decltype(_impl_.softnet_time_squeeze_){0}
+    , decltype(_impl_.sched_run_delay_){0}
+    , decltype(_impl_.softnet_squeezed_cpus_){0}
+  };
+}
+
+SarInfo::~SarInfo() {
+  // @@protoc_insertion_point(destructor:SarInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SarInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sar_disk_info_.~RepeatedPtrField();
+  _impl_.sar_cpu_info_.~RepeatedPtrField();
+  _impl_.sar_task_sched_info_.~RepeatedPtrField();
+  _impl_.sar_cgroup_info_.~RepeatedPtrField();
+  _impl_.sar_process_info_.~RepeatedPtrField();
+  _impl_.sar_netns_info_.~RepeatedPtrField();
+  _impl_.sar_fs_info_.~RepeatedPtrField();
+  _impl_.sar_core_info_.~RepeatedPtrField();
+  _impl_.sar_socket_info_.~RepeatedPtrField();
+  _impl_.sar_node_info_.~RepeatedPtrField();
+  _impl_.sar_sketch_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.net_proto_;
+  if (this != internal_default_instance()) delete _impl_.psi_cpu_;
+  if (this != internal_default_instance()) delete _impl_.psi_memory_;
+  if (this != internal_default_instance()) delete _impl_.psi_io_;
+}
+
+void SarInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SarInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:SarInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sar_disk_info_.Clear();
+  _impl_.sar_cpu_info_.Clear();
+  _impl_.sar_task_sched_info_.Clear();
+  _impl_.sar_cgroup_info_.Clear();
+  _impl_.sar_process_info_.Clear();
+  _impl_.sar_netns_info_.Clear();
+  _impl_.sar_fs_info_.Clear();
+  _impl_.sar_core_info_.Clear();
+  _impl_.sar_socket_info_.Clear();
+  _impl_.sar_node_info_.Clear();
+  _impl_.sar_sketch_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.net_proto_ != nullptr);
+      _impl_.net_proto_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.psi_cpu_ != nullptr);
+      _impl_.psi_cpu_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.psi_memory_ != nullptr);
+      _impl_.psi_memory_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.psi_io_ != nullptr);
+      _impl_.psi_io_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.rxpck_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.txbyt_) -
+        reinterpret_cast<char*>(&_impl_.rxpck_)) + sizeof(_impl_.txbyt_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.rxcmp_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.txdrop_) -
+        reinterpret_cast<char*>(&_impl_.rxcmp_)) + sizeof(_impl_.txdrop_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&_impl_.txcarr_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cpu_system_) -
+        reinterpret_cast<char*>(&_impl_.txcarr_)) + sizeof(_impl_.cpu_system_));
+  }
+  if (cached_has_bits & 0xff000000u) {
+    ::memset(&_impl_.cpu_iowait_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pswpin_) -
+        reinterpret_cast<char*>(&_impl_.cpu_iowait_)) + sizeof(_impl_.pswpin_));
+  }
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.pswpout_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bufpg_) -
+        reinterpret_cast<char*>(&_impl_.pswpout_)) + sizeof(_impl_.bufpg_));
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    ::memset(&_impl_.campg_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.softnet_squeezed_cpus_) -
+        reinterpret_cast<char*>(&_impl_.campg_)) + sizeof(_impl_.softnet_squeezed_cpus_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SarInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double rxpck = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_rxpck(&_impl_._has_bits_);
+          _impl_.rxpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txpck = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_txpck(&_impl_._has_bits_);
+          _impl_.txpck_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxbyt = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_rxbyt(&_impl_._has_bits_);
+          _impl_.rxbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txbyt = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_txbyt(&_impl_._has_bits_);
+          _impl_.txbyt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxcmp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_rxcmp(&_impl_._has_bits_);
+          _impl_.rxcmp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txcmp = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_txcmp(&_impl_._has_bits_);
+          _impl_.txcmp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxmcst = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_rxmcst(&_impl_._has_bits_);
+          _impl_.rxmcst_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxerr = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_rxerr(&_impl_._has_bits_);
+          _impl_.rxerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txerr = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_txerr(&_impl_._has_bits_);
+          _impl_.txerr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double coll = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_coll(&_impl_._has_bits_);
+          _impl_.coll_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxdrop = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_rxdrop(&_impl_._has_bits_);
+          _impl_.rxdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txdrop = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_txdrop(&_impl_._has_bits_);
+          _impl_.txdrop_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txcarr = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_txcarr(&_impl_._has_bits_);
+          _impl_.txcarr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxfram = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_rxfram(&_impl_._has_bits_);
+          _impl_.rxfram_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rxfifo = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_rxfifo(&_impl_._has_bits_);
+          _impl_.rxfifo_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double txfifo = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_txfifo(&_impl_._has_bits_);
+          _impl_.txfifo_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double nr_processes = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_nr_processes(&_impl_._has_bits_);
+          _impl_.nr_processes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_user = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 145)) {
+          _Internal::set_has_cpu_user(&_impl_._has_bits_);
+          _impl_.cpu_user_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_nice = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 153)) {
+          _Internal::set_has_cpu_nice(&_impl_._has_bits_);
+          _impl_.cpu_nice_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_system = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 161)) {
+          _Internal::set_has_cpu_system(&_impl_._has_bits_);
+          _impl_.cpu_system_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_iowait = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 169)) {
+          _Internal::set_has_cpu_iowait(&_impl_._has_bits_);
+          _impl_.cpu_iowait_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_steal = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _Internal::set_has_cpu_steal(&_impl_._has_bits_);
+          _impl_.cpu_steal_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double cpu_idle = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
+          _Internal::set_has_cpu_idle(&_impl_._has_bits_);
+          _impl_.cpu_idle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgpgin = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 193)) {
+          _Internal::set_has_pgpgin(&_impl_._has_bits_);
+          _impl_.pgpgin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgpgout = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 201)) {
+          _Internal::set_has_pgpgout(&_impl_._has_bits_);
+          _impl_.pgpgout_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgfault = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
+          _Internal::set_has_pgfault(&_impl_._has_bits_);
+          _impl_.pgfault_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pgmajfault = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 217)) {
+          _Internal::set_has_pgmajfault(&_impl_._has_bits_);
+          _impl_.pgmajfault_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pswpin = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 225)) {
+          _Internal::set_has_pswpin(&_impl_._has_bits_);
+          _impl_.pswpin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pswpout = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 233)) {
+          _Internal::set_has_pswpout(&_impl_._has_bits_);
+          _impl_.pswpout_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double tps = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 241)) {
+          _Internal::set_has_tps(&_impl_._has_bits_);
+          _impl_.tps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rtps = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 249)) {
+          _Internal::set_has_rtps(&_impl_._has_bits_);
+          _impl_.rtps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double wtps = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 1)) {
+          _Internal::set_has_wtps(&_impl_._has_bits_);
+          _impl_.wtps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double bread = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_bread(&_impl_._has_bits_);
+          _impl_.bread_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double bwrtn = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_bwrtn(&_impl_._has_bits_);
+          _impl_.bwrtn_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double frmpg = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_frmpg(&_impl_._has_bits_);
+          _impl_.frmpg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double bufpg = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_bufpg(&_impl_._has_bits_);
+          _impl_.bufpg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double campg = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_campg(&_impl_._has_bits_);
+          _impl_.campg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarDiskInfo sar_disk_info = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_disk_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<306>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarNetProtoInfo net_proto = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_net_proto(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarCpuInfo sar_cpu_info = 40;
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_cpu_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<322>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_processed = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_softnet_processed(&_impl_._has_bits_);
+          _impl_.softnet_processed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_dropped = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_softnet_dropped(&_impl_._has_bits_);
+          _impl_.softnet_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double softnet_time_squeeze = 43;
+      case 43:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_softnet_time_squeeze(&_impl_._has_bits_);
+          _impl_.softnet_time_squeeze_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 softnet_squeezed_cpus = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_softnet_squeezed_cpus(&_impl_._has_bits_);
+          _impl_.softnet_squeezed_cpus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double sched_run_delay = 45;
+      case 45:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_sched_run_delay(&_impl_._has_bits_);
+          _impl_.sched_run_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarTaskSchedInfo sar_task_sched_info = 46;
+      case 46:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_task_sched_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<370>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_cpu = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_cpu(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_memory = 48;
+      case 48:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_memory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .SarInfo.SarPsiInfo psi_io = 49;
+      case 49:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psi_io(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarCgroupInfo sar_cgroup_info = 50;
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_cgroup_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<402>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarProcessInfo sar_process_info = 51;
+      case 51:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_process_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<410>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarNetnsInfo sar_netns_info = 52;
+      case 52:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_netns_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<418>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarFsInfo sar_fs_info = 53;
+      case 53:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_fs_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<426>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarCpuGroupInfo sar_core_info = 54;
+      case 54:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_core_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<434>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarCpuGroupInfo sar_socket_info = 55;
+      case 55:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_socket_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<442>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarNodeInfo sar_node_info = 56;
+      case 56:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_node_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<450>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SarInfo.SarSketch sar_sketch = 57;
+      case 57:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_sar_sketch(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<458>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SarInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SarInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double rxpck = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_rxpck(), target);
+  }
+
+  // optional double txpck = 2;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_txpck(), target);
+  }
+
+  // optional double rxbyt = 3;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_rxbyt(), target);
+  }
+
+  // optional double txbyt = 4;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_txbyt(), target);
+  }
+
+  // optional double rxcmp = 5;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_rxcmp(), target);
+  }
+
+  // optional double txcmp = 6;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_txcmp(), target);
+  }
+
+  // optional double rxmcst = 7;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_rxmcst(), target);
+  }
+
+  // optional double rxerr = 8;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_rxerr(), target);
+  }
+
+  // optional double txerr = 9;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_txerr(), target);
+  }
+
+  // optional double coll = 10;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_coll(), target);
+  }
+
+  // optional double rxdrop = 11;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_rxdrop(), target);
+  }
+
+  // optional double txdrop = 12;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_txdrop(), target);
+  }
+
+  // optional double txcarr = 13;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_txcarr(), target);
+  }
+
+  // optional double rxfram = 14;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_rxfram(), target);
+  }
+
+  // optional double rxfifo = 15;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_rxfifo(), target);
+  }
+
+  // optional double txfifo = 16;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_txfifo(), target);
+  }
+
+  // optional double nr_processes = 17;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(17, this->_internal_nr_processes(), target);
+  }
+
+  // optional double cpu_user = 18;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(18, this->_internal_cpu_user(), target);
+  }
+
+  // optional double cpu_nice = 19;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(19, this->_internal_cpu_nice(), target);
+  }
+
+  // optional double cpu_system = 20;
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(20, this->_internal_cpu_system(), target);
+  }
+
+  // optional double cpu_iowait = 21;
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(21, this->_internal_cpu_iowait(), target);
+  }
+
+  // optional double cpu_steal = 22;
+  if (cached_has_bits & 0x02000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_cpu_steal(), target);
+  }
+
+  // optional double cpu_idle = 23;
+  if (cached_has_bits & 0x04000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(23, this->_internal_cpu_idle(), target);
+  }
+
+  // optional double pgpgin = 24;
+  if (cached_has_bits & 0x08000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(24, this->_internal_pgpgin(), target);
+  }
+
+  // optional double pgpgout = 25;
+  if (cached_has_bits & 0x10000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(25, this->_internal_pgpgout(), target);
+  }
+
+  // optional double pgfault = 26;
+  if (cached_has_bits & 0x20000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_pgfault(), target);
+  }
+
+  // optional double pgmajfault = 27;
+  if (cached_has_bits & 0x40000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(27, this->_internal_pgmajfault(), target);
+  }
+
+  // optional double pswpin = 28;
+  if (cached_has_bits & 0x80000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(28, this->_internal_pswpin(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional double pswpout = 29;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(29, this->_internal_pswpout(), target);
+  }
+
+  // optional double tps = 30;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(30, this->_internal_tps(), target);
+  }
+
+  // optional double rtps = 31;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(31, this->_internal_rtps(), target);
+  }
+
+  // optional double wtps = 32;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(32, this->_internal_wtps(), target);
+  }
+
+  // optional double bread = 33;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(33, this->_internal_bread(), target);
+  }
+
+  // optional double bwrtn = 34;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(34, this->_internal_bwrtn(), target);
+  }
+
+  // optional double frmpg = 35;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(35, this->_internal_frmpg(), target);
+  }
+
+  // optional double bufpg = 36;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(36, this->_internal_bufpg(), target);
+  }
+
+  // optional double campg = 37;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(37, this->_internal_campg(), target);
+  }
+
+  // repeated .SarInfo.SarDiskInfo sar_disk_info = 38;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_disk_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_disk_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(38, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .SarInfo.SarNetProtoInfo net_proto = 39;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(39, _Internal::net_proto(this),
+        _Internal::net_proto(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarCpuInfo sar_cpu_info = 40;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_cpu_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_cpu_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(40, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional double softnet_processed = 41;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(41, this->_internal_softnet_processed(), target);
+  }
+
+  // optional double softnet_dropped = 42;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(42, this->_internal_softnet_dropped(), target);
+  }
+
+  // optional double softnet_time_squeeze = 43;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(43, this->_internal_softnet_time_squeeze(), target);
+  }
+
+  // optional int32 softnet_squeezed_cpus = 44;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(44, this->_internal_softnet_squeezed_cpus(), target);
+  }
+
+  // optional double sched_run_delay = 45;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(45, this->_internal_sched_run_delay(), target);
+  }
+
+  // repeated .SarInfo.SarTaskSchedInfo sar_task_sched_info = 46;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_task_sched_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_task_sched_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(46, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .SarInfo.SarPsiInfo psi_cpu = 47;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(47, _Internal::psi_cpu(this),
+        _Internal::psi_cpu(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .SarInfo.SarPsiInfo psi_memory = 48;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(48, _Internal::psi_memory(this),
+        _Internal::psi_memory(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .SarInfo.SarPsiInfo psi_io = 49;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(49, _Internal::psi_io(this),
+        _Internal::psi_io(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarCgroupInfo sar_cgroup_info = 50;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_cgroup_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_cgroup_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(50, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarProcessInfo sar_process_info = 51;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_process_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_process_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(51, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarNetnsInfo sar_netns_info = 52;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_netns_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_netns_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(52, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarFsInfo sar_fs_info = 53;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_fs_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_fs_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(53, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_core_info = 54;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_core_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_core_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(54, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_socket_info = 55;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_socket_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_socket_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(55, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarNodeInfo sar_node_info = 56;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_node_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_node_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(56, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SarInfo.SarSketch sar_sketch = 57;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sar_sketch_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sar_sketch(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(57, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SarInfo)
+  return target;
+}
+
+size_t SarInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SarInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SarInfo.SarDiskInfo sar_disk_info = 38;
+  total_size += 2UL * this->_internal_sar_disk_info_size();
+  for (const auto& msg : this->_impl_.sar_disk_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarCpuInfo sar_cpu_info = 40;
+  total_size += 2UL * this->_internal_sar_cpu_info_size();
+  for (const auto& msg : this->_impl_.sar_cpu_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarTaskSchedInfo sar_task_sched_info = 46;
+  total_size += 2UL * this->_internal_sar_task_sched_info_size();
+  for (const auto& msg : this->_impl_.sar_task_sched_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarCgroupInfo sar_cgroup_info = 50;
+  total_size += 2UL * this->_internal_sar_cgroup_info_size();
+  for (const auto& msg : this->_impl_.sar_cgroup_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarProcessInfo sar_process_info = 51;
+  total_size += 2UL * this->_internal_sar_process_info_size();
+  for (const auto& msg : this->_impl_.sar_process_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarNetnsInfo sar_netns_info = 52;
+  total_size += 2UL * this->_internal_sar_netns_info_size();
+  for (const auto& msg : this->_impl_.sar_netns_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarFsInfo sar_fs_info = 53;
+  total_size += 2UL * this->_internal_sar_fs_info_size();
+  for (const auto& msg : this->_impl_.sar_fs_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_core_info = 54;
+  total_size += 2UL * this->_internal_sar_core_info_size();
+  for (const auto& msg : this->_impl_.sar_core_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_socket_info = 55;
+  total_size += 2UL * this->_internal_sar_socket_info_size();
+  for (const auto& msg : this->_impl_.sar_socket_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarNodeInfo sar_node_info = 56;
+  total_size += 2UL * this->_internal_sar_node_info_size();
+  for (const auto& msg : this->_impl_.sar_node_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SarInfo.SarSketch sar_sketch = 57;
+  total_size += 2UL * this->_internal_sar_sketch_size();
+  for (const auto& msg : this->_impl_.sar_sketch_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .SarInfo.SarNetProtoInfo net_proto = 39;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.net_proto_);
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_cpu = 47;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_cpu_);
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_memory = 48;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_memory_);
+    }
+
+    // optional .SarInfo.SarPsiInfo psi_io = 49;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psi_io_);
+    }
+
+    // optional double rxpck = 1;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txpck = 2;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxbyt = 3;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txbyt = 4;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double rxcmp = 5;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txcmp = 6;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxmcst = 7;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxerr = 8;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txerr = 9;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double coll = 10;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxdrop = 11;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txdrop = 12;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional double txcarr = 13;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxfram = 14;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rxfifo = 15;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double txfifo = 16;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double nr_processes = 17;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double cpu_user = 18;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double cpu_nice = 19;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double cpu_system = 20;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0xff000000u) {
+    // optional double cpu_iowait = 21;
+    if (cached_has_bits & 0x01000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double cpu_steal = 22;
+    if (cached_has_bits & 0x02000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double cpu_idle = 23;
+    if (cached_has_bits & 0x04000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double pgpgin = 24;
+    if (cached_has_bits & 0x08000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double pgpgout = 25;
+    if (cached_has_bits & 0x10000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double pgfault = 26;
+    if (cached_has_bits & 0x20000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double pgmajfault = 27;
+    if (cached_has_bits & 0x40000000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double pswpin = 28;
+    if (cached_has_bits & 0x80000000u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double pswpout = 29;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double tps = 30;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double rtps = 31;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double wtps = 32;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double bread = 33;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double bwrtn = 34;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double frmpg = 35;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double bufpg = 36;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    // optional double campg = 37;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double softnet_processed = 41;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double softnet_dropped = 42;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double softnet_time_squeeze = 43;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double sched_run_delay = 45;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional int32 softnet_squeezed_cpus = 44;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_softnet_squeezed_cpus());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SarInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SarInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SarInfo::GetClassData() const { return &_class_data_; }
+
+
+void SarInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SarInfo*>(&to_msg);
+  auto& from = static_cast<const SarInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SarInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sar_disk_info_.MergeFrom(from._impl_.sar_disk_info_);
+  _this->_impl_.sar_cpu_info_.MergeFrom(from._impl_.sar_cpu_info_);
+  _this->_impl_.sar_task_sched_info_.MergeFrom(from._impl_.sar_task_sched_info_);
+  _this->_impl_.sar_cgroup_info_.MergeFrom(from._impl_.sar_cgroup_info_);
+  _this->_impl_.sar_process_info_.MergeFrom(from._impl_.sar_process_info_);
+  _this->_impl_.sar_netns_info_.MergeFrom(from._impl_.sar_netns_info_);
+  _this->_impl_.sar_fs_info_.MergeFrom(from._impl_.sar_fs_info_);
+  _this->_impl_.sar_core_info_.MergeFrom(from._impl_.sar_core_info_);
+  _this->_impl_.sar_socket_info_.MergeFrom(from._impl_.sar_socket_info_);
+  _this->_impl_.sar_node_info_.MergeFrom(from._impl_.sar_node_info_);
+  _this->_impl_.sar_sketch_.MergeFrom(from._impl_.sar_sketch_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_net_proto()->::SarInfo_SarNetProtoInfo::MergeFrom(
+          from._internal_net_proto());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_psi_cpu()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_cpu());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_psi_memory()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_memory());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_psi_io()->::SarInfo_SarPsiInfo::MergeFrom(
+          from._internal_psi_io());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.rxpck_ = from._impl_.rxpck_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.txpck_ = from._impl_.txpck_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.rxbyt_ = from._impl_.rxbyt_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.txbyt_ = from._impl_.txbyt_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.rxcmp_ = from._impl_.rxcmp_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.txcmp_ = from._impl_.txcmp_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.rxmcst_ = from._impl_.rxmcst_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.rxerr_ = from._impl_.rxerr_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.txerr_ = from._impl_.txerr_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.coll_ = from._impl_.coll_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.rxdrop_ = from._impl_.rxdrop_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.txdrop_ = from._impl_.txdrop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.txcarr_ = from._impl_.txcarr_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.rxfram_ = from._impl_.rxfram_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.rxfifo_ = from._impl_.rxfifo_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.txfifo_ = from._impl_.txfifo_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.nr_processes_ = from._impl_.nr_processes_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.cpu_user_ = from._impl_.cpu_user_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.cpu_nice_ = from._impl_.cpu_nice_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.cpu_system_ = from._impl_.cpu_system_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0xff000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      _this->_impl_.cpu_iowait_ = from._impl_.cpu_iowait_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      _this->_impl_.cpu_steal_ = from._impl_.cpu_steal_;
+    }
+    if (cached_has_bits & 0x04000000u) {
+      _this->_impl_.cpu_idle_ = from._impl_.cpu_idle_;
+    }
+    if (cached_has_bits & 0x08000000u) {
+      _this->_impl_.pgpgin_ = from._impl_.pgpgin_;
+    }
+    if (cached_has_bits & 0x10000000u) {
+      _this->_impl_.pgpgout_ = from._impl_.pgpgout_;
+    }
+    if (cached_has_bits & 0x20000000u) {
+      _this->_impl_.pgfault_ = from._impl_.pgfault_;
+    }
+    if (cached_has_bits & 0x40000000u) {
+      _this->_impl_.pgmajfault_ = from._impl_.pgmajfault_;
+    }
+    if (cached_has_bits & 0x80000000u) {
+      _this->_impl_.pswpin_ = from._impl_.pswpin_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  cached_has_bits = from._impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.pswpout_ = from._impl_.pswpout_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tps_ = from._impl_.tps_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.rtps_ = from._impl_.rtps_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.wtps_ = from._impl_.wtps_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.bread_ = from._impl_.bread_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.bwrtn_ = from._impl_.bwrtn_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.frmpg_ = from._impl_.frmpg_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.bufpg_ = from._impl_.bufpg_;
+    }
+    _this->_impl_._has_bits_[1] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.campg_ = from._impl_.campg_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.softnet_processed_ = from._impl_.softnet_processed_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.softnet_dropped_ = from._impl_.softnet_dropped_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.softnet_time_squeeze_ = from._impl_.softnet_time_squeeze_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.sched_run_delay_ = from._impl_.sched_run_delay_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.softnet_squeezed_cpus_ = from._impl_.softnet_squeezed_cpus_;
+    }
+    _this->_impl_._has_bits_[1] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SarInfo::CopyFrom(const SarInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SarInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SarInfo::IsInitialized() const {
+  return true;
+}
+
+void SarInfo::InternalSwap(SarInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_._has_bits_[1], other->_impl_._has_bits_[1]);
+  _impl_.sar_disk_info_.InternalSwap(&other->_impl_.sar_disk_info_);
+  _impl_.sar_cpu_info_.InternalSwap(&other->_impl_.sar_cpu_info_);
+  _impl_.sar_task_sched_info_.InternalSwap(&other->_impl_.sar_task_sched_info_);
+  _impl_.sar_cgroup_info_.InternalSwap(&other->_impl_.sar_cgroup_info_);
+  _impl_.sar_process_info_.InternalSwap(&other->_impl_.sar_process_info_);
+  _impl_.sar_netns_info_.InternalSwap(&other->_impl_.sar_netns_info_);
+  _impl_.sar_fs_info_.InternalSwap(&other->_impl_.sar_fs_info_);
+  _impl_.sar_core_info_.InternalSwap(&other->_impl_.sar_core_info_);
+  _impl_.sar_socket_info_.InternalSwap(&other->_impl_.sar_socket_info_);
+  _impl_.sar_node_info_.InternalSwap(&other->_impl_.sar_node_info_);
+  _impl_.sar_sketch_.InternalSwap(&other->_impl_.sar_sketch_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SarInfo, _impl_.softnet_squeezed_cpus_)
+      + sizeof(SarInfo::_impl_.softnet_squeezed_cpus_)
+      - PROTOBUF_FIELD_OFFSET(SarInfo, _impl_.net_proto_)>(
+          reinterpret_cast<char*>(&_impl_.net_proto_),
+          reinterpret_cast<char*>(&other->_impl_.net_proto_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SarInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SarInfo_2eproto_getter, &descriptor_table_SarInfo_2eproto_once,
+      file_level_metadata_SarInfo_2eproto[13]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::SarInfo_SarDiskInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarDiskInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarDiskInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarNetProtoInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarNetProtoInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarNetProtoInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarCpuInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarCpuInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarCpuInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarTaskSchedInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarTaskSchedInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarTaskSchedInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarPsiInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarPsiInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarPsiInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarCgroupInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarCgroupInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarCgroupInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarProcessInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarProcessInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarProcessInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarIfaceInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarIfaceInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarIfaceInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarNetnsInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarNetnsInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarNetnsInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarFsInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarFsInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarFsInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarCpuGroupInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarCpuGroupInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarCpuGroupInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarNodeInfo*
+Arena::CreateMaybeMessage< ::SarInfo_SarNodeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarNodeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo_SarSketch*
+Arena::CreateMaybeMessage< ::SarInfo_SarSketch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo_SarSketch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SarInfo*
+Arena::CreateMaybeMessage< ::SarInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SarInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
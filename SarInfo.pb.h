@@ -0,0 +1,13148 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SarInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SarInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SarInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SarInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SarInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SarInfo_2eproto;
+class SarInfo;
+struct SarInfoDefaultTypeInternal;
+extern SarInfoDefaultTypeInternal _SarInfo_default_instance_;
+class SarInfo_SarCgroupInfo;
+struct SarInfo_SarCgroupInfoDefaultTypeInternal;
+extern SarInfo_SarCgroupInfoDefaultTypeInternal _SarInfo_SarCgroupInfo_default_instance_;
+class SarInfo_SarCpuGroupInfo;
+struct SarInfo_SarCpuGroupInfoDefaultTypeInternal;
+extern SarInfo_SarCpuGroupInfoDefaultTypeInternal _SarInfo_SarCpuGroupInfo_default_instance_;
+class SarInfo_SarCpuInfo;
+struct SarInfo_SarCpuInfoDefaultTypeInternal;
+extern SarInfo_SarCpuInfoDefaultTypeInternal _SarInfo_SarCpuInfo_default_instance_;
+class SarInfo_SarDiskInfo;
+struct SarInfo_SarDiskInfoDefaultTypeInternal;
+extern SarInfo_SarDiskInfoDefaultTypeInternal _SarInfo_SarDiskInfo_default_instance_;
+class SarInfo_SarFsInfo;
+struct SarInfo_SarFsInfoDefaultTypeInternal;
+extern SarInfo_SarFsInfoDefaultTypeInternal _SarInfo_SarFsInfo_default_instance_;
+class SarInfo_SarIfaceInfo;
+struct SarInfo_SarIfaceInfoDefaultTypeInternal;
+extern SarInfo_SarIfaceInfoDefaultTypeInternal _SarInfo_SarIfaceInfo_default_instance_;
+class SarInfo_SarNetProtoInfo;
+struct SarInfo_SarNetProtoInfoDefaultTypeInternal;
+extern SarInfo_SarNetProtoInfoDefaultTypeInternal _SarInfo_SarNetProtoInfo_default_instance_;
+class SarInfo_SarNetnsInfo;
+struct SarInfo_SarNetnsInfoDefaultTypeInternal;
+extern SarInfo_SarNetnsInfoDefaultTypeInternal _SarInfo_SarNetnsInfo_default_instance_;
+class SarInfo_SarNodeInfo;
+struct SarInfo_SarNodeInfoDefaultTypeInternal;
+extern SarInfo_SarNodeInfoDefaultTypeInternal _SarInfo_SarNodeInfo_default_instance_;
+class SarInfo_SarProcessInfo;
+struct SarInfo_SarProcessInfoDefaultTypeInternal;
+extern SarInfo_SarProcessInfoDefaultTypeInternal _SarInfo_SarProcessInfo_default_instance_;
+class SarInfo_SarPsiInfo;
+struct SarInfo_SarPsiInfoDefaultTypeInternal;
+extern SarInfo_SarPsiInfoDefaultTypeInternal _SarInfo_SarPsiInfo_default_instance_;
+class SarInfo_SarSketch;
+struct SarInfo_SarSketchDefaultTypeInternal;
+extern SarInfo_SarSketchDefaultTypeInternal _SarInfo_SarSketch_default_instance_;
+class SarInfo_SarTaskSchedInfo;
+struct SarInfo_SarTaskSchedInfoDefaultTypeInternal;
+extern SarInfo_SarTaskSchedInfoDefaultTypeInternal _SarInfo_SarTaskSchedInfo_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::SarInfo* Arena::CreateMaybeMessage<::SarInfo>(Arena*);
+template<> ::SarInfo_SarCgroupInfo* Arena::CreateMaybeMessage<::SarInfo_SarCgroupInfo>(Arena*);
+template<> ::SarInfo_SarCpuGroupInfo* Arena::CreateMaybeMessage<::SarInfo_SarCpuGroupInfo>(Arena*);
+template<> ::SarInfo_SarCpuInfo* Arena::CreateMaybeMessage<::SarInfo_SarCpuInfo>(Arena*);
+template<> ::SarInfo_SarDiskInfo* Arena::CreateMaybeMessage<::SarInfo_SarDiskInfo>(Arena*);
+template<> ::SarInfo_SarFsInfo* Arena::CreateMaybeMessage<::SarInfo_SarFsInfo>(Arena*);
+template<> ::SarInfo_SarIfaceInfo* Arena::CreateMaybeMessage<::SarInfo_SarIfaceInfo>(Arena*);
+template<> ::SarInfo_SarNetProtoInfo* Arena::CreateMaybeMessage<::SarInfo_SarNetProtoInfo>(Arena*);
+template<> ::SarInfo_SarNetnsInfo* Arena::CreateMaybeMessage<::SarInfo_SarNetnsInfo>(Arena*);
+template<> ::SarInfo_SarNodeInfo* Arena::CreateMaybeMessage<::SarInfo_SarNodeInfo>(Arena*);
+template<> ::SarInfo_SarProcessInfo* Arena::CreateMaybeMessage<::SarInfo_SarProcessInfo>(Arena*);
+template<> ::SarInfo_SarPsiInfo* Arena::CreateMaybeMessage<::SarInfo_SarPsiInfo>(Arena*);
+template<> ::SarInfo_SarSketch* Arena::CreateMaybeMessage<::SarInfo_SarSketch>(Arena*);
+template<> ::SarInfo_SarTaskSchedInfo* Arena::CreateMaybeMessage<::SarInfo_SarTaskSchedInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+// ===================================================================
+
+class SarInfo_SarDiskInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarDiskInfo) */ {
+ public:
+  inline SarInfo_SarDiskInfo() : SarInfo_SarDiskInfo(nullptr) {}
+  ~SarInfo_SarDiskInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarDiskInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarDiskInfo(const SarInfo_SarDiskInfo& from);
+  SarInfo_SarDiskInfo(SarInfo_SarDiskInfo&& from) noexcept
+    : SarInfo_SarDiskInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarDiskInfo& operator=(const SarInfo_SarDiskInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarDiskInfo& operator=(SarInfo_SarDiskInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarDiskInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarDiskInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarDiskInfo*>(
+               &_SarInfo_SarDiskInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SarInfo_SarDiskInfo& a, SarInfo_SarDiskInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarDiskInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarDiskInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarDiskInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarDiskInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarDiskInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarDiskInfo& from) {
+    SarInfo_SarDiskInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarDiskInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarDiskInfo";
+  }
+  protected:
+  explicit SarInfo_SarDiskInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDevNameFieldNumber = 9,
+    kTpsFieldNumber = 1,
+    kRdSecFieldNumber = 2,
+    kWrSecFieldNumber = 3,
+    kAvgrqSzFieldNumber = 4,
+    kAvgquSzFieldNumber = 5,
+    kAwaitFieldNumber = 6,
+    kSvctmFieldNumber = 7,
+    kUtilFieldNumber = 8,
+  };
+  // optional string dev_name = 9;
+  bool has_dev_name() const;
+  private:
+  bool _internal_has_dev_name() const;
+  public:
+  void clear_dev_name();
+  const std::string& dev_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dev_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dev_name();
+  PROTOBUF_NODISCARD std::string* release_dev_name();
+  void set_allocated_dev_name(std::string* dev_name);
+  private:
+  const std::string& _internal_dev_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dev_name(const std::string& value);
+  std::string* _internal_mutable_dev_name();
+  public:
+
+  // optional double tps = 1;
+  bool has_tps() const;
+  private:
+  bool _internal_has_tps() const;
+  public:
+  void clear_tps();
+  double tps() const;
+  void set_tps(double value);
+  private:
+  double _internal_tps() const;
+  void _internal_set_tps(double value);
+  public:
+
+  // optional double rd_sec = 2;
+  bool has_rd_sec() const;
+  private:
+  bool _internal_has_rd_sec() const;
+  public:
+  void clear_rd_sec();
+  double rd_sec() const;
+  void set_rd_sec(double value);
+  private:
+  double _internal_rd_sec() const;
+  void _internal_set_rd_sec(double value);
+  public:
+
+  // optional double wr_sec = 3;
+  bool has_wr_sec() const;
+  private:
+  bool _internal_has_wr_sec() const;
+  public:
+  void clear_wr_sec();
+  double wr_sec() const;
+  void set_wr_sec(double value);
+  private:
+  double _internal_wr_sec() const;
+  void _internal_set_wr_sec(double value);
+  public:
+
+  // optional double avgrq_sz = 4;
+  bool has_avgrq_sz() const;
+  private:
+  bool _internal_has_avgrq_sz() const;
+  public:
+  void clear_avgrq_sz();
+  double avgrq_sz() const;
+  void set_avgrq_sz(double value);
+  private:
+  double _internal_avgrq_sz() const;
+  void _internal_set_avgrq_sz(double value);
+  public:
+
+  // optional double avgqu_sz = 5;
+  bool has_avgqu_sz() const;
+  private:
+  bool _internal_has_avgqu_sz() const;
+  public:
+  void clear_avgqu_sz();
+  double avgqu_sz() const;
+  void set_avgqu_sz(double value);
+  private:
+  double _internal_avgqu_sz() const;
+  void _internal_set_avgqu_sz(double value);
+  public:
+
+  // optional double await = 6;
+  bool has_await() const;
+  private:
+  bool _internal_has_await() const;
+  public:
+  void clear_await();
+  double await() const;
+  void set_await(double value);
+  private:
+  double _internal_await() const;
+  void _internal_set_await(double value);
+  public:
+
+  // optional double svctm = 7;
+  bool has_svctm() const;
+  private:
+  bool _internal_has_svctm() const;
+  public:
+  void clear_svctm();
+  double svctm() const;
+  void set_svctm(double value);
+  private:
+  double _internal_svctm() const;
+  void _internal_set_svctm(double value);
+  public:
+
+  // optional double util = 8;
+  bool has_util() const;
+  private:
+  bool _internal_has_util() const;
+  public:
+  void clear_util();
+  double util() const;
+  void set_util(double value);
+  private:
+  double _internal_util() const;
+  void _internal_set_util(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarDiskInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dev_name_;
+    double tps_;
+    double rd_sec_;
+    double wr_sec_;
+    double avgrq_sz_;
+    double avgqu_sz_;
+    double await_;
+    double svctm_;
+    double util_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarNetProtoInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarNetProtoInfo) */ {
+ public:
+  inline SarInfo_SarNetProtoInfo() : SarInfo_SarNetProtoInfo(nullptr) {}
+  ~SarInfo_SarNetProtoInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarNetProtoInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarNetProtoInfo(const SarInfo_SarNetProtoInfo& from);
+  SarInfo_SarNetProtoInfo(SarInfo_SarNetProtoInfo&& from) noexcept
+    : SarInfo_SarNetProtoInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarNetProtoInfo& operator=(const SarInfo_SarNetProtoInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarNetProtoInfo& operator=(SarInfo_SarNetProtoInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarNetProtoInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarNetProtoInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarNetProtoInfo*>(
+               &_SarInfo_SarNetProtoInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SarInfo_SarNetProtoInfo& a, SarInfo_SarNetProtoInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarNetProtoInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarNetProtoInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarNetProtoInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarNetProtoInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarNetProtoInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarNetProtoInfo& from) {
+    SarInfo_SarNetProtoInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarNetProtoInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarNetProtoInfo";
+  }
+  protected:
+  explicit SarInfo_SarNetProtoInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTcpActiveOpensFieldNumber = 1,
+    kTcpPassiveOpensFieldNumber = 2,
+    kTcpAttemptFailsFieldNumber = 3,
+    kTcpEstabResetsFieldNumber = 4,
+    kTcpInSegsFieldNumber = 5,
+    kTcpOutSegsFieldNumber = 6,
+    kTcpRetransSegsFieldNumber = 7,
+    kTcpRetransPctFieldNumber = 8,
+    kTcpInErrsFieldNumber = 9,
+    kTcpOutRstsFieldNumber = 10,
+    kTcpTimeoutsFieldNumber = 11,
+    kTcpSynRetransFieldNumber = 12,
+    kListenOverflowsFieldNumber = 13,
+    kListenDropsFieldNumber = 14,
+    kSynDropsFieldNumber = 15,
+    kSyncookiesSentFieldNumber = 16,
+    kTcpMemoryPressuresFieldNumber = 17,
+    kTcpAbortOnMemoryFieldNumber = 18,
+    kTcpPruneCalledFieldNumber = 19,
+    kTcpRcvPrunedFieldNumber = 20,
+    kUdpInDatagramsFieldNumber = 21,
+    kUdpOutDatagramsFieldNumber = 22,
+    kUdpNoPortsFieldNumber = 23,
+    kUdpInErrorsFieldNumber = 24,
+    kUdpRcvbufErrorsFieldNumber = 25,
+    kUdpSndbufErrorsFieldNumber = 26,
+  };
+  // optional double tcp_active_opens = 1;
+  bool has_tcp_active_opens() const;
+  private:
+  bool _internal_has_tcp_active_opens() const;
+  public:
+  void clear_tcp_active_opens();
+  double tcp_active_opens() const;
+  void set_tcp_active_opens(double value);
+  private:
+  double _internal_tcp_active_opens() const;
+  void _internal_set_tcp_active_opens(double value);
+  public:
+
+  // optional double tcp_passive_opens = 2;
+  bool has_tcp_passive_opens() const;
+  private:
+  bool _internal_has_tcp_passive_opens() const;
+  public:
+  void clear_tcp_passive_opens();
+  double tcp_passive_opens() const;
+  void set_tcp_passive_opens(double value);
+  private:
+  double _internal_tcp_passive_opens() const;
+  void _internal_set_tcp_passive_opens(double value);
+  public:
+
+  // optional double tcp_attempt_fails = 3;
+  bool has_tcp_attempt_fails() const;
+  private:
+  bool _internal_has_tcp_attempt_fails() const;
+  public:
+  void clear_tcp_attempt_fails();
+  double tcp_attempt_fails() const;
+  void set_tcp_attempt_fails(double value);
+  private:
+  double _internal_tcp_attempt_fails() const;
+  void _internal_set_tcp_attempt_fails(double value);
+  public:
+
+  // optional double tcp_estab_resets = 4;
+  bool has_tcp_estab_resets() const;
+  private:
+  bool _internal_has_tcp_estab_resets() const;
+  public:
+  void clear_tcp_estab_resets();
+  double tcp_estab_resets() const;
+  void set_tcp_estab_resets(double value);
+  private:
+  double _internal_tcp_estab_resets() const;
+  void _internal_set_tcp_estab_resets(double value);
+  public:
+
+  // optional double tcp_in_segs = 5;
+  bool has_tcp_in_segs() const;
+  private:
+  bool _internal_has_tcp_in_segs() const;
+  public:
+  void clear_tcp_in_segs();
+  double tcp_in_segs() const;
+  void set_tcp_in_segs(double value);
+  private:
+  double _internal_tcp_in_segs() const;
+  void _internal_set_tcp_in_segs(double value);
+  public:
+
+  // optional double tcp_out_segs = 6;
+  bool has_tcp_out_segs() const;
+  private:
+  bool _internal_has_tcp_out_segs() const;
+  public:
+  void clear_tcp_out_segs();
+  double tcp_out_segs() const;
+  void set_tcp_out_segs(double value);
+  private:
+  double _internal_tcp_out_segs() const;
+  void _internal_set_tcp_out_segs(double value);
+  public:
+
+  // optional double tcp_retrans_segs = 7;
+  bool has_tcp_retrans_segs() const;
+  private:
+  bool _internal_has_tcp_retrans_segs() const;
+  public:
+  void clear_tcp_retrans_segs();
+  double tcp_retrans_segs() const;
+  void set_tcp_retrans_segs(double value);
+  private:
+  double _internal_tcp_retrans_segs() const;
+  void _internal_set_tcp_retrans_segs(double value);
+  public:
+
+  // optional double tcp_retrans_pct = 8;
+  bool has_tcp_retrans_pct() const;
+  private:
+  bool _internal_has_tcp_retrans_pct() const;
+  public:
+  void clear_tcp_retrans_pct();
+  double tcp_retrans_pct() const;
+  void set_tcp_retrans_pct(double value);
+  private:
+  double _internal_tcp_retrans_pct() const;
+  void _internal_set_tcp_retrans_pct(double value);
+  public:
+
+  // optional double tcp_in_errs = 9;
+  bool has_tcp_in_errs() const;
+  private:
+  bool _internal_has_tcp_in_errs() const;
+  public:
+  void clear_tcp_in_errs();
+  double tcp_in_errs() const;
+  void set_tcp_in_errs(double value);
+  private:
+  double _internal_tcp_in_errs() const;
+  void _internal_set_tcp_in_errs(double value);
+  public:
+
+  // optional double tcp_out_rsts = 10;
+  bool has_tcp_out_rsts() const;
+  private:
+  bool _internal_has_tcp_out_rsts() const;
+  public:
+  void clear_tcp_out_rsts();
+  double tcp_out_rsts() const;
+  void set_tcp_out_rsts(double value);
+  private:
+  double _internal_tcp_out_rsts() const;
+  void _internal_set_tcp_out_rsts(double value);
+  public:
+
+  // optional double tcp_timeouts = 11;
+  bool has_tcp_timeouts() const;
+  private:
+  bool _internal_has_tcp_timeouts() const;
+  public:
+  void clear_tcp_timeouts();
+  double tcp_timeouts() const;
+  void set_tcp_timeouts(double value);
+  private:
+  double _internal_tcp_timeouts() const;
+  void _internal_set_tcp_timeouts(double value);
+  public:
+
+  // optional double tcp_syn_retrans = 12;
+  bool has_tcp_syn_retrans() const;
+  private:
+  bool _internal_has_tcp_syn_retrans() const;
+  public:
+  void clear_tcp_syn_retrans();
+  double tcp_syn_retrans() const;
+  void set_tcp_syn_retrans(double value);
+  private:
+  double _internal_tcp_syn_retrans() const;
+  void _internal_set_tcp_syn_retrans(double value);
+  public:
+
+  // optional double listen_overflows = 13;
+  bool has_listen_overflows() const;
+  private:
+  bool _internal_has_listen_overflows() const;
+  public:
+  void clear_listen_overflows();
+  double listen_overflows() const;
+  void set_listen_overflows(double value);
+  private:
+  double _internal_listen_overflows() const;
+  void _internal_set_listen_overflows(double value);
+  public:
+
+  // optional double listen_drops = 14;
+  bool has_listen_drops() const;
+  private:
+  bool _internal_has_listen_drops() const;
+  public:
+  void clear_listen_drops();
+  double listen_drops() const;
+  void set_listen_drops(double value);
+  private:
+  double _internal_listen_drops() const;
+  void _internal_set_listen_drops(double value);
+  public:
+
+  // optional double syn_drops = 15;
+  bool has_syn_drops() const;
+  private:
+  bool _internal_has_syn_drops() const;
+  public:
+  void clear_syn_drops();
+  double syn_drops() const;
+  void set_syn_drops(double value);
+  private:
+  double _internal_syn_drops() const;
+  void _internal_set_syn_drops(double value);
+  public:
+
+  // optional double syncookies_sent = 16;
+  bool has_syncookies_sent() const;
+  private:
+  bool _internal_has_syncookies_sent() const;
+  public:
+  void clear_syncookies_sent();
+  double syncookies_sent() const;
+  void set_syncookies_sent(double value);
+  private:
+  double _internal_syncookies_sent() const;
+  void _internal_set_syncookies_sent(double value);
+  public:
+
+  // optional double tcp_memory_pressures = 17;
+  bool has_tcp_memory_pressures() const;
+  private:
+  bool _internal_has_tcp_memory_pressures() const;
+  public:
+  void clear_tcp_memory_pressures();
+  double tcp_memory_pressures() const;
+  void set_tcp_memory_pressures(double value);
+  private:
+  double _internal_tcp_memory_pressures() const;
+  void _internal_set_tcp_memory_pressures(double value);
+  public:
+
+  // optional double tcp_abort_on_memory = 18;
+  bool has_tcp_abort_on_memory() const;
+  private:
+  bool _internal_has_tcp_abort_on_memory() const;
+  public:
+  void clear_tcp_abort_on_memory();
+  double tcp_abort_on_memory() const;
+  void set_tcp_abort_on_memory(double value);
+  private:
+  double _internal_tcp_abort_on_memory() const;
+  void _internal_set_tcp_abort_on_memory(double value);
+  public:
+
+  // optional double tcp_prune_called = 19;
+  bool has_tcp_prune_called() const;
+  private:
+  bool _internal_has_tcp_prune_called() const;
+  public:
+  void clear_tcp_prune_called();
+  double tcp_prune_called() const;
+  void set_tcp_prune_called(double value);
+  private:
+  double _internal_tcp_prune_called() const;
+  void _internal_set_tcp_prune_called(double value);
+  public:
+
+  // optional double tcp_rcv_pruned = 20;
+  bool has_tcp_rcv_pruned() const;
+  private:
+  bool _internal_has_tcp_rcv_pruned() const;
+  public:
+  void clear_tcp_rcv_pruned();
+  double tcp_rcv_pruned() const;
+  void set_tcp_rcv_pruned(double value);
+  private:
+  double _internal_tcp_rcv_pruned() const;
+  void _internal_set_tcp_rcv_pruned(double value);
+  public:
+
+  // optional double udp_in_datagrams = 21;
+  bool has_udp_in_datagrams() const;
+  private:
+  bool _internal_has_udp_in_datagrams() const;
+  public:
+  void clear_udp_in_datagrams();
+  double udp_in_datagrams() const;
+  void set_udp_in_datagrams(double value);
+  private:
+  double _internal_udp_in_datagrams() const;
+  void _internal_set_udp_in_datagrams(double value);
+  public:
+
+  // optional double udp_out_datagrams = 22;
+  bool has_udp_out_datagrams() const;
+  private:
+  bool _internal_has_udp_out_datagrams() const;
+  public:
+  void clear_udp_out_datagrams();
+  double udp_out_datagrams() const;
+  void set_udp_out_datagrams(double value);
+  private:
+  double _internal_udp_out_datagrams() const;
+  void _internal_set_udp_out_datagrams(double value);
+  public:
+
+  // optional double udp_no_ports = 23;
+  bool has_udp_no_ports() const;
+  private:
+  bool _internal_has_udp_no_ports() const;
+  public:
+  void clear_udp_no_ports();
+  double udp_no_ports() const;
+  void set_udp_no_ports(double value);
+  private:
+  double _internal_udp_no_ports() const;
+  void _internal_set_udp_no_ports(double value);
+  public:
+
+  // optional double udp_in_errors = 24;
+  bool has_udp_in_errors() const;
+  private:
+  bool _internal_has_udp_in_errors() const;
+  public:
+  void clear_udp_in_errors();
+  double udp_in_errors() const;
+  void set_udp_in_errors(double value);
+  private:
+  double _internal_udp_in_errors() const;
+  void _internal_set_udp_in_errors(double value);
+  public:
+
+  // optional double udp_rcvbuf_errors = 25;
+  bool has_udp_rcvbuf_errors() const;
+  private:
+  bool _internal_has_udp_rcvbuf_errors() const;
+  public:
+  void clear_udp_rcvbuf_errors();
+  double udp_rcvbuf_errors() const;
+  void set_udp_rcvbuf_errors(double value);
+  private:
+  double _internal_udp_rcvbuf_errors() const;
+  void _internal_set_udp_rcvbuf_errors(double value);
+  public:
+
+  // optional double udp_sndbuf_errors = 26;
+  bool has_udp_sndbuf_errors() const;
+  private:
+  bool _internal_has_udp_sndbuf_errors() const;
+  public:
+  void clear_udp_sndbuf_errors();
+  double udp_sndbuf_errors() const;
+  void set_udp_sndbuf_errors(double value);
+  private:
+  double _internal_udp_sndbuf_errors() const;
+  void _internal_set_udp_sndbuf_errors(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarNetProtoInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double tcp_active_opens_;
+    double tcp_passive_opens_;
+    double tcp_attempt_fails_;
+    double tcp_estab_resets_;
+    double tcp_in_segs_;
+    double tcp_out_segs_;
+    double tcp_retrans_segs_;
+    double tcp_retrans_pct_;
+    double tcp_in_errs_;
+    double tcp_out_rsts_;
+    double tcp_timeouts_;
+    double tcp_syn_retrans_;
+    double listen_overflows_;
+    double listen_drops_;
+    double syn_drops_;
+    double syncookies_sent_;
+    double tcp_memory_pressures_;
+    double tcp_abort_on_memory_;
+    double tcp_prune_called_;
+    double tcp_rcv_pruned_;
+    double udp_in_datagrams_;
+    double udp_out_datagrams_;
+    double udp_no_ports_;
+    double udp_in_errors_;
+    double udp_rcvbuf_errors_;
+    double udp_sndbuf_errors_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarCpuInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarCpuInfo) */ {
+ public:
+  inline SarInfo_SarCpuInfo() : SarInfo_SarCpuInfo(nullptr) {}
+  ~SarInfo_SarCpuInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarCpuInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarCpuInfo(const SarInfo_SarCpuInfo& from);
+  SarInfo_SarCpuInfo(SarInfo_SarCpuInfo&& from) noexcept
+    : SarInfo_SarCpuInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarCpuInfo& operator=(const SarInfo_SarCpuInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarCpuInfo& operator=(SarInfo_SarCpuInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarCpuInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarCpuInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarCpuInfo*>(
+               &_SarInfo_SarCpuInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SarInfo_SarCpuInfo& a, SarInfo_SarCpuInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarCpuInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarCpuInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarCpuInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarCpuInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarCpuInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarCpuInfo& from) {
+    SarInfo_SarCpuInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarCpuInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarCpuInfo";
+  }
+  protected:
+  explicit SarInfo_SarCpuInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSoftnetProcessedFieldNumber = 2,
+    kSoftnetDroppedFieldNumber = 3,
+    kSoftnetTimeSqueezeFieldNumber = 4,
+    kCpuFieldNumber = 1,
+    kSoftnetSqueezedFieldNumber = 7,
+    kSoftnetReceivedRpsFieldNumber = 5,
+    kSoftnetFlowLimitFieldNumber = 6,
+    kSchedRunTimeFieldNumber = 8,
+    kSchedRunDelayFieldNumber = 9,
+    kSchedTimeslicesFieldNumber = 10,
+    kCpuUserFieldNumber = 11,
+    kCpuNiceFieldNumber = 12,
+    kCpuSystemFieldNumber = 13,
+    kCpuIowaitFieldNumber = 14,
+    kCpuStealFieldNumber = 15,
+    kCpuIdleFieldNumber = 16,
+    kCoreIdFieldNumber = 17,
+    kPackageIdFieldNumber = 18,
+    kCurFreqFieldNumber = 20,
+    kMaxFreqFieldNumber = 21,
+    kCoreThrottleFieldNumber = 22,
+    kPackageThrottleFieldNumber = 23,
+    kNodeFieldNumber = 19,
+  };
+  // optional double softnet_processed = 2;
+  bool has_softnet_processed() const;
+  private:
+  bool _internal_has_softnet_processed() const;
+  public:
+  void clear_softnet_processed();
+  double softnet_processed() const;
+  void set_softnet_processed(double value);
+  private:
+  double _internal_softnet_processed() const;
+  void _internal_set_softnet_processed(double value);
+  public:
+
+  // optional double softnet_dropped = 3;
+  bool has_softnet_dropped() const;
+  private:
+  bool _internal_has_softnet_dropped() const;
+  public:
+  void clear_softnet_dropped();
+  double softnet_dropped() const;
+  void set_softnet_dropped(double value);
+  private:
+  double _internal_softnet_dropped() const;
+  void _internal_set_softnet_dropped(double value);
+  public:
+
+  // optional double softnet_time_squeeze = 4;
+  bool has_softnet_time_squeeze() const;
+  private:
+  bool _internal_has_softnet_time_squeeze() const;
+  public:
+  void clear_softnet_time_squeeze();
+  double softnet_time_squeeze() const;
+  void set_softnet_time_squeeze(double value);
+  private:
+  double _internal_softnet_time_squeeze() const;
+  void _internal_set_softnet_time_squeeze(double value);
+  public:
+
+  // optional int32 cpu = 1;
+  bool has_cpu() const;
+  private:
+  bool _internal_has_cpu() const;
+  public:
+  void clear_cpu();
+  int32_t cpu() const;
+  void set_cpu(int32_t value);
+  private:
+  int32_t _internal_cpu() const;
+  void _internal_set_cpu(int32_t value);
+  public:
+
+  // optional bool softnet_squeezed = 7;
+  bool has_softnet_squeezed() const;
+  private:
+  bool _internal_has_softnet_squeezed() const;
+  public:
+  void clear_softnet_squeezed();
+  bool softnet_squeezed() const;
+  void set_softnet_squeezed(bool value);
+  private:
+  bool _internal_softnet_squeezed() const;
+  void _internal_set_softnet_squeezed(bool value);
+  public:
+
+  // optional double softnet_received_rps = 5;
+  bool has_softnet_received_rps() const;
+  private:
+  bool _internal_has_softnet_received_rps() const;
+  public:
+  void clear_softnet_received_rps();
+  double softnet_received_rps() const;
+  void set_softnet_received_rps(double value);
+  private:
+  double _internal_softnet_received_rps() const;
+  void _internal_set_softnet_received_rps(double value);
+  public:
+
+  // optional double softnet_flow_limit = 6;
+  bool has_softnet_flow_limit() const;
+  private:
+  bool _internal_has_softnet_flow_limit() const;
+  public:
+  void clear_softnet_flow_limit();
+  double softnet_flow_limit() const;
+  void set_softnet_flow_limit(double value);
+  private:
+  double _internal_softnet_flow_limit() const;
+  void _internal_set_softnet_flow_limit(double value);
+  public:
+
+  // optional double sched_run_time = 8;
+  bool has_sched_run_time() const;
+  private:
+  bool _internal_has_sched_run_time() const;
+  public:
+  void clear_sched_run_time();
+  double sched_run_time() const;
+  void set_sched_run_time(double value);
+  private:
+  double _internal_sched_run_time() const;
+  void _internal_set_sched_run_time(double value);
+  public:
+
+  // optional double sched_run_delay = 9;
+  bool has_sched_run_delay() const;
+  private:
+  bool _internal_has_sched_run_delay() const;
+  public:
+  void clear_sched_run_delay();
+  double sched_run_delay() const;
+  void set_sched_run_delay(double value);
+  private:
+  double _internal_sched_run_delay() const;
+  void _internal_set_sched_run_delay(double value);
+  public:
+
+  // optional double sched_timeslices = 10;
+  bool has_sched_timeslices() const;
+  private:
+  bool _internal_has_sched_timeslices() const;
+  public:
+  void clear_sched_timeslices();
+  double sched_timeslices() const;
+  void set_sched_timeslices(double value);
+  private:
+  double _internal_sched_timeslices() const;
+  void _internal_set_sched_timeslices(double value);
+  public:
+
+  // optional double cpu_user = 11;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_nice = 12;
+  bool has_cpu_nice() const;
+  private:
+  bool _internal_has_cpu_nice() const;
+  public:
+  void clear_cpu_nice();
+  double cpu_nice() const;
+  void set_cpu_nice(double value);
+  private:
+  double _internal_cpu_nice() const;
+  void _internal_set_cpu_nice(double value);
+  public:
+
+  // optional double cpu_system = 13;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional double cpu_iowait = 14;
+  bool has_cpu_iowait() const;
+  private:
+  bool _internal_has_cpu_iowait() const;
+  public:
+  void clear_cpu_iowait();
+  double cpu_iowait() const;
+  void set_cpu_iowait(double value);
+  private:
+  double _internal_cpu_iowait() const;
+  void _internal_set_cpu_iowait(double value);
+  public:
+
+  // optional double cpu_steal = 15;
+  bool has_cpu_steal() const;
+  private:
+  bool _internal_has_cpu_steal() const;
+  public:
+  void clear_cpu_steal();
+  double cpu_steal() const;
+  void set_cpu_steal(double value);
+  private:
+  double _internal_cpu_steal() const;
+  void _internal_set_cpu_steal(double value);
+  public:
+
+  // optional double cpu_idle = 16;
+  bool has_cpu_idle() const;
+  private:
+  bool _internal_has_cpu_idle() const;
+  public:
+  void clear_cpu_idle();
+  double cpu_idle() const;
+  void set_cpu_idle(double value);
+  private:
+  double _internal_cpu_idle() const;
+  void _internal_set_cpu_idle(double value);
+  public:
+
+  // optional int32 core_id = 17;
+  bool has_core_id() const;
+  private:
+  bool _internal_has_core_id() const;
+  public:
+  void clear_core_id();
+  int32_t core_id() const;
+  void set_core_id(int32_t value);
+  private:
+  int32_t _internal_core_id() const;
+  void _internal_set_core_id(int32_t value);
+  public:
+
+  // optional int32 package_id = 18;
+  bool has_package_id() const;
+  private:
+  bool _internal_has_package_id() const;
+  public:
+  void clear_package_id();
+  int32_t package_id() const;
+  void set_package_id(int32_t value);
+  private:
+  int32_t _internal_package_id() const;
+  void _internal_set_package_id(int32_t value);
+  public:
+
+  // optional double cur_freq = 20;
+  bool has_cur_freq() const;
+  private:
+  bool _internal_has_cur_freq() const;
+  public:
+  void clear_cur_freq();
+  double cur_freq() const;
+  void set_cur_freq(double value);
+  private:
+  double _internal_cur_freq() const;
+  void _internal_set_cur_freq(double value);
+  public:
+
+  // optional double max_freq = 21;
+  bool has_max_freq() const;
+  private:
+  bool _internal_has_max_freq() const;
+  public:
+  void clear_max_freq();
+  double max_freq() const;
+  void set_max_freq(double value);
+  private:
+  double _internal_max_freq() const;
+  void _internal_set_max_freq(double value);
+  public:
+
+  // optional double core_throttle = 22;
+  bool has_core_throttle() const;
+  private:
+  bool _internal_has_core_throttle() const;
+  public:
+  void clear_core_throttle();
+  double core_throttle() const;
+  void set_core_throttle(double value);
+  private:
+  double _internal_core_throttle() const;
+  void _internal_set_core_throttle(double value);
+  public:
+
+  // optional double package_throttle = 23;
+  bool has_package_throttle() const;
+  private:
+  bool _internal_has_package_throttle() const;
+  public:
+  void clear_package_throttle();
+  double package_throttle() const;
+  void set_package_throttle(double value);
+  private:
+  double _internal_package_throttle() const;
+  void _internal_set_package_throttle(double value);
+  public:
+
+  // optional int32 node = 19;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  int32_t node() const;
+  void set_node(int32_t value);
+  private:
+  int32_t _internal_node() const;
+  void _internal_set_node(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarCpuInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double softnet_processed_;
+    double softnet_dropped_;
+    double softnet_time_squeeze_;
+    int32_t cpu_;
+    bool softnet_squeezed_;
+    double softnet_received_rps_;
+    double softnet_flow_limit_;
+    double sched_run_time_;
+    double sched_run_delay_;
+    double sched_timeslices_;
+    double cpu_user_;
+    double cpu_nice_;
+    double cpu_system_;
+    double cpu_iowait_;
+    double cpu_steal_;
+    double cpu_idle_;
+    int32_t core_id_;
+    int32_t package_id_;
+    double cur_freq_;
+    double max_freq_;
+    double core_throttle_;
+    double package_throttle_;
+    int32_t node_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarTaskSchedInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarTaskSchedInfo) */ {
+ public:
+  inline SarInfo_SarTaskSchedInfo() : SarInfo_SarTaskSchedInfo(nullptr) {}
+  ~SarInfo_SarTaskSchedInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarTaskSchedInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarTaskSchedInfo(const SarInfo_SarTaskSchedInfo& from);
+  SarInfo_SarTaskSchedInfo(SarInfo_SarTaskSchedInfo&& from) noexcept
+    : SarInfo_SarTaskSchedInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarTaskSchedInfo& operator=(const SarInfo_SarTaskSchedInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarTaskSchedInfo& operator=(SarInfo_SarTaskSchedInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarTaskSchedInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarTaskSchedInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarTaskSchedInfo*>(
+               &_SarInfo_SarTaskSchedInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SarInfo_SarTaskSchedInfo& a, SarInfo_SarTaskSchedInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarTaskSchedInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarTaskSchedInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarTaskSchedInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarTaskSchedInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarTaskSchedInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarTaskSchedInfo& from) {
+    SarInfo_SarTaskSchedInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarTaskSchedInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarTaskSchedInfo";
+  }
+  protected:
+  explicit SarInfo_SarTaskSchedInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommFieldNumber = 2,
+    kRunTimeFieldNumber = 3,
+    kRunDelayFieldNumber = 4,
+    kTimeslicesFieldNumber = 5,
+    kAvgDelayFieldNumber = 6,
+    kPidFieldNumber = 1,
+  };
+  // optional string comm = 2;
+  bool has_comm() const;
+  private:
+  bool _internal_has_comm() const;
+  public:
+  void clear_comm();
+  const std::string& comm() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_comm(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_comm();
+  PROTOBUF_NODISCARD std::string* release_comm();
+  void set_allocated_comm(std::string* comm);
+  private:
+  const std::string& _internal_comm() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_comm(const std::string& value);
+  std::string* _internal_mutable_comm();
+  public:
+
+  // optional double run_time = 3;
+  bool has_run_time() const;
+  private:
+  bool _internal_has_run_time() const;
+  public:
+  void clear_run_time();
+  double run_time() const;
+  void set_run_time(double value);
+  private:
+  double _internal_run_time() const;
+  void _internal_set_run_time(double value);
+  public:
+
+  // optional double run_delay = 4;
+  bool has_run_delay() const;
+  private:
+  bool _internal_has_run_delay() const;
+  public:
+  void clear_run_delay();
+  double run_delay() const;
+  void set_run_delay(double value);
+  private:
+  double _internal_run_delay() const;
+  void _internal_set_run_delay(double value);
+  public:
+
+  // optional double timeslices = 5;
+  bool has_timeslices() const;
+  private:
+  bool _internal_has_timeslices() const;
+  public:
+  void clear_timeslices();
+  double timeslices() const;
+  void set_timeslices(double value);
+  private:
+  double _internal_timeslices() const;
+  void _internal_set_timeslices(double value);
+  public:
+
+  // optional double avg_delay = 6;
+  bool has_avg_delay() const;
+  private:
+  bool _internal_has_avg_delay() const;
+  public:
+  void clear_avg_delay();
+  double avg_delay() const;
+  void set_avg_delay(double value);
+  private:
+  double _internal_avg_delay() const;
+  void _internal_set_avg_delay(double value);
+  public:
+
+  // optional int32 pid = 1;
+  bool has_pid() const;
+  private:
+  bool _internal_has_pid() const;
+  public:
+  void clear_pid();
+  int32_t pid() const;
+  void set_pid(int32_t value);
+  private:
+  int32_t _internal_pid() const;
+  void _internal_set_pid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarTaskSchedInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comm_;
+    double run_time_;
+    double run_delay_;
+    double timeslices_;
+    double avg_delay_;
+    int32_t pid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarPsiInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarPsiInfo) */ {
+ public:
+  inline SarInfo_SarPsiInfo() : SarInfo_SarPsiInfo(nullptr) {}
+  ~SarInfo_SarPsiInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarPsiInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarPsiInfo(const SarInfo_SarPsiInfo& from);
+  SarInfo_SarPsiInfo(SarInfo_SarPsiInfo&& from) noexcept
+    : SarInfo_SarPsiInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarPsiInfo& operator=(const SarInfo_SarPsiInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarPsiInfo& operator=(SarInfo_SarPsiInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarPsiInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarPsiInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarPsiInfo*>(
+               &_SarInfo_SarPsiInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SarInfo_SarPsiInfo& a, SarInfo_SarPsiInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarPsiInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarPsiInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarPsiInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarPsiInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarPsiInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarPsiInfo& from) {
+    SarInfo_SarPsiInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarPsiInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarPsiInfo";
+  }
+  protected:
+  explicit SarInfo_SarPsiInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSomeAvg10FieldNumber = 1,
+    kSomeAvg60FieldNumber = 2,
+    kSomeAvg300FieldNumber = 3,
+    kFullAvg10FieldNumber = 4,
+    kFullAvg60FieldNumber = 5,
+    kFullAvg300FieldNumber = 6,
+    kSomeStallFieldNumber = 7,
+    kFullStallFieldNumber = 8,
+  };
+  // optional double some_avg10 = 1;
+  bool has_some_avg10() const;
+  private:
+  bool _internal_has_some_avg10() const;
+  public:
+  void clear_some_avg10();
+  double some_avg10() const;
+  void set_some_avg10(double value);
+  private:
+  double _internal_some_avg10() const;
+  void _internal_set_some_avg10(double value);
+  public:
+
+  // optional double some_avg60 = 2;
+  bool has_some_avg60() const;
+  private:
+  bool _internal_has_some_avg60() const;
+  public:
+  void clear_some_avg60();
+  double some_avg60() const;
+  void set_some_avg60(double value);
+  private:
+  double _internal_some_avg60() const;
+  void _internal_set_some_avg60(double value);
+  public:
+
+  // optional double some_avg300 = 3;
+  bool has_some_avg300() const;
+  private:
+  bool _internal_has_some_avg300() const;
+  public:
+  void clear_some_avg300();
+  double some_avg300() const;
+  void set_some_avg300(double value);
+  private:
+  double _internal_some_avg300() const;
+  void _internal_set_some_avg300(double value);
+  public:
+
+  // optional double full_avg10 = 4;
+  bool has_full_avg10() const;
+  private:
+  bool _internal_has_full_avg10() const;
+  public:
+  void clear_full_avg10();
+  double full_avg10() const;
+  void set_full_avg10(double value);
+  private:
+  double _internal_full_avg10() const;
+  void _internal_set_full_avg10(double value);
+  public:
+
+  // optional double full_avg60 = 5;
+  bool has_full_avg60() const;
+  private:
+  bool _internal_has_full_avg60() const;
+  public:
+  void clear_full_avg60();
+  double full_avg60() const;
+  void set_full_avg60(double value);
+  private:
+  double _internal_full_avg60() const;
+  void _internal_set_full_avg60(double value);
+  public:
+
+  // optional double full_avg300 = 6;
+  bool has_full_avg300() const;
+  private:
+  bool _internal_has_full_avg300() const;
+  public:
+  void clear_full_avg300();
+  double full_avg300() const;
+  void set_full_avg300(double value);
+  private:
+  double _internal_full_avg300() const;
+  void _internal_set_full_avg300(double value);
+  public:
+
+  // optional double some_stall = 7;
+  bool has_some_stall() const;
+  private:
+  bool _internal_has_some_stall() const;
+  public:
+  void clear_some_stall();
+  double some_stall() const;
+  void set_some_stall(double value);
+  private:
+  double _internal_some_stall() const;
+  void _internal_set_some_stall(double value);
+  public:
+
+  // optional double full_stall = 8;
+  bool has_full_stall() const;
+  private:
+  bool _internal_has_full_stall() const;
+  public:
+  void clear_full_stall();
+  double full_stall() const;
+  void set_full_stall(double value);
+  private:
+  double _internal_full_stall() const;
+  void _internal_set_full_stall(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarPsiInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double some_avg10_;
+    double some_avg60_;
+    double some_avg300_;
+    double full_avg10_;
+    double full_avg60_;
+    double full_avg300_;
+    double some_stall_;
+    double full_stall_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarCgroupInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarCgroupInfo) */ {
+ public:
+  inline SarInfo_SarCgroupInfo() : SarInfo_SarCgroupInfo(nullptr) {}
+  ~SarInfo_SarCgroupInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarCgroupInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarCgroupInfo(const SarInfo_SarCgroupInfo& from);
+  SarInfo_SarCgroupInfo(SarInfo_SarCgroupInfo&& from) noexcept
+    : SarInfo_SarCgroupInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarCgroupInfo& operator=(const SarInfo_SarCgroupInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarCgroupInfo& operator=(SarInfo_SarCgroupInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarCgroupInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarCgroupInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarCgroupInfo*>(
+               &_SarInfo_SarCgroupInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SarInfo_SarCgroupInfo& a, SarInfo_SarCgroupInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarCgroupInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarCgroupInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarCgroupInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarCgroupInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarCgroupInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarCgroupInfo& from) {
+    SarInfo_SarCgroupInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarCgroupInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarCgroupInfo";
+  }
+  protected:
+  explicit SarInfo_SarCgroupInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kPsiCpuFieldNumber = 17,
+    kPsiMemoryFieldNumber = 18,
+    kPsiIoFieldNumber = 19,
+    kInodeFieldNumber = 2,
+    kCpuUsageFieldNumber = 3,
+    kCpuUserFieldNumber = 4,
+    kCpuSystemFieldNumber = 5,
+    kNrThrottledFieldNumber = 6,
+    kThrottledTimeFieldNumber = 7,
+    kMemoryCurrentFieldNumber = 8,
+    kMemoryAnonFieldNumber = 9,
+    kMemoryFileFieldNumber = 10,
+    kPgfaultFieldNumber = 11,
+    kPgmajfaultFieldNumber = 12,
+    kIoRbytesFieldNumber = 13,
+    kIoWbytesFieldNumber = 14,
+    kIoRiosFieldNumber = 15,
+    kIoWiosFieldNumber = 16,
+  };
+  // optional string path = 1;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // optional .SarInfo.SarPsiInfo psi_cpu = 17;
+  bool has_psi_cpu() const;
+  private:
+  bool _internal_has_psi_cpu() const;
+  public:
+  void clear_psi_cpu();
+  const ::SarInfo_SarPsiInfo& psi_cpu() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_cpu();
+  ::SarInfo_SarPsiInfo* mutable_psi_cpu();
+  void set_allocated_psi_cpu(::SarInfo_SarPsiInfo* psi_cpu);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_cpu() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_cpu();
+  public:
+  void unsafe_arena_set_allocated_psi_cpu(
+      ::SarInfo_SarPsiInfo* psi_cpu);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_cpu();
+
+  // optional .SarInfo.SarPsiInfo psi_memory = 18;
+  bool has_psi_memory() const;
+  private:
+  bool _internal_has_psi_memory() const;
+  public:
+  void clear_psi_memory();
+  const ::SarInfo_SarPsiInfo& psi_memory() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_memory();
+  ::SarInfo_SarPsiInfo* mutable_psi_memory();
+  void set_allocated_psi_memory(::SarInfo_SarPsiInfo* psi_memory);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_memory() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_memory();
+  public:
+  void unsafe_arena_set_allocated_psi_memory(
+      ::SarInfo_SarPsiInfo* psi_memory);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_memory();
+
+  // optional .SarInfo.SarPsiInfo psi_io = 19;
+  bool has_psi_io() const;
+  private:
+  bool _internal_has_psi_io() const;
+  public:
+  void clear_psi_io();
+  const ::SarInfo_SarPsiInfo& psi_io() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_io();
+  ::SarInfo_SarPsiInfo* mutable_psi_io();
+  void set_allocated_psi_io(::SarInfo_SarPsiInfo* psi_io);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_io() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_io();
+  public:
+  void unsafe_arena_set_allocated_psi_io(
+      ::SarInfo_SarPsiInfo* psi_io);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_io();
+
+  // optional uint64 inode = 2;
+  bool has_inode() const;
+  private:
+  bool _internal_has_inode() const;
+  public:
+  void clear_inode();
+  uint64_t inode() const;
+  void set_inode(uint64_t value);
+  private:
+  uint64_t _internal_inode() const;
+  void _internal_set_inode(uint64_t value);
+  public:
+
+  // optional double cpu_usage = 3;
+  bool has_cpu_usage() const;
+  private:
+  bool _internal_has_cpu_usage() const;
+  public:
+  void clear_cpu_usage();
+  double cpu_usage() const;
+  void set_cpu_usage(double value);
+  private:
+  double _internal_cpu_usage() const;
+  void _internal_set_cpu_usage(double value);
+  public:
+
+  // optional double cpu_user = 4;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_system = 5;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional double nr_throttled = 6;
+  bool has_nr_throttled() const;
+  private:
+  bool _internal_has_nr_throttled() const;
+  public:
+  void clear_nr_throttled();
+  double nr_throttled() const;
+  void set_nr_throttled(double value);
+  private:
+  double _internal_nr_throttled() const;
+  void _internal_set_nr_throttled(double value);
+  public:
+
+  // optional double throttled_time = 7;
+  bool has_throttled_time() const;
+  private:
+  bool _internal_has_throttled_time() const;
+  public:
+  void clear_throttled_time();
+  double throttled_time() const;
+  void set_throttled_time(double value);
+  private:
+  double _internal_throttled_time() const;
+  void _internal_set_throttled_time(double value);
+  public:
+
+  // optional uint64 memory_current = 8;
+  bool has_memory_current() const;
+  private:
+  bool _internal_has_memory_current() const;
+  public:
+  void clear_memory_current();
+  uint64_t memory_current() const;
+  void set_memory_current(uint64_t value);
+  private:
+  uint64_t _internal_memory_current() const;
+  void _internal_set_memory_current(uint64_t value);
+  public:
+
+  // optional uint64 memory_anon = 9;
+  bool has_memory_anon() const;
+  private:
+  bool _internal_has_memory_anon() const;
+  public:
+  void clear_memory_anon();
+  uint64_t memory_anon() const;
+  void set_memory_anon(uint64_t value);
+  private:
+  uint64_t _internal_memory_anon() const;
+  void _internal_set_memory_anon(uint64_t value);
+  public:
+
+  // optional uint64 memory_file = 10;
+  bool has_memory_file() const;
+  private:
+  bool _internal_has_memory_file() const;
+  public:
+  void clear_memory_file();
+  uint64_t memory_file() const;
+  void set_memory_file(uint64_t value);
+  private:
+  uint64_t _internal_memory_file() const;
+  void _internal_set_memory_file(uint64_t value);
+  public:
+
+  // optional double pgfault = 11;
+  bool has_pgfault() const;
+  private:
+  bool _internal_has_pgfault() const;
+  public:
+  void clear_pgfault();
+  double pgfault() const;
+  void set_pgfault(double value);
+  private:
+  double _internal_pgfault() const;
+  void _internal_set_pgfault(double value);
+  public:
+
+  // optional double pgmajfault = 12;
+  bool has_pgmajfault() const;
+  private:
+  bool _internal_has_pgmajfault() const;
+  public:
+  void clear_pgmajfault();
+  double pgmajfault() const;
+  void set_pgmajfault(double value);
+  private:
+  double _internal_pgmajfault() const;
+  void _internal_set_pgmajfault(double value);
+  public:
+
+  // optional double io_rbytes = 13;
+  bool has_io_rbytes() const;
+  private:
+  bool _internal_has_io_rbytes() const;
+  public:
+  void clear_io_rbytes();
+  double io_rbytes() const;
+  void set_io_rbytes(double value);
+  private:
+  double _internal_io_rbytes() const;
+  void _internal_set_io_rbytes(double value);
+  public:
+
+  // optional double io_wbytes = 14;
+  bool has_io_wbytes() const;
+  private:
+  bool _internal_has_io_wbytes() const;
+  public:
+  void clear_io_wbytes();
+  double io_wbytes() const;
+  void set_io_wbytes(double value);
+  private:
+  double _internal_io_wbytes() const;
+  void _internal_set_io_wbytes(double value);
+  public:
+
+  // optional double io_rios = 15;
+  bool has_io_rios() const;
+  private:
+  bool _internal_has_io_rios() const;
+  public:
+  void clear_io_rios();
+  double io_rios() const;
+  void set_io_rios(double value);
+  private:
+  double _internal_io_rios() const;
+  void _internal_set_io_rios(double value);
+  public:
+
+  // optional double io_wios = 16;
+  bool has_io_wios() const;
+  private:
+  bool _internal_has_io_wios() const;
+  public:
+  void clear_io_wios();
+  double io_wios() const;
+  void set_io_wios(double value);
+  private:
+  double _internal_io_wios() const;
+  void _internal_set_io_wios(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarCgroupInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::SarInfo_SarPsiInfo* psi_cpu_;
+    ::SarInfo_SarPsiInfo* psi_memory_;
+    ::SarInfo_SarPsiInfo* psi_io_;
+    uint64_t inode_;
+    double cpu_usage_;
+    double cpu_user_;
+    double cpu_system_;
+    double nr_throttled_;
+    double throttled_time_;
+    uint64_t memory_current_;
+    uint64_t memory_anon_;
+    uint64_t memory_file_;
+    double pgfault_;
+    double pgmajfault_;
+    double io_rbytes_;
+    double io_wbytes_;
+    double io_rios_;
+    double io_wios_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarProcessInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarProcessInfo) */ {
+ public:
+  inline SarInfo_SarProcessInfo() : SarInfo_SarProcessInfo(nullptr) {}
+  ~SarInfo_SarProcessInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarProcessInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarProcessInfo(const SarInfo_SarProcessInfo& from);
+  SarInfo_SarProcessInfo(SarInfo_SarProcessInfo&& from) noexcept
+    : SarInfo_SarProcessInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarProcessInfo& operator=(const SarInfo_SarProcessInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarProcessInfo& operator=(SarInfo_SarProcessInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarProcessInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarProcessInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarProcessInfo*>(
+               &_SarInfo_SarProcessInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SarInfo_SarProcessInfo& a, SarInfo_SarProcessInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarProcessInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarProcessInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarProcessInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarProcessInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarProcessInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarProcessInfo& from) {
+    SarInfo_SarProcessInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarProcessInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarProcessInfo";
+  }
+  protected:
+  explicit SarInfo_SarProcessInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommFieldNumber = 2,
+    kCpuFieldNumber = 3,
+    kCpuUserFieldNumber = 4,
+    kCpuSystemFieldNumber = 5,
+    kRssFieldNumber = 6,
+    kSharedFieldNumber = 7,
+    kMinfltFieldNumber = 8,
+    kMajfltFieldNumber = 9,
+    kReadBytesFieldNumber = 10,
+    kWriteBytesFieldNumber = 11,
+    kPidFieldNumber = 1,
+  };
+  // optional string comm = 2;
+  bool has_comm() const;
+  private:
+  bool _internal_has_comm() const;
+  public:
+  void clear_comm();
+  const std::string& comm() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_comm(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_comm();
+  PROTOBUF_NODISCARD std::string* release_comm();
+  void set_allocated_comm(std::string* comm);
+  private:
+  const std::string& _internal_comm() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_comm(const std::string& value);
+  std::string* _internal_mutable_comm();
+  public:
+
+  // optional double cpu = 3;
+  bool has_cpu() const;
+  private:
+  bool _internal_has_cpu() const;
+  public:
+  void clear_cpu();
+  double cpu() const;
+  void set_cpu(double value);
+  private:
+  double _internal_cpu() const;
+  void _internal_set_cpu(double value);
+  public:
+
+  // optional double cpu_user = 4;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_system = 5;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional uint64 rss = 6;
+  bool has_rss() const;
+  private:
+  bool _internal_has_rss() const;
+  public:
+  void clear_rss();
+  uint64_t rss() const;
+  void set_rss(uint64_t value);
+  private:
+  uint64_t _internal_rss() const;
+  void _internal_set_rss(uint64_t value);
+  public:
+
+  // optional uint64 shared = 7;
+  bool has_shared() const;
+  private:
+  bool _internal_has_shared() const;
+  public:
+  void clear_shared();
+  uint64_t shared() const;
+  void set_shared(uint64_t value);
+  private:
+  uint64_t _internal_shared() const;
+  void _internal_set_shared(uint64_t value);
+  public:
+
+  // optional double minflt = 8;
+  bool has_minflt() const;
+  private:
+  bool _internal_has_minflt() const;
+  public:
+  void clear_minflt();
+  double minflt() const;
+  void set_minflt(double value);
+  private:
+  double _internal_minflt() const;
+  void _internal_set_minflt(double value);
+  public:
+
+  // optional double majflt = 9;
+  bool has_majflt() const;
+  private:
+  bool _internal_has_majflt() const;
+  public:
+  void clear_majflt();
+  double majflt() const;
+  void set_majflt(double value);
+  private:
+  double _internal_majflt() const;
+  void _internal_set_majflt(double value);
+  public:
+
+  // optional double read_bytes = 10;
+  bool has_read_bytes() const;
+  private:
+  bool _internal_has_read_bytes() const;
+  public:
+  void clear_read_bytes();
+  double read_bytes() const;
+  void set_read_bytes(double value);
+  private:
+  double _internal_read_bytes() const;
+  void _internal_set_read_bytes(double value);
+  public:
+
+  // optional double write_bytes = 11;
+  bool has_write_bytes() const;
+  private:
+  bool _internal_has_write_bytes() const;
+  public:
+  void clear_write_bytes();
+  double write_bytes() const;
+  void set_write_bytes(double value);
+  private:
+  double _internal_write_bytes() const;
+  void _internal_set_write_bytes(double value);
+  public:
+
+  // optional int32 pid = 1;
+  bool has_pid() const;
+  private:
+  bool _internal_has_pid() const;
+  public:
+  void clear_pid();
+  int32_t pid() const;
+  void set_pid(int32_t value);
+  private:
+  int32_t _internal_pid() const;
+  void _internal_set_pid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarProcessInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comm_;
+    double cpu_;
+    double cpu_user_;
+    double cpu_system_;
+    uint64_t rss_;
+    uint64_t shared_;
+    double minflt_;
+    double majflt_;
+    double read_bytes_;
+    double write_bytes_;
+    int32_t pid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarIfaceInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarIfaceInfo) */ {
+ public:
+  inline SarInfo_SarIfaceInfo() : SarInfo_SarIfaceInfo(nullptr) {}
+  ~SarInfo_SarIfaceInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarIfaceInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarIfaceInfo(const SarInfo_SarIfaceInfo& from);
+  SarInfo_SarIfaceInfo(SarInfo_SarIfaceInfo&& from) noexcept
+    : SarInfo_SarIfaceInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarIfaceInfo& operator=(const SarInfo_SarIfaceInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarIfaceInfo& operator=(SarInfo_SarIfaceInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarIfaceInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarIfaceInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarIfaceInfo*>(
+               &_SarInfo_SarIfaceInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(SarInfo_SarIfaceInfo& a, SarInfo_SarIfaceInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarIfaceInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarIfaceInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarIfaceInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarIfaceInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarIfaceInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarIfaceInfo& from) {
+    SarInfo_SarIfaceInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarIfaceInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarIfaceInfo";
+  }
+  protected:
+  explicit SarInfo_SarIfaceInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kRxpckFieldNumber = 2,
+    kTxpckFieldNumber = 3,
+    kRxbytFieldNumber = 4,
+    kTxbytFieldNumber = 5,
+    kRxerrFieldNumber = 6,
+    kTxerrFieldNumber = 7,
+    kRxdropFieldNumber = 8,
+    kTxdropFieldNumber = 9,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional double rxpck = 2;
+  bool has_rxpck() const;
+  private:
+  bool _internal_has_rxpck() const;
+  public:
+  void clear_rxpck();
+  double rxpck() const;
+  void set_rxpck(double value);
+  private:
+  double _internal_rxpck() const;
+  void _internal_set_rxpck(double value);
+  public:
+
+  // optional double txpck = 3;
+  bool has_txpck() const;
+  private:
+  bool _internal_has_txpck() const;
+  public:
+  void clear_txpck();
+  double txpck() const;
+  void set_txpck(double value);
+  private:
+  double _internal_txpck() const;
+  void _internal_set_txpck(double value);
+  public:
+
+  // optional double rxbyt = 4;
+  bool has_rxbyt() const;
+  private:
+  bool _internal_has_rxbyt() const;
+  public:
+  void clear_rxbyt();
+  double rxbyt() const;
+  void set_rxbyt(double value);
+  private:
+  double _internal_rxbyt() const;
+  void _internal_set_rxbyt(double value);
+  public:
+
+  // optional double txbyt = 5;
+  bool has_txbyt() const;
+  private:
+  bool _internal_has_txbyt() const;
+  public:
+  void clear_txbyt();
+  double txbyt() const;
+  void set_txbyt(double value);
+  private:
+  double _internal_txbyt() const;
+  void _internal_set_txbyt(double value);
+  public:
+
+  // optional double rxerr = 6;
+  bool has_rxerr() const;
+  private:
+  bool _internal_has_rxerr() const;
+  public:
+  void clear_rxerr();
+  double rxerr() const;
+  void set_rxerr(double value);
+  private:
+  double _internal_rxerr() const;
+  void _internal_set_rxerr(double value);
+  public:
+
+  // optional double txerr = 7;
+  bool has_txerr() const;
+  private:
+  bool _internal_has_txerr() const;
+  public:
+  void clear_txerr();
+  double txerr() const;
+  void set_txerr(double value);
+  private:
+  double _internal_txerr() const;
+  void _internal_set_txerr(double value);
+  public:
+
+  // optional double rxdrop = 8;
+  bool has_rxdrop() const;
+  private:
+  bool _internal_has_rxdrop() const;
+  public:
+  void clear_rxdrop();
+  double rxdrop() const;
+  void set_rxdrop(double value);
+  private:
+  double _internal_rxdrop() const;
+  void _internal_set_rxdrop(double value);
+  public:
+
+  // optional double txdrop = 9;
+  bool has_txdrop() const;
+  private:
+  bool _internal_has_txdrop() const;
+  public:
+  void clear_txdrop();
+  double txdrop() const;
+  void set_txdrop(double value);
+  private:
+  double _internal_txdrop() const;
+  void _internal_set_txdrop(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarIfaceInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double rxpck_;
+    double txpck_;
+    double rxbyt_;
+    double txbyt_;
+    double rxerr_;
+    double txerr_;
+    double rxdrop_;
+    double txdrop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarNetnsInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarNetnsInfo) */ {
+ public:
+  inline SarInfo_SarNetnsInfo() : SarInfo_SarNetnsInfo(nullptr) {}
+  ~SarInfo_SarNetnsInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarNetnsInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarNetnsInfo(const SarInfo_SarNetnsInfo& from);
+  SarInfo_SarNetnsInfo(SarInfo_SarNetnsInfo&& from) noexcept
+    : SarInfo_SarNetnsInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarNetnsInfo& operator=(const SarInfo_SarNetnsInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarNetnsInfo& operator=(SarInfo_SarNetnsInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarNetnsInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarNetnsInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarNetnsInfo*>(
+               &_SarInfo_SarNetnsInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SarInfo_SarNetnsInfo& a, SarInfo_SarNetnsInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarNetnsInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarNetnsInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarNetnsInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarNetnsInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarNetnsInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarNetnsInfo& from) {
+    SarInfo_SarNetnsInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarNetnsInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarNetnsInfo";
+  }
+  protected:
+  explicit SarInfo_SarNetnsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIfaceFieldNumber = 12,
+    kNameFieldNumber = 1,
+    kInodeFieldNumber = 2,
+    kRxpckFieldNumber = 4,
+    kTxpckFieldNumber = 5,
+    kRxbytFieldNumber = 6,
+    kTxbytFieldNumber = 7,
+    kRxerrFieldNumber = 8,
+    kTxerrFieldNumber = 9,
+    kRxdropFieldNumber = 10,
+    kTxdropFieldNumber = 11,
+    kPidFieldNumber = 3,
+  };
+  // repeated .SarInfo.SarIfaceInfo iface = 12;
+  int iface_size() const;
+  private:
+  int _internal_iface_size() const;
+  public:
+  void clear_iface();
+  ::SarInfo_SarIfaceInfo* mutable_iface(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarIfaceInfo >*
+      mutable_iface();
+  private:
+  const ::SarInfo_SarIfaceInfo& _internal_iface(int index) const;
+  ::SarInfo_SarIfaceInfo* _internal_add_iface();
+  public:
+  const ::SarInfo_SarIfaceInfo& iface(int index) const;
+  ::SarInfo_SarIfaceInfo* add_iface();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarIfaceInfo >&
+      iface() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional uint64 inode = 2;
+  bool has_inode() const;
+  private:
+  bool _internal_has_inode() const;
+  public:
+  void clear_inode();
+  uint64_t inode() const;
+  void set_inode(uint64_t value);
+  private:
+  uint64_t _internal_inode() const;
+  void _internal_set_inode(uint64_t value);
+  public:
+
+  // optional double rxpck = 4;
+  bool has_rxpck() const;
+  private:
+  bool _internal_has_rxpck() const;
+  public:
+  void clear_rxpck();
+  double rxpck() const;
+  void set_rxpck(double value);
+  private:
+  double _internal_rxpck() const;
+  void _internal_set_rxpck(double value);
+  public:
+
+  // optional double txpck = 5;
+  bool has_txpck() const;
+  private:
+  bool _internal_has_txpck() const;
+  public:
+  void clear_txpck();
+  double txpck() const;
+  void set_txpck(double value);
+  private:
+  double _internal_txpck() const;
+  void _internal_set_txpck(double value);
+  public:
+
+  // optional double rxbyt = 6;
+  bool has_rxbyt() const;
+  private:
+  bool _internal_has_rxbyt() const;
+  public:
+  void clear_rxbyt();
+  double rxbyt() const;
+  void set_rxbyt(double value);
+  private:
+  double _internal_rxbyt() const;
+  void _internal_set_rxbyt(double value);
+  public:
+
+  // optional double txbyt = 7;
+  bool has_txbyt() const;
+  private:
+  bool _internal_has_txbyt() const;
+  public:
+  void clear_txbyt();
+  double txbyt() const;
+  void set_txbyt(double value);
+  private:
+  double _internal_txbyt() const;
+  void _internal_set_txbyt(double value);
+  public:
+
+  // optional double rxerr = 8;
+  bool has_rxerr() const;
+  private:
+  bool _internal_has_rxerr() const;
+  public:
+  void clear_rxerr();
+  double rxerr() const;
+  void set_rxerr(double value);
+  private:
+  double _internal_rxerr() const;
+  void _internal_set_rxerr(double value);
+  public:
+
+  // optional double txerr = 9;
+  bool has_txerr() const;
+  private:
+  bool _internal_has_txerr() const;
+  public:
+  void clear_txerr();
+  double txerr() const;
+  void set_txerr(double value);
+  private:
+  double _internal_txerr() const;
+  void _internal_set_txerr(double value);
+  public:
+
+  // optional double rxdrop = 10;
+  bool has_rxdrop() const;
+  private:
+  bool _internal_has_rxdrop() const;
+  public:
+  void clear_rxdrop();
+  double rxdrop() const;
+  void set_rxdrop(double value);
+  private:
+  double _internal_rxdrop() const;
+  void _internal_set_rxdrop(double value);
+  public:
+
+  // optional double txdrop = 11;
+  bool has_txdrop() const;
+  private:
+  bool _internal_has_txdrop() const;
+  public:
+  void clear_txdrop();
+  double txdrop() const;
+  void set_txdrop(double value);
+  private:
+  double _internal_txdrop() const;
+  void _internal_set_txdrop(double value);
+  public:
+
+  // optional int32 pid = 3;
+  bool has_pid() const;
+  private:
+  bool _internal_has_pid() const;
+  public:
+  void clear_pid();
+  int32_t pid() const;
+  void set_pid(int32_t value);
+  private:
+  int32_t _internal_pid() const;
+  void _internal_set_pid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarNetnsInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarIfaceInfo > iface_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t inode_;
+    double rxpck_;
+    double txpck_;
+    double rxbyt_;
+    double txbyt_;
+    double rxerr_;
+    double txerr_;
+    double rxdrop_;
+    double txdrop_;
+    int32_t pid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarFsInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarFsInfo) */ {
+ public:
+  inline SarInfo_SarFsInfo() : SarInfo_SarFsInfo(nullptr) {}
+  ~SarInfo_SarFsInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarFsInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarFsInfo(const SarInfo_SarFsInfo& from);
+  SarInfo_SarFsInfo(SarInfo_SarFsInfo&& from) noexcept
+    : SarInfo_SarFsInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarFsInfo& operator=(const SarInfo_SarFsInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarFsInfo& operator=(SarInfo_SarFsInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarFsInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarFsInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarFsInfo*>(
+               &_SarInfo_SarFsInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SarInfo_SarFsInfo& a, SarInfo_SarFsInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarFsInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarFsInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarFsInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarFsInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarFsInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarFsInfo& from) {
+    SarInfo_SarFsInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarFsInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarFsInfo";
+  }
+  protected:
+  explicit SarInfo_SarFsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMountPointFieldNumber = 1,
+    kFsTypeFieldNumber = 2,
+    kSourceFieldNumber = 3,
+    kSizeFieldNumber = 4,
+    kUsedFieldNumber = 5,
+    kAvailFieldNumber = 6,
+    kUsedPctFieldNumber = 7,
+    kFreePctFieldNumber = 8,
+    kInodeUsedPctFieldNumber = 9,
+    kGrowthFieldNumber = 10,
+    kTimeToFullFieldNumber = 11,
+  };
+  // optional string mount_point = 1;
+  bool has_mount_point() const;
+  private:
+  bool _internal_has_mount_point() const;
+  public:
+  void clear_mount_point();
+  const std::string& mount_point() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mount_point(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mount_point();
+  PROTOBUF_NODISCARD std::string* release_mount_point();
+  void set_allocated_mount_point(std::string* mount_point);
+  private:
+  const std::string& _internal_mount_point() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mount_point(const std::string& value);
+  std::string* _internal_mutable_mount_point();
+  public:
+
+  // optional string fs_type = 2;
+  bool has_fs_type() const;
+  private:
+  bool _internal_has_fs_type() const;
+  public:
+  void clear_fs_type();
+  const std::string& fs_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_fs_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_fs_type();
+  PROTOBUF_NODISCARD std::string* release_fs_type();
+  void set_allocated_fs_type(std::string* fs_type);
+  private:
+  const std::string& _internal_fs_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_fs_type(const std::string& value);
+  std::string* _internal_mutable_fs_type();
+  public:
+
+  // optional string source = 3;
+  bool has_source() const;
+  private:
+  bool _internal_has_source() const;
+  public:
+  void clear_source();
+  const std::string& source() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* source);
+  private:
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(const std::string& value);
+  std::string* _internal_mutable_source();
+  public:
+
+  // optional uint64 size = 4;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // optional uint64 used = 5;
+  bool has_used() const;
+  private:
+  bool _internal_has_used() const;
+  public:
+  void clear_used();
+  uint64_t used() const;
+  void set_used(uint64_t value);
+  private:
+  uint64_t _internal_used() const;
+  void _internal_set_used(uint64_t value);
+  public:
+
+  // optional uint64 avail = 6;
+  bool has_avail() const;
+  private:
+  bool _internal_has_avail() const;
+  public:
+  void clear_avail();
+  uint64_t avail() const;
+  void set_avail(uint64_t value);
+  private:
+  uint64_t _internal_avail() const;
+  void _internal_set_avail(uint64_t value);
+  public:
+
+  // optional double used_pct = 7;
+  bool has_used_pct() const;
+  private:
+  bool _internal_has_used_pct() const;
+  public:
+  void clear_used_pct();
+  double used_pct() const;
+  void set_used_pct(double value);
+  private:
+  double _internal_used_pct() const;
+  void _internal_set_used_pct(double value);
+  public:
+
+  // optional double free_pct = 8;
+  bool has_free_pct() const;
+  private:
+  bool _internal_has_free_pct() const;
+  public:
+  void clear_free_pct();
+  double free_pct() const;
+  void set_free_pct(double value);
+  private:
+  double _internal_free_pct() const;
+  void _internal_set_free_pct(double value);
+  public:
+
+  // optional double inode_used_pct = 9;
+  bool has_inode_used_pct() const;
+  private:
+  bool _internal_has_inode_used_pct() const;
+  public:
+  void clear_inode_used_pct();
+  double inode_used_pct() const;
+  void set_inode_used_pct(double value);
+  private:
+  double _internal_inode_used_pct() const;
+  void _internal_set_inode_used_pct(double value);
+  public:
+
+  // optional double growth = 10;
+  bool has_growth() const;
+  private:
+  bool _internal_has_growth() const;
+  public:
+  void clear_growth();
+  double growth() const;
+  void set_growth(double value);
+  private:
+  double _internal_growth() const;
+  void _internal_set_growth(double value);
+  public:
+
+  // optional double time_to_full = 11;
+  bool has_time_to_full() const;
+  private:
+  bool _internal_has_time_to_full() const;
+  public:
+  void clear_time_to_full();
+  double time_to_full() const;
+  void set_time_to_full(double value);
+  private:
+  double _internal_time_to_full() const;
+  void _internal_set_time_to_full(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarFsInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mount_point_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr fs_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_;
+    uint64_t size_;
+    uint64_t used_;
+    uint64_t avail_;
+    double used_pct_;
+    double free_pct_;
+    double inode_used_pct_;
+    double growth_;
+    double time_to_full_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarCpuGroupInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarCpuGroupInfo) */ {
+ public:
+  inline SarInfo_SarCpuGroupInfo() : SarInfo_SarCpuGroupInfo(nullptr) {}
+  ~SarInfo_SarCpuGroupInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarCpuGroupInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarCpuGroupInfo(const SarInfo_SarCpuGroupInfo& from);
+  SarInfo_SarCpuGroupInfo(SarInfo_SarCpuGroupInfo&& from) noexcept
+    : SarInfo_SarCpuGroupInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarCpuGroupInfo& operator=(const SarInfo_SarCpuGroupInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarCpuGroupInfo& operator=(SarInfo_SarCpuGroupInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarCpuGroupInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarCpuGroupInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarCpuGroupInfo*>(
+               &_SarInfo_SarCpuGroupInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(SarInfo_SarCpuGroupInfo& a, SarInfo_SarCpuGroupInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarCpuGroupInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarCpuGroupInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarCpuGroupInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarCpuGroupInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarCpuGroupInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarCpuGroupInfo& from) {
+    SarInfo_SarCpuGroupInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarCpuGroupInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarCpuGroupInfo";
+  }
+  protected:
+  explicit SarInfo_SarCpuGroupInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPackageIdFieldNumber = 2,
+    kCpuUserFieldNumber = 4,
+    kCpuNiceFieldNumber = 5,
+    kCpuSystemFieldNumber = 6,
+    kCpuIowaitFieldNumber = 7,
+    kCpuStealFieldNumber = 8,
+    kCpuIdleFieldNumber = 9,
+    kNrCpusFieldNumber = 3,
+  };
+  // optional int32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 package_id = 2;
+  bool has_package_id() const;
+  private:
+  bool _internal_has_package_id() const;
+  public:
+  void clear_package_id();
+  int32_t package_id() const;
+  void set_package_id(int32_t value);
+  private:
+  int32_t _internal_package_id() const;
+  void _internal_set_package_id(int32_t value);
+  public:
+
+  // optional double cpu_user = 4;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_nice = 5;
+  bool has_cpu_nice() const;
+  private:
+  bool _internal_has_cpu_nice() const;
+  public:
+  void clear_cpu_nice();
+  double cpu_nice() const;
+  void set_cpu_nice(double value);
+  private:
+  double _internal_cpu_nice() const;
+  void _internal_set_cpu_nice(double value);
+  public:
+
+  // optional double cpu_system = 6;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional double cpu_iowait = 7;
+  bool has_cpu_iowait() const;
+  private:
+  bool _internal_has_cpu_iowait() const;
+  public:
+  void clear_cpu_iowait();
+  double cpu_iowait() const;
+  void set_cpu_iowait(double value);
+  private:
+  double _internal_cpu_iowait() const;
+  void _internal_set_cpu_iowait(double value);
+  public:
+
+  // optional double cpu_steal = 8;
+  bool has_cpu_steal() const;
+  private:
+  bool _internal_has_cpu_steal() const;
+  public:
+  void clear_cpu_steal();
+  double cpu_steal() const;
+  void set_cpu_steal(double value);
+  private:
+  double _internal_cpu_steal() const;
+  void _internal_set_cpu_steal(double value);
+  public:
+
+  // optional double cpu_idle = 9;
+  bool has_cpu_idle() const;
+  private:
+  bool _internal_has_cpu_idle() const;
+  public:
+  void clear_cpu_idle();
+  double cpu_idle() const;
+  void set_cpu_idle(double value);
+  private:
+  double _internal_cpu_idle() const;
+  void _internal_set_cpu_idle(double value);
+  public:
+
+  // optional int32 nr_cpus = 3;
+  bool has_nr_cpus() const;
+  private:
+  bool _internal_has_nr_cpus() const;
+  public:
+  void clear_nr_cpus();
+  int32_t nr_cpus() const;
+  void set_nr_cpus(int32_t value);
+  private:
+  int32_t _internal_nr_cpus() const;
+  void _internal_set_nr_cpus(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarCpuGroupInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+    int32_t package_id_;
+    double cpu_user_;
+    double cpu_nice_;
+    double cpu_system_;
+    double cpu_iowait_;
+    double cpu_steal_;
+    double cpu_idle_;
+    int32_t nr_cpus_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarNodeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarNodeInfo) */ {
+ public:
+  inline SarInfo_SarNodeInfo() : SarInfo_SarNodeInfo(nullptr) {}
+  ~SarInfo_SarNodeInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarNodeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarNodeInfo(const SarInfo_SarNodeInfo& from);
+  SarInfo_SarNodeInfo(SarInfo_SarNodeInfo&& from) noexcept
+    : SarInfo_SarNodeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarNodeInfo& operator=(const SarInfo_SarNodeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarNodeInfo& operator=(SarInfo_SarNodeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarNodeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarNodeInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarNodeInfo*>(
+               &_SarInfo_SarNodeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SarInfo_SarNodeInfo& a, SarInfo_SarNodeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarNodeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarNodeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarNodeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarNodeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarNodeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarNodeInfo& from) {
+    SarInfo_SarNodeInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarNodeInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarNodeInfo";
+  }
+  protected:
+  explicit SarInfo_SarNodeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeFieldNumber = 1,
+    kNrCpusFieldNumber = 2,
+    kCpuUserFieldNumber = 3,
+    kCpuNiceFieldNumber = 4,
+    kCpuSystemFieldNumber = 5,
+    kCpuIowaitFieldNumber = 6,
+    kCpuStealFieldNumber = 7,
+    kCpuIdleFieldNumber = 8,
+    kMemTotalFieldNumber = 9,
+    kMemFreeFieldNumber = 10,
+    kNumaHitFieldNumber = 11,
+    kNumaMissFieldNumber = 12,
+    kNumaForeignFieldNumber = 13,
+    kLocalNodeFieldNumber = 14,
+    kOtherNodeFieldNumber = 15,
+  };
+  // optional int32 node = 1;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  int32_t node() const;
+  void set_node(int32_t value);
+  private:
+  int32_t _internal_node() const;
+  void _internal_set_node(int32_t value);
+  public:
+
+  // optional int32 nr_cpus = 2;
+  bool has_nr_cpus() const;
+  private:
+  bool _internal_has_nr_cpus() const;
+  public:
+  void clear_nr_cpus();
+  int32_t nr_cpus() const;
+  void set_nr_cpus(int32_t value);
+  private:
+  int32_t _internal_nr_cpus() const;
+  void _internal_set_nr_cpus(int32_t value);
+  public:
+
+  // optional double cpu_user = 3;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_nice = 4;
+  bool has_cpu_nice() const;
+  private:
+  bool _internal_has_cpu_nice() const;
+  public:
+  void clear_cpu_nice();
+  double cpu_nice() const;
+  void set_cpu_nice(double value);
+  private:
+  double _internal_cpu_nice() const;
+  void _internal_set_cpu_nice(double value);
+  public:
+
+  // optional double cpu_system = 5;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional double cpu_iowait = 6;
+  bool has_cpu_iowait() const;
+  private:
+  bool _internal_has_cpu_iowait() const;
+  public:
+  void clear_cpu_iowait();
+  double cpu_iowait() const;
+  void set_cpu_iowait(double value);
+  private:
+  double _internal_cpu_iowait() const;
+  void _internal_set_cpu_iowait(double value);
+  public:
+
+  // optional double cpu_steal = 7;
+  bool has_cpu_steal() const;
+  private:
+  bool _internal_has_cpu_steal() const;
+  public:
+  void clear_cpu_steal();
+  double cpu_steal() const;
+  void set_cpu_steal(double value);
+  private:
+  double _internal_cpu_steal() const;
+  void _internal_set_cpu_steal(double value);
+  public:
+
+  // optional double cpu_idle = 8;
+  bool has_cpu_idle() const;
+  private:
+  bool _internal_has_cpu_idle() const;
+  public:
+  void clear_cpu_idle();
+  double cpu_idle() const;
+  void set_cpu_idle(double value);
+  private:
+  double _internal_cpu_idle() const;
+  void _internal_set_cpu_idle(double value);
+  public:
+
+  // optional uint64 mem_total = 9;
+  bool has_mem_total() const;
+  private:
+  bool _internal_has_mem_total() const;
+  public:
+  void clear_mem_total();
+  uint64_t mem_total() const;
+  void set_mem_total(uint64_t value);
+  private:
+  uint64_t _internal_mem_total() const;
+  void _internal_set_mem_total(uint64_t value);
+  public:
+
+  // optional uint64 mem_free = 10;
+  bool has_mem_free() const;
+  private:
+  bool _internal_has_mem_free() const;
+  public:
+  void clear_mem_free();
+  uint64_t mem_free() const;
+  void set_mem_free(uint64_t value);
+  private:
+  uint64_t _internal_mem_free() const;
+  void _internal_set_mem_free(uint64_t value);
+  public:
+
+  // optional double numa_hit = 11;
+  bool has_numa_hit() const;
+  private:
+  bool _internal_has_numa_hit() const;
+  public:
+  void clear_numa_hit();
+  double numa_hit() const;
+  void set_numa_hit(double value);
+  private:
+  double _internal_numa_hit() const;
+  void _internal_set_numa_hit(double value);
+  public:
+
+  // optional double numa_miss = 12;
+  bool has_numa_miss() const;
+  private:
+  bool _internal_has_numa_miss() const;
+  public:
+  void clear_numa_miss();
+  double numa_miss() const;
+  void set_numa_miss(double value);
+  private:
+  double _internal_numa_miss() const;
+  void _internal_set_numa_miss(double value);
+  public:
+
+  // optional double numa_foreign = 13;
+  bool has_numa_foreign() const;
+  private:
+  bool _internal_has_numa_foreign() const;
+  public:
+  void clear_numa_foreign();
+  double numa_foreign() const;
+  void set_numa_foreign(double value);
+  private:
+  double _internal_numa_foreign() const;
+  void _internal_set_numa_foreign(double value);
+  public:
+
+  // optional double local_node = 14;
+  bool has_local_node() const;
+  private:
+  bool _internal_has_local_node() const;
+  public:
+  void clear_local_node();
+  double local_node() const;
+  void set_local_node(double value);
+  private:
+  double _internal_local_node() const;
+  void _internal_set_local_node(double value);
+  public:
+
+  // optional double other_node = 15;
+  bool has_other_node() const;
+  private:
+  bool _internal_has_other_node() const;
+  public:
+  void clear_other_node();
+  double other_node() const;
+  void set_other_node(double value);
+  private:
+  double _internal_other_node() const;
+  void _internal_set_other_node(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarNodeInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t node_;
+    int32_t nr_cpus_;
+    double cpu_user_;
+    double cpu_nice_;
+    double cpu_system_;
+    double cpu_iowait_;
+    double cpu_steal_;
+    double cpu_idle_;
+    uint64_t mem_total_;
+    uint64_t mem_free_;
+    double numa_hit_;
+    double numa_miss_;
+    double numa_foreign_;
+    double local_node_;
+    double other_node_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo_SarSketch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo.SarSketch) */ {
+ public:
+  inline SarInfo_SarSketch() : SarInfo_SarSketch(nullptr) {}
+  ~SarInfo_SarSketch() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo_SarSketch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo_SarSketch(const SarInfo_SarSketch& from);
+  SarInfo_SarSketch(SarInfo_SarSketch&& from) noexcept
+    : SarInfo_SarSketch() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo_SarSketch& operator=(const SarInfo_SarSketch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo_SarSketch& operator=(SarInfo_SarSketch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo_SarSketch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo_SarSketch* internal_default_instance() {
+    return reinterpret_cast<const SarInfo_SarSketch*>(
+               &_SarInfo_SarSketch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SarInfo_SarSketch& a, SarInfo_SarSketch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo_SarSketch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo_SarSketch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo_SarSketch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo_SarSketch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo_SarSketch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo_SarSketch& from) {
+    SarInfo_SarSketch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo_SarSketch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo.SarSketch";
+  }
+  protected:
+  explicit SarInfo_SarSketch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountsFieldNumber = 9,
+    kNegativeCountsFieldNumber = 11,
+    kNameFieldNumber = 1,
+    kRelativeAccuracyFieldNumber = 2,
+    kCountFieldNumber = 3,
+    kSumFieldNumber = 4,
+    kMinFieldNumber = 5,
+    kMaxFieldNumber = 6,
+    kZeroCountFieldNumber = 7,
+    kOffsetFieldNumber = 8,
+    kNegativeOffsetFieldNumber = 10,
+  };
+  // repeated uint64 counts = 9 [packed = true];
+  int counts_size() const;
+  private:
+  int _internal_counts_size() const;
+  public:
+  void clear_counts();
+  private:
+  uint64_t _internal_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_counts() const;
+  void _internal_add_counts(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_counts();
+  public:
+  uint64_t counts(int index) const;
+  void set_counts(int index, uint64_t value);
+  void add_counts(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_counts();
+
+  // repeated uint64 negative_counts = 11 [packed = true];
+  int negative_counts_size() const;
+  private:
+  int _internal_negative_counts_size() const;
+  public:
+  void clear_negative_counts();
+  private:
+  uint64_t _internal_negative_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_negative_counts() const;
+  void _internal_add_negative_counts(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_negative_counts();
+  public:
+  uint64_t negative_counts(int index) const;
+  void set_negative_counts(int index, uint64_t value);
+  void add_negative_counts(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      negative_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_negative_counts();
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional double relative_accuracy = 2;
+  bool has_relative_accuracy() const;
+  private:
+  bool _internal_has_relative_accuracy() const;
+  public:
+  void clear_relative_accuracy();
+  double relative_accuracy() const;
+  void set_relative_accuracy(double value);
+  private:
+  double _internal_relative_accuracy() const;
+  void _internal_set_relative_accuracy(double value);
+  public:
+
+  // optional uint64 count = 3;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // optional double sum = 4;
+  bool has_sum() const;
+  private:
+  bool _internal_has_sum() const;
+  public:
+  void clear_sum();
+  double sum() const;
+  void set_sum(double value);
+  private:
+  double _internal_sum() const;
+  void _internal_set_sum(double value);
+  public:
+
+  // optional double min = 5;
+  bool has_min() const;
+  private:
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  double min() const;
+  void set_min(double value);
+  private:
+  double _internal_min() const;
+  void _internal_set_min(double value);
+  public:
+
+  // optional double max = 6;
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  double max() const;
+  void set_max(double value);
+  private:
+  double _internal_max() const;
+  void _internal_set_max(double value);
+  public:
+
+  // optional uint64 zero_count = 7;
+  bool has_zero_count() const;
+  private:
+  bool _internal_has_zero_count() const;
+  public:
+  void clear_zero_count();
+  uint64_t zero_count() const;
+  void set_zero_count(uint64_t value);
+  private:
+  uint64_t _internal_zero_count() const;
+  void _internal_set_zero_count(uint64_t value);
+  public:
+
+  // optional sint32 offset = 8;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
+  // optional sint32 negative_offset = 10;
+  bool has_negative_offset() const;
+  private:
+  bool _internal_has_negative_offset() const;
+  public:
+  void clear_negative_offset();
+  int32_t negative_offset() const;
+  void set_negative_offset(int32_t value);
+  private:
+  int32_t _internal_negative_offset() const;
+  void _internal_set_negative_offset(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo.SarSketch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > counts_;
+    mutable std::atomic<int> _counts_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > negative_counts_;
+    mutable std::atomic<int> _negative_counts_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double relative_accuracy_;
+    uint64_t count_;
+    double sum_;
+    double min_;
+    double max_;
+    uint64_t zero_count_;
+    int32_t offset_;
+    int32_t negative_offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SarInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SarInfo) */ {
+ public:
+  inline SarInfo() : SarInfo(nullptr) {}
+  ~SarInfo() override;
+  explicit PROTOBUF_CONSTEXPR SarInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SarInfo(const SarInfo& from);
+  SarInfo(SarInfo&& from) noexcept
+    : SarInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SarInfo& operator=(const SarInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SarInfo& operator=(SarInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SarInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SarInfo* internal_default_instance() {
+    return reinterpret_cast<const SarInfo*>(
+               &_SarInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SarInfo& a, SarInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SarInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SarInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SarInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SarInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SarInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SarInfo& from) {
+    SarInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SarInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SarInfo";
+  }
+  protected:
+  explicit SarInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SarInfo_SarDiskInfo SarDiskInfo;
+  typedef SarInfo_SarNetProtoInfo SarNetProtoInfo;
+  typedef SarInfo_SarCpuInfo SarCpuInfo;
+  typedef SarInfo_SarTaskSchedInfo SarTaskSchedInfo;
+  typedef SarInfo_SarPsiInfo SarPsiInfo;
+  typedef SarInfo_SarCgroupInfo SarCgroupInfo;
+  typedef SarInfo_SarProcessInfo SarProcessInfo;
+  typedef SarInfo_SarIfaceInfo SarIfaceInfo;
+  typedef SarInfo_SarNetnsInfo SarNetnsInfo;
+  typedef SarInfo_SarFsInfo SarFsInfo;
+  typedef SarInfo_SarCpuGroupInfo SarCpuGroupInfo;
+  typedef SarInfo_SarNodeInfo SarNodeInfo;
+  typedef SarInfo_SarSketch SarSketch;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSarDiskInfoFieldNumber = 38,
+    kSarCpuInfoFieldNumber = 40,
+    kSarTaskSchedInfoFieldNumber = 46,
+    kSarCgroupInfoFieldNumber = 50,
+    kSarProcessInfoFieldNumber = 51,
+    kSarNetnsInfoFieldNumber = 52,
+    kSarFsInfoFieldNumber = 53,
+    kSarCoreInfoFieldNumber = 54,
+    kSarSocketInfoFieldNumber = 55,
+    kSarNodeInfoFieldNumber = 56,
+    kSarSketchFieldNumber = 57,
+    kNetProtoFieldNumber = 39,
+    kPsiCpuFieldNumber = 47,
+    kPsiMemoryFieldNumber = 48,
+    kPsiIoFieldNumber = 49,
+    kRxpckFieldNumber = 1,
+    kTxpckFieldNumber = 2,
+    kRxbytFieldNumber = 3,
+    kTxbytFieldNumber = 4,
+    kRxcmpFieldNumber = 5,
+    kTxcmpFieldNumber = 6,
+    kRxmcstFieldNumber = 7,
+    kRxerrFieldNumber = 8,
+    kTxerrFieldNumber = 9,
+    kCollFieldNumber = 10,
+    kRxdropFieldNumber = 11,
+    kTxdropFieldNumber = 12,
+    kTxcarrFieldNumber = 13,
+    kRxframFieldNumber = 14,
+    kRxfifoFieldNumber = 15,
+    kTxfifoFieldNumber = 16,
+    kNrProcessesFieldNumber = 17,
+    kCpuUserFieldNumber = 18,
+    kCpuNiceFieldNumber = 19,
+    kCpuSystemFieldNumber = 20,
+    kCpuIowaitFieldNumber = 21,
+    kCpuStealFieldNumber = 22,
+    kCpuIdleFieldNumber = 23,
+    kPgpginFieldNumber = 24,
+    kPgpgoutFieldNumber = 25,
+    kPgfaultFieldNumber = 26,
+    kPgmajfaultFieldNumber = 27,
+    kPswpinFieldNumber = 28,
+    kPswpoutFieldNumber = 29,
+    kTpsFieldNumber = 30,
+    kRtpsFieldNumber = 31,
+    kWtpsFieldNumber = 32,
+    kBreadFieldNumber = 33,
+    kBwrtnFieldNumber = 34,
+    kFrmpgFieldNumber = 35,
+    kBufpgFieldNumber = 36,
+    kCampgFieldNumber = 37,
+    kSoftnetProcessedFieldNumber = 41,
+    kSoftnetDroppedFieldNumber = 42,
+    kSoftnetTimeSqueezeFieldNumber = 43,
+    kSchedRunDelayFieldNumber = 45,
+    kSoftnetSqueezedCpusFieldNumber = 44,
+  };
+  // repeated .SarInfo.SarDiskInfo sar_disk_info = 38;
+  int sar_disk_info_size() const;
+  private:
+  int _internal_sar_disk_info_size() const;
+  public:
+  void clear_sar_disk_info();
+  ::SarInfo_SarDiskInfo* mutable_sar_disk_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarDiskInfo >*
+      mutable_sar_disk_info();
+  private:
+  const ::SarInfo_SarDiskInfo& _internal_sar_disk_info(int index) const;
+  ::SarInfo_SarDiskInfo* _internal_add_sar_disk_info();
+  public:
+  const ::SarInfo_SarDiskInfo& sar_disk_info(int index) const;
+  ::SarInfo_SarDiskInfo* add_sar_disk_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarDiskInfo >&
+      sar_disk_info() const;
+
+  // repeated .SarInfo.SarCpuInfo sar_cpu_info = 40;
+  int sar_cpu_info_size() const;
+  private:
+  int _internal_sar_cpu_info_size() const;
+  public:
+  void clear_sar_cpu_info();
+  ::SarInfo_SarCpuInfo* mutable_sar_cpu_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuInfo >*
+      mutable_sar_cpu_info();
+  private:
+  const ::SarInfo_SarCpuInfo& _internal_sar_cpu_info(int index) const;
+  ::SarInfo_SarCpuInfo* _internal_add_sar_cpu_info();
+  public:
+  const ::SarInfo_SarCpuInfo& sar_cpu_info(int index) const;
+  ::SarInfo_SarCpuInfo* add_sar_cpu_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuInfo >&
+      sar_cpu_info() const;
+
+  // repeated .SarInfo.SarTaskSchedInfo sar_task_sched_info = 46;
+  int sar_task_sched_info_size() const;
+  private:
+  int _internal_sar_task_sched_info_size() const;
+  public:
+  void clear_sar_task_sched_info();
+  ::SarInfo_SarTaskSchedInfo* mutable_sar_task_sched_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarTaskSchedInfo >*
+      mutable_sar_task_sched_info();
+  private:
+  const ::SarInfo_SarTaskSchedInfo& _internal_sar_task_sched_info(int index) const;
+  ::SarInfo_SarTaskSchedInfo* _internal_add_sar_task_sched_info();
+  public:
+  const ::SarInfo_SarTaskSchedInfo& sar_task_sched_info(int index) const;
+  ::SarInfo_SarTaskSchedInfo* add_sar_task_sched_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarTaskSchedInfo >&
+      sar_task_sched_info() const;
+
+  // repeated .SarInfo.SarCgroupInfo sar_cgroup_info = 50;
+  int sar_cgroup_info_size() const;
+  private:
+  int _internal_sar_cgroup_info_size() const;
+  public:
+  void clear_sar_cgroup_info();
+  ::SarInfo_SarCgroupInfo* mutable_sar_cgroup_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCgroupInfo >*
+      mutable_sar_cgroup_info();
+  private:
+  const ::SarInfo_SarCgroupInfo& _internal_sar_cgroup_info(int index) const;
+  ::SarInfo_SarCgroupInfo* _internal_add_sar_cgroup_info();
+  public:
+  const ::SarInfo_SarCgroupInfo& sar_cgroup_info(int index) const;
+  ::SarInfo_SarCgroupInfo* add_sar_cgroup_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCgroupInfo >&
+      sar_cgroup_info() const;
+
+  // repeated .SarInfo.SarProcessInfo sar_process_info = 51;
+  int sar_process_info_size() const;
+  private:
+  int _internal_sar_process_info_size() const;
+  public:
+  void clear_sar_process_info();
+  ::SarInfo_SarProcessInfo* mutable_sar_process_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarProcessInfo >*
+      mutable_sar_process_info();
+  private:
+  const ::SarInfo_SarProcessInfo& _internal_sar_process_info(int index) const;
+  ::SarInfo_SarProcessInfo* _internal_add_sar_process_info();
+  public:
+  const ::SarInfo_SarProcessInfo& sar_process_info(int index) const;
+  ::SarInfo_SarProcessInfo* add_sar_process_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarProcessInfo >&
+      sar_process_info() const;
+
+  // repeated .SarInfo.SarNetnsInfo sar_netns_info = 52;
+  int sar_netns_info_size() const;
+  private:
+  int _internal_sar_netns_info_size() const;
+  public:
+  void clear_sar_netns_info();
+  ::SarInfo_SarNetnsInfo* mutable_sar_netns_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNetnsInfo >*
+      mutable_sar_netns_info();
+  private:
+  const ::SarInfo_SarNetnsInfo& _internal_sar_netns_info(int index) const;
+  ::SarInfo_SarNetnsInfo* _internal_add_sar_netns_info();
+  public:
+  const ::SarInfo_SarNetnsInfo& sar_netns_info(int index) const;
+  ::SarInfo_SarNetnsInfo* add_sar_netns_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNetnsInfo >&
+      sar_netns_info() const;
+
+  // repeated .SarInfo.SarFsInfo sar_fs_info = 53;
+  int sar_fs_info_size() const;
+  private:
+  int _internal_sar_fs_info_size() const;
+  public:
+  void clear_sar_fs_info();
+  ::SarInfo_SarFsInfo* mutable_sar_fs_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarFsInfo >*
+      mutable_sar_fs_info();
+  private:
+  const ::SarInfo_SarFsInfo& _internal_sar_fs_info(int index) const;
+  ::SarInfo_SarFsInfo* _internal_add_sar_fs_info();
+  public:
+  const ::SarInfo_SarFsInfo& sar_fs_info(int index) const;
+  ::SarInfo_SarFsInfo* add_sar_fs_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarFsInfo >&
+      sar_fs_info() const;
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_core_info = 54;
+  int sar_core_info_size() const;
+  private:
+  int _internal_sar_core_info_size() const;
+  public:
+  void clear_sar_core_info();
+  ::SarInfo_SarCpuGroupInfo* mutable_sar_core_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >*
+      mutable_sar_core_info();
+  private:
+  const ::SarInfo_SarCpuGroupInfo& _internal_sar_core_info(int index) const;
+  ::SarInfo_SarCpuGroupInfo* _internal_add_sar_core_info();
+  public:
+  const ::SarInfo_SarCpuGroupInfo& sar_core_info(int index) const;
+  ::SarInfo_SarCpuGroupInfo* add_sar_core_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >&
+      sar_core_info() const;
+
+  // repeated .SarInfo.SarCpuGroupInfo sar_socket_info = 55;
+  int sar_socket_info_size() const;
+  private:
+  int _internal_sar_socket_info_size() const;
+  public:
+  void clear_sar_socket_info();
+  ::SarInfo_SarCpuGroupInfo* mutable_sar_socket_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >*
+      mutable_sar_socket_info();
+  private:
+  const ::SarInfo_SarCpuGroupInfo& _internal_sar_socket_info(int index) const;
+  ::SarInfo_SarCpuGroupInfo* _internal_add_sar_socket_info();
+  public:
+  const ::SarInfo_SarCpuGroupInfo& sar_socket_info(int index) const;
+  ::SarInfo_SarCpuGroupInfo* add_sar_socket_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >&
+      sar_socket_info() const;
+
+  // repeated .SarInfo.SarNodeInfo sar_node_info = 56;
+  int sar_node_info_size() const;
+  private:
+  int _internal_sar_node_info_size() const;
+  public:
+  void clear_sar_node_info();
+  ::SarInfo_SarNodeInfo* mutable_sar_node_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNodeInfo >*
+      mutable_sar_node_info();
+  private:
+  const ::SarInfo_SarNodeInfo& _internal_sar_node_info(int index) const;
+  ::SarInfo_SarNodeInfo* _internal_add_sar_node_info();
+  public:
+  const ::SarInfo_SarNodeInfo& sar_node_info(int index) const;
+  ::SarInfo_SarNodeInfo* add_sar_node_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNodeInfo >&
+      sar_node_info() const;
+
+  // repeated .SarInfo.SarSketch sar_sketch = 57;
+  int sar_sketch_size() const;
+  private:
+  int _internal_sar_sketch_size() const;
+  public:
+  void clear_sar_sketch();
+  ::SarInfo_SarSketch* mutable_sar_sketch(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarSketch >*
+      mutable_sar_sketch();
+  private:
+  const ::SarInfo_SarSketch& _internal_sar_sketch(int index) const;
+  ::SarInfo_SarSketch* _internal_add_sar_sketch();
+  public:
+  const ::SarInfo_SarSketch& sar_sketch(int index) const;
+  ::SarInfo_SarSketch* add_sar_sketch();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarSketch >&
+      sar_sketch() const;
+
+  // optional .SarInfo.SarNetProtoInfo net_proto = 39;
+  bool has_net_proto() const;
+  private:
+  bool _internal_has_net_proto() const;
+  public:
+  void clear_net_proto();
+  const ::SarInfo_SarNetProtoInfo& net_proto() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarNetProtoInfo* release_net_proto();
+  ::SarInfo_SarNetProtoInfo* mutable_net_proto();
+  void set_allocated_net_proto(::SarInfo_SarNetProtoInfo* net_proto);
+  private:
+  const ::SarInfo_SarNetProtoInfo& _internal_net_proto() const;
+  ::SarInfo_SarNetProtoInfo* _internal_mutable_net_proto();
+  public:
+  void unsafe_arena_set_allocated_net_proto(
+      ::SarInfo_SarNetProtoInfo* net_proto);
+  ::SarInfo_SarNetProtoInfo* unsafe_arena_release_net_proto();
+
+  // optional .SarInfo.SarPsiInfo psi_cpu = 47;
+  bool has_psi_cpu() const;
+  private:
+  bool _internal_has_psi_cpu() const;
+  public:
+  void clear_psi_cpu();
+  const ::SarInfo_SarPsiInfo& psi_cpu() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_cpu();
+  ::SarInfo_SarPsiInfo* mutable_psi_cpu();
+  void set_allocated_psi_cpu(::SarInfo_SarPsiInfo* psi_cpu);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_cpu() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_cpu();
+  public:
+  void unsafe_arena_set_allocated_psi_cpu(
+      ::SarInfo_SarPsiInfo* psi_cpu);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_cpu();
+
+  // optional .SarInfo.SarPsiInfo psi_memory = 48;
+  bool has_psi_memory() const;
+  private:
+  bool _internal_has_psi_memory() const;
+  public:
+  void clear_psi_memory();
+  const ::SarInfo_SarPsiInfo& psi_memory() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_memory();
+  ::SarInfo_SarPsiInfo* mutable_psi_memory();
+  void set_allocated_psi_memory(::SarInfo_SarPsiInfo* psi_memory);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_memory() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_memory();
+  public:
+  void unsafe_arena_set_allocated_psi_memory(
+      ::SarInfo_SarPsiInfo* psi_memory);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_memory();
+
+  // optional .SarInfo.SarPsiInfo psi_io = 49;
+  bool has_psi_io() const;
+  private:
+  bool _internal_has_psi_io() const;
+  public:
+  void clear_psi_io();
+  const ::SarInfo_SarPsiInfo& psi_io() const;
+  PROTOBUF_NODISCARD ::SarInfo_SarPsiInfo* release_psi_io();
+  ::SarInfo_SarPsiInfo* mutable_psi_io();
+  void set_allocated_psi_io(::SarInfo_SarPsiInfo* psi_io);
+  private:
+  const ::SarInfo_SarPsiInfo& _internal_psi_io() const;
+  ::SarInfo_SarPsiInfo* _internal_mutable_psi_io();
+  public:
+  void unsafe_arena_set_allocated_psi_io(
+      ::SarInfo_SarPsiInfo* psi_io);
+  ::SarInfo_SarPsiInfo* unsafe_arena_release_psi_io();
+
+  // optional double rxpck = 1;
+  bool has_rxpck() const;
+  private:
+  bool _internal_has_rxpck() const;
+  public:
+  void clear_rxpck();
+  double rxpck() const;
+  void set_rxpck(double value);
+  private:
+  double _internal_rxpck() const;
+  void _internal_set_rxpck(double value);
+  public:
+
+  // optional double txpck = 2;
+  bool has_txpck() const;
+  private:
+  bool _internal_has_txpck() const;
+  public:
+  void clear_txpck();
+  double txpck() const;
+  void set_txpck(double value);
+  private:
+  double _internal_txpck() const;
+  void _internal_set_txpck(double value);
+  public:
+
+  // optional double rxbyt = 3;
+  bool has_rxbyt() const;
+  private:
+  bool _internal_has_rxbyt() const;
+  public:
+  void clear_rxbyt();
+  double rxbyt() const;
+  void set_rxbyt(double value);
+  private:
+  double _internal_rxbyt() const;
+  void _internal_set_rxbyt(double value);
+  public:
+
+  // optional double txbyt = 4;
+  bool has_txbyt() const;
+  private:
+  bool _internal_has_txbyt() const;
+  public:
+  void clear_txbyt();
+  double txbyt() const;
+  void set_txbyt(double value);
+  private:
+  double _internal_txbyt() const;
+  void _internal_set_txbyt(double value);
+  public:
+
+  // optional double rxcmp = 5;
+  bool has_rxcmp() const;
+  private:
+  bool _internal_has_rxcmp() const;
+  public:
+  void clear_rxcmp();
+  double rxcmp() const;
+  void set_rxcmp(double value);
+  private:
+  double _internal_rxcmp() const;
+  void _internal_set_rxcmp(double value);
+  public:
+
+  // optional double txcmp = 6;
+  bool has_txcmp() const;
+  private:
+  bool _internal_has_txcmp() const;
+  public:
+  void clear_txcmp();
+  double txcmp() const;
+  void set_txcmp(double value);
+  private:
+  double _internal_txcmp() const;
+  void _internal_set_txcmp(double value);
+  public:
+
+  // optional double rxmcst = 7;
+  bool has_rxmcst() const;
+  private:
+  bool _internal_has_rxmcst() const;
+  public:
+  void clear_rxmcst();
+  double rxmcst() const;
+  void set_rxmcst(double value);
+  private:
+  double _internal_rxmcst() const;
+  void _internal_set_rxmcst(double value);
+  public:
+
+  // optional double rxerr = 8;
+  bool has_rxerr() const;
+  private:
+  bool _internal_has_rxerr() const;
+  public:
+  void clear_rxerr();
+  double rxerr() const;
+  void set_rxerr(double value);
+  private:
+  double _internal_rxerr() const;
+  void _internal_set_rxerr(double value);
+  public:
+
+  // optional double txerr = 9;
+  bool has_txerr() const;
+  private:
+  bool _internal_has_txerr() const;
+  public:
+  void clear_txerr();
+  double txerr() const;
+  void set_txerr(double value);
+  private:
+  double _internal_txerr() const;
+  void _internal_set_txerr(double value);
+  public:
+
+  // optional double coll = 10;
+  bool has_coll() const;
+  private:
+  bool _internal_has_coll() const;
+  public:
+  void clear_coll();
+  double coll() const;
+  void set_coll(double value);
+  private:
+  double _internal_coll() const;
+  void _internal_set_coll(double value);
+  public:
+
+  // optional double rxdrop = 11;
+  bool has_rxdrop() const;
+  private:
+  bool _internal_has_rxdrop() const;
+  public:
+  void clear_rxdrop();
+  double rxdrop() const;
+  void set_rxdrop(double value);
+  private:
+  double _internal_rxdrop() const;
+  void _internal_set_rxdrop(double value);
+  public:
+
+  // optional double txdrop = 12;
+  bool has_txdrop() const;
+  private:
+  bool _internal_has_txdrop() const;
+  public:
+  void clear_txdrop();
+  double txdrop() const;
+  void set_txdrop(double value);
+  private:
+  double _internal_txdrop() const;
+  void _internal_set_txdrop(double value);
+  public:
+
+  // optional double txcarr = 13;
+  bool has_txcarr() const;
+  private:
+  bool _internal_has_txcarr() const;
+  public:
+  void clear_txcarr();
+  double txcarr() const;
+  void set_txcarr(double value);
+  private:
+  double _internal_txcarr() const;
+  void _internal_set_txcarr(double value);
+  public:
+
+  // optional double rxfram = 14;
+  bool has_rxfram() const;
+  private:
+  bool _internal_has_rxfram() const;
+  public:
+  void clear_rxfram();
+  double rxfram() const;
+  void set_rxfram(double value);
+  private:
+  double _internal_rxfram() const;
+  void _internal_set_rxfram(double value);
+  public:
+
+  // optional double rxfifo = 15;
+  bool has_rxfifo() const;
+  private:
+  bool _internal_has_rxfifo() const;
+  public:
+  void clear_rxfifo();
+  double rxfifo() const;
+  void set_rxfifo(double value);
+  private:
+  double _internal_rxfifo() const;
+  void _internal_set_rxfifo(double value);
+  public:
+
+  // optional double txfifo = 16;
+  bool has_txfifo() const;
+  private:
+  bool _internal_has_txfifo() const;
+  public:
+  void clear_txfifo();
+  double txfifo() const;
+  void set_txfifo(double value);
+  private:
+  double _internal_txfifo() const;
+  void _internal_set_txfifo(double value);
+  public:
+
+  // optional double nr_processes = 17;
+  bool has_nr_processes() const;
+  private:
+  bool _internal_has_nr_processes() const;
+  public:
+  void clear_nr_processes();
+  double nr_processes() const;
+  void set_nr_processes(double value);
+  private:
+  double _internal_nr_processes() const;
+  void _internal_set_nr_processes(double value);
+  public:
+
+  // optional double cpu_user = 18;
+  bool has_cpu_user() const;
+  private:
+  bool _internal_has_cpu_user() const;
+  public:
+  void clear_cpu_user();
+  double cpu_user() const;
+  void set_cpu_user(double value);
+  private:
+  double _internal_cpu_user() const;
+  void _internal_set_cpu_user(double value);
+  public:
+
+  // optional double cpu_nice = 19;
+  bool has_cpu_nice() const;
+  private:
+  bool _internal_has_cpu_nice() const;
+  public:
+  void clear_cpu_nice();
+  double cpu_nice() const;
+  void set_cpu_nice(double value);
+  private:
+  double _internal_cpu_nice() const;
+  void _internal_set_cpu_nice(double value);
+  public:
+
+  // optional double cpu_system = 20;
+  bool has_cpu_system() const;
+  private:
+  bool _internal_has_cpu_system() const;
+  public:
+  void clear_cpu_system();
+  double cpu_system() const;
+  void set_cpu_system(double value);
+  private:
+  double _internal_cpu_system() const;
+  void _internal_set_cpu_system(double value);
+  public:
+
+  // optional double cpu_iowait = 21;
+  bool has_cpu_iowait() const;
+  private:
+  bool _internal_has_cpu_iowait() const;
+  public:
+  void clear_cpu_iowait();
+  double cpu_iowait() const;
+  void set_cpu_iowait(double value);
+  private:
+  double _internal_cpu_iowait() const;
+  void _internal_set_cpu_iowait(double value);
+  public:
+
+  // optional double cpu_steal = 22;
+  bool has_cpu_steal() const;
+  private:
+  bool _internal_has_cpu_steal() const;
+  public:
+  void clear_cpu_steal();
+  double cpu_steal() const;
+  void set_cpu_steal(double value);
+  private:
+  double _internal_cpu_steal() const;
+  void _internal_set_cpu_steal(double value);
+  public:
+
+  // optional double cpu_idle = 23;
+  bool has_cpu_idle() const;
+  private:
+  bool _internal_has_cpu_idle() const;
+  public:
+  void clear_cpu_idle();
+  double cpu_idle() const;
+  void set_cpu_idle(double value);
+  private:
+  double _internal_cpu_idle() const;
+  void _internal_set_cpu_idle(double value);
+  public:
+
+  // optional double pgpgin = 24;
+  bool has_pgpgin() const;
+  private:
+  bool _internal_has_pgpgin() const;
+  public:
+  void clear_pgpgin();
+  double pgpgin() const;
+  void set_pgpgin(double value);
+  private:
+  double _internal_pgpgin() const;
+  void _internal_set_pgpgin(double value);
+  public:
+
+  // optional double pgpgout = 25;
+  bool has_pgpgout() const;
+  private:
+  bool _internal_has_pgpgout() const;
+  public:
+  void clear_pgpgout();
+  double pgpgout() const;
+  void set_pgpgout(double value);
+  private:
+  double _internal_pgpgout() const;
+  void _internal_set_pgpgout(double value);
+  public:
+
+  // optional double pgfault = 26;
+  bool has_pgfault() const;
+  private:
+  bool _internal_has_pgfault() const;
+  public:
+  void clear_pgfault();
+  double pgfault() const;
+  void set_pgfault(double value);
+  private:
+  double _internal_pgfault() const;
+  void _internal_set_pgfault(double value);
+  public:
+
+  // optional double pgmajfault = 27;
+  bool has_pgmajfault() const;
+  private:
+  bool _internal_has_pgmajfault() const;
+  public:
+  void clear_pgmajfault();
+  double pgmajfault() const;
+  void set_pgmajfault(double value);
+  private:
+  double _internal_pgmajfault() const;
+  void _internal_set_pgmajfault(double value);
+  public:
+
+  // optional double pswpin = 28;
+  bool has_pswpin() const;
+  private:
+  bool _internal_has_pswpin() const;
+  public:
+  void clear_pswpin();
+  double pswpin() const;
+  void set_pswpin(double value);
+  private:
+  double _internal_pswpin() const;
+  void _internal_set_pswpin(double value);
+  public:
+
+  // optional double pswpout = 29;
+  bool has_pswpout() const;
+  private:
+  bool _internal_has_pswpout() const;
+  public:
+  void clear_pswpout();
+  double pswpout() const;
+  void set_pswpout(double value);
+  private:
+  double _internal_pswpout() const;
+  void _internal_set_pswpout(double value);
+  public:
+
+  // optional double tps = 30;
+  bool has_tps() const;
+  private:
+  bool _internal_has_tps() const;
+  public:
+  void clear_tps();
+  double tps() const;
+  void set_tps(double value);
+  private:
+  double _internal_tps() const;
+  void _internal_set_tps(double value);
+  public:
+
+  // optional double rtps = 31;
+  bool has_rtps() const;
+  private:
+  bool _internal_has_rtps() const;
+  public:
+  void clear_rtps();
+  double rtps() const;
+  void set_rtps(double value);
+  private:
+  double _internal_rtps() const;
+  void _internal_set_rtps(double value);
+  public:
+
+  // optional double wtps = 32;
+  bool has_wtps() const;
+  private:
+  bool _internal_has_wtps() const;
+  public:
+  void clear_wtps();
+  double wtps() const;
+  void set_wtps(double value);
+  private:
+  double _internal_wtps() const;
+  void _internal_set_wtps(double value);
+  public:
+
+  // optional double bread = 33;
+  bool has_bread() const;
+  private:
+  bool _internal_has_bread() const;
+  public:
+  void clear_bread();
+  double bread() const;
+  void set_bread(double value);
+  private:
+  double _internal_bread() const;
+  void _internal_set_bread(double value);
+  public:
+
+  // optional double bwrtn = 34;
+  bool has_bwrtn() const;
+  private:
+  bool _internal_has_bwrtn() const;
+  public:
+  void clear_bwrtn();
+  double bwrtn() const;
+  void set_bwrtn(double value);
+  private:
+  double _internal_bwrtn() const;
+  void _internal_set_bwrtn(double value);
+  public:
+
+  // optional double frmpg = 35;
+  bool has_frmpg() const;
+  private:
+  bool _internal_has_frmpg() const;
+  public:
+  void clear_frmpg();
+  double frmpg() const;
+  void set_frmpg(double value);
+  private:
+  double _internal_frmpg() const;
+  void _internal_set_frmpg(double value);
+  public:
+
+  // optional double bufpg = 36;
+  bool has_bufpg() const;
+  private:
+  bool _internal_has_bufpg() const;
+  public:
+  void clear_bufpg();
+  double bufpg() const;
+  void set_bufpg(double value);
+  private:
+  double _internal_bufpg() const;
+  void _internal_set_bufpg(double value);
+  public:
+
+  // optional double campg = 37;
+  bool has_campg() const;
+  private:
+  bool _internal_has_campg() const;
+  public:
+  void clear_campg();
+  double campg() const;
+  void set_campg(double value);
+  private:
+  double _internal_campg() const;
+  void _internal_set_campg(double value);
+  public:
+
+  // optional double softnet_processed = 41;
+  bool has_softnet_processed() const;
+  private:
+  bool _internal_has_softnet_processed() const;
+  public:
+  void clear_softnet_processed();
+  double softnet_processed() const;
+  void set_softnet_processed(double value);
+  private:
+  double _internal_softnet_processed() const;
+  void _internal_set_softnet_processed(double value);
+  public:
+
+  // optional double softnet_dropped = 42;
+  bool has_softnet_dropped() const;
+  private:
+  bool _internal_has_softnet_dropped() const;
+  public:
+  void clear_softnet_dropped();
+  double softnet_dropped() const;
+  void set_softnet_dropped(double value);
+  private:
+  double _internal_softnet_dropped() const;
+  void _internal_set_softnet_dropped(double value);
+  public:
+
+  // optional double softnet_time_squeeze = 43;
+  bool has_softnet_time_squeeze() const;
+  private:
+  bool _internal_has_softnet_time_squeeze() const;
+  public:
+  void clear_softnet_time_squeeze();
+  double softnet_time_squeeze() const;
+  void set_softnet_time_squeeze(double value);
+  private:
+  double _internal_softnet_time_squeeze() const;
+  void _internal_set_softnet_time_squeeze(double value);
+  public:
+
+  // optional double sched_run_delay = 45;
+  bool has_sched_run_delay() const;
+  private:
+  bool _internal_has_sched_run_delay() const;
+  public:
+  void clear_sched_run_delay();
+  double sched_run_delay() const;
+  void set_sched_run_delay(double value);
+  private:
+  double _internal_sched_run_delay() const;
+  void _internal_set_sched_run_delay(double value);
+  public:
+
+  // optional int32 softnet_squeezed_cpus = 44;
+  bool has_softnet_squeezed_cpus() const;
+  private:
+  bool _internal_has_softnet_squeezed_cpus() const;
+  public:
+  void clear_softnet_squeezed_cpus();
+  int32_t softnet_squeezed_cpus() const;
+  void set_softnet_squeezed_cpus(int32_t value);
+  private:
+  int32_t _internal_softnet_squeezed_cpus() const;
+  void _internal_set_softnet_squeezed_cpus(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SarInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<2> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarDiskInfo > sar_disk_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuInfo > sar_cpu_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarTaskSchedInfo > sar_task_sched_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCgroupInfo > sar_cgroup_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarProcessInfo > sar_process_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNetnsInfo > sar_netns_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarFsInfo > sar_fs_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo > sar_core_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo > sar_socket_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNodeInfo > sar_node_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarSketch > sar_sketch_;
+    ::SarInfo_SarNetProtoInfo* net_proto_;
+    ::SarInfo_SarPsiInfo* psi_cpu_;
+    ::SarInfo_SarPsiInfo* psi_memory_;
+    ::SarInfo_SarPsiInfo* psi_io_;
+    double rxpck_;
+    double txpck_;
+    double rxbyt_;
+    double txbyt_;
+    double rxcmp_;
+    double txcmp_;
+    double rxmcst_;
+    double rxerr_;
+    double txerr_;
+    double coll_;
+    double rxdrop_;
+    double txdrop_;
+    double txcarr_;
+    double rxfram_;
+    double rxfifo_;
+    double txfifo_;
+    double nr_processes_;
+    double cpu_user_;
+    double cpu_nice_;
+    double cpu_system_;
+    double cpu_iowait_;
+    double cpu_steal_;
+    double cpu_idle_;
+    double pgpgin_;
+    double pgpgout_;
+    double pgfault_;
+    double pgmajfault_;
+    double pswpin_;
+    double pswpout_;
+    double tps_;
+    double rtps_;
+    double wtps_;
+    double bread_;
+    double bwrtn_;
+    double frmpg_;
+    double bufpg_;
+    double campg_;
+    double softnet_processed_;
+    double softnet_dropped_;
+    double softnet_time_squeeze_;
+    double sched_run_delay_;
+    int32_t softnet_squeezed_cpus_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SarInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SarInfo_SarDiskInfo
+
+// optional double tps = 1;
+inline bool SarInfo_SarDiskInfo::_internal_has_tps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_tps() const {
+  return _internal_has_tps();
+}
+inline void SarInfo_SarDiskInfo::clear_tps() {
+  _impl_.tps_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarDiskInfo::_internal_tps() const {
+  return _impl_.tps_;
+}
+inline double SarInfo_SarDiskInfo::tps() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.tps)
+  return _internal_tps();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_tps(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tps_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_tps(double value) {
+  _internal_set_tps(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.tps)
+}
+
+// optional double rd_sec = 2;
+inline bool SarInfo_SarDiskInfo::_internal_has_rd_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_rd_sec() const {
+  return _internal_has_rd_sec();
+}
+inline void SarInfo_SarDiskInfo::clear_rd_sec() {
+  _impl_.rd_sec_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarDiskInfo::_internal_rd_sec() const {
+  return _impl_.rd_sec_;
+}
+inline double SarInfo_SarDiskInfo::rd_sec() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.rd_sec)
+  return _internal_rd_sec();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_rd_sec(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.rd_sec_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_rd_sec(double value) {
+  _internal_set_rd_sec(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.rd_sec)
+}
+
+// optional double wr_sec = 3;
+inline bool SarInfo_SarDiskInfo::_internal_has_wr_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_wr_sec() const {
+  return _internal_has_wr_sec();
+}
+inline void SarInfo_SarDiskInfo::clear_wr_sec() {
+  _impl_.wr_sec_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarDiskInfo::_internal_wr_sec() const {
+  return _impl_.wr_sec_;
+}
+inline double SarInfo_SarDiskInfo::wr_sec() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.wr_sec)
+  return _internal_wr_sec();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_wr_sec(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.wr_sec_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_wr_sec(double value) {
+  _internal_set_wr_sec(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.wr_sec)
+}
+
+// optional double avgrq_sz = 4;
+inline bool SarInfo_SarDiskInfo::_internal_has_avgrq_sz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_avgrq_sz() const {
+  return _internal_has_avgrq_sz();
+}
+inline void SarInfo_SarDiskInfo::clear_avgrq_sz() {
+  _impl_.avgrq_sz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarDiskInfo::_internal_avgrq_sz() const {
+  return _impl_.avgrq_sz_;
+}
+inline double SarInfo_SarDiskInfo::avgrq_sz() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.avgrq_sz)
+  return _internal_avgrq_sz();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_avgrq_sz(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.avgrq_sz_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_avgrq_sz(double value) {
+  _internal_set_avgrq_sz(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.avgrq_sz)
+}
+
+// optional double avgqu_sz = 5;
+inline bool SarInfo_SarDiskInfo::_internal_has_avgqu_sz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_avgqu_sz() const {
+  return _internal_has_avgqu_sz();
+}
+inline void SarInfo_SarDiskInfo::clear_avgqu_sz() {
+  _impl_.avgqu_sz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarDiskInfo::_internal_avgqu_sz() const {
+  return _impl_.avgqu_sz_;
+}
+inline double SarInfo_SarDiskInfo::avgqu_sz() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.avgqu_sz)
+  return _internal_avgqu_sz();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_avgqu_sz(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.avgqu_sz_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_avgqu_sz(double value) {
+  _internal_set_avgqu_sz(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.avgqu_sz)
+}
+
+// optional double await = 6;
+inline bool SarInfo_SarDiskInfo::_internal_has_await() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_await() const {
+  return _internal_has_await();
+}
+inline void SarInfo_SarDiskInfo::clear_await() {
+  _impl_.await_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarDiskInfo::_internal_await() const {
+  return _impl_.await_;
+}
+inline double SarInfo_SarDiskInfo::await() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.await)
+  return _internal_await();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_await(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.await_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_await(double value) {
+  _internal_set_await(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.await)
+}
+
+// optional double svctm = 7;
+inline bool SarInfo_SarDiskInfo::_internal_has_svctm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_svctm() const {
+  return _internal_has_svctm();
+}
+inline void SarInfo_SarDiskInfo::clear_svctm() {
+  _impl_.svctm_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarDiskInfo::_internal_svctm() const {
+  return _impl_.svctm_;
+}
+inline double SarInfo_SarDiskInfo::svctm() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.svctm)
+  return _internal_svctm();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_svctm(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.svctm_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_svctm(double value) {
+  _internal_set_svctm(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.svctm)
+}
+
+// optional double util = 8;
+inline bool SarInfo_SarDiskInfo::_internal_has_util() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_util() const {
+  return _internal_has_util();
+}
+inline void SarInfo_SarDiskInfo::clear_util() {
+  _impl_.util_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarDiskInfo::_internal_util() const {
+  return _impl_.util_;
+}
+inline double SarInfo_SarDiskInfo::util() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.util)
+  return _internal_util();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_util(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.util_ = value;
+}
+inline void SarInfo_SarDiskInfo::set_util(double value) {
+  _internal_set_util(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.util)
+}
+
+// optional string dev_name = 9;
+inline bool SarInfo_SarDiskInfo::_internal_has_dev_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarDiskInfo::has_dev_name() const {
+  return _internal_has_dev_name();
+}
+inline void SarInfo_SarDiskInfo::clear_dev_name() {
+  _impl_.dev_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarDiskInfo::dev_name() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarDiskInfo.dev_name)
+  return _internal_dev_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarDiskInfo::set_dev_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.dev_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarDiskInfo.dev_name)
+}
+inline std::string* SarInfo_SarDiskInfo::mutable_dev_name() {
+  std::string* _s = _internal_mutable_dev_name();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarDiskInfo.dev_name)
+  return _s;
+}
+inline const std::string& SarInfo_SarDiskInfo::_internal_dev_name() const {
+  return _impl_.dev_name_.Get();
+}
+inline void SarInfo_SarDiskInfo::_internal_set_dev_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.dev_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarDiskInfo::_internal_mutable_dev_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.dev_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarDiskInfo::release_dev_name() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarDiskInfo.dev_name)
+  if (!_internal_has_dev_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.dev_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dev_name_.IsDefault()) {
+    _impl_.dev_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarDiskInfo::set_allocated_dev_name(std::string* dev_name) {
+  if (dev_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.dev_name_.SetAllocated(dev_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dev_name_.IsDefault()) {
+    _impl_.dev_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarDiskInfo.dev_name)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarNetProtoInfo
+
+// optional double tcp_active_opens = 1;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_active_opens() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_active_opens() const {
+  return _internal_has_tcp_active_opens();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_active_opens() {
+  _impl_.tcp_active_opens_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_active_opens() const {
+  return _impl_.tcp_active_opens_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_active_opens() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_active_opens)
+  return _internal_tcp_active_opens();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_active_opens(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tcp_active_opens_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_active_opens(double value) {
+  _internal_set_tcp_active_opens(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_active_opens)
+}
+
+// optional double tcp_passive_opens = 2;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_passive_opens() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_passive_opens() const {
+  return _internal_has_tcp_passive_opens();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_passive_opens() {
+  _impl_.tcp_passive_opens_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_passive_opens() const {
+  return _impl_.tcp_passive_opens_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_passive_opens() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_passive_opens)
+  return _internal_tcp_passive_opens();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_passive_opens(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tcp_passive_opens_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_passive_opens(double value) {
+  _internal_set_tcp_passive_opens(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_passive_opens)
+}
+
+// optional double tcp_attempt_fails = 3;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_attempt_fails() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_attempt_fails() const {
+  return _internal_has_tcp_attempt_fails();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_attempt_fails() {
+  _impl_.tcp_attempt_fails_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_attempt_fails() const {
+  return _impl_.tcp_attempt_fails_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_attempt_fails() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_attempt_fails)
+  return _internal_tcp_attempt_fails();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_attempt_fails(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.tcp_attempt_fails_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_attempt_fails(double value) {
+  _internal_set_tcp_attempt_fails(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_attempt_fails)
+}
+
+// optional double tcp_estab_resets = 4;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_estab_resets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_estab_resets() const {
+  return _internal_has_tcp_estab_resets();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_estab_resets() {
+  _impl_.tcp_estab_resets_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_estab_resets() const {
+  return _impl_.tcp_estab_resets_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_estab_resets() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_estab_resets)
+  return _internal_tcp_estab_resets();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_estab_resets(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.tcp_estab_resets_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_estab_resets(double value) {
+  _internal_set_tcp_estab_resets(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_estab_resets)
+}
+
+// optional double tcp_in_segs = 5;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_in_segs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_in_segs() const {
+  return _internal_has_tcp_in_segs();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_in_segs() {
+  _impl_.tcp_in_segs_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_in_segs() const {
+  return _impl_.tcp_in_segs_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_in_segs() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_in_segs)
+  return _internal_tcp_in_segs();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_in_segs(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.tcp_in_segs_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_in_segs(double value) {
+  _internal_set_tcp_in_segs(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_in_segs)
+}
+
+// optional double tcp_out_segs = 6;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_out_segs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_out_segs() const {
+  return _internal_has_tcp_out_segs();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_out_segs() {
+  _impl_.tcp_out_segs_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_out_segs() const {
+  return _impl_.tcp_out_segs_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_out_segs() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_out_segs)
+  return _internal_tcp_out_segs();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_out_segs(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.tcp_out_segs_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_out_segs(double value) {
+  _internal_set_tcp_out_segs(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_out_segs)
+}
+
+// optional double tcp_retrans_segs = 7;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_retrans_segs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_retrans_segs() const {
+  return _internal_has_tcp_retrans_segs();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_retrans_segs() {
+  _impl_.tcp_retrans_segs_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_retrans_segs() const {
+  return _impl_.tcp_retrans_segs_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_retrans_segs() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_retrans_segs)
+  return _internal_tcp_retrans_segs();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_retrans_segs(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.tcp_retrans_segs_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_retrans_segs(double value) {
+  _internal_set_tcp_retrans_segs(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_retrans_segs)
+}
+
+// optional double tcp_retrans_pct = 8;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_retrans_pct() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_retrans_pct() const {
+  return _internal_has_tcp_retrans_pct();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_retrans_pct() {
+  _impl_.tcp_retrans_pct_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_retrans_pct() const {
+  return _impl_.tcp_retrans_pct_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_retrans_pct() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_retrans_pct)
+  return _internal_tcp_retrans_pct();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_retrans_pct(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.tcp_retrans_pct_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_retrans_pct(double value) {
+  _internal_set_tcp_retrans_pct(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_retrans_pct)
+}
+
+// optional double tcp_in_errs = 9;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_in_errs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_in_errs() const {
+  return _internal_has_tcp_in_errs();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_in_errs() {
+  _impl_.tcp_in_errs_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_in_errs() const {
+  return _impl_.tcp_in_errs_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_in_errs() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_in_errs)
+  return _internal_tcp_in_errs();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_in_errs(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.tcp_in_errs_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_in_errs(double value) {
+  _internal_set_tcp_in_errs(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_in_errs)
+}
+
+// optional double tcp_out_rsts = 10;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_out_rsts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_out_rsts() const {
+  return _internal_has_tcp_out_rsts();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_out_rsts() {
+  _impl_.tcp_out_rsts_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_out_rsts() const {
+  return _impl_.tcp_out_rsts_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_out_rsts() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_out_rsts)
+  return _internal_tcp_out_rsts();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_out_rsts(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.tcp_out_rsts_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_out_rsts(double value) {
+  _internal_set_tcp_out_rsts(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_out_rsts)
+}
+
+// optional double tcp_timeouts = 11;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_timeouts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_timeouts() const {
+  return _internal_has_tcp_timeouts();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_timeouts() {
+  _impl_.tcp_timeouts_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_timeouts() const {
+  return _impl_.tcp_timeouts_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_timeouts() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_timeouts)
+  return _internal_tcp_timeouts();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_timeouts(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.tcp_timeouts_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_timeouts(double value) {
+  _internal_set_tcp_timeouts(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_timeouts)
+}
+
+// optional double tcp_syn_retrans = 12;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_syn_retrans() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_syn_retrans() const {
+  return _internal_has_tcp_syn_retrans();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_syn_retrans() {
+  _impl_.tcp_syn_retrans_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_syn_retrans() const {
+  return _impl_.tcp_syn_retrans_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_syn_retrans() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_syn_retrans)
+  return _internal_tcp_syn_retrans();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_syn_retrans(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.tcp_syn_retrans_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_syn_retrans(double value) {
+  _internal_set_tcp_syn_retrans(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_syn_retrans)
+}
+
+// optional double listen_overflows = 13;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_listen_overflows() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_listen_overflows() const {
+  return _internal_has_listen_overflows();
+}
+inline void SarInfo_SarNetProtoInfo::clear_listen_overflows() {
+  _impl_.listen_overflows_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_listen_overflows() const {
+  return _impl_.listen_overflows_;
+}
+inline double SarInfo_SarNetProtoInfo::listen_overflows() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.listen_overflows)
+  return _internal_listen_overflows();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_listen_overflows(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.listen_overflows_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_listen_overflows(double value) {
+  _internal_set_listen_overflows(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.listen_overflows)
+}
+
+// optional double listen_drops = 14;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_listen_drops() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_listen_drops() const {
+  return _internal_has_listen_drops();
+}
+inline void SarInfo_SarNetProtoInfo::clear_listen_drops() {
+  _impl_.listen_drops_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_listen_drops() const {
+  return _impl_.listen_drops_;
+}
+inline double SarInfo_SarNetProtoInfo::listen_drops() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.listen_drops)
+  return _internal_listen_drops();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_listen_drops(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.listen_drops_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_listen_drops(double value) {
+  _internal_set_listen_drops(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.listen_drops)
+}
+
+// optional double syn_drops = 15;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_syn_drops() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_syn_drops() const {
+  return _internal_has_syn_drops();
+}
+inline void SarInfo_SarNetProtoInfo::clear_syn_drops() {
+  _impl_.syn_drops_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_syn_drops() const {
+  return _impl_.syn_drops_;
+}
+inline double SarInfo_SarNetProtoInfo::syn_drops() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.syn_drops)
+  return _internal_syn_drops();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_syn_drops(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.syn_drops_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_syn_drops(double value) {
+  _internal_set_syn_drops(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.syn_drops)
+}
+
+// optional double syncookies_sent = 16;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_syncookies_sent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_syncookies_sent() const {
+  return _internal_has_syncookies_sent();
+}
+inline void SarInfo_SarNetProtoInfo::clear_syncookies_sent() {
+  _impl_.syncookies_sent_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_syncookies_sent() const {
+  return _impl_.syncookies_sent_;
+}
+inline double SarInfo_SarNetProtoInfo::syncookies_sent() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.syncookies_sent)
+  return _internal_syncookies_sent();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_syncookies_sent(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.syncookies_sent_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_syncookies_sent(double value) {
+  _internal_set_syncookies_sent(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.syncookies_sent)
+}
+
+// optional double tcp_memory_pressures = 17;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_memory_pressures() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_memory_pressures() const {
+  return _internal_has_tcp_memory_pressures();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_memory_pressures() {
+  _impl_.tcp_memory_pressures_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_memory_pressures() const {
+  return _impl_.tcp_memory_pressures_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_memory_pressures() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_memory_pressures)
+  return _internal_tcp_memory_pressures();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_memory_pressures(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.tcp_memory_pressures_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_memory_pressures(double value) {
+  _internal_set_tcp_memory_pressures(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_memory_pressures)
+}
+
+// optional double tcp_abort_on_memory = 18;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_abort_on_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_abort_on_memory() const {
+  return _internal_has_tcp_abort_on_memory();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_abort_on_memory() {
+  _impl_.tcp_abort_on_memory_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_abort_on_memory() const {
+  return _impl_.tcp_abort_on_memory_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_abort_on_memory() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_abort_on_memory)
+  return _internal_tcp_abort_on_memory();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_abort_on_memory(double value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.tcp_abort_on_memory_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_abort_on_memory(double value) {
+  _internal_set_tcp_abort_on_memory(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_abort_on_memory)
+}
+
+// optional double tcp_prune_called = 19;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_prune_called() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_prune_called() const {
+  return _internal_has_tcp_prune_called();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_prune_called() {
+  _impl_.tcp_prune_called_ = 0;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_prune_called() const {
+  return _impl_.tcp_prune_called_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_prune_called() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_prune_called)
+  return _internal_tcp_prune_called();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_prune_called(double value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.tcp_prune_called_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_prune_called(double value) {
+  _internal_set_tcp_prune_called(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_prune_called)
+}
+
+// optional double tcp_rcv_pruned = 20;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_tcp_rcv_pruned() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_tcp_rcv_pruned() const {
+  return _internal_has_tcp_rcv_pruned();
+}
+inline void SarInfo_SarNetProtoInfo::clear_tcp_rcv_pruned() {
+  _impl_.tcp_rcv_pruned_ = 0;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_tcp_rcv_pruned() const {
+  return _impl_.tcp_rcv_pruned_;
+}
+inline double SarInfo_SarNetProtoInfo::tcp_rcv_pruned() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.tcp_rcv_pruned)
+  return _internal_tcp_rcv_pruned();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_tcp_rcv_pruned(double value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.tcp_rcv_pruned_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_tcp_rcv_pruned(double value) {
+  _internal_set_tcp_rcv_pruned(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.tcp_rcv_pruned)
+}
+
+// optional double udp_in_datagrams = 21;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_in_datagrams() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_in_datagrams() const {
+  return _internal_has_udp_in_datagrams();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_in_datagrams() {
+  _impl_.udp_in_datagrams_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_in_datagrams() const {
+  return _impl_.udp_in_datagrams_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_in_datagrams() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_in_datagrams)
+  return _internal_udp_in_datagrams();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_in_datagrams(double value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.udp_in_datagrams_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_in_datagrams(double value) {
+  _internal_set_udp_in_datagrams(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_in_datagrams)
+}
+
+// optional double udp_out_datagrams = 22;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_out_datagrams() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_out_datagrams() const {
+  return _internal_has_udp_out_datagrams();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_out_datagrams() {
+  _impl_.udp_out_datagrams_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_out_datagrams() const {
+  return _impl_.udp_out_datagrams_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_out_datagrams() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_out_datagrams)
+  return _internal_udp_out_datagrams();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_out_datagrams(double value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.udp_out_datagrams_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_out_datagrams(double value) {
+  _internal_set_udp_out_datagrams(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_out_datagrams)
+}
+
+// optional double udp_no_ports = 23;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_no_ports() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_no_ports() const {
+  return _internal_has_udp_no_ports();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_no_ports() {
+  _impl_.udp_no_ports_ = 0;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_no_ports() const {
+  return _impl_.udp_no_ports_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_no_ports() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_no_ports)
+  return _internal_udp_no_ports();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_no_ports(double value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.udp_no_ports_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_no_ports(double value) {
+  _internal_set_udp_no_ports(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_no_ports)
+}
+
+// optional double udp_in_errors = 24;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_in_errors() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_in_errors() const {
+  return _internal_has_udp_in_errors();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_in_errors() {
+  _impl_.udp_in_errors_ = 0;
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_in_errors() const {
+  return _impl_.udp_in_errors_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_in_errors() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_in_errors)
+  return _internal_udp_in_errors();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_in_errors(double value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.udp_in_errors_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_in_errors(double value) {
+  _internal_set_udp_in_errors(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_in_errors)
+}
+
+// optional double udp_rcvbuf_errors = 25;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_rcvbuf_errors() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_rcvbuf_errors() const {
+  return _internal_has_udp_rcvbuf_errors();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_rcvbuf_errors() {
+  _impl_.udp_rcvbuf_errors_ = 0;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_rcvbuf_errors() const {
+  return _impl_.udp_rcvbuf_errors_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_rcvbuf_errors() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_rcvbuf_errors)
+  return _internal_udp_rcvbuf_errors();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_rcvbuf_errors(double value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.udp_rcvbuf_errors_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_rcvbuf_errors(double value) {
+  _internal_set_udp_rcvbuf_errors(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_rcvbuf_errors)
+}
+
+// optional double udp_sndbuf_errors = 26;
+inline bool SarInfo_SarNetProtoInfo::_internal_has_udp_sndbuf_errors() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetProtoInfo::has_udp_sndbuf_errors() const {
+  return _internal_has_udp_sndbuf_errors();
+}
+inline void SarInfo_SarNetProtoInfo::clear_udp_sndbuf_errors() {
+  _impl_.udp_sndbuf_errors_ = 0;
+  _impl_._has_bits_[0] &= ~0x02000000u;
+}
+inline double SarInfo_SarNetProtoInfo::_internal_udp_sndbuf_errors() const {
+  return _impl_.udp_sndbuf_errors_;
+}
+inline double SarInfo_SarNetProtoInfo::udp_sndbuf_errors() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetProtoInfo.udp_sndbuf_errors)
+  return _internal_udp_sndbuf_errors();
+}
+inline void SarInfo_SarNetProtoInfo::_internal_set_udp_sndbuf_errors(double value) {
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.udp_sndbuf_errors_ = value;
+}
+inline void SarInfo_SarNetProtoInfo::set_udp_sndbuf_errors(double value) {
+  _internal_set_udp_sndbuf_errors(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetProtoInfo.udp_sndbuf_errors)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarCpuInfo
+
+// optional int32 cpu = 1;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu() const {
+  return _internal_has_cpu();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu() {
+  _impl_.cpu_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t SarInfo_SarCpuInfo::_internal_cpu() const {
+  return _impl_.cpu_;
+}
+inline int32_t SarInfo_SarCpuInfo::cpu() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu)
+  return _internal_cpu();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cpu_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu(int32_t value) {
+  _internal_set_cpu(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu)
+}
+
+// optional double softnet_processed = 2;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_processed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_processed() const {
+  return _internal_has_softnet_processed();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_processed() {
+  _impl_.softnet_processed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SarInfo_SarCpuInfo::_internal_softnet_processed() const {
+  return _impl_.softnet_processed_;
+}
+inline double SarInfo_SarCpuInfo::softnet_processed() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_processed)
+  return _internal_softnet_processed();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_processed(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.softnet_processed_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_processed(double value) {
+  _internal_set_softnet_processed(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_processed)
+}
+
+// optional double softnet_dropped = 3;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_dropped() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_dropped() const {
+  return _internal_has_softnet_dropped();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_dropped() {
+  _impl_.softnet_dropped_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarCpuInfo::_internal_softnet_dropped() const {
+  return _impl_.softnet_dropped_;
+}
+inline double SarInfo_SarCpuInfo::softnet_dropped() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_dropped)
+  return _internal_softnet_dropped();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_dropped(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.softnet_dropped_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_dropped(double value) {
+  _internal_set_softnet_dropped(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_dropped)
+}
+
+// optional double softnet_time_squeeze = 4;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_time_squeeze() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_time_squeeze() const {
+  return _internal_has_softnet_time_squeeze();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_time_squeeze() {
+  _impl_.softnet_time_squeeze_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarCpuInfo::_internal_softnet_time_squeeze() const {
+  return _impl_.softnet_time_squeeze_;
+}
+inline double SarInfo_SarCpuInfo::softnet_time_squeeze() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_time_squeeze)
+  return _internal_softnet_time_squeeze();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_time_squeeze(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.softnet_time_squeeze_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_time_squeeze(double value) {
+  _internal_set_softnet_time_squeeze(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_time_squeeze)
+}
+
+// optional double softnet_received_rps = 5;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_received_rps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_received_rps() const {
+  return _internal_has_softnet_received_rps();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_received_rps() {
+  _impl_.softnet_received_rps_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarCpuInfo::_internal_softnet_received_rps() const {
+  return _impl_.softnet_received_rps_;
+}
+inline double SarInfo_SarCpuInfo::softnet_received_rps() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_received_rps)
+  return _internal_softnet_received_rps();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_received_rps(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.softnet_received_rps_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_received_rps(double value) {
+  _internal_set_softnet_received_rps(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_received_rps)
+}
+
+// optional double softnet_flow_limit = 6;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_flow_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_flow_limit() const {
+  return _internal_has_softnet_flow_limit();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_flow_limit() {
+  _impl_.softnet_flow_limit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarCpuInfo::_internal_softnet_flow_limit() const {
+  return _impl_.softnet_flow_limit_;
+}
+inline double SarInfo_SarCpuInfo::softnet_flow_limit() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_flow_limit)
+  return _internal_softnet_flow_limit();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_flow_limit(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.softnet_flow_limit_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_flow_limit(double value) {
+  _internal_set_softnet_flow_limit(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_flow_limit)
+}
+
+// optional bool softnet_squeezed = 7;
+inline bool SarInfo_SarCpuInfo::_internal_has_softnet_squeezed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_softnet_squeezed() const {
+  return _internal_has_softnet_squeezed();
+}
+inline void SarInfo_SarCpuInfo::clear_softnet_squeezed() {
+  _impl_.softnet_squeezed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool SarInfo_SarCpuInfo::_internal_softnet_squeezed() const {
+  return _impl_.softnet_squeezed_;
+}
+inline bool SarInfo_SarCpuInfo::softnet_squeezed() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.softnet_squeezed)
+  return _internal_softnet_squeezed();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_softnet_squeezed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.softnet_squeezed_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_softnet_squeezed(bool value) {
+  _internal_set_softnet_squeezed(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.softnet_squeezed)
+}
+
+// optional double sched_run_time = 8;
+inline bool SarInfo_SarCpuInfo::_internal_has_sched_run_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_sched_run_time() const {
+  return _internal_has_sched_run_time();
+}
+inline void SarInfo_SarCpuInfo::clear_sched_run_time() {
+  _impl_.sched_run_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarCpuInfo::_internal_sched_run_time() const {
+  return _impl_.sched_run_time_;
+}
+inline double SarInfo_SarCpuInfo::sched_run_time() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.sched_run_time)
+  return _internal_sched_run_time();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_sched_run_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.sched_run_time_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_sched_run_time(double value) {
+  _internal_set_sched_run_time(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.sched_run_time)
+}
+
+// optional double sched_run_delay = 9;
+inline bool SarInfo_SarCpuInfo::_internal_has_sched_run_delay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_sched_run_delay() const {
+  return _internal_has_sched_run_delay();
+}
+inline void SarInfo_SarCpuInfo::clear_sched_run_delay() {
+  _impl_.sched_run_delay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarCpuInfo::_internal_sched_run_delay() const {
+  return _impl_.sched_run_delay_;
+}
+inline double SarInfo_SarCpuInfo::sched_run_delay() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.sched_run_delay)
+  return _internal_sched_run_delay();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_sched_run_delay(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.sched_run_delay_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_sched_run_delay(double value) {
+  _internal_set_sched_run_delay(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.sched_run_delay)
+}
+
+// optional double sched_timeslices = 10;
+inline bool SarInfo_SarCpuInfo::_internal_has_sched_timeslices() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_sched_timeslices() const {
+  return _internal_has_sched_timeslices();
+}
+inline void SarInfo_SarCpuInfo::clear_sched_timeslices() {
+  _impl_.sched_timeslices_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarCpuInfo::_internal_sched_timeslices() const {
+  return _impl_.sched_timeslices_;
+}
+inline double SarInfo_SarCpuInfo::sched_timeslices() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.sched_timeslices)
+  return _internal_sched_timeslices();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_sched_timeslices(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.sched_timeslices_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_sched_timeslices(double value) {
+  _internal_set_sched_timeslices(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.sched_timeslices)
+}
+
+// optional double cpu_user = 11;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo_SarCpuInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_user)
+}
+
+// optional double cpu_nice = 12;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_nice() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_nice() const {
+  return _internal_has_cpu_nice();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_nice() {
+  _impl_.cpu_nice_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_nice() const {
+  return _impl_.cpu_nice_;
+}
+inline double SarInfo_SarCpuInfo::cpu_nice() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_nice)
+  return _internal_cpu_nice();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_nice(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.cpu_nice_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_nice(double value) {
+  _internal_set_cpu_nice(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_nice)
+}
+
+// optional double cpu_system = 13;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo_SarCpuInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_system)
+}
+
+// optional double cpu_iowait = 14;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_iowait() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_iowait() const {
+  return _internal_has_cpu_iowait();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_iowait() {
+  _impl_.cpu_iowait_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_iowait() const {
+  return _impl_.cpu_iowait_;
+}
+inline double SarInfo_SarCpuInfo::cpu_iowait() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_iowait)
+  return _internal_cpu_iowait();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_iowait(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.cpu_iowait_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_iowait(double value) {
+  _internal_set_cpu_iowait(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_iowait)
+}
+
+// optional double cpu_steal = 15;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_steal() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_steal() const {
+  return _internal_has_cpu_steal();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_steal() {
+  _impl_.cpu_steal_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_steal() const {
+  return _impl_.cpu_steal_;
+}
+inline double SarInfo_SarCpuInfo::cpu_steal() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_steal)
+  return _internal_cpu_steal();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_steal(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.cpu_steal_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_steal(double value) {
+  _internal_set_cpu_steal(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_steal)
+}
+
+// optional double cpu_idle = 16;
+inline bool SarInfo_SarCpuInfo::_internal_has_cpu_idle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cpu_idle() const {
+  return _internal_has_cpu_idle();
+}
+inline void SarInfo_SarCpuInfo::clear_cpu_idle() {
+  _impl_.cpu_idle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cpu_idle() const {
+  return _impl_.cpu_idle_;
+}
+inline double SarInfo_SarCpuInfo::cpu_idle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cpu_idle)
+  return _internal_cpu_idle();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cpu_idle(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.cpu_idle_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cpu_idle(double value) {
+  _internal_set_cpu_idle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cpu_idle)
+}
+
+// optional int32 core_id = 17;
+inline bool SarInfo_SarCpuInfo::_internal_has_core_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_core_id() const {
+  return _internal_has_core_id();
+}
+inline void SarInfo_SarCpuInfo::clear_core_id() {
+  _impl_.core_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t SarInfo_SarCpuInfo::_internal_core_id() const {
+  return _impl_.core_id_;
+}
+inline int32_t SarInfo_SarCpuInfo::core_id() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.core_id)
+  return _internal_core_id();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_core_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.core_id_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_core_id(int32_t value) {
+  _internal_set_core_id(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.core_id)
+}
+
+// optional int32 package_id = 18;
+inline bool SarInfo_SarCpuInfo::_internal_has_package_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_package_id() const {
+  return _internal_has_package_id();
+}
+inline void SarInfo_SarCpuInfo::clear_package_id() {
+  _impl_.package_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline int32_t SarInfo_SarCpuInfo::_internal_package_id() const {
+  return _impl_.package_id_;
+}
+inline int32_t SarInfo_SarCpuInfo::package_id() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.package_id)
+  return _internal_package_id();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_package_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.package_id_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_package_id(int32_t value) {
+  _internal_set_package_id(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.package_id)
+}
+
+// optional int32 node = 19;
+inline bool SarInfo_SarCpuInfo::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_node() const {
+  return _internal_has_node();
+}
+inline void SarInfo_SarCpuInfo::clear_node() {
+  _impl_.node_ = 0;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline int32_t SarInfo_SarCpuInfo::_internal_node() const {
+  return _impl_.node_;
+}
+inline int32_t SarInfo_SarCpuInfo::node() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.node)
+  return _internal_node();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_node(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.node_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_node(int32_t value) {
+  _internal_set_node(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.node)
+}
+
+// optional double cur_freq = 20;
+inline bool SarInfo_SarCpuInfo::_internal_has_cur_freq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_cur_freq() const {
+  return _internal_has_cur_freq();
+}
+inline void SarInfo_SarCpuInfo::clear_cur_freq() {
+  _impl_.cur_freq_ = 0;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_cur_freq() const {
+  return _impl_.cur_freq_;
+}
+inline double SarInfo_SarCpuInfo::cur_freq() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.cur_freq)
+  return _internal_cur_freq();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_cur_freq(double value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.cur_freq_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_cur_freq(double value) {
+  _internal_set_cur_freq(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.cur_freq)
+}
+
+// optional double max_freq = 21;
+inline bool SarInfo_SarCpuInfo::_internal_has_max_freq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_max_freq() const {
+  return _internal_has_max_freq();
+}
+inline void SarInfo_SarCpuInfo::clear_max_freq() {
+  _impl_.max_freq_ = 0;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_max_freq() const {
+  return _impl_.max_freq_;
+}
+inline double SarInfo_SarCpuInfo::max_freq() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.max_freq)
+  return _internal_max_freq();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_max_freq(double value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.max_freq_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_max_freq(double value) {
+  _internal_set_max_freq(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.max_freq)
+}
+
+// optional double core_throttle = 22;
+inline bool SarInfo_SarCpuInfo::_internal_has_core_throttle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_core_throttle() const {
+  return _internal_has_core_throttle();
+}
+inline void SarInfo_SarCpuInfo::clear_core_throttle() {
+  _impl_.core_throttle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_core_throttle() const {
+  return _impl_.core_throttle_;
+}
+inline double SarInfo_SarCpuInfo::core_throttle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.core_throttle)
+  return _internal_core_throttle();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_core_throttle(double value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.core_throttle_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_core_throttle(double value) {
+  _internal_set_core_throttle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.core_throttle)
+}
+
+// optional double package_throttle = 23;
+inline bool SarInfo_SarCpuInfo::_internal_has_package_throttle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuInfo::has_package_throttle() const {
+  return _internal_has_package_throttle();
+}
+inline void SarInfo_SarCpuInfo::clear_package_throttle() {
+  _impl_.package_throttle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline double SarInfo_SarCpuInfo::_internal_package_throttle() const {
+  return _impl_.package_throttle_;
+}
+inline double SarInfo_SarCpuInfo::package_throttle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuInfo.package_throttle)
+  return _internal_package_throttle();
+}
+inline void SarInfo_SarCpuInfo::_internal_set_package_throttle(double value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.package_throttle_ = value;
+}
+inline void SarInfo_SarCpuInfo::set_package_throttle(double value) {
+  _internal_set_package_throttle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuInfo.package_throttle)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarTaskSchedInfo
+
+// optional int32 pid = 1;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_pid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_pid() const {
+  return _internal_has_pid();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_pid() {
+  _impl_.pid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t SarInfo_SarTaskSchedInfo::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline int32_t SarInfo_SarTaskSchedInfo::pid() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.pid)
+  return _internal_pid();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_pid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.pid_ = value;
+}
+inline void SarInfo_SarTaskSchedInfo::set_pid(int32_t value) {
+  _internal_set_pid(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.pid)
+}
+
+// optional string comm = 2;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_comm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_comm() const {
+  return _internal_has_comm();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_comm() {
+  _impl_.comm_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarTaskSchedInfo::comm() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.comm)
+  return _internal_comm();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarTaskSchedInfo::set_comm(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.comm_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.comm)
+}
+inline std::string* SarInfo_SarTaskSchedInfo::mutable_comm() {
+  std::string* _s = _internal_mutable_comm();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarTaskSchedInfo.comm)
+  return _s;
+}
+inline const std::string& SarInfo_SarTaskSchedInfo::_internal_comm() const {
+  return _impl_.comm_.Get();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_comm(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.comm_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarTaskSchedInfo::_internal_mutable_comm() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.comm_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarTaskSchedInfo::release_comm() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarTaskSchedInfo.comm)
+  if (!_internal_has_comm()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.comm_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comm_.IsDefault()) {
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarTaskSchedInfo::set_allocated_comm(std::string* comm) {
+  if (comm != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.comm_.SetAllocated(comm, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comm_.IsDefault()) {
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarTaskSchedInfo.comm)
+}
+
+// optional double run_time = 3;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_run_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_run_time() const {
+  return _internal_has_run_time();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_run_time() {
+  _impl_.run_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarTaskSchedInfo::_internal_run_time() const {
+  return _impl_.run_time_;
+}
+inline double SarInfo_SarTaskSchedInfo::run_time() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.run_time)
+  return _internal_run_time();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_run_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.run_time_ = value;
+}
+inline void SarInfo_SarTaskSchedInfo::set_run_time(double value) {
+  _internal_set_run_time(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.run_time)
+}
+
+// optional double run_delay = 4;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_run_delay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_run_delay() const {
+  return _internal_has_run_delay();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_run_delay() {
+  _impl_.run_delay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarTaskSchedInfo::_internal_run_delay() const {
+  return _impl_.run_delay_;
+}
+inline double SarInfo_SarTaskSchedInfo::run_delay() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.run_delay)
+  return _internal_run_delay();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_run_delay(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.run_delay_ = value;
+}
+inline void SarInfo_SarTaskSchedInfo::set_run_delay(double value) {
+  _internal_set_run_delay(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.run_delay)
+}
+
+// optional double timeslices = 5;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_timeslices() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_timeslices() const {
+  return _internal_has_timeslices();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_timeslices() {
+  _impl_.timeslices_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarTaskSchedInfo::_internal_timeslices() const {
+  return _impl_.timeslices_;
+}
+inline double SarInfo_SarTaskSchedInfo::timeslices() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.timeslices)
+  return _internal_timeslices();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_timeslices(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.timeslices_ = value;
+}
+inline void SarInfo_SarTaskSchedInfo::set_timeslices(double value) {
+  _internal_set_timeslices(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.timeslices)
+}
+
+// optional double avg_delay = 6;
+inline bool SarInfo_SarTaskSchedInfo::_internal_has_avg_delay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarTaskSchedInfo::has_avg_delay() const {
+  return _internal_has_avg_delay();
+}
+inline void SarInfo_SarTaskSchedInfo::clear_avg_delay() {
+  _impl_.avg_delay_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarTaskSchedInfo::_internal_avg_delay() const {
+  return _impl_.avg_delay_;
+}
+inline double SarInfo_SarTaskSchedInfo::avg_delay() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarTaskSchedInfo.avg_delay)
+  return _internal_avg_delay();
+}
+inline void SarInfo_SarTaskSchedInfo::_internal_set_avg_delay(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.avg_delay_ = value;
+}
+inline void SarInfo_SarTaskSchedInfo::set_avg_delay(double value) {
+  _internal_set_avg_delay(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarTaskSchedInfo.avg_delay)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarPsiInfo
+
+// optional double some_avg10 = 1;
+inline bool SarInfo_SarPsiInfo::_internal_has_some_avg10() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_some_avg10() const {
+  return _internal_has_some_avg10();
+}
+inline void SarInfo_SarPsiInfo::clear_some_avg10() {
+  _impl_.some_avg10_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SarInfo_SarPsiInfo::_internal_some_avg10() const {
+  return _impl_.some_avg10_;
+}
+inline double SarInfo_SarPsiInfo::some_avg10() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.some_avg10)
+  return _internal_some_avg10();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_some_avg10(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.some_avg10_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_some_avg10(double value) {
+  _internal_set_some_avg10(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.some_avg10)
+}
+
+// optional double some_avg60 = 2;
+inline bool SarInfo_SarPsiInfo::_internal_has_some_avg60() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_some_avg60() const {
+  return _internal_has_some_avg60();
+}
+inline void SarInfo_SarPsiInfo::clear_some_avg60() {
+  _impl_.some_avg60_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarPsiInfo::_internal_some_avg60() const {
+  return _impl_.some_avg60_;
+}
+inline double SarInfo_SarPsiInfo::some_avg60() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.some_avg60)
+  return _internal_some_avg60();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_some_avg60(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.some_avg60_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_some_avg60(double value) {
+  _internal_set_some_avg60(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.some_avg60)
+}
+
+// optional double some_avg300 = 3;
+inline bool SarInfo_SarPsiInfo::_internal_has_some_avg300() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_some_avg300() const {
+  return _internal_has_some_avg300();
+}
+inline void SarInfo_SarPsiInfo::clear_some_avg300() {
+  _impl_.some_avg300_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarPsiInfo::_internal_some_avg300() const {
+  return _impl_.some_avg300_;
+}
+inline double SarInfo_SarPsiInfo::some_avg300() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.some_avg300)
+  return _internal_some_avg300();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_some_avg300(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.some_avg300_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_some_avg300(double value) {
+  _internal_set_some_avg300(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.some_avg300)
+}
+
+// optional double full_avg10 = 4;
+inline bool SarInfo_SarPsiInfo::_internal_has_full_avg10() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_full_avg10() const {
+  return _internal_has_full_avg10();
+}
+inline void SarInfo_SarPsiInfo::clear_full_avg10() {
+  _impl_.full_avg10_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarPsiInfo::_internal_full_avg10() const {
+  return _impl_.full_avg10_;
+}
+inline double SarInfo_SarPsiInfo::full_avg10() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.full_avg10)
+  return _internal_full_avg10();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_full_avg10(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.full_avg10_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_full_avg10(double value) {
+  _internal_set_full_avg10(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.full_avg10)
+}
+
+// optional double full_avg60 = 5;
+inline bool SarInfo_SarPsiInfo::_internal_has_full_avg60() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_full_avg60() const {
+  return _internal_has_full_avg60();
+}
+inline void SarInfo_SarPsiInfo::clear_full_avg60() {
+  _impl_.full_avg60_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarPsiInfo::_internal_full_avg60() const {
+  return _impl_.full_avg60_;
+}
+inline double SarInfo_SarPsiInfo::full_avg60() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.full_avg60)
+  return _internal_full_avg60();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_full_avg60(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.full_avg60_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_full_avg60(double value) {
+  _internal_set_full_avg60(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.full_avg60)
+}
+
+// optional double full_avg300 = 6;
+inline bool SarInfo_SarPsiInfo::_internal_has_full_avg300() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_full_avg300() const {
+  return _internal_has_full_avg300();
+}
+inline void SarInfo_SarPsiInfo::clear_full_avg300() {
+  _impl_.full_avg300_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarPsiInfo::_internal_full_avg300() const {
+  return _impl_.full_avg300_;
+}
+inline double SarInfo_SarPsiInfo::full_avg300() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.full_avg300)
+  return _internal_full_avg300();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_full_avg300(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.full_avg300_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_full_avg300(double value) {
+  _internal_set_full_avg300(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.full_avg300)
+}
+
+// optional double some_stall = 7;
+inline bool SarInfo_SarPsiInfo::_internal_has_some_stall() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_some_stall() const {
+  return _internal_has_some_stall();
+}
+inline void SarInfo_SarPsiInfo::clear_some_stall() {
+  _impl_.some_stall_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarPsiInfo::_internal_some_stall() const {
+  return _impl_.some_stall_;
+}
+inline double SarInfo_SarPsiInfo::some_stall() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.some_stall)
+  return _internal_some_stall();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_some_stall(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.some_stall_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_some_stall(double value) {
+  _internal_set_some_stall(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.some_stall)
+}
+
+// optional double full_stall = 8;
+inline bool SarInfo_SarPsiInfo::_internal_has_full_stall() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarPsiInfo::has_full_stall() const {
+  return _internal_has_full_stall();
+}
+inline void SarInfo_SarPsiInfo::clear_full_stall() {
+  _impl_.full_stall_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarPsiInfo::_internal_full_stall() const {
+  return _impl_.full_stall_;
+}
+inline double SarInfo_SarPsiInfo::full_stall() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarPsiInfo.full_stall)
+  return _internal_full_stall();
+}
+inline void SarInfo_SarPsiInfo::_internal_set_full_stall(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.full_stall_ = value;
+}
+inline void SarInfo_SarPsiInfo::set_full_stall(double value) {
+  _internal_set_full_stall(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarPsiInfo.full_stall)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarCgroupInfo
+
+// optional string path = 1;
+inline bool SarInfo_SarCgroupInfo::_internal_has_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_path() const {
+  return _internal_has_path();
+}
+inline void SarInfo_SarCgroupInfo::clear_path() {
+  _impl_.path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarCgroupInfo::path() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarCgroupInfo::set_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.path)
+}
+inline std::string* SarInfo_SarCgroupInfo::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarCgroupInfo.path)
+  return _s;
+}
+inline const std::string& SarInfo_SarCgroupInfo::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarCgroupInfo::_internal_mutable_path() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarCgroupInfo::release_path() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarCgroupInfo.path)
+  if (!_internal_has_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarCgroupInfo::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarCgroupInfo.path)
+}
+
+// optional uint64 inode = 2;
+inline bool SarInfo_SarCgroupInfo::_internal_has_inode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_inode() const {
+  return _internal_has_inode();
+}
+inline void SarInfo_SarCgroupInfo::clear_inode() {
+  _impl_.inode_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t SarInfo_SarCgroupInfo::_internal_inode() const {
+  return _impl_.inode_;
+}
+inline uint64_t SarInfo_SarCgroupInfo::inode() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.inode)
+  return _internal_inode();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_inode(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.inode_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_inode(uint64_t value) {
+  _internal_set_inode(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.inode)
+}
+
+// optional double cpu_usage = 3;
+inline bool SarInfo_SarCgroupInfo::_internal_has_cpu_usage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_cpu_usage() const {
+  return _internal_has_cpu_usage();
+}
+inline void SarInfo_SarCgroupInfo::clear_cpu_usage() {
+  _impl_.cpu_usage_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_cpu_usage() const {
+  return _impl_.cpu_usage_;
+}
+inline double SarInfo_SarCgroupInfo::cpu_usage() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.cpu_usage)
+  return _internal_cpu_usage();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_cpu_usage(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cpu_usage_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_cpu_usage(double value) {
+  _internal_set_cpu_usage(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.cpu_usage)
+}
+
+// optional double cpu_user = 4;
+inline bool SarInfo_SarCgroupInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo_SarCgroupInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo_SarCgroupInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.cpu_user)
+}
+
+// optional double cpu_system = 5;
+inline bool SarInfo_SarCgroupInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo_SarCgroupInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo_SarCgroupInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.cpu_system)
+}
+
+// optional double nr_throttled = 6;
+inline bool SarInfo_SarCgroupInfo::_internal_has_nr_throttled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_nr_throttled() const {
+  return _internal_has_nr_throttled();
+}
+inline void SarInfo_SarCgroupInfo::clear_nr_throttled() {
+  _impl_.nr_throttled_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_nr_throttled() const {
+  return _impl_.nr_throttled_;
+}
+inline double SarInfo_SarCgroupInfo::nr_throttled() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.nr_throttled)
+  return _internal_nr_throttled();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_nr_throttled(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.nr_throttled_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_nr_throttled(double value) {
+  _internal_set_nr_throttled(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.nr_throttled)
+}
+
+// optional double throttled_time = 7;
+inline bool SarInfo_SarCgroupInfo::_internal_has_throttled_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_throttled_time() const {
+  return _internal_has_throttled_time();
+}
+inline void SarInfo_SarCgroupInfo::clear_throttled_time() {
+  _impl_.throttled_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_throttled_time() const {
+  return _impl_.throttled_time_;
+}
+inline double SarInfo_SarCgroupInfo::throttled_time() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.throttled_time)
+  return _internal_throttled_time();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_throttled_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.throttled_time_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_throttled_time(double value) {
+  _internal_set_throttled_time(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.throttled_time)
+}
+
+// optional uint64 memory_current = 8;
+inline bool SarInfo_SarCgroupInfo::_internal_has_memory_current() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_memory_current() const {
+  return _internal_has_memory_current();
+}
+inline void SarInfo_SarCgroupInfo::clear_memory_current() {
+  _impl_.memory_current_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t SarInfo_SarCgroupInfo::_internal_memory_current() const {
+  return _impl_.memory_current_;
+}
+inline uint64_t SarInfo_SarCgroupInfo::memory_current() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.memory_current)
+  return _internal_memory_current();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_memory_current(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.memory_current_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_memory_current(uint64_t value) {
+  _internal_set_memory_current(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.memory_current)
+}
+
+// optional uint64 memory_anon = 9;
+inline bool SarInfo_SarCgroupInfo::_internal_has_memory_anon() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_memory_anon() const {
+  return _internal_has_memory_anon();
+}
+inline void SarInfo_SarCgroupInfo::clear_memory_anon() {
+  _impl_.memory_anon_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t SarInfo_SarCgroupInfo::_internal_memory_anon() const {
+  return _impl_.memory_anon_;
+}
+inline uint64_t SarInfo_SarCgroupInfo::memory_anon() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.memory_anon)
+  return _internal_memory_anon();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_memory_anon(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.memory_anon_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_memory_anon(uint64_t value) {
+  _internal_set_memory_anon(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.memory_anon)
+}
+
+// optional uint64 memory_file = 10;
+inline bool SarInfo_SarCgroupInfo::_internal_has_memory_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_memory_file() const {
+  return _internal_has_memory_file();
+}
+inline void SarInfo_SarCgroupInfo::clear_memory_file() {
+  _impl_.memory_file_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint64_t SarInfo_SarCgroupInfo::_internal_memory_file() const {
+  return _impl_.memory_file_;
+}
+inline uint64_t SarInfo_SarCgroupInfo::memory_file() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.memory_file)
+  return _internal_memory_file();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_memory_file(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.memory_file_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_memory_file(uint64_t value) {
+  _internal_set_memory_file(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.memory_file)
+}
+
+// optional double pgfault = 11;
+inline bool SarInfo_SarCgroupInfo::_internal_has_pgfault() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_pgfault() const {
+  return _internal_has_pgfault();
+}
+inline void SarInfo_SarCgroupInfo::clear_pgfault() {
+  _impl_.pgfault_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_pgfault() const {
+  return _impl_.pgfault_;
+}
+inline double SarInfo_SarCgroupInfo::pgfault() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.pgfault)
+  return _internal_pgfault();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_pgfault(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.pgfault_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_pgfault(double value) {
+  _internal_set_pgfault(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.pgfault)
+}
+
+// optional double pgmajfault = 12;
+inline bool SarInfo_SarCgroupInfo::_internal_has_pgmajfault() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_pgmajfault() const {
+  return _internal_has_pgmajfault();
+}
+inline void SarInfo_SarCgroupInfo::clear_pgmajfault() {
+  _impl_.pgmajfault_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_pgmajfault() const {
+  return _impl_.pgmajfault_;
+}
+inline double SarInfo_SarCgroupInfo::pgmajfault() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.pgmajfault)
+  return _internal_pgmajfault();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_pgmajfault(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.pgmajfault_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_pgmajfault(double value) {
+  _internal_set_pgmajfault(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.pgmajfault)
+}
+
+// optional double io_rbytes = 13;
+inline bool SarInfo_SarCgroupInfo::_internal_has_io_rbytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_io_rbytes() const {
+  return _internal_has_io_rbytes();
+}
+inline void SarInfo_SarCgroupInfo::clear_io_rbytes() {
+  _impl_.io_rbytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_io_rbytes() const {
+  return _impl_.io_rbytes_;
+}
+inline double SarInfo_SarCgroupInfo::io_rbytes() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.io_rbytes)
+  return _internal_io_rbytes();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_io_rbytes(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.io_rbytes_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_io_rbytes(double value) {
+  _internal_set_io_rbytes(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.io_rbytes)
+}
+
+// optional double io_wbytes = 14;
+inline bool SarInfo_SarCgroupInfo::_internal_has_io_wbytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_io_wbytes() const {
+  return _internal_has_io_wbytes();
+}
+inline void SarInfo_SarCgroupInfo::clear_io_wbytes() {
+  _impl_.io_wbytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_io_wbytes() const {
+  return _impl_.io_wbytes_;
+}
+inline double SarInfo_SarCgroupInfo::io_wbytes() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.io_wbytes)
+  return _internal_io_wbytes();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_io_wbytes(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.io_wbytes_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_io_wbytes(double value) {
+  _internal_set_io_wbytes(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.io_wbytes)
+}
+
+// optional double io_rios = 15;
+inline bool SarInfo_SarCgroupInfo::_internal_has_io_rios() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_io_rios() const {
+  return _internal_has_io_rios();
+}
+inline void SarInfo_SarCgroupInfo::clear_io_rios() {
+  _impl_.io_rios_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_io_rios() const {
+  return _impl_.io_rios_;
+}
+inline double SarInfo_SarCgroupInfo::io_rios() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.io_rios)
+  return _internal_io_rios();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_io_rios(double value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.io_rios_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_io_rios(double value) {
+  _internal_set_io_rios(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.io_rios)
+}
+
+// optional double io_wios = 16;
+inline bool SarInfo_SarCgroupInfo::_internal_has_io_wios() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_io_wios() const {
+  return _internal_has_io_wios();
+}
+inline void SarInfo_SarCgroupInfo::clear_io_wios() {
+  _impl_.io_wios_ = 0;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline double SarInfo_SarCgroupInfo::_internal_io_wios() const {
+  return _impl_.io_wios_;
+}
+inline double SarInfo_SarCgroupInfo::io_wios() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.io_wios)
+  return _internal_io_wios();
+}
+inline void SarInfo_SarCgroupInfo::_internal_set_io_wios(double value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.io_wios_ = value;
+}
+inline void SarInfo_SarCgroupInfo::set_io_wios(double value) {
+  _internal_set_io_wios(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCgroupInfo.io_wios)
+}
+
+// optional .SarInfo.SarPsiInfo psi_cpu = 17;
+inline bool SarInfo_SarCgroupInfo::_internal_has_psi_cpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_cpu_ != nullptr);
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_psi_cpu() const {
+  return _internal_has_psi_cpu();
+}
+inline void SarInfo_SarCgroupInfo::clear_psi_cpu() {
+  if (_impl_.psi_cpu_ != nullptr) _impl_.psi_cpu_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::_internal_psi_cpu() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_cpu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::psi_cpu() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.psi_cpu)
+  return _internal_psi_cpu();
+}
+inline void SarInfo_SarCgroupInfo::unsafe_arena_set_allocated_psi_cpu(
+    ::SarInfo_SarPsiInfo* psi_cpu) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_cpu_);
+  }
+  _impl_.psi_cpu_ = psi_cpu;
+  if (psi_cpu) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.SarCgroupInfo.psi_cpu)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::release_psi_cpu() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_cpu_;
+  _impl_.psi_cpu_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::unsafe_arena_release_psi_cpu() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarCgroupInfo.psi_cpu)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_cpu_;
+  _impl_.psi_cpu_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::_internal_mutable_psi_cpu() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.psi_cpu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_cpu_ = p;
+  }
+  return _impl_.psi_cpu_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::mutable_psi_cpu() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_cpu();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarCgroupInfo.psi_cpu)
+  return _msg;
+}
+inline void SarInfo_SarCgroupInfo::set_allocated_psi_cpu(::SarInfo_SarPsiInfo* psi_cpu) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_cpu_;
+  }
+  if (psi_cpu) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_cpu);
+    if (message_arena != submessage_arena) {
+      psi_cpu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_cpu, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.psi_cpu_ = psi_cpu;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarCgroupInfo.psi_cpu)
+}
+
+// optional .SarInfo.SarPsiInfo psi_memory = 18;
+inline bool SarInfo_SarCgroupInfo::_internal_has_psi_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_memory_ != nullptr);
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_psi_memory() const {
+  return _internal_has_psi_memory();
+}
+inline void SarInfo_SarCgroupInfo::clear_psi_memory() {
+  if (_impl_.psi_memory_ != nullptr) _impl_.psi_memory_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::_internal_psi_memory() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::psi_memory() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.psi_memory)
+  return _internal_psi_memory();
+}
+inline void SarInfo_SarCgroupInfo::unsafe_arena_set_allocated_psi_memory(
+    ::SarInfo_SarPsiInfo* psi_memory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_memory_);
+  }
+  _impl_.psi_memory_ = psi_memory;
+  if (psi_memory) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.SarCgroupInfo.psi_memory)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::release_psi_memory() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_memory_;
+  _impl_.psi_memory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::unsafe_arena_release_psi_memory() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarCgroupInfo.psi_memory)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_memory_;
+  _impl_.psi_memory_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::_internal_mutable_psi_memory() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.psi_memory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_memory_ = p;
+  }
+  return _impl_.psi_memory_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::mutable_psi_memory() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_memory();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarCgroupInfo.psi_memory)
+  return _msg;
+}
+inline void SarInfo_SarCgroupInfo::set_allocated_psi_memory(::SarInfo_SarPsiInfo* psi_memory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_memory_;
+  }
+  if (psi_memory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_memory);
+    if (message_arena != submessage_arena) {
+      psi_memory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_memory, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.psi_memory_ = psi_memory;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarCgroupInfo.psi_memory)
+}
+
+// optional .SarInfo.SarPsiInfo psi_io = 19;
+inline bool SarInfo_SarCgroupInfo::_internal_has_psi_io() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_io_ != nullptr);
+  return value;
+}
+inline bool SarInfo_SarCgroupInfo::has_psi_io() const {
+  return _internal_has_psi_io();
+}
+inline void SarInfo_SarCgroupInfo::clear_psi_io() {
+  if (_impl_.psi_io_ != nullptr) _impl_.psi_io_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::_internal_psi_io() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_io_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo_SarCgroupInfo::psi_io() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCgroupInfo.psi_io)
+  return _internal_psi_io();
+}
+inline void SarInfo_SarCgroupInfo::unsafe_arena_set_allocated_psi_io(
+    ::SarInfo_SarPsiInfo* psi_io) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_io_);
+  }
+  _impl_.psi_io_ = psi_io;
+  if (psi_io) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.SarCgroupInfo.psi_io)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::release_psi_io() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_io_;
+  _impl_.psi_io_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::unsafe_arena_release_psi_io() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarCgroupInfo.psi_io)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_io_;
+  _impl_.psi_io_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::_internal_mutable_psi_io() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.psi_io_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_io_ = p;
+  }
+  return _impl_.psi_io_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo_SarCgroupInfo::mutable_psi_io() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_io();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarCgroupInfo.psi_io)
+  return _msg;
+}
+inline void SarInfo_SarCgroupInfo::set_allocated_psi_io(::SarInfo_SarPsiInfo* psi_io) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_io_;
+  }
+  if (psi_io) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_io);
+    if (message_arena != submessage_arena) {
+      psi_io = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_io, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.psi_io_ = psi_io;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarCgroupInfo.psi_io)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarProcessInfo
+
+// optional int32 pid = 1;
+inline bool SarInfo_SarProcessInfo::_internal_has_pid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_pid() const {
+  return _internal_has_pid();
+}
+inline void SarInfo_SarProcessInfo::clear_pid() {
+  _impl_.pid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t SarInfo_SarProcessInfo::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline int32_t SarInfo_SarProcessInfo::pid() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.pid)
+  return _internal_pid();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_pid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.pid_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_pid(int32_t value) {
+  _internal_set_pid(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.pid)
+}
+
+// optional string comm = 2;
+inline bool SarInfo_SarProcessInfo::_internal_has_comm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_comm() const {
+  return _internal_has_comm();
+}
+inline void SarInfo_SarProcessInfo::clear_comm() {
+  _impl_.comm_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarProcessInfo::comm() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.comm)
+  return _internal_comm();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarProcessInfo::set_comm(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.comm_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.comm)
+}
+inline std::string* SarInfo_SarProcessInfo::mutable_comm() {
+  std::string* _s = _internal_mutable_comm();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarProcessInfo.comm)
+  return _s;
+}
+inline const std::string& SarInfo_SarProcessInfo::_internal_comm() const {
+  return _impl_.comm_.Get();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_comm(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.comm_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarProcessInfo::_internal_mutable_comm() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.comm_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarProcessInfo::release_comm() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarProcessInfo.comm)
+  if (!_internal_has_comm()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.comm_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comm_.IsDefault()) {
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarProcessInfo::set_allocated_comm(std::string* comm) {
+  if (comm != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.comm_.SetAllocated(comm, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comm_.IsDefault()) {
+    _impl_.comm_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarProcessInfo.comm)
+}
+
+// optional double cpu = 3;
+inline bool SarInfo_SarProcessInfo::_internal_has_cpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_cpu() const {
+  return _internal_has_cpu();
+}
+inline void SarInfo_SarProcessInfo::clear_cpu() {
+  _impl_.cpu_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarProcessInfo::_internal_cpu() const {
+  return _impl_.cpu_;
+}
+inline double SarInfo_SarProcessInfo::cpu() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.cpu)
+  return _internal_cpu();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_cpu(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cpu_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_cpu(double value) {
+  _internal_set_cpu(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.cpu)
+}
+
+// optional double cpu_user = 4;
+inline bool SarInfo_SarProcessInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo_SarProcessInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarProcessInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo_SarProcessInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.cpu_user)
+}
+
+// optional double cpu_system = 5;
+inline bool SarInfo_SarProcessInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo_SarProcessInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarProcessInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo_SarProcessInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.cpu_system)
+}
+
+// optional uint64 rss = 6;
+inline bool SarInfo_SarProcessInfo::_internal_has_rss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_rss() const {
+  return _internal_has_rss();
+}
+inline void SarInfo_SarProcessInfo::clear_rss() {
+  _impl_.rss_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t SarInfo_SarProcessInfo::_internal_rss() const {
+  return _impl_.rss_;
+}
+inline uint64_t SarInfo_SarProcessInfo::rss() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.rss)
+  return _internal_rss();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_rss(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rss_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_rss(uint64_t value) {
+  _internal_set_rss(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.rss)
+}
+
+// optional uint64 shared = 7;
+inline bool SarInfo_SarProcessInfo::_internal_has_shared() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_shared() const {
+  return _internal_has_shared();
+}
+inline void SarInfo_SarProcessInfo::clear_shared() {
+  _impl_.shared_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t SarInfo_SarProcessInfo::_internal_shared() const {
+  return _impl_.shared_;
+}
+inline uint64_t SarInfo_SarProcessInfo::shared() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.shared)
+  return _internal_shared();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_shared(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.shared_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_shared(uint64_t value) {
+  _internal_set_shared(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.shared)
+}
+
+// optional double minflt = 8;
+inline bool SarInfo_SarProcessInfo::_internal_has_minflt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_minflt() const {
+  return _internal_has_minflt();
+}
+inline void SarInfo_SarProcessInfo::clear_minflt() {
+  _impl_.minflt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarProcessInfo::_internal_minflt() const {
+  return _impl_.minflt_;
+}
+inline double SarInfo_SarProcessInfo::minflt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.minflt)
+  return _internal_minflt();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_minflt(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.minflt_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_minflt(double value) {
+  _internal_set_minflt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.minflt)
+}
+
+// optional double majflt = 9;
+inline bool SarInfo_SarProcessInfo::_internal_has_majflt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_majflt() const {
+  return _internal_has_majflt();
+}
+inline void SarInfo_SarProcessInfo::clear_majflt() {
+  _impl_.majflt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarProcessInfo::_internal_majflt() const {
+  return _impl_.majflt_;
+}
+inline double SarInfo_SarProcessInfo::majflt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.majflt)
+  return _internal_majflt();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_majflt(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.majflt_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_majflt(double value) {
+  _internal_set_majflt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.majflt)
+}
+
+// optional double read_bytes = 10;
+inline bool SarInfo_SarProcessInfo::_internal_has_read_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_read_bytes() const {
+  return _internal_has_read_bytes();
+}
+inline void SarInfo_SarProcessInfo::clear_read_bytes() {
+  _impl_.read_bytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarProcessInfo::_internal_read_bytes() const {
+  return _impl_.read_bytes_;
+}
+inline double SarInfo_SarProcessInfo::read_bytes() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.read_bytes)
+  return _internal_read_bytes();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_read_bytes(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.read_bytes_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_read_bytes(double value) {
+  _internal_set_read_bytes(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.read_bytes)
+}
+
+// optional double write_bytes = 11;
+inline bool SarInfo_SarProcessInfo::_internal_has_write_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarProcessInfo::has_write_bytes() const {
+  return _internal_has_write_bytes();
+}
+inline void SarInfo_SarProcessInfo::clear_write_bytes() {
+  _impl_.write_bytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarProcessInfo::_internal_write_bytes() const {
+  return _impl_.write_bytes_;
+}
+inline double SarInfo_SarProcessInfo::write_bytes() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarProcessInfo.write_bytes)
+  return _internal_write_bytes();
+}
+inline void SarInfo_SarProcessInfo::_internal_set_write_bytes(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.write_bytes_ = value;
+}
+inline void SarInfo_SarProcessInfo::set_write_bytes(double value) {
+  _internal_set_write_bytes(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarProcessInfo.write_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarIfaceInfo
+
+// optional string name = 1;
+inline bool SarInfo_SarIfaceInfo::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_name() const {
+  return _internal_has_name();
+}
+inline void SarInfo_SarIfaceInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarIfaceInfo::name() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarIfaceInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.name)
+}
+inline std::string* SarInfo_SarIfaceInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarIfaceInfo.name)
+  return _s;
+}
+inline const std::string& SarInfo_SarIfaceInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarIfaceInfo::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarIfaceInfo::release_name() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarIfaceInfo.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarIfaceInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarIfaceInfo.name)
+}
+
+// optional double rxpck = 2;
+inline bool SarInfo_SarIfaceInfo::_internal_has_rxpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_rxpck() const {
+  return _internal_has_rxpck();
+}
+inline void SarInfo_SarIfaceInfo::clear_rxpck() {
+  _impl_.rxpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_rxpck() const {
+  return _impl_.rxpck_;
+}
+inline double SarInfo_SarIfaceInfo::rxpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.rxpck)
+  return _internal_rxpck();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_rxpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.rxpck_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_rxpck(double value) {
+  _internal_set_rxpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.rxpck)
+}
+
+// optional double txpck = 3;
+inline bool SarInfo_SarIfaceInfo::_internal_has_txpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_txpck() const {
+  return _internal_has_txpck();
+}
+inline void SarInfo_SarIfaceInfo::clear_txpck() {
+  _impl_.txpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_txpck() const {
+  return _impl_.txpck_;
+}
+inline double SarInfo_SarIfaceInfo::txpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.txpck)
+  return _internal_txpck();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_txpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.txpck_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_txpck(double value) {
+  _internal_set_txpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.txpck)
+}
+
+// optional double rxbyt = 4;
+inline bool SarInfo_SarIfaceInfo::_internal_has_rxbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_rxbyt() const {
+  return _internal_has_rxbyt();
+}
+inline void SarInfo_SarIfaceInfo::clear_rxbyt() {
+  _impl_.rxbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_rxbyt() const {
+  return _impl_.rxbyt_;
+}
+inline double SarInfo_SarIfaceInfo::rxbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.rxbyt)
+  return _internal_rxbyt();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_rxbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.rxbyt_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_rxbyt(double value) {
+  _internal_set_rxbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.rxbyt)
+}
+
+// optional double txbyt = 5;
+inline bool SarInfo_SarIfaceInfo::_internal_has_txbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_txbyt() const {
+  return _internal_has_txbyt();
+}
+inline void SarInfo_SarIfaceInfo::clear_txbyt() {
+  _impl_.txbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_txbyt() const {
+  return _impl_.txbyt_;
+}
+inline double SarInfo_SarIfaceInfo::txbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.txbyt)
+  return _internal_txbyt();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_txbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.txbyt_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_txbyt(double value) {
+  _internal_set_txbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.txbyt)
+}
+
+// optional double rxerr = 6;
+inline bool SarInfo_SarIfaceInfo::_internal_has_rxerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_rxerr() const {
+  return _internal_has_rxerr();
+}
+inline void SarInfo_SarIfaceInfo::clear_rxerr() {
+  _impl_.rxerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_rxerr() const {
+  return _impl_.rxerr_;
+}
+inline double SarInfo_SarIfaceInfo::rxerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.rxerr)
+  return _internal_rxerr();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_rxerr(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.rxerr_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_rxerr(double value) {
+  _internal_set_rxerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.rxerr)
+}
+
+// optional double txerr = 7;
+inline bool SarInfo_SarIfaceInfo::_internal_has_txerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_txerr() const {
+  return _internal_has_txerr();
+}
+inline void SarInfo_SarIfaceInfo::clear_txerr() {
+  _impl_.txerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_txerr() const {
+  return _impl_.txerr_;
+}
+inline double SarInfo_SarIfaceInfo::txerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.txerr)
+  return _internal_txerr();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_txerr(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.txerr_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_txerr(double value) {
+  _internal_set_txerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.txerr)
+}
+
+// optional double rxdrop = 8;
+inline bool SarInfo_SarIfaceInfo::_internal_has_rxdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_rxdrop() const {
+  return _internal_has_rxdrop();
+}
+inline void SarInfo_SarIfaceInfo::clear_rxdrop() {
+  _impl_.rxdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_rxdrop() const {
+  return _impl_.rxdrop_;
+}
+inline double SarInfo_SarIfaceInfo::rxdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.rxdrop)
+  return _internal_rxdrop();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_rxdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.rxdrop_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_rxdrop(double value) {
+  _internal_set_rxdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.rxdrop)
+}
+
+// optional double txdrop = 9;
+inline bool SarInfo_SarIfaceInfo::_internal_has_txdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarIfaceInfo::has_txdrop() const {
+  return _internal_has_txdrop();
+}
+inline void SarInfo_SarIfaceInfo::clear_txdrop() {
+  _impl_.txdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarIfaceInfo::_internal_txdrop() const {
+  return _impl_.txdrop_;
+}
+inline double SarInfo_SarIfaceInfo::txdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarIfaceInfo.txdrop)
+  return _internal_txdrop();
+}
+inline void SarInfo_SarIfaceInfo::_internal_set_txdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.txdrop_ = value;
+}
+inline void SarInfo_SarIfaceInfo::set_txdrop(double value) {
+  _internal_set_txdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarIfaceInfo.txdrop)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarNetnsInfo
+
+// optional string name = 1;
+inline bool SarInfo_SarNetnsInfo::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_name() const {
+  return _internal_has_name();
+}
+inline void SarInfo_SarNetnsInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarNetnsInfo::name() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarNetnsInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.name)
+}
+inline std::string* SarInfo_SarNetnsInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarNetnsInfo.name)
+  return _s;
+}
+inline const std::string& SarInfo_SarNetnsInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarNetnsInfo::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarNetnsInfo::release_name() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarNetnsInfo.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarNetnsInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarNetnsInfo.name)
+}
+
+// optional uint64 inode = 2;
+inline bool SarInfo_SarNetnsInfo::_internal_has_inode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_inode() const {
+  return _internal_has_inode();
+}
+inline void SarInfo_SarNetnsInfo::clear_inode() {
+  _impl_.inode_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SarInfo_SarNetnsInfo::_internal_inode() const {
+  return _impl_.inode_;
+}
+inline uint64_t SarInfo_SarNetnsInfo::inode() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.inode)
+  return _internal_inode();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_inode(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.inode_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_inode(uint64_t value) {
+  _internal_set_inode(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.inode)
+}
+
+// optional int32 pid = 3;
+inline bool SarInfo_SarNetnsInfo::_internal_has_pid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_pid() const {
+  return _internal_has_pid();
+}
+inline void SarInfo_SarNetnsInfo::clear_pid() {
+  _impl_.pid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t SarInfo_SarNetnsInfo::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline int32_t SarInfo_SarNetnsInfo::pid() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.pid)
+  return _internal_pid();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_pid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.pid_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_pid(int32_t value) {
+  _internal_set_pid(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.pid)
+}
+
+// optional double rxpck = 4;
+inline bool SarInfo_SarNetnsInfo::_internal_has_rxpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_rxpck() const {
+  return _internal_has_rxpck();
+}
+inline void SarInfo_SarNetnsInfo::clear_rxpck() {
+  _impl_.rxpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_rxpck() const {
+  return _impl_.rxpck_;
+}
+inline double SarInfo_SarNetnsInfo::rxpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.rxpck)
+  return _internal_rxpck();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_rxpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.rxpck_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_rxpck(double value) {
+  _internal_set_rxpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.rxpck)
+}
+
+// optional double txpck = 5;
+inline bool SarInfo_SarNetnsInfo::_internal_has_txpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_txpck() const {
+  return _internal_has_txpck();
+}
+inline void SarInfo_SarNetnsInfo::clear_txpck() {
+  _impl_.txpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_txpck() const {
+  return _impl_.txpck_;
+}
+inline double SarInfo_SarNetnsInfo::txpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.txpck)
+  return _internal_txpck();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_txpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.txpck_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_txpck(double value) {
+  _internal_set_txpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.txpck)
+}
+
+// optional double rxbyt = 6;
+inline bool SarInfo_SarNetnsInfo::_internal_has_rxbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_rxbyt() const {
+  return _internal_has_rxbyt();
+}
+inline void SarInfo_SarNetnsInfo::clear_rxbyt() {
+  _impl_.rxbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_rxbyt() const {
+  return _impl_.rxbyt_;
+}
+inline double SarInfo_SarNetnsInfo::rxbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.rxbyt)
+  return _internal_rxbyt();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_rxbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rxbyt_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_rxbyt(double value) {
+  _internal_set_rxbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.rxbyt)
+}
+
+// optional double txbyt = 7;
+inline bool SarInfo_SarNetnsInfo::_internal_has_txbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_txbyt() const {
+  return _internal_has_txbyt();
+}
+inline void SarInfo_SarNetnsInfo::clear_txbyt() {
+  _impl_.txbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_txbyt() const {
+  return _impl_.txbyt_;
+}
+inline double SarInfo_SarNetnsInfo::txbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.txbyt)
+  return _internal_txbyt();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_txbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.txbyt_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_txbyt(double value) {
+  _internal_set_txbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.txbyt)
+}
+
+// optional double rxerr = 8;
+inline bool SarInfo_SarNetnsInfo::_internal_has_rxerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_rxerr() const {
+  return _internal_has_rxerr();
+}
+inline void SarInfo_SarNetnsInfo::clear_rxerr() {
+  _impl_.rxerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_rxerr() const {
+  return _impl_.rxerr_;
+}
+inline double SarInfo_SarNetnsInfo::rxerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.rxerr)
+  return _internal_rxerr();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_rxerr(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.rxerr_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_rxerr(double value) {
+  _internal_set_rxerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.rxerr)
+}
+
+// optional double txerr = 9;
+inline bool SarInfo_SarNetnsInfo::_internal_has_txerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_txerr() const {
+  return _internal_has_txerr();
+}
+inline void SarInfo_SarNetnsInfo::clear_txerr() {
+  _impl_.txerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_txerr() const {
+  return _impl_.txerr_;
+}
+inline double SarInfo_SarNetnsInfo::txerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.txerr)
+  return _internal_txerr();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_txerr(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.txerr_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_txerr(double value) {
+  _internal_set_txerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.txerr)
+}
+
+// optional double rxdrop = 10;
+inline bool SarInfo_SarNetnsInfo::_internal_has_rxdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_rxdrop() const {
+  return _internal_has_rxdrop();
+}
+inline void SarInfo_SarNetnsInfo::clear_rxdrop() {
+  _impl_.rxdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_rxdrop() const {
+  return _impl_.rxdrop_;
+}
+inline double SarInfo_SarNetnsInfo::rxdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.rxdrop)
+  return _internal_rxdrop();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_rxdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.rxdrop_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_rxdrop(double value) {
+  _internal_set_rxdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.rxdrop)
+}
+
+// optional double txdrop = 11;
+inline bool SarInfo_SarNetnsInfo::_internal_has_txdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNetnsInfo::has_txdrop() const {
+  return _internal_has_txdrop();
+}
+inline void SarInfo_SarNetnsInfo::clear_txdrop() {
+  _impl_.txdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarNetnsInfo::_internal_txdrop() const {
+  return _impl_.txdrop_;
+}
+inline double SarInfo_SarNetnsInfo::txdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.txdrop)
+  return _internal_txdrop();
+}
+inline void SarInfo_SarNetnsInfo::_internal_set_txdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.txdrop_ = value;
+}
+inline void SarInfo_SarNetnsInfo::set_txdrop(double value) {
+  _internal_set_txdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNetnsInfo.txdrop)
+}
+
+// repeated .SarInfo.SarIfaceInfo iface = 12;
+inline int SarInfo_SarNetnsInfo::_internal_iface_size() const {
+  return _impl_.iface_.size();
+}
+inline int SarInfo_SarNetnsInfo::iface_size() const {
+  return _internal_iface_size();
+}
+inline void SarInfo_SarNetnsInfo::clear_iface() {
+  _impl_.iface_.Clear();
+}
+inline ::SarInfo_SarIfaceInfo* SarInfo_SarNetnsInfo::mutable_iface(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarNetnsInfo.iface)
+  return _impl_.iface_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarIfaceInfo >*
+SarInfo_SarNetnsInfo::mutable_iface() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.SarNetnsInfo.iface)
+  return &_impl_.iface_;
+}
+inline const ::SarInfo_SarIfaceInfo& SarInfo_SarNetnsInfo::_internal_iface(int index) const {
+  return _impl_.iface_.Get(index);
+}
+inline const ::SarInfo_SarIfaceInfo& SarInfo_SarNetnsInfo::iface(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNetnsInfo.iface)
+  return _internal_iface(index);
+}
+inline ::SarInfo_SarIfaceInfo* SarInfo_SarNetnsInfo::_internal_add_iface() {
+  return _impl_.iface_.Add();
+}
+inline ::SarInfo_SarIfaceInfo* SarInfo_SarNetnsInfo::add_iface() {
+  ::SarInfo_SarIfaceInfo* _add = _internal_add_iface();
+  // @@protoc_insertion_point(field_add:SarInfo.SarNetnsInfo.iface)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarIfaceInfo >&
+SarInfo_SarNetnsInfo::iface() const {
+  // @@protoc_insertion_point(field_list:SarInfo.SarNetnsInfo.iface)
+  return _impl_.iface_;
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarFsInfo
+
+// optional string mount_point = 1;
+inline bool SarInfo_SarFsInfo::_internal_has_mount_point() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_mount_point() const {
+  return _internal_has_mount_point();
+}
+inline void SarInfo_SarFsInfo::clear_mount_point() {
+  _impl_.mount_point_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarFsInfo::mount_point() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.mount_point)
+  return _internal_mount_point();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarFsInfo::set_mount_point(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.mount_point_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.mount_point)
+}
+inline std::string* SarInfo_SarFsInfo::mutable_mount_point() {
+  std::string* _s = _internal_mutable_mount_point();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarFsInfo.mount_point)
+  return _s;
+}
+inline const std::string& SarInfo_SarFsInfo::_internal_mount_point() const {
+  return _impl_.mount_point_.Get();
+}
+inline void SarInfo_SarFsInfo::_internal_set_mount_point(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.mount_point_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::_internal_mutable_mount_point() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.mount_point_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::release_mount_point() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarFsInfo.mount_point)
+  if (!_internal_has_mount_point()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.mount_point_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mount_point_.IsDefault()) {
+    _impl_.mount_point_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarFsInfo::set_allocated_mount_point(std::string* mount_point) {
+  if (mount_point != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.mount_point_.SetAllocated(mount_point, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mount_point_.IsDefault()) {
+    _impl_.mount_point_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarFsInfo.mount_point)
+}
+
+// optional string fs_type = 2;
+inline bool SarInfo_SarFsInfo::_internal_has_fs_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_fs_type() const {
+  return _internal_has_fs_type();
+}
+inline void SarInfo_SarFsInfo::clear_fs_type() {
+  _impl_.fs_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SarInfo_SarFsInfo::fs_type() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.fs_type)
+  return _internal_fs_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarFsInfo::set_fs_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.fs_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.fs_type)
+}
+inline std::string* SarInfo_SarFsInfo::mutable_fs_type() {
+  std::string* _s = _internal_mutable_fs_type();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarFsInfo.fs_type)
+  return _s;
+}
+inline const std::string& SarInfo_SarFsInfo::_internal_fs_type() const {
+  return _impl_.fs_type_.Get();
+}
+inline void SarInfo_SarFsInfo::_internal_set_fs_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.fs_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::_internal_mutable_fs_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.fs_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::release_fs_type() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarFsInfo.fs_type)
+  if (!_internal_has_fs_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.fs_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fs_type_.IsDefault()) {
+    _impl_.fs_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarFsInfo::set_allocated_fs_type(std::string* fs_type) {
+  if (fs_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.fs_type_.SetAllocated(fs_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fs_type_.IsDefault()) {
+    _impl_.fs_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarFsInfo.fs_type)
+}
+
+// optional string source = 3;
+inline bool SarInfo_SarFsInfo::_internal_has_source() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_source() const {
+  return _internal_has_source();
+}
+inline void SarInfo_SarFsInfo::clear_source() {
+  _impl_.source_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& SarInfo_SarFsInfo::source() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.source)
+  return _internal_source();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarFsInfo::set_source(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.source)
+}
+inline std::string* SarInfo_SarFsInfo::mutable_source() {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarFsInfo.source)
+  return _s;
+}
+inline const std::string& SarInfo_SarFsInfo::_internal_source() const {
+  return _impl_.source_.Get();
+}
+inline void SarInfo_SarFsInfo::_internal_set_source(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.source_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::_internal_mutable_source() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.source_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarFsInfo::release_source() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarFsInfo.source)
+  if (!_internal_has_source()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.source_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarFsInfo::set_allocated_source(std::string* source) {
+  if (source != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.source_.SetAllocated(source, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarFsInfo.source)
+}
+
+// optional uint64 size = 4;
+inline bool SarInfo_SarFsInfo::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_size() const {
+  return _internal_has_size();
+}
+inline void SarInfo_SarFsInfo::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SarInfo_SarFsInfo::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t SarInfo_SarFsInfo::size() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.size)
+  return _internal_size();
+}
+inline void SarInfo_SarFsInfo::_internal_set_size(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.size_ = value;
+}
+inline void SarInfo_SarFsInfo::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.size)
+}
+
+// optional uint64 used = 5;
+inline bool SarInfo_SarFsInfo::_internal_has_used() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_used() const {
+  return _internal_has_used();
+}
+inline void SarInfo_SarFsInfo::clear_used() {
+  _impl_.used_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t SarInfo_SarFsInfo::_internal_used() const {
+  return _impl_.used_;
+}
+inline uint64_t SarInfo_SarFsInfo::used() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.used)
+  return _internal_used();
+}
+inline void SarInfo_SarFsInfo::_internal_set_used(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.used_ = value;
+}
+inline void SarInfo_SarFsInfo::set_used(uint64_t value) {
+  _internal_set_used(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.used)
+}
+
+// optional uint64 avail = 6;
+inline bool SarInfo_SarFsInfo::_internal_has_avail() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_avail() const {
+  return _internal_has_avail();
+}
+inline void SarInfo_SarFsInfo::clear_avail() {
+  _impl_.avail_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t SarInfo_SarFsInfo::_internal_avail() const {
+  return _impl_.avail_;
+}
+inline uint64_t SarInfo_SarFsInfo::avail() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.avail)
+  return _internal_avail();
+}
+inline void SarInfo_SarFsInfo::_internal_set_avail(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.avail_ = value;
+}
+inline void SarInfo_SarFsInfo::set_avail(uint64_t value) {
+  _internal_set_avail(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.avail)
+}
+
+// optional double used_pct = 7;
+inline bool SarInfo_SarFsInfo::_internal_has_used_pct() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_used_pct() const {
+  return _internal_has_used_pct();
+}
+inline void SarInfo_SarFsInfo::clear_used_pct() {
+  _impl_.used_pct_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarFsInfo::_internal_used_pct() const {
+  return _impl_.used_pct_;
+}
+inline double SarInfo_SarFsInfo::used_pct() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.used_pct)
+  return _internal_used_pct();
+}
+inline void SarInfo_SarFsInfo::_internal_set_used_pct(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.used_pct_ = value;
+}
+inline void SarInfo_SarFsInfo::set_used_pct(double value) {
+  _internal_set_used_pct(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.used_pct)
+}
+
+// optional double free_pct = 8;
+inline bool SarInfo_SarFsInfo::_internal_has_free_pct() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_free_pct() const {
+  return _internal_has_free_pct();
+}
+inline void SarInfo_SarFsInfo::clear_free_pct() {
+  _impl_.free_pct_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarFsInfo::_internal_free_pct() const {
+  return _impl_.free_pct_;
+}
+inline double SarInfo_SarFsInfo::free_pct() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.free_pct)
+  return _internal_free_pct();
+}
+inline void SarInfo_SarFsInfo::_internal_set_free_pct(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.free_pct_ = value;
+}
+inline void SarInfo_SarFsInfo::set_free_pct(double value) {
+  _internal_set_free_pct(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.free_pct)
+}
+
+// optional double inode_used_pct = 9;
+inline bool SarInfo_SarFsInfo::_internal_has_inode_used_pct() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_inode_used_pct() const {
+  return _internal_has_inode_used_pct();
+}
+inline void SarInfo_SarFsInfo::clear_inode_used_pct() {
+  _impl_.inode_used_pct_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo_SarFsInfo::_internal_inode_used_pct() const {
+  return _impl_.inode_used_pct_;
+}
+inline double SarInfo_SarFsInfo::inode_used_pct() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.inode_used_pct)
+  return _internal_inode_used_pct();
+}
+inline void SarInfo_SarFsInfo::_internal_set_inode_used_pct(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.inode_used_pct_ = value;
+}
+inline void SarInfo_SarFsInfo::set_inode_used_pct(double value) {
+  _internal_set_inode_used_pct(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.inode_used_pct)
+}
+
+// optional double growth = 10;
+inline bool SarInfo_SarFsInfo::_internal_has_growth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_growth() const {
+  return _internal_has_growth();
+}
+inline void SarInfo_SarFsInfo::clear_growth() {
+  _impl_.growth_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo_SarFsInfo::_internal_growth() const {
+  return _impl_.growth_;
+}
+inline double SarInfo_SarFsInfo::growth() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.growth)
+  return _internal_growth();
+}
+inline void SarInfo_SarFsInfo::_internal_set_growth(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.growth_ = value;
+}
+inline void SarInfo_SarFsInfo::set_growth(double value) {
+  _internal_set_growth(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.growth)
+}
+
+// optional double time_to_full = 11;
+inline bool SarInfo_SarFsInfo::_internal_has_time_to_full() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarFsInfo::has_time_to_full() const {
+  return _internal_has_time_to_full();
+}
+inline void SarInfo_SarFsInfo::clear_time_to_full() {
+  _impl_.time_to_full_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SarInfo_SarFsInfo::_internal_time_to_full() const {
+  return _impl_.time_to_full_;
+}
+inline double SarInfo_SarFsInfo::time_to_full() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarFsInfo.time_to_full)
+  return _internal_time_to_full();
+}
+inline void SarInfo_SarFsInfo::_internal_set_time_to_full(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.time_to_full_ = value;
+}
+inline void SarInfo_SarFsInfo::set_time_to_full(double value) {
+  _internal_set_time_to_full(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarFsInfo.time_to_full)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarCpuGroupInfo
+
+// optional int32 id = 1;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_id() const {
+  return _internal_has_id();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::id() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.id)
+  return _internal_id();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.id)
+}
+
+// optional int32 package_id = 2;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_package_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_package_id() const {
+  return _internal_has_package_id();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_package_id() {
+  _impl_.package_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::_internal_package_id() const {
+  return _impl_.package_id_;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::package_id() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.package_id)
+  return _internal_package_id();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_package_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.package_id_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_package_id(int32_t value) {
+  _internal_set_package_id(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.package_id)
+}
+
+// optional int32 nr_cpus = 3;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_nr_cpus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_nr_cpus() const {
+  return _internal_has_nr_cpus();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_nr_cpus() {
+  _impl_.nr_cpus_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::_internal_nr_cpus() const {
+  return _impl_.nr_cpus_;
+}
+inline int32_t SarInfo_SarCpuGroupInfo::nr_cpus() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.nr_cpus)
+  return _internal_nr_cpus();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_nr_cpus(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.nr_cpus_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_nr_cpus(int32_t value) {
+  _internal_set_nr_cpus(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.nr_cpus)
+}
+
+// optional double cpu_user = 4;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_user)
+}
+
+// optional double cpu_nice = 5;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_nice() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_nice() const {
+  return _internal_has_cpu_nice();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_nice() {
+  _impl_.cpu_nice_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_nice() const {
+  return _impl_.cpu_nice_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_nice() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_nice)
+  return _internal_cpu_nice();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_nice(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cpu_nice_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_nice(double value) {
+  _internal_set_cpu_nice(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_nice)
+}
+
+// optional double cpu_system = 6;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_system)
+}
+
+// optional double cpu_iowait = 7;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_iowait() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_iowait() const {
+  return _internal_has_cpu_iowait();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_iowait() {
+  _impl_.cpu_iowait_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_iowait() const {
+  return _impl_.cpu_iowait_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_iowait() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_iowait)
+  return _internal_cpu_iowait();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_iowait(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cpu_iowait_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_iowait(double value) {
+  _internal_set_cpu_iowait(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_iowait)
+}
+
+// optional double cpu_steal = 8;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_steal() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_steal() const {
+  return _internal_has_cpu_steal();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_steal() {
+  _impl_.cpu_steal_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_steal() const {
+  return _impl_.cpu_steal_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_steal() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_steal)
+  return _internal_cpu_steal();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_steal(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.cpu_steal_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_steal(double value) {
+  _internal_set_cpu_steal(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_steal)
+}
+
+// optional double cpu_idle = 9;
+inline bool SarInfo_SarCpuGroupInfo::_internal_has_cpu_idle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarCpuGroupInfo::has_cpu_idle() const {
+  return _internal_has_cpu_idle();
+}
+inline void SarInfo_SarCpuGroupInfo::clear_cpu_idle() {
+  _impl_.cpu_idle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarCpuGroupInfo::_internal_cpu_idle() const {
+  return _impl_.cpu_idle_;
+}
+inline double SarInfo_SarCpuGroupInfo::cpu_idle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarCpuGroupInfo.cpu_idle)
+  return _internal_cpu_idle();
+}
+inline void SarInfo_SarCpuGroupInfo::_internal_set_cpu_idle(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.cpu_idle_ = value;
+}
+inline void SarInfo_SarCpuGroupInfo::set_cpu_idle(double value) {
+  _internal_set_cpu_idle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarCpuGroupInfo.cpu_idle)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarNodeInfo
+
+// optional int32 node = 1;
+inline bool SarInfo_SarNodeInfo::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_node() const {
+  return _internal_has_node();
+}
+inline void SarInfo_SarNodeInfo::clear_node() {
+  _impl_.node_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t SarInfo_SarNodeInfo::_internal_node() const {
+  return _impl_.node_;
+}
+inline int32_t SarInfo_SarNodeInfo::node() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.node)
+  return _internal_node();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_node(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.node_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_node(int32_t value) {
+  _internal_set_node(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.node)
+}
+
+// optional int32 nr_cpus = 2;
+inline bool SarInfo_SarNodeInfo::_internal_has_nr_cpus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_nr_cpus() const {
+  return _internal_has_nr_cpus();
+}
+inline void SarInfo_SarNodeInfo::clear_nr_cpus() {
+  _impl_.nr_cpus_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SarInfo_SarNodeInfo::_internal_nr_cpus() const {
+  return _impl_.nr_cpus_;
+}
+inline int32_t SarInfo_SarNodeInfo::nr_cpus() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.nr_cpus)
+  return _internal_nr_cpus();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_nr_cpus(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.nr_cpus_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_nr_cpus(int32_t value) {
+  _internal_set_nr_cpus(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.nr_cpus)
+}
+
+// optional double cpu_user = 3;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo_SarNodeInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_user)
+}
+
+// optional double cpu_nice = 4;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_nice() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_nice() const {
+  return _internal_has_cpu_nice();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_nice() {
+  _impl_.cpu_nice_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_nice() const {
+  return _impl_.cpu_nice_;
+}
+inline double SarInfo_SarNodeInfo::cpu_nice() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_nice)
+  return _internal_cpu_nice();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_nice(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cpu_nice_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_nice(double value) {
+  _internal_set_cpu_nice(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_nice)
+}
+
+// optional double cpu_system = 5;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo_SarNodeInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_system)
+}
+
+// optional double cpu_iowait = 6;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_iowait() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_iowait() const {
+  return _internal_has_cpu_iowait();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_iowait() {
+  _impl_.cpu_iowait_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_iowait() const {
+  return _impl_.cpu_iowait_;
+}
+inline double SarInfo_SarNodeInfo::cpu_iowait() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_iowait)
+  return _internal_cpu_iowait();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_iowait(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cpu_iowait_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_iowait(double value) {
+  _internal_set_cpu_iowait(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_iowait)
+}
+
+// optional double cpu_steal = 7;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_steal() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_steal() const {
+  return _internal_has_cpu_steal();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_steal() {
+  _impl_.cpu_steal_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_steal() const {
+  return _impl_.cpu_steal_;
+}
+inline double SarInfo_SarNodeInfo::cpu_steal() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_steal)
+  return _internal_cpu_steal();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_steal(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.cpu_steal_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_steal(double value) {
+  _internal_set_cpu_steal(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_steal)
+}
+
+// optional double cpu_idle = 8;
+inline bool SarInfo_SarNodeInfo::_internal_has_cpu_idle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_cpu_idle() const {
+  return _internal_has_cpu_idle();
+}
+inline void SarInfo_SarNodeInfo::clear_cpu_idle() {
+  _impl_.cpu_idle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo_SarNodeInfo::_internal_cpu_idle() const {
+  return _impl_.cpu_idle_;
+}
+inline double SarInfo_SarNodeInfo::cpu_idle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.cpu_idle)
+  return _internal_cpu_idle();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_cpu_idle(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.cpu_idle_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_cpu_idle(double value) {
+  _internal_set_cpu_idle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.cpu_idle)
+}
+
+// optional uint64 mem_total = 9;
+inline bool SarInfo_SarNodeInfo::_internal_has_mem_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_mem_total() const {
+  return _internal_has_mem_total();
+}
+inline void SarInfo_SarNodeInfo::clear_mem_total() {
+  _impl_.mem_total_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t SarInfo_SarNodeInfo::_internal_mem_total() const {
+  return _impl_.mem_total_;
+}
+inline uint64_t SarInfo_SarNodeInfo::mem_total() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.mem_total)
+  return _internal_mem_total();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_mem_total(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.mem_total_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_mem_total(uint64_t value) {
+  _internal_set_mem_total(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.mem_total)
+}
+
+// optional uint64 mem_free = 10;
+inline bool SarInfo_SarNodeInfo::_internal_has_mem_free() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_mem_free() const {
+  return _internal_has_mem_free();
+}
+inline void SarInfo_SarNodeInfo::clear_mem_free() {
+  _impl_.mem_free_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t SarInfo_SarNodeInfo::_internal_mem_free() const {
+  return _impl_.mem_free_;
+}
+inline uint64_t SarInfo_SarNodeInfo::mem_free() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.mem_free)
+  return _internal_mem_free();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_mem_free(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.mem_free_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_mem_free(uint64_t value) {
+  _internal_set_mem_free(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.mem_free)
+}
+
+// optional double numa_hit = 11;
+inline bool SarInfo_SarNodeInfo::_internal_has_numa_hit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_numa_hit() const {
+  return _internal_has_numa_hit();
+}
+inline void SarInfo_SarNodeInfo::clear_numa_hit() {
+  _impl_.numa_hit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SarInfo_SarNodeInfo::_internal_numa_hit() const {
+  return _impl_.numa_hit_;
+}
+inline double SarInfo_SarNodeInfo::numa_hit() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.numa_hit)
+  return _internal_numa_hit();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_numa_hit(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.numa_hit_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_numa_hit(double value) {
+  _internal_set_numa_hit(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.numa_hit)
+}
+
+// optional double numa_miss = 12;
+inline bool SarInfo_SarNodeInfo::_internal_has_numa_miss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_numa_miss() const {
+  return _internal_has_numa_miss();
+}
+inline void SarInfo_SarNodeInfo::clear_numa_miss() {
+  _impl_.numa_miss_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double SarInfo_SarNodeInfo::_internal_numa_miss() const {
+  return _impl_.numa_miss_;
+}
+inline double SarInfo_SarNodeInfo::numa_miss() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.numa_miss)
+  return _internal_numa_miss();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_numa_miss(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.numa_miss_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_numa_miss(double value) {
+  _internal_set_numa_miss(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.numa_miss)
+}
+
+// optional double numa_foreign = 13;
+inline bool SarInfo_SarNodeInfo::_internal_has_numa_foreign() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_numa_foreign() const {
+  return _internal_has_numa_foreign();
+}
+inline void SarInfo_SarNodeInfo::clear_numa_foreign() {
+  _impl_.numa_foreign_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double SarInfo_SarNodeInfo::_internal_numa_foreign() const {
+  return _impl_.numa_foreign_;
+}
+inline double SarInfo_SarNodeInfo::numa_foreign() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.numa_foreign)
+  return _internal_numa_foreign();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_numa_foreign(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.numa_foreign_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_numa_foreign(double value) {
+  _internal_set_numa_foreign(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.numa_foreign)
+}
+
+// optional double local_node = 14;
+inline bool SarInfo_SarNodeInfo::_internal_has_local_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_local_node() const {
+  return _internal_has_local_node();
+}
+inline void SarInfo_SarNodeInfo::clear_local_node() {
+  _impl_.local_node_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double SarInfo_SarNodeInfo::_internal_local_node() const {
+  return _impl_.local_node_;
+}
+inline double SarInfo_SarNodeInfo::local_node() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.local_node)
+  return _internal_local_node();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_local_node(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.local_node_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_local_node(double value) {
+  _internal_set_local_node(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.local_node)
+}
+
+// optional double other_node = 15;
+inline bool SarInfo_SarNodeInfo::_internal_has_other_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool SarInfo_SarNodeInfo::has_other_node() const {
+  return _internal_has_other_node();
+}
+inline void SarInfo_SarNodeInfo::clear_other_node() {
+  _impl_.other_node_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double SarInfo_SarNodeInfo::_internal_other_node() const {
+  return _impl_.other_node_;
+}
+inline double SarInfo_SarNodeInfo::other_node() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarNodeInfo.other_node)
+  return _internal_other_node();
+}
+inline void SarInfo_SarNodeInfo::_internal_set_other_node(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.other_node_ = value;
+}
+inline void SarInfo_SarNodeInfo::set_other_node(double value) {
+  _internal_set_other_node(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarNodeInfo.other_node)
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo_SarSketch
+
+// optional string name = 1;
+inline bool SarInfo_SarSketch::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_name() const {
+  return _internal_has_name();
+}
+inline void SarInfo_SarSketch::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SarInfo_SarSketch::name() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SarInfo_SarSketch::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.name)
+}
+inline std::string* SarInfo_SarSketch::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:SarInfo.SarSketch.name)
+  return _s;
+}
+inline const std::string& SarInfo_SarSketch::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SarInfo_SarSketch::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarSketch::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SarInfo_SarSketch::release_name() {
+  // @@protoc_insertion_point(field_release:SarInfo.SarSketch.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SarInfo_SarSketch::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.SarSketch.name)
+}
+
+// optional double relative_accuracy = 2;
+inline bool SarInfo_SarSketch::_internal_has_relative_accuracy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_relative_accuracy() const {
+  return _internal_has_relative_accuracy();
+}
+inline void SarInfo_SarSketch::clear_relative_accuracy() {
+  _impl_.relative_accuracy_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SarInfo_SarSketch::_internal_relative_accuracy() const {
+  return _impl_.relative_accuracy_;
+}
+inline double SarInfo_SarSketch::relative_accuracy() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.relative_accuracy)
+  return _internal_relative_accuracy();
+}
+inline void SarInfo_SarSketch::_internal_set_relative_accuracy(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.relative_accuracy_ = value;
+}
+inline void SarInfo_SarSketch::set_relative_accuracy(double value) {
+  _internal_set_relative_accuracy(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.relative_accuracy)
+}
+
+// optional uint64 count = 3;
+inline bool SarInfo_SarSketch::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_count() const {
+  return _internal_has_count();
+}
+inline void SarInfo_SarSketch::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SarInfo_SarSketch::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t SarInfo_SarSketch::count() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.count)
+  return _internal_count();
+}
+inline void SarInfo_SarSketch::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.count_ = value;
+}
+inline void SarInfo_SarSketch::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.count)
+}
+
+// optional double sum = 4;
+inline bool SarInfo_SarSketch::_internal_has_sum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_sum() const {
+  return _internal_has_sum();
+}
+inline void SarInfo_SarSketch::clear_sum() {
+  _impl_.sum_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SarInfo_SarSketch::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline double SarInfo_SarSketch::sum() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.sum)
+  return _internal_sum();
+}
+inline void SarInfo_SarSketch::_internal_set_sum(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sum_ = value;
+}
+inline void SarInfo_SarSketch::set_sum(double value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.sum)
+}
+
+// optional double min = 5;
+inline bool SarInfo_SarSketch::_internal_has_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_min() const {
+  return _internal_has_min();
+}
+inline void SarInfo_SarSketch::clear_min() {
+  _impl_.min_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo_SarSketch::_internal_min() const {
+  return _impl_.min_;
+}
+inline double SarInfo_SarSketch::min() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.min)
+  return _internal_min();
+}
+inline void SarInfo_SarSketch::_internal_set_min(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.min_ = value;
+}
+inline void SarInfo_SarSketch::set_min(double value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.min)
+}
+
+// optional double max = 6;
+inline bool SarInfo_SarSketch::_internal_has_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_max() const {
+  return _internal_has_max();
+}
+inline void SarInfo_SarSketch::clear_max() {
+  _impl_.max_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo_SarSketch::_internal_max() const {
+  return _impl_.max_;
+}
+inline double SarInfo_SarSketch::max() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.max)
+  return _internal_max();
+}
+inline void SarInfo_SarSketch::_internal_set_max(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.max_ = value;
+}
+inline void SarInfo_SarSketch::set_max(double value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.max)
+}
+
+// optional uint64 zero_count = 7;
+inline bool SarInfo_SarSketch::_internal_has_zero_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_zero_count() const {
+  return _internal_has_zero_count();
+}
+inline void SarInfo_SarSketch::clear_zero_count() {
+  _impl_.zero_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t SarInfo_SarSketch::_internal_zero_count() const {
+  return _impl_.zero_count_;
+}
+inline uint64_t SarInfo_SarSketch::zero_count() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.zero_count)
+  return _internal_zero_count();
+}
+inline void SarInfo_SarSketch::_internal_set_zero_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.zero_count_ = value;
+}
+inline void SarInfo_SarSketch::set_zero_count(uint64_t value) {
+  _internal_set_zero_count(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.zero_count)
+}
+
+// optional sint32 offset = 8;
+inline bool SarInfo_SarSketch::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_offset() const {
+  return _internal_has_offset();
+}
+inline void SarInfo_SarSketch::clear_offset() {
+  _impl_.offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t SarInfo_SarSketch::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t SarInfo_SarSketch::offset() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.offset)
+  return _internal_offset();
+}
+inline void SarInfo_SarSketch::_internal_set_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.offset_ = value;
+}
+inline void SarInfo_SarSketch::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.offset)
+}
+
+// repeated uint64 counts = 9 [packed = true];
+inline int SarInfo_SarSketch::_internal_counts_size() const {
+  return _impl_.counts_.size();
+}
+inline int SarInfo_SarSketch::counts_size() const {
+  return _internal_counts_size();
+}
+inline void SarInfo_SarSketch::clear_counts() {
+  _impl_.counts_.Clear();
+}
+inline uint64_t SarInfo_SarSketch::_internal_counts(int index) const {
+  return _impl_.counts_.Get(index);
+}
+inline uint64_t SarInfo_SarSketch::counts(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.counts)
+  return _internal_counts(index);
+}
+inline void SarInfo_SarSketch::set_counts(int index, uint64_t value) {
+  _impl_.counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.counts)
+}
+inline void SarInfo_SarSketch::_internal_add_counts(uint64_t value) {
+  _impl_.counts_.Add(value);
+}
+inline void SarInfo_SarSketch::add_counts(uint64_t value) {
+  _internal_add_counts(value);
+  // @@protoc_insertion_point(field_add:SarInfo.SarSketch.counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SarInfo_SarSketch::_internal_counts() const {
+  return _impl_.counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SarInfo_SarSketch::counts() const {
+  // @@protoc_insertion_point(field_list:SarInfo.SarSketch.counts)
+  return _internal_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SarInfo_SarSketch::_internal_mutable_counts() {
+  return &_impl_.counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SarInfo_SarSketch::mutable_counts() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.SarSketch.counts)
+  return _internal_mutable_counts();
+}
+
+// optional sint32 negative_offset = 10;
+inline bool SarInfo_SarSketch::_internal_has_negative_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo_SarSketch::has_negative_offset() const {
+  return _internal_has_negative_offset();
+}
+inline void SarInfo_SarSketch::clear_negative_offset() {
+  _impl_.negative_offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t SarInfo_SarSketch::_internal_negative_offset() const {
+  return _impl_.negative_offset_;
+}
+inline int32_t SarInfo_SarSketch::negative_offset() const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.negative_offset)
+  return _internal_negative_offset();
+}
+inline void SarInfo_SarSketch::_internal_set_negative_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.negative_offset_ = value;
+}
+inline void SarInfo_SarSketch::set_negative_offset(int32_t value) {
+  _internal_set_negative_offset(value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.negative_offset)
+}
+
+// repeated uint64 negative_counts = 11 [packed = true];
+inline int SarInfo_SarSketch::_internal_negative_counts_size() const {
+  return _impl_.negative_counts_.size();
+}
+inline int SarInfo_SarSketch::negative_counts_size() const {
+  return _internal_negative_counts_size();
+}
+inline void SarInfo_SarSketch::clear_negative_counts() {
+  _impl_.negative_counts_.Clear();
+}
+inline uint64_t SarInfo_SarSketch::_internal_negative_counts(int index) const {
+  return _impl_.negative_counts_.Get(index);
+}
+inline uint64_t SarInfo_SarSketch::negative_counts(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.SarSketch.negative_counts)
+  return _internal_negative_counts(index);
+}
+inline void SarInfo_SarSketch::set_negative_counts(int index, uint64_t value) {
+  _impl_.negative_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SarInfo.SarSketch.negative_counts)
+}
+inline void SarInfo_SarSketch::_internal_add_negative_counts(uint64_t value) {
+  _impl_.negative_counts_.Add(value);
+}
+inline void SarInfo_SarSketch::add_negative_counts(uint64_t value) {
+  _internal_add_negative_counts(value);
+  // @@protoc_insertion_point(field_add:SarInfo.SarSketch.negative_counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SarInfo_SarSketch::_internal_negative_counts() const {
+  return _impl_.negative_counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SarInfo_SarSketch::negative_counts() const {
+  // @@protoc_insertion_point(field_list:SarInfo.SarSketch.negative_counts)
+  return _internal_negative_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SarInfo_SarSketch::_internal_mutable_negative_counts() {
+  return &_impl_.negative_counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SarInfo_SarSketch::mutable_negative_counts() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.SarSketch.negative_counts)
+  return _internal_mutable_negative_counts();
+}
+
+// -------------------------------------------------------------------
+
+// SarInfo
+
+// optional double rxpck = 1;
+inline bool SarInfo::_internal_has_rxpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxpck() const {
+  return _internal_has_rxpck();
+}
+inline void SarInfo::clear_rxpck() {
+  _impl_.rxpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SarInfo::_internal_rxpck() const {
+  return _impl_.rxpck_;
+}
+inline double SarInfo::rxpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxpck)
+  return _internal_rxpck();
+}
+inline void SarInfo::_internal_set_rxpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rxpck_ = value;
+}
+inline void SarInfo::set_rxpck(double value) {
+  _internal_set_rxpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxpck)
+}
+
+// optional double txpck = 2;
+inline bool SarInfo::_internal_has_txpck() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txpck() const {
+  return _internal_has_txpck();
+}
+inline void SarInfo::clear_txpck() {
+  _impl_.txpck_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SarInfo::_internal_txpck() const {
+  return _impl_.txpck_;
+}
+inline double SarInfo::txpck() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txpck)
+  return _internal_txpck();
+}
+inline void SarInfo::_internal_set_txpck(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.txpck_ = value;
+}
+inline void SarInfo::set_txpck(double value) {
+  _internal_set_txpck(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txpck)
+}
+
+// optional double rxbyt = 3;
+inline bool SarInfo::_internal_has_rxbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxbyt() const {
+  return _internal_has_rxbyt();
+}
+inline void SarInfo::clear_rxbyt() {
+  _impl_.rxbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SarInfo::_internal_rxbyt() const {
+  return _impl_.rxbyt_;
+}
+inline double SarInfo::rxbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxbyt)
+  return _internal_rxbyt();
+}
+inline void SarInfo::_internal_set_rxbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.rxbyt_ = value;
+}
+inline void SarInfo::set_rxbyt(double value) {
+  _internal_set_rxbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxbyt)
+}
+
+// optional double txbyt = 4;
+inline bool SarInfo::_internal_has_txbyt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txbyt() const {
+  return _internal_has_txbyt();
+}
+inline void SarInfo::clear_txbyt() {
+  _impl_.txbyt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SarInfo::_internal_txbyt() const {
+  return _impl_.txbyt_;
+}
+inline double SarInfo::txbyt() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txbyt)
+  return _internal_txbyt();
+}
+inline void SarInfo::_internal_set_txbyt(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.txbyt_ = value;
+}
+inline void SarInfo::set_txbyt(double value) {
+  _internal_set_txbyt(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txbyt)
+}
+
+// optional double rxcmp = 5;
+inline bool SarInfo::_internal_has_rxcmp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxcmp() const {
+  return _internal_has_rxcmp();
+}
+inline void SarInfo::clear_rxcmp() {
+  _impl_.rxcmp_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double SarInfo::_internal_rxcmp() const {
+  return _impl_.rxcmp_;
+}
+inline double SarInfo::rxcmp() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxcmp)
+  return _internal_rxcmp();
+}
+inline void SarInfo::_internal_set_rxcmp(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.rxcmp_ = value;
+}
+inline void SarInfo::set_rxcmp(double value) {
+  _internal_set_rxcmp(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxcmp)
+}
+
+// optional double txcmp = 6;
+inline bool SarInfo::_internal_has_txcmp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txcmp() const {
+  return _internal_has_txcmp();
+}
+inline void SarInfo::clear_txcmp() {
+  _impl_.txcmp_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double SarInfo::_internal_txcmp() const {
+  return _impl_.txcmp_;
+}
+inline double SarInfo::txcmp() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txcmp)
+  return _internal_txcmp();
+}
+inline void SarInfo::_internal_set_txcmp(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.txcmp_ = value;
+}
+inline void SarInfo::set_txcmp(double value) {
+  _internal_set_txcmp(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txcmp)
+}
+
+// optional double rxmcst = 7;
+inline bool SarInfo::_internal_has_rxmcst() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxmcst() const {
+  return _internal_has_rxmcst();
+}
+inline void SarInfo::clear_rxmcst() {
+  _impl_.rxmcst_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SarInfo::_internal_rxmcst() const {
+  return _impl_.rxmcst_;
+}
+inline double SarInfo::rxmcst() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxmcst)
+  return _internal_rxmcst();
+}
+inline void SarInfo::_internal_set_rxmcst(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.rxmcst_ = value;
+}
+inline void SarInfo::set_rxmcst(double value) {
+  _internal_set_rxmcst(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxmcst)
+}
+
+// optional double rxerr = 8;
+inline bool SarInfo::_internal_has_rxerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxerr() const {
+  return _internal_has_rxerr();
+}
+inline void SarInfo::clear_rxerr() {
+  _impl_.rxerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double SarInfo::_internal_rxerr() const {
+  return _impl_.rxerr_;
+}
+inline double SarInfo::rxerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxerr)
+  return _internal_rxerr();
+}
+inline void SarInfo::_internal_set_rxerr(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.rxerr_ = value;
+}
+inline void SarInfo::set_rxerr(double value) {
+  _internal_set_rxerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxerr)
+}
+
+// optional double txerr = 9;
+inline bool SarInfo::_internal_has_txerr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txerr() const {
+  return _internal_has_txerr();
+}
+inline void SarInfo::clear_txerr() {
+  _impl_.txerr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double SarInfo::_internal_txerr() const {
+  return _impl_.txerr_;
+}
+inline double SarInfo::txerr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txerr)
+  return _internal_txerr();
+}
+inline void SarInfo::_internal_set_txerr(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.txerr_ = value;
+}
+inline void SarInfo::set_txerr(double value) {
+  _internal_set_txerr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txerr)
+}
+
+// optional double coll = 10;
+inline bool SarInfo::_internal_has_coll() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_coll() const {
+  return _internal_has_coll();
+}
+inline void SarInfo::clear_coll() {
+  _impl_.coll_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double SarInfo::_internal_coll() const {
+  return _impl_.coll_;
+}
+inline double SarInfo::coll() const {
+  // @@protoc_insertion_point(field_get:SarInfo.coll)
+  return _internal_coll();
+}
+inline void SarInfo::_internal_set_coll(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.coll_ = value;
+}
+inline void SarInfo::set_coll(double value) {
+  _internal_set_coll(value);
+  // @@protoc_insertion_point(field_set:SarInfo.coll)
+}
+
+// optional double rxdrop = 11;
+inline bool SarInfo::_internal_has_rxdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxdrop() const {
+  return _internal_has_rxdrop();
+}
+inline void SarInfo::clear_rxdrop() {
+  _impl_.rxdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double SarInfo::_internal_rxdrop() const {
+  return _impl_.rxdrop_;
+}
+inline double SarInfo::rxdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxdrop)
+  return _internal_rxdrop();
+}
+inline void SarInfo::_internal_set_rxdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.rxdrop_ = value;
+}
+inline void SarInfo::set_rxdrop(double value) {
+  _internal_set_rxdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxdrop)
+}
+
+// optional double txdrop = 12;
+inline bool SarInfo::_internal_has_txdrop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txdrop() const {
+  return _internal_has_txdrop();
+}
+inline void SarInfo::clear_txdrop() {
+  _impl_.txdrop_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double SarInfo::_internal_txdrop() const {
+  return _impl_.txdrop_;
+}
+inline double SarInfo::txdrop() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txdrop)
+  return _internal_txdrop();
+}
+inline void SarInfo::_internal_set_txdrop(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.txdrop_ = value;
+}
+inline void SarInfo::set_txdrop(double value) {
+  _internal_set_txdrop(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txdrop)
+}
+
+// optional double txcarr = 13;
+inline bool SarInfo::_internal_has_txcarr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txcarr() const {
+  return _internal_has_txcarr();
+}
+inline void SarInfo::clear_txcarr() {
+  _impl_.txcarr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline double SarInfo::_internal_txcarr() const {
+  return _impl_.txcarr_;
+}
+inline double SarInfo::txcarr() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txcarr)
+  return _internal_txcarr();
+}
+inline void SarInfo::_internal_set_txcarr(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.txcarr_ = value;
+}
+inline void SarInfo::set_txcarr(double value) {
+  _internal_set_txcarr(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txcarr)
+}
+
+// optional double rxfram = 14;
+inline bool SarInfo::_internal_has_rxfram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxfram() const {
+  return _internal_has_rxfram();
+}
+inline void SarInfo::clear_rxfram() {
+  _impl_.rxfram_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline double SarInfo::_internal_rxfram() const {
+  return _impl_.rxfram_;
+}
+inline double SarInfo::rxfram() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxfram)
+  return _internal_rxfram();
+}
+inline void SarInfo::_internal_set_rxfram(double value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.rxfram_ = value;
+}
+inline void SarInfo::set_rxfram(double value) {
+  _internal_set_rxfram(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxfram)
+}
+
+// optional double rxfifo = 15;
+inline bool SarInfo::_internal_has_rxfifo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rxfifo() const {
+  return _internal_has_rxfifo();
+}
+inline void SarInfo::clear_rxfifo() {
+  _impl_.rxfifo_ = 0;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline double SarInfo::_internal_rxfifo() const {
+  return _impl_.rxfifo_;
+}
+inline double SarInfo::rxfifo() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rxfifo)
+  return _internal_rxfifo();
+}
+inline void SarInfo::_internal_set_rxfifo(double value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.rxfifo_ = value;
+}
+inline void SarInfo::set_rxfifo(double value) {
+  _internal_set_rxfifo(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rxfifo)
+}
+
+// optional double txfifo = 16;
+inline bool SarInfo::_internal_has_txfifo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_txfifo() const {
+  return _internal_has_txfifo();
+}
+inline void SarInfo::clear_txfifo() {
+  _impl_.txfifo_ = 0;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline double SarInfo::_internal_txfifo() const {
+  return _impl_.txfifo_;
+}
+inline double SarInfo::txfifo() const {
+  // @@protoc_insertion_point(field_get:SarInfo.txfifo)
+  return _internal_txfifo();
+}
+inline void SarInfo::_internal_set_txfifo(double value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.txfifo_ = value;
+}
+inline void SarInfo::set_txfifo(double value) {
+  _internal_set_txfifo(value);
+  // @@protoc_insertion_point(field_set:SarInfo.txfifo)
+}
+
+// optional double nr_processes = 17;
+inline bool SarInfo::_internal_has_nr_processes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_nr_processes() const {
+  return _internal_has_nr_processes();
+}
+inline void SarInfo::clear_nr_processes() {
+  _impl_.nr_processes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline double SarInfo::_internal_nr_processes() const {
+  return _impl_.nr_processes_;
+}
+inline double SarInfo::nr_processes() const {
+  // @@protoc_insertion_point(field_get:SarInfo.nr_processes)
+  return _internal_nr_processes();
+}
+inline void SarInfo::_internal_set_nr_processes(double value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.nr_processes_ = value;
+}
+inline void SarInfo::set_nr_processes(double value) {
+  _internal_set_nr_processes(value);
+  // @@protoc_insertion_point(field_set:SarInfo.nr_processes)
+}
+
+// optional double cpu_user = 18;
+inline bool SarInfo::_internal_has_cpu_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_user() const {
+  return _internal_has_cpu_user();
+}
+inline void SarInfo::clear_cpu_user() {
+  _impl_.cpu_user_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline double SarInfo::_internal_cpu_user() const {
+  return _impl_.cpu_user_;
+}
+inline double SarInfo::cpu_user() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_user)
+  return _internal_cpu_user();
+}
+inline void SarInfo::_internal_set_cpu_user(double value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.cpu_user_ = value;
+}
+inline void SarInfo::set_cpu_user(double value) {
+  _internal_set_cpu_user(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_user)
+}
+
+// optional double cpu_nice = 19;
+inline bool SarInfo::_internal_has_cpu_nice() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_nice() const {
+  return _internal_has_cpu_nice();
+}
+inline void SarInfo::clear_cpu_nice() {
+  _impl_.cpu_nice_ = 0;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline double SarInfo::_internal_cpu_nice() const {
+  return _impl_.cpu_nice_;
+}
+inline double SarInfo::cpu_nice() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_nice)
+  return _internal_cpu_nice();
+}
+inline void SarInfo::_internal_set_cpu_nice(double value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.cpu_nice_ = value;
+}
+inline void SarInfo::set_cpu_nice(double value) {
+  _internal_set_cpu_nice(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_nice)
+}
+
+// optional double cpu_system = 20;
+inline bool SarInfo::_internal_has_cpu_system() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_system() const {
+  return _internal_has_cpu_system();
+}
+inline void SarInfo::clear_cpu_system() {
+  _impl_.cpu_system_ = 0;
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline double SarInfo::_internal_cpu_system() const {
+  return _impl_.cpu_system_;
+}
+inline double SarInfo::cpu_system() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_system)
+  return _internal_cpu_system();
+}
+inline void SarInfo::_internal_set_cpu_system(double value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.cpu_system_ = value;
+}
+inline void SarInfo::set_cpu_system(double value) {
+  _internal_set_cpu_system(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_system)
+}
+
+// optional double cpu_iowait = 21;
+inline bool SarInfo::_internal_has_cpu_iowait() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_iowait() const {
+  return _internal_has_cpu_iowait();
+}
+inline void SarInfo::clear_cpu_iowait() {
+  _impl_.cpu_iowait_ = 0;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline double SarInfo::_internal_cpu_iowait() const {
+  return _impl_.cpu_iowait_;
+}
+inline double SarInfo::cpu_iowait() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_iowait)
+  return _internal_cpu_iowait();
+}
+inline void SarInfo::_internal_set_cpu_iowait(double value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.cpu_iowait_ = value;
+}
+inline void SarInfo::set_cpu_iowait(double value) {
+  _internal_set_cpu_iowait(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_iowait)
+}
+
+// optional double cpu_steal = 22;
+inline bool SarInfo::_internal_has_cpu_steal() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_steal() const {
+  return _internal_has_cpu_steal();
+}
+inline void SarInfo::clear_cpu_steal() {
+  _impl_.cpu_steal_ = 0;
+  _impl_._has_bits_[0] &= ~0x02000000u;
+}
+inline double SarInfo::_internal_cpu_steal() const {
+  return _impl_.cpu_steal_;
+}
+inline double SarInfo::cpu_steal() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_steal)
+  return _internal_cpu_steal();
+}
+inline void SarInfo::_internal_set_cpu_steal(double value) {
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.cpu_steal_ = value;
+}
+inline void SarInfo::set_cpu_steal(double value) {
+  _internal_set_cpu_steal(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_steal)
+}
+
+// optional double cpu_idle = 23;
+inline bool SarInfo::_internal_has_cpu_idle() const {
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_cpu_idle() const {
+  return _internal_has_cpu_idle();
+}
+inline void SarInfo::clear_cpu_idle() {
+  _impl_.cpu_idle_ = 0;
+  _impl_._has_bits_[0] &= ~0x04000000u;
+}
+inline double SarInfo::_internal_cpu_idle() const {
+  return _impl_.cpu_idle_;
+}
+inline double SarInfo::cpu_idle() const {
+  // @@protoc_insertion_point(field_get:SarInfo.cpu_idle)
+  return _internal_cpu_idle();
+}
+inline void SarInfo::_internal_set_cpu_idle(double value) {
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.cpu_idle_ = value;
+}
+inline void SarInfo::set_cpu_idle(double value) {
+  _internal_set_cpu_idle(value);
+  // @@protoc_insertion_point(field_set:SarInfo.cpu_idle)
+}
+
+// optional double pgpgin = 24;
+inline bool SarInfo::_internal_has_pgpgin() const {
+  bool value = (_impl_._has_bits_[0] & 0x08000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pgpgin() const {
+  return _internal_has_pgpgin();
+}
+inline void SarInfo::clear_pgpgin() {
+  _impl_.pgpgin_ = 0;
+  _impl_._has_bits_[0] &= ~0x08000000u;
+}
+inline double SarInfo::_internal_pgpgin() const {
+  return _impl_.pgpgin_;
+}
+inline double SarInfo::pgpgin() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pgpgin)
+  return _internal_pgpgin();
+}
+inline void SarInfo::_internal_set_pgpgin(double value) {
+  _impl_._has_bits_[0] |= 0x08000000u;
+  _impl_.pgpgin_ = value;
+}
+inline void SarInfo::set_pgpgin(double value) {
+  _internal_set_pgpgin(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pgpgin)
+}
+
+// optional double pgpgout = 25;
+inline bool SarInfo::_internal_has_pgpgout() const {
+  bool value = (_impl_._has_bits_[0] & 0x10000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pgpgout() const {
+  return _internal_has_pgpgout();
+}
+inline void SarInfo::clear_pgpgout() {
+  _impl_.pgpgout_ = 0;
+  _impl_._has_bits_[0] &= ~0x10000000u;
+}
+inline double SarInfo::_internal_pgpgout() const {
+  return _impl_.pgpgout_;
+}
+inline double SarInfo::pgpgout() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pgpgout)
+  return _internal_pgpgout();
+}
+inline void SarInfo::_internal_set_pgpgout(double value) {
+  _impl_._has_bits_[0] |= 0x10000000u;
+  _impl_.pgpgout_ = value;
+}
+inline void SarInfo::set_pgpgout(double value) {
+  _internal_set_pgpgout(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pgpgout)
+}
+
+// optional double pgfault = 26;
+inline bool SarInfo::_internal_has_pgfault() const {
+  bool value = (_impl_._has_bits_[0] & 0x20000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pgfault() const {
+  return _internal_has_pgfault();
+}
+inline void SarInfo::clear_pgfault() {
+  _impl_.pgfault_ = 0;
+  _impl_._has_bits_[0] &= ~0x20000000u;
+}
+inline double SarInfo::_internal_pgfault() const {
+  return _impl_.pgfault_;
+}
+inline double SarInfo::pgfault() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pgfault)
+  return _internal_pgfault();
+}
+inline void SarInfo::_internal_set_pgfault(double value) {
+  _impl_._has_bits_[0] |= 0x20000000u;
+  _impl_.pgfault_ = value;
+}
+inline void SarInfo::set_pgfault(double value) {
+  _internal_set_pgfault(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pgfault)
+}
+
+// optional double pgmajfault = 27;
+inline bool SarInfo::_internal_has_pgmajfault() const {
+  bool value = (_impl_._has_bits_[0] & 0x40000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pgmajfault() const {
+  return _internal_has_pgmajfault();
+}
+inline void SarInfo::clear_pgmajfault() {
+  _impl_.pgmajfault_ = 0;
+  _impl_._has_bits_[0] &= ~0x40000000u;
+}
+inline double SarInfo::_internal_pgmajfault() const {
+  return _impl_.pgmajfault_;
+}
+inline double SarInfo::pgmajfault() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pgmajfault)
+  return _internal_pgmajfault();
+}
+inline void SarInfo::_internal_set_pgmajfault(double value) {
+  _impl_._has_bits_[0] |= 0x40000000u;
+  _impl_.pgmajfault_ = value;
+}
+inline void SarInfo::set_pgmajfault(double value) {
+  _internal_set_pgmajfault(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pgmajfault)
+}
+
+// optional double pswpin = 28;
+inline bool SarInfo::_internal_has_pswpin() const {
+  bool value = (_impl_._has_bits_[0] & 0x80000000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pswpin() const {
+  return _internal_has_pswpin();
+}
+inline void SarInfo::clear_pswpin() {
+  _impl_.pswpin_ = 0;
+  _impl_._has_bits_[0] &= ~0x80000000u;
+}
+inline double SarInfo::_internal_pswpin() const {
+  return _impl_.pswpin_;
+}
+inline double SarInfo::pswpin() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pswpin)
+  return _internal_pswpin();
+}
+inline void SarInfo::_internal_set_pswpin(double value) {
+  _impl_._has_bits_[0] |= 0x80000000u;
+  _impl_.pswpin_ = value;
+}
+inline void SarInfo::set_pswpin(double value) {
+  _internal_set_pswpin(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pswpin)
+}
+
+// optional double pswpout = 29;
+inline bool SarInfo::_internal_has_pswpout() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SarInfo::has_pswpout() const {
+  return _internal_has_pswpout();
+}
+inline void SarInfo::clear_pswpout() {
+  _impl_.pswpout_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000001u;
+}
+inline double SarInfo::_internal_pswpout() const {
+  return _impl_.pswpout_;
+}
+inline double SarInfo::pswpout() const {
+  // @@protoc_insertion_point(field_get:SarInfo.pswpout)
+  return _internal_pswpout();
+}
+inline void SarInfo::_internal_set_pswpout(double value) {
+  _impl_._has_bits_[1] |= 0x00000001u;
+  _impl_.pswpout_ = value;
+}
+inline void SarInfo::set_pswpout(double value) {
+  _internal_set_pswpout(value);
+  // @@protoc_insertion_point(field_set:SarInfo.pswpout)
+}
+
+// optional double tps = 30;
+inline bool SarInfo::_internal_has_tps() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SarInfo::has_tps() const {
+  return _internal_has_tps();
+}
+inline void SarInfo::clear_tps() {
+  _impl_.tps_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000002u;
+}
+inline double SarInfo::_internal_tps() const {
+  return _impl_.tps_;
+}
+inline double SarInfo::tps() const {
+  // @@protoc_insertion_point(field_get:SarInfo.tps)
+  return _internal_tps();
+}
+inline void SarInfo::_internal_set_tps(double value) {
+  _impl_._has_bits_[1] |= 0x00000002u;
+  _impl_.tps_ = value;
+}
+inline void SarInfo::set_tps(double value) {
+  _internal_set_tps(value);
+  // @@protoc_insertion_point(field_set:SarInfo.tps)
+}
+
+// optional double rtps = 31;
+inline bool SarInfo::_internal_has_rtps() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SarInfo::has_rtps() const {
+  return _internal_has_rtps();
+}
+inline void SarInfo::clear_rtps() {
+  _impl_.rtps_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000004u;
+}
+inline double SarInfo::_internal_rtps() const {
+  return _impl_.rtps_;
+}
+inline double SarInfo::rtps() const {
+  // @@protoc_insertion_point(field_get:SarInfo.rtps)
+  return _internal_rtps();
+}
+inline void SarInfo::_internal_set_rtps(double value) {
+  _impl_._has_bits_[1] |= 0x00000004u;
+  _impl_.rtps_ = value;
+}
+inline void SarInfo::set_rtps(double value) {
+  _internal_set_rtps(value);
+  // @@protoc_insertion_point(field_set:SarInfo.rtps)
+}
+
+// optional double wtps = 32;
+inline bool SarInfo::_internal_has_wtps() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SarInfo::has_wtps() const {
+  return _internal_has_wtps();
+}
+inline void SarInfo::clear_wtps() {
+  _impl_.wtps_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000008u;
+}
+inline double SarInfo::_internal_wtps() const {
+  return _impl_.wtps_;
+}
+inline double SarInfo::wtps() const {
+  // @@protoc_insertion_point(field_get:SarInfo.wtps)
+  return _internal_wtps();
+}
+inline void SarInfo::_internal_set_wtps(double value) {
+  _impl_._has_bits_[1] |= 0x00000008u;
+  _impl_.wtps_ = value;
+}
+inline void SarInfo::set_wtps(double value) {
+  _internal_set_wtps(value);
+  // @@protoc_insertion_point(field_set:SarInfo.wtps)
+}
+
+// optional double bread = 33;
+inline bool SarInfo::_internal_has_bread() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SarInfo::has_bread() const {
+  return _internal_has_bread();
+}
+inline void SarInfo::clear_bread() {
+  _impl_.bread_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000010u;
+}
+inline double SarInfo::_internal_bread() const {
+  return _impl_.bread_;
+}
+inline double SarInfo::bread() const {
+  // @@protoc_insertion_point(field_get:SarInfo.bread)
+  return _internal_bread();
+}
+inline void SarInfo::_internal_set_bread(double value) {
+  _impl_._has_bits_[1] |= 0x00000010u;
+  _impl_.bread_ = value;
+}
+inline void SarInfo::set_bread(double value) {
+  _internal_set_bread(value);
+  // @@protoc_insertion_point(field_set:SarInfo.bread)
+}
+
+// optional double bwrtn = 34;
+inline bool SarInfo::_internal_has_bwrtn() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SarInfo::has_bwrtn() const {
+  return _internal_has_bwrtn();
+}
+inline void SarInfo::clear_bwrtn() {
+  _impl_.bwrtn_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000020u;
+}
+inline double SarInfo::_internal_bwrtn() const {
+  return _impl_.bwrtn_;
+}
+inline double SarInfo::bwrtn() const {
+  // @@protoc_insertion_point(field_get:SarInfo.bwrtn)
+  return _internal_bwrtn();
+}
+inline void SarInfo::_internal_set_bwrtn(double value) {
+  _impl_._has_bits_[1] |= 0x00000020u;
+  _impl_.bwrtn_ = value;
+}
+inline void SarInfo::set_bwrtn(double value) {
+  _internal_set_bwrtn(value);
+  // @@protoc_insertion_point(field_set:SarInfo.bwrtn)
+}
+
+// optional double frmpg = 35;
+inline bool SarInfo::_internal_has_frmpg() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SarInfo::has_frmpg() const {
+  return _internal_has_frmpg();
+}
+inline void SarInfo::clear_frmpg() {
+  _impl_.frmpg_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000040u;
+}
+inline double SarInfo::_internal_frmpg() const {
+  return _impl_.frmpg_;
+}
+inline double SarInfo::frmpg() const {
+  // @@protoc_insertion_point(field_get:SarInfo.frmpg)
+  return _internal_frmpg();
+}
+inline void SarInfo::_internal_set_frmpg(double value) {
+  _impl_._has_bits_[1] |= 0x00000040u;
+  _impl_.frmpg_ = value;
+}
+inline void SarInfo::set_frmpg(double value) {
+  _internal_set_frmpg(value);
+  // @@protoc_insertion_point(field_set:SarInfo.frmpg)
+}
+
+// optional double bufpg = 36;
+inline bool SarInfo::_internal_has_bufpg() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SarInfo::has_bufpg() const {
+  return _internal_has_bufpg();
+}
+inline void SarInfo::clear_bufpg() {
+  _impl_.bufpg_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000080u;
+}
+inline double SarInfo::_internal_bufpg() const {
+  return _impl_.bufpg_;
+}
+inline double SarInfo::bufpg() const {
+  // @@protoc_insertion_point(field_get:SarInfo.bufpg)
+  return _internal_bufpg();
+}
+inline void SarInfo::_internal_set_bufpg(double value) {
+  _impl_._has_bits_[1] |= 0x00000080u;
+  _impl_.bufpg_ = value;
+}
+inline void SarInfo::set_bufpg(double value) {
+  _internal_set_bufpg(value);
+  // @@protoc_insertion_point(field_set:SarInfo.bufpg)
+}
+
+// optional double campg = 37;
+inline bool SarInfo::_internal_has_campg() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SarInfo::has_campg() const {
+  return _internal_has_campg();
+}
+inline void SarInfo::clear_campg() {
+  _impl_.campg_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000100u;
+}
+inline double SarInfo::_internal_campg() const {
+  return _impl_.campg_;
+}
+inline double SarInfo::campg() const {
+  // @@protoc_insertion_point(field_get:SarInfo.campg)
+  return _internal_campg();
+}
+inline void SarInfo::_internal_set_campg(double value) {
+  _impl_._has_bits_[1] |= 0x00000100u;
+  _impl_.campg_ = value;
+}
+inline void SarInfo::set_campg(double value) {
+  _internal_set_campg(value);
+  // @@protoc_insertion_point(field_set:SarInfo.campg)
+}
+
+// repeated .SarInfo.SarDiskInfo sar_disk_info = 38;
+inline int SarInfo::_internal_sar_disk_info_size() const {
+  return _impl_.sar_disk_info_.size();
+}
+inline int SarInfo::sar_disk_info_size() const {
+  return _internal_sar_disk_info_size();
+}
+inline void SarInfo::clear_sar_disk_info() {
+  _impl_.sar_disk_info_.Clear();
+}
+inline ::SarInfo_SarDiskInfo* SarInfo::mutable_sar_disk_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_disk_info)
+  return _impl_.sar_disk_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarDiskInfo >*
+SarInfo::mutable_sar_disk_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_disk_info)
+  return &_impl_.sar_disk_info_;
+}
+inline const ::SarInfo_SarDiskInfo& SarInfo::_internal_sar_disk_info(int index) const {
+  return _impl_.sar_disk_info_.Get(index);
+}
+inline const ::SarInfo_SarDiskInfo& SarInfo::sar_disk_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_disk_info)
+  return _internal_sar_disk_info(index);
+}
+inline ::SarInfo_SarDiskInfo* SarInfo::_internal_add_sar_disk_info() {
+  return _impl_.sar_disk_info_.Add();
+}
+inline ::SarInfo_SarDiskInfo* SarInfo::add_sar_disk_info() {
+  ::SarInfo_SarDiskInfo* _add = _internal_add_sar_disk_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_disk_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarDiskInfo >&
+SarInfo::sar_disk_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_disk_info)
+  return _impl_.sar_disk_info_;
+}
+
+// optional .SarInfo.SarNetProtoInfo net_proto = 39;
+inline bool SarInfo::_internal_has_net_proto() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.net_proto_ != nullptr);
+  return value;
+}
+inline bool SarInfo::has_net_proto() const {
+  return _internal_has_net_proto();
+}
+inline void SarInfo::clear_net_proto() {
+  if (_impl_.net_proto_ != nullptr) _impl_.net_proto_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::SarInfo_SarNetProtoInfo& SarInfo::_internal_net_proto() const {
+  const ::SarInfo_SarNetProtoInfo* p = _impl_.net_proto_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarNetProtoInfo&>(
+      ::_SarInfo_SarNetProtoInfo_default_instance_);
+}
+inline const ::SarInfo_SarNetProtoInfo& SarInfo::net_proto() const {
+  // @@protoc_insertion_point(field_get:SarInfo.net_proto)
+  return _internal_net_proto();
+}
+inline void SarInfo::unsafe_arena_set_allocated_net_proto(
+    ::SarInfo_SarNetProtoInfo* net_proto) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.net_proto_);
+  }
+  _impl_.net_proto_ = net_proto;
+  if (net_proto) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.net_proto)
+}
+inline ::SarInfo_SarNetProtoInfo* SarInfo::release_net_proto() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::SarInfo_SarNetProtoInfo* temp = _impl_.net_proto_;
+  _impl_.net_proto_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarNetProtoInfo* SarInfo::unsafe_arena_release_net_proto() {
+  // @@protoc_insertion_point(field_release:SarInfo.net_proto)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::SarInfo_SarNetProtoInfo* temp = _impl_.net_proto_;
+  _impl_.net_proto_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarNetProtoInfo* SarInfo::_internal_mutable_net_proto() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.net_proto_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarNetProtoInfo>(GetArenaForAllocation());
+    _impl_.net_proto_ = p;
+  }
+  return _impl_.net_proto_;
+}
+inline ::SarInfo_SarNetProtoInfo* SarInfo::mutable_net_proto() {
+  ::SarInfo_SarNetProtoInfo* _msg = _internal_mutable_net_proto();
+  // @@protoc_insertion_point(field_mutable:SarInfo.net_proto)
+  return _msg;
+}
+inline void SarInfo::set_allocated_net_proto(::SarInfo_SarNetProtoInfo* net_proto) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.net_proto_;
+  }
+  if (net_proto) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(net_proto);
+    if (message_arena != submessage_arena) {
+      net_proto = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, net_proto, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.net_proto_ = net_proto;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.net_proto)
+}
+
+// repeated .SarInfo.SarCpuInfo sar_cpu_info = 40;
+inline int SarInfo::_internal_sar_cpu_info_size() const {
+  return _impl_.sar_cpu_info_.size();
+}
+inline int SarInfo::sar_cpu_info_size() const {
+  return _internal_sar_cpu_info_size();
+}
+inline void SarInfo::clear_sar_cpu_info() {
+  _impl_.sar_cpu_info_.Clear();
+}
+inline ::SarInfo_SarCpuInfo* SarInfo::mutable_sar_cpu_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_cpu_info)
+  return _impl_.sar_cpu_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuInfo >*
+SarInfo::mutable_sar_cpu_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_cpu_info)
+  return &_impl_.sar_cpu_info_;
+}
+inline const ::SarInfo_SarCpuInfo& SarInfo::_internal_sar_cpu_info(int index) const {
+  return _impl_.sar_cpu_info_.Get(index);
+}
+inline const ::SarInfo_SarCpuInfo& SarInfo::sar_cpu_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_cpu_info)
+  return _internal_sar_cpu_info(index);
+}
+inline ::SarInfo_SarCpuInfo* SarInfo::_internal_add_sar_cpu_info() {
+  return _impl_.sar_cpu_info_.Add();
+}
+inline ::SarInfo_SarCpuInfo* SarInfo::add_sar_cpu_info() {
+  ::SarInfo_SarCpuInfo* _add = _internal_add_sar_cpu_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_cpu_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuInfo >&
+SarInfo::sar_cpu_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_cpu_info)
+  return _impl_.sar_cpu_info_;
+}
+
+// optional double softnet_processed = 41;
+inline bool SarInfo::_internal_has_softnet_processed() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SarInfo::has_softnet_processed() const {
+  return _internal_has_softnet_processed();
+}
+inline void SarInfo::clear_softnet_processed() {
+  _impl_.softnet_processed_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000200u;
+}
+inline double SarInfo::_internal_softnet_processed() const {
+  return _impl_.softnet_processed_;
+}
+inline double SarInfo::softnet_processed() const {
+  // @@protoc_insertion_point(field_get:SarInfo.softnet_processed)
+  return _internal_softnet_processed();
+}
+inline void SarInfo::_internal_set_softnet_processed(double value) {
+  _impl_._has_bits_[1] |= 0x00000200u;
+  _impl_.softnet_processed_ = value;
+}
+inline void SarInfo::set_softnet_processed(double value) {
+  _internal_set_softnet_processed(value);
+  // @@protoc_insertion_point(field_set:SarInfo.softnet_processed)
+}
+
+// optional double softnet_dropped = 42;
+inline bool SarInfo::_internal_has_softnet_dropped() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SarInfo::has_softnet_dropped() const {
+  return _internal_has_softnet_dropped();
+}
+inline void SarInfo::clear_softnet_dropped() {
+  _impl_.softnet_dropped_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000400u;
+}
+inline double SarInfo::_internal_softnet_dropped() const {
+  return _impl_.softnet_dropped_;
+}
+inline double SarInfo::softnet_dropped() const {
+  // @@protoc_insertion_point(field_get:SarInfo.softnet_dropped)
+  return _internal_softnet_dropped();
+}
+inline void SarInfo::_internal_set_softnet_dropped(double value) {
+  _impl_._has_bits_[1] |= 0x00000400u;
+  _impl_.softnet_dropped_ = value;
+}
+inline void SarInfo::set_softnet_dropped(double value) {
+  _internal_set_softnet_dropped(value);
+  // @@protoc_insertion_point(field_set:SarInfo.softnet_dropped)
+}
+
+// optional double softnet_time_squeeze = 43;
+inline bool SarInfo::_internal_has_softnet_time_squeeze() const {
+  bool value = (_impl_._has_bits_[1] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SarInfo::has_softnet_time_squeeze() const {
+  return _internal_has_softnet_time_squeeze();
+}
+inline void SarInfo::clear_softnet_time_squeeze() {
+  _impl_.softnet_time_squeeze_ = 0;
+  _impl_._has_bits_[1] &= ~0x00000800u;
+}
+inline double SarInfo::_internal_softnet_time_squeeze() const {
+  return _impl_.softnet_time_squeeze_;
+}
+inline double SarInfo::softnet_time_squeeze() const {
+  // @@protoc_insertion_point(field_get:SarInfo.softnet_time_squeeze)
+  return _internal_softnet_time_squeeze();
+}
+inline void SarInfo::_internal_set_softnet_time_squeeze(double value) {
+  _impl_._has_bits_[1] |= 0x00000800u;
+  _impl_.softnet_time_squeeze_ = value;
+}
+inline void SarInfo::set_softnet_time_squeeze(double value) {
+  _internal_set_softnet_time_squeeze(value);
+  // @@protoc_insertion_point(field_set:SarInfo.softnet_time_squeeze)
+}
+
+// optional int32 softnet_squeezed_cpus = 44;
+inline bool SarInfo::_internal_has_softnet_squeezed_cpus() const {
+  bool value = (_impl_._has_bits_[1] & 0x00002000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_softnet_squeezed_cpus() const {
+  return _internal_has_softnet_squeezed_cpus();
+}
+inline void SarInfo::clear_softnet_squeezed_cpus() {
+  _impl_.softnet_squeezed_cpus_ = 0;
+  _impl_._has_bits_[1] &= ~0x00002000u;
+}
+inline int32_t SarInfo::_internal_softnet_squeezed_cpus() const {
+  return _impl_.softnet_squeezed_cpus_;
+}
+inline int32_t SarInfo::softnet_squeezed_cpus() const {
+  // @@protoc_insertion_point(field_get:SarInfo.softnet_squeezed_cpus)
+  return _internal_softnet_squeezed_cpus();
+}
+inline void SarInfo::_internal_set_softnet_squeezed_cpus(int32_t value) {
+  _impl_._has_bits_[1] |= 0x00002000u;
+  _impl_.softnet_squeezed_cpus_ = value;
+}
+inline void SarInfo::set_softnet_squeezed_cpus(int32_t value) {
+  _internal_set_softnet_squeezed_cpus(value);
+  // @@protoc_insertion_point(field_set:SarInfo.softnet_squeezed_cpus)
+}
+
+// optional double sched_run_delay = 45;
+inline bool SarInfo::_internal_has_sched_run_delay() const {
+  bool value = (_impl_._has_bits_[1] & 0x00001000u) != 0;
+  return value;
+}
+inline bool SarInfo::has_sched_run_delay() const {
+  return _internal_has_sched_run_delay();
+}
+inline void SarInfo::clear_sched_run_delay() {
+  _impl_.sched_run_delay_ = 0;
+  _impl_._has_bits_[1] &= ~0x00001000u;
+}
+inline double SarInfo::_internal_sched_run_delay() const {
+  return _impl_.sched_run_delay_;
+}
+inline double SarInfo::sched_run_delay() const {
+  // @@protoc_insertion_point(field_get:SarInfo.sched_run_delay)
+  return _internal_sched_run_delay();
+}
+inline void SarInfo::_internal_set_sched_run_delay(double value) {
+  _impl_._has_bits_[1] |= 0x00001000u;
+  _impl_.sched_run_delay_ = value;
+}
+inline void SarInfo::set_sched_run_delay(double value) {
+  _internal_set_sched_run_delay(value);
+  // @@protoc_insertion_point(field_set:SarInfo.sched_run_delay)
+}
+
+// repeated .SarInfo.SarTaskSchedInfo sar_task_sched_info = 46;
+inline int SarInfo::_internal_sar_task_sched_info_size() const {
+  return _impl_.sar_task_sched_info_.size();
+}
+inline int SarInfo::sar_task_sched_info_size() const {
+  return _internal_sar_task_sched_info_size();
+}
+inline void SarInfo::clear_sar_task_sched_info() {
+  _impl_.sar_task_sched_info_.Clear();
+}
+inline ::SarInfo_SarTaskSchedInfo* SarInfo::mutable_sar_task_sched_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_task_sched_info)
+  return _impl_.sar_task_sched_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarTaskSchedInfo >*
+SarInfo::mutable_sar_task_sched_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_task_sched_info)
+  return &_impl_.sar_task_sched_info_;
+}
+inline const ::SarInfo_SarTaskSchedInfo& SarInfo::_internal_sar_task_sched_info(int index) const {
+  return _impl_.sar_task_sched_info_.Get(index);
+}
+inline const ::SarInfo_SarTaskSchedInfo& SarInfo::sar_task_sched_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_task_sched_info)
+  return _internal_sar_task_sched_info(index);
+}
+inline ::SarInfo_SarTaskSchedInfo* SarInfo::_internal_add_sar_task_sched_info() {
+  return _impl_.sar_task_sched_info_.Add();
+}
+inline ::SarInfo_SarTaskSchedInfo* SarInfo::add_sar_task_sched_info() {
+  ::SarInfo_SarTaskSchedInfo* _add = _internal_add_sar_task_sched_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_task_sched_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarTaskSchedInfo >&
+SarInfo::sar_task_sched_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_task_sched_info)
+  return _impl_.sar_task_sched_info_;
+}
+
+// optional .SarInfo.SarPsiInfo psi_cpu = 47;
+inline bool SarInfo::_internal_has_psi_cpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_cpu_ != nullptr);
+  return value;
+}
+inline bool SarInfo::has_psi_cpu() const {
+  return _internal_has_psi_cpu();
+}
+inline void SarInfo::clear_psi_cpu() {
+  if (_impl_.psi_cpu_ != nullptr) _impl_.psi_cpu_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::_internal_psi_cpu() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_cpu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::psi_cpu() const {
+  // @@protoc_insertion_point(field_get:SarInfo.psi_cpu)
+  return _internal_psi_cpu();
+}
+inline void SarInfo::unsafe_arena_set_allocated_psi_cpu(
+    ::SarInfo_SarPsiInfo* psi_cpu) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_cpu_);
+  }
+  _impl_.psi_cpu_ = psi_cpu;
+  if (psi_cpu) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.psi_cpu)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::release_psi_cpu() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_cpu_;
+  _impl_.psi_cpu_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::unsafe_arena_release_psi_cpu() {
+  // @@protoc_insertion_point(field_release:SarInfo.psi_cpu)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_cpu_;
+  _impl_.psi_cpu_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::_internal_mutable_psi_cpu() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.psi_cpu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_cpu_ = p;
+  }
+  return _impl_.psi_cpu_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::mutable_psi_cpu() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_cpu();
+  // @@protoc_insertion_point(field_mutable:SarInfo.psi_cpu)
+  return _msg;
+}
+inline void SarInfo::set_allocated_psi_cpu(::SarInfo_SarPsiInfo* psi_cpu) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_cpu_;
+  }
+  if (psi_cpu) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_cpu);
+    if (message_arena != submessage_arena) {
+      psi_cpu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_cpu, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.psi_cpu_ = psi_cpu;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.psi_cpu)
+}
+
+// optional .SarInfo.SarPsiInfo psi_memory = 48;
+inline bool SarInfo::_internal_has_psi_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_memory_ != nullptr);
+  return value;
+}
+inline bool SarInfo::has_psi_memory() const {
+  return _internal_has_psi_memory();
+}
+inline void SarInfo::clear_psi_memory() {
+  if (_impl_.psi_memory_ != nullptr) _impl_.psi_memory_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::_internal_psi_memory() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::psi_memory() const {
+  // @@protoc_insertion_point(field_get:SarInfo.psi_memory)
+  return _internal_psi_memory();
+}
+inline void SarInfo::unsafe_arena_set_allocated_psi_memory(
+    ::SarInfo_SarPsiInfo* psi_memory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_memory_);
+  }
+  _impl_.psi_memory_ = psi_memory;
+  if (psi_memory) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.psi_memory)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::release_psi_memory() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_memory_;
+  _impl_.psi_memory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::unsafe_arena_release_psi_memory() {
+  // @@protoc_insertion_point(field_release:SarInfo.psi_memory)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_memory_;
+  _impl_.psi_memory_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::_internal_mutable_psi_memory() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.psi_memory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_memory_ = p;
+  }
+  return _impl_.psi_memory_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::mutable_psi_memory() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_memory();
+  // @@protoc_insertion_point(field_mutable:SarInfo.psi_memory)
+  return _msg;
+}
+inline void SarInfo::set_allocated_psi_memory(::SarInfo_SarPsiInfo* psi_memory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_memory_;
+  }
+  if (psi_memory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_memory);
+    if (message_arena != submessage_arena) {
+      psi_memory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_memory, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.psi_memory_ = psi_memory;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.psi_memory)
+}
+
+// optional .SarInfo.SarPsiInfo psi_io = 49;
+inline bool SarInfo::_internal_has_psi_io() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.psi_io_ != nullptr);
+  return value;
+}
+inline bool SarInfo::has_psi_io() const {
+  return _internal_has_psi_io();
+}
+inline void SarInfo::clear_psi_io() {
+  if (_impl_.psi_io_ != nullptr) _impl_.psi_io_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::_internal_psi_io() const {
+  const ::SarInfo_SarPsiInfo* p = _impl_.psi_io_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SarInfo_SarPsiInfo&>(
+      ::_SarInfo_SarPsiInfo_default_instance_);
+}
+inline const ::SarInfo_SarPsiInfo& SarInfo::psi_io() const {
+  // @@protoc_insertion_point(field_get:SarInfo.psi_io)
+  return _internal_psi_io();
+}
+inline void SarInfo::unsafe_arena_set_allocated_psi_io(
+    ::SarInfo_SarPsiInfo* psi_io) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.psi_io_);
+  }
+  _impl_.psi_io_ = psi_io;
+  if (psi_io) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SarInfo.psi_io)
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::release_psi_io() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_io_;
+  _impl_.psi_io_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::unsafe_arena_release_psi_io() {
+  // @@protoc_insertion_point(field_release:SarInfo.psi_io)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::SarInfo_SarPsiInfo* temp = _impl_.psi_io_;
+  _impl_.psi_io_ = nullptr;
+  return temp;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::_internal_mutable_psi_io() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.psi_io_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SarInfo_SarPsiInfo>(GetArenaForAllocation());
+    _impl_.psi_io_ = p;
+  }
+  return _impl_.psi_io_;
+}
+inline ::SarInfo_SarPsiInfo* SarInfo::mutable_psi_io() {
+  ::SarInfo_SarPsiInfo* _msg = _internal_mutable_psi_io();
+  // @@protoc_insertion_point(field_mutable:SarInfo.psi_io)
+  return _msg;
+}
+inline void SarInfo::set_allocated_psi_io(::SarInfo_SarPsiInfo* psi_io) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.psi_io_;
+  }
+  if (psi_io) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(psi_io);
+    if (message_arena != submessage_arena) {
+      psi_io = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, psi_io, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.psi_io_ = psi_io;
+  // @@protoc_insertion_point(field_set_allocated:SarInfo.psi_io)
+}
+
+// repeated .SarInfo.SarCgroupInfo sar_cgroup_info = 50;
+inline int SarInfo::_internal_sar_cgroup_info_size() const {
+  return _impl_.sar_cgroup_info_.size();
+}
+inline int SarInfo::sar_cgroup_info_size() const {
+  return _internal_sar_cgroup_info_size();
+}
+inline void SarInfo::clear_sar_cgroup_info() {
+  _impl_.sar_cgroup_info_.Clear();
+}
+inline ::SarInfo_SarCgroupInfo* SarInfo::mutable_sar_cgroup_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_cgroup_info)
+  return _impl_.sar_cgroup_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCgroupInfo >*
+SarInfo::mutable_sar_cgroup_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_cgroup_info)
+  return &_impl_.sar_cgroup_info_;
+}
+inline const ::SarInfo_SarCgroupInfo& SarInfo::_internal_sar_cgroup_info(int index) const {
+  return _impl_.sar_cgroup_info_.Get(index);
+}
+inline const ::SarInfo_SarCgroupInfo& SarInfo::sar_cgroup_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_cgroup_info)
+  return _internal_sar_cgroup_info(index);
+}
+inline ::SarInfo_SarCgroupInfo* SarInfo::_internal_add_sar_cgroup_info() {
+  return _impl_.sar_cgroup_info_.Add();
+}
+inline ::SarInfo_SarCgroupInfo* SarInfo::add_sar_cgroup_info() {
+  ::SarInfo_SarCgroupInfo* _add = _internal_add_sar_cgroup_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_cgroup_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCgroupInfo >&
+SarInfo::sar_cgroup_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_cgroup_info)
+  return _impl_.sar_cgroup_info_;
+}
+
+// repeated .SarInfo.SarProcessInfo sar_process_info = 51;
+inline int SarInfo::_internal_sar_process_info_size() const {
+  return _impl_.sar_process_info_.size();
+}
+inline int SarInfo::sar_process_info_size() const {
+  return _internal_sar_process_info_size();
+}
+inline void SarInfo::clear_sar_process_info() {
+  _impl_.sar_process_info_.Clear();
+}
+inline ::SarInfo_SarProcessInfo* SarInfo::mutable_sar_process_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_process_info)
+  return _impl_.sar_process_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarProcessInfo >*
+SarInfo::mutable_sar_process_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_process_info)
+  return &_impl_.sar_process_info_;
+}
+inline const ::SarInfo_SarProcessInfo& SarInfo::_internal_sar_process_info(int index) const {
+  return _impl_.sar_process_info_.Get(index);
+}
+inline const ::SarInfo_SarProcessInfo& SarInfo::sar_process_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_process_info)
+  return _internal_sar_process_info(index);
+}
+inline ::SarInfo_SarProcessInfo* SarInfo::_internal_add_sar_process_info() {
+  return _impl_.sar_process_info_.Add();
+}
+inline ::SarInfo_SarProcessInfo* SarInfo::add_sar_process_info() {
+  ::SarInfo_SarProcessInfo* _add = _internal_add_sar_process_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_process_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarProcessInfo >&
+SarInfo::sar_process_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_process_info)
+  return _impl_.sar_process_info_;
+}
+
+// repeated .SarInfo.SarNetnsInfo sar_netns_info = 52;
+inline int SarInfo::_internal_sar_netns_info_size() const {
+  return _impl_.sar_netns_info_.size();
+}
+inline int SarInfo::sar_netns_info_size() const {
+  return _internal_sar_netns_info_size();
+}
+inline void SarInfo::clear_sar_netns_info() {
+  _impl_.sar_netns_info_.Clear();
+}
+inline ::SarInfo_SarNetnsInfo* SarInfo::mutable_sar_netns_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_netns_info)
+  return _impl_.sar_netns_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNetnsInfo >*
+SarInfo::mutable_sar_netns_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_netns_info)
+  return &_impl_.sar_netns_info_;
+}
+inline const ::SarInfo_SarNetnsInfo& SarInfo::_internal_sar_netns_info(int index) const {
+  return _impl_.sar_netns_info_.Get(index);
+}
+inline const ::SarInfo_SarNetnsInfo& SarInfo::sar_netns_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_netns_info)
+  return _internal_sar_netns_info(index);
+}
+inline ::SarInfo_SarNetnsInfo* SarInfo::_internal_add_sar_netns_info() {
+  return _impl_.sar_netns_info_.Add();
+}
+inline ::SarInfo_SarNetnsInfo* SarInfo::add_sar_netns_info() {
+  ::SarInfo_SarNetnsInfo* _add = _internal_add_sar_netns_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_netns_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNetnsInfo >&
+SarInfo::sar_netns_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_netns_info)
+  return _impl_.sar_netns_info_;
+}
+
+// repeated .SarInfo.SarFsInfo sar_fs_info = 53;
+inline int SarInfo::_internal_sar_fs_info_size() const {
+  return _impl_.sar_fs_info_.size();
+}
+inline int SarInfo::sar_fs_info_size() const {
+  return _internal_sar_fs_info_size();
+}
+inline void SarInfo::clear_sar_fs_info() {
+  _impl_.sar_fs_info_.Clear();
+}
+inline ::SarInfo_SarFsInfo* SarInfo::mutable_sar_fs_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_fs_info)
+  return _impl_.sar_fs_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarFsInfo >*
+SarInfo::mutable_sar_fs_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_fs_info)
+  return &_impl_.sar_fs_info_;
+}
+inline const ::SarInfo_SarFsInfo& SarInfo::_internal_sar_fs_info(int index) const {
+  return _impl_.sar_fs_info_.Get(index);
+}
+inline const ::SarInfo_SarFsInfo& SarInfo::sar_fs_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_fs_info)
+  return _internal_sar_fs_info(index);
+}
+inline ::SarInfo_SarFsInfo* SarInfo::_internal_add_sar_fs_info() {
+  return _impl_.sar_fs_info_.Add();
+}
+inline ::SarInfo_SarFsInfo* SarInfo::add_sar_fs_info() {
+  ::SarInfo_SarFsInfo* _add = _internal_add_sar_fs_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_fs_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarFsInfo >&
+SarInfo::sar_fs_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_fs_info)
+  return _impl_.sar_fs_info_;
+}
+
+// repeated .SarInfo.SarCpuGroupInfo sar_core_info = 54;
+inline int SarInfo::_internal_sar_core_info_size() const {
+  return _impl_.sar_core_info_.size();
+}
+inline int SarInfo::sar_core_info_size() const {
+  return _internal_sar_core_info_size();
+}
+inline void SarInfo::clear_sar_core_info() {
+  _impl_.sar_core_info_.Clear();
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::mutable_sar_core_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_core_info)
+  return _impl_.sar_core_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >*
+SarInfo::mutable_sar_core_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_core_info)
+  return &_impl_.sar_core_info_;
+}
+inline const ::SarInfo_SarCpuGroupInfo& SarInfo::_internal_sar_core_info(int index) const {
+  return _impl_.sar_core_info_.Get(index);
+}
+inline const ::SarInfo_SarCpuGroupInfo& SarInfo::sar_core_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_core_info)
+  return _internal_sar_core_info(index);
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::_internal_add_sar_core_info() {
+  return _impl_.sar_core_info_.Add();
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::add_sar_core_info() {
+  ::SarInfo_SarCpuGroupInfo* _add = _internal_add_sar_core_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_core_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >&
+SarInfo::sar_core_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_core_info)
+  return _impl_.sar_core_info_;
+}
+
+// repeated .SarInfo.SarCpuGroupInfo sar_socket_info = 55;
+inline int SarInfo::_internal_sar_socket_info_size() const {
+  return _impl_.sar_socket_info_.size();
+}
+inline int SarInfo::sar_socket_info_size() const {
+  return _internal_sar_socket_info_size();
+}
+inline void SarInfo::clear_sar_socket_info() {
+  _impl_.sar_socket_info_.Clear();
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::mutable_sar_socket_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_socket_info)
+  return _impl_.sar_socket_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >*
+SarInfo::mutable_sar_socket_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_socket_info)
+  return &_impl_.sar_socket_info_;
+}
+inline const ::SarInfo_SarCpuGroupInfo& SarInfo::_internal_sar_socket_info(int index) const {
+  return _impl_.sar_socket_info_.Get(index);
+}
+inline const ::SarInfo_SarCpuGroupInfo& SarInfo::sar_socket_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_socket_info)
+  return _internal_sar_socket_info(index);
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::_internal_add_sar_socket_info() {
+  return _impl_.sar_socket_info_.Add();
+}
+inline ::SarInfo_SarCpuGroupInfo* SarInfo::add_sar_socket_info() {
+  ::SarInfo_SarCpuGroupInfo* _add = _internal_add_sar_socket_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_socket_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarCpuGroupInfo >&
+SarInfo::sar_socket_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_socket_info)
+  return _impl_.sar_socket_info_;
+}
+
+// repeated .SarInfo.SarNodeInfo sar_node_info = 56;
+inline int SarInfo::_internal_sar_node_info_size() const {
+  return _impl_.sar_node_info_.size();
+}
+inline int SarInfo::sar_node_info_size() const {
+  return _internal_sar_node_info_size();
+}
+inline void SarInfo::clear_sar_node_info() {
+  _impl_.sar_node_info_.Clear();
+}
+inline ::SarInfo_SarNodeInfo* SarInfo::mutable_sar_node_info(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_node_info)
+  return _impl_.sar_node_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNodeInfo >*
+SarInfo::mutable_sar_node_info() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_node_info)
+  return &_impl_.sar_node_info_;
+}
+inline const ::SarInfo_SarNodeInfo& SarInfo::_internal_sar_node_info(int index) const {
+  return _impl_.sar_node_info_.Get(index);
+}
+inline const ::SarInfo_SarNodeInfo& SarInfo::sar_node_info(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_node_info)
+  return _internal_sar_node_info(index);
+}
+inline ::SarInfo_SarNodeInfo* SarInfo::_internal_add_sar_node_info() {
+  return _impl_.sar_node_info_.Add();
+}
+inline ::SarInfo_SarNodeInfo* SarInfo::add_sar_node_info() {
+  ::SarInfo_SarNodeInfo* _add = _internal_add_sar_node_info();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_node_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarNodeInfo >&
+SarInfo::sar_node_info() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_node_info)
+  return _impl_.sar_node_info_;
+}
+
+// repeated .SarInfo.SarSketch sar_sketch = 57;
+inline int SarInfo::_internal_sar_sketch_size() const {
+  return _impl_.sar_sketch_.size();
+}
+inline int SarInfo::sar_sketch_size() const {
+  return _internal_sar_sketch_size();
+}
+inline void SarInfo::clear_sar_sketch() {
+  _impl_.sar_sketch_.Clear();
+}
+inline ::SarInfo_SarSketch* SarInfo::mutable_sar_sketch(int index) {
+  // @@protoc_insertion_point(field_mutable:SarInfo.sar_sketch)
+  return _impl_.sar_sketch_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarSketch >*
+SarInfo::mutable_sar_sketch() {
+  // @@protoc_insertion_point(field_mutable_list:SarInfo.sar_sketch)
+  return &_impl_.sar_sketch_;
+}
+inline const ::SarInfo_SarSketch& SarInfo::_internal_sar_sketch(int index) const {
+  return _impl_.sar_sketch_.Get(index);
+}
+inline const ::SarInfo_SarSketch& SarInfo::sar_sketch(int index) const {
+  // @@protoc_insertion_point(field_get:SarInfo.sar_sketch)
+  return _internal_sar_sketch(index);
+}
+inline ::SarInfo_SarSketch* SarInfo::_internal_add_sar_sketch() {
+  return _impl_.sar_sketch_.Add();
+}
+inline ::SarInfo_SarSketch* SarInfo::add_sar_sketch() {
+  ::SarInfo_SarSketch* _add = _internal_add_sar_sketch();
+  // @@protoc_insertion_point(field_add:SarInfo.sar_sketch)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SarInfo_SarSketch >&
+SarInfo::sar_sketch() const {
+  // @@protoc_insertion_point(field_list:SarInfo.sar_sketch)
+  return _impl_.sar_sketch_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SarInfo_2eproto
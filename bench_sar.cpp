@@ -0,0 +1,303 @@
+/* The readers are static: build them in this translation unit */
+#include "sar.cpp"
+
+#include <dlfcn.h>
+#include <cstdarg>
+
+
+/*
+ * Collector micro-benchmarks: every reader of read_stats(), get_itv_value(),
+ * check_iface_reg(), check_disk_reg() and the rate computation, run on the
+ * fixed /proc and /sys trees of fixtures/ (or of -r root), so that results
+ * only depend on the code. Per call: the time, the heap allocations, and
+ * the files opened, read() system calls (from /proc/self/io) and closes;
+ * failed opens are not counted.
+ * Other system calls (fstat() of stdio, lseek()...) are not counted.
+ *     bench_sar [-r root] [-n iterations]
+ */
+
+/* Counters of the interposed calls: successful opens only */
+static unsigned long long g_allocs;
+static unsigned long long g_alloc_bytes;
+static unsigned long long g_opens;
+static unsigned long long g_closes;
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size)
+{
+    g_allocs++;
+    g_alloc_bytes += size;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size)
+{
+    g_allocs++;
+    g_alloc_bytes += n * size;
+    return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    g_allocs++;
+    g_alloc_bytes += size;
+    return __libc_realloc(ptr, size);
+}
+
+typedef FILE *(*FopenFn)(const char *, const char *);
+typedef int (*OpenFn)(const char *, int, ...);
+typedef int (*OpenatFn)(int, const char *, int, ...);
+typedef DIR *(*OpendirFn)(const char *);
+typedef int (*FcloseFn)(FILE *);
+typedef int (*CloseFn)(int);
+typedef int (*ClosedirFn)(DIR *);
+
+/* Next definition of @name, that of the C library */
+#define REAL(name, type)    static type real = (type) dlsym(RTLD_NEXT, name)
+
+FILE *fopen(const char *path, const char *mode)
+{
+    REAL("fopen", FopenFn);
+    FILE *fp = real(path, mode);
+    g_opens += fp != NULL;
+    return fp;
+}
+
+int open(const char *path, int flags, ...)
+{
+    REAL("open", OpenFn);
+    mode_t mode = 0;
+    if (flags & (O_CREAT | O_TMPFILE)) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = va_arg(ap, mode_t);
+        va_end(ap);
+    }
+    int fd = real(path, flags, mode);
+    g_opens += fd >= 0;
+    return fd;
+}
+
+int openat(int dirfd, const char *path, int flags, ...)
+{
+    REAL("openat", OpenatFn);
+    mode_t mode = 0;
+    if (flags & (O_CREAT | O_TMPFILE)) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = va_arg(ap, mode_t);
+        va_end(ap);
+    }
+    int fd = real(dirfd, path, flags, mode);
+    g_opens += fd >= 0;
+    return fd;
+}
+
+DIR *opendir(const char *path)
+{
+    REAL("opendir", OpendirFn);
+    DIR *dir = real(path);
+    g_opens += dir != NULL;
+    return dir;
+}
+
+int fclose(FILE *fp)
+{
+    REAL("fclose", FcloseFn);
+    g_closes++;
+    return real(fp);
+}
+
+int close(int fd)
+{
+    REAL("close", CloseFn);
+    g_closes++;
+    return real(fd);
+}
+
+int closedir(DIR *dir)
+{
+    REAL("closedir", ClosedirFn);
+    g_closes++;
+    return real(dir);
+}
+
+}
+
+/* read() system calls of the process so far */
+static unsigned long long read_syscalls()
+{
+    static int fd = -1;
+    char buf[256];
+    if (fd < 0 && (fd = syscall(SYS_open, "/proc/self/io", O_RDONLY)) < 0) {
+        return 0;
+    }
+    ssize_t len = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (len <= 0) {
+        return 0;
+    }
+    buf[len] = '\0';
+    const char *p = strstr(buf, "syscr:");
+    return p ? strtoull(p + 6, NULL, 10) : 0;
+}
+
+static FileStats g_bench_stats[2];
+static SarInfo g_bench_info;
+
+/* One call of the benchmarked code, @i: iteration */
+typedef void (*BenchFn)(unsigned int i);
+
+static void bench_proc_stat(unsigned int i) { read_proc_stat(g_bench_stats[i & 1], i & 1); }
+static void bench_meminfo(unsigned int i) { read_proc_meminfo(g_bench_stats[i & 1]); }
+static void bench_loadavg(unsigned int i) { read_proc_loadavg(g_bench_stats[i & 1]); }
+static void bench_vmstat(unsigned int i) { read_proc_vmstat(g_bench_stats[i & 1]); }
+static void bench_ktables(unsigned int i) { read_ktables_stat(g_bench_stats[i & 1]); }
+static void bench_net_sock(unsigned int i) { read_net_sock_stat(g_bench_stats[i & 1]); }
+static void bench_net_proto(unsigned int i) { read_net_proto_stat(i & 1); }
+static void bench_softnet(unsigned int i) { read_softnet_stat(i & 1); }
+static void bench_schedstat(unsigned int i) { read_schedstat(i & 1); }
+static void bench_psi(unsigned int i) { read_psi_stat(i & 1); }
+static void bench_node(unsigned int i) { read_node_stat(i & 1); }
+static void bench_cpufreq(unsigned int i) { read_cpufreq_stat(i & 1); }
+static void bench_nfs(unsigned int i) { read_net_nfs_stat(g_bench_stats[i & 1]); }
+static void bench_nfsd(unsigned int i) { read_net_nfsd_stat(g_bench_stats[i & 1]); }
+static void bench_diskstats(unsigned int i) { read_diskstats_stat(g_bench_stats[i & 1], i & 1); }
+static void bench_net_dev(unsigned int i) { read_net_dev_stat(g_bench_stats[i & 1], i & 1); }
+static void bench_read_stats(unsigned int i) { read_stats(g_bench_stats[i & 1], i & 1); }
+
+static void bench_itv(unsigned int i)
+{
+    unsigned long long itv, g_itv;
+    get_itv_value(g_bench_stats[i & 1], g_bench_stats[!(i & 1)], g_cpu_nr, &itv, &g_itv);
+}
+
+static void bench_iface_reg(unsigned int)
+{
+    for (int j = 0; j < g_iface_nr; j++) {
+        check_iface_reg(stats_net_dev, 1, 0, j);
+    }
+}
+
+static void bench_disk_reg(unsigned int)
+{
+    for (int j = 0; j < g_disk_nr; j++) {
+        check_disk_reg(disk_stats, 1, 0, j);
+    }
+}
+
+static void bench_rates(unsigned int)
+{
+    g_bench_info.Clear();
+    export_system_stats(g_bench_info, g_bench_stats[0], g_bench_stats[1], 100, 100 * g_cpu_nr);
+    export_net_dev_stats(g_bench_info, 1, 0, 100);
+    export_disk_stats(g_bench_info, 1, 0, 100);
+}
+
+static void no_sleep(int)
+{
+}
+
+static void bench_sample(unsigned int)
+{
+    g_bench_info.Clear();
+    get_sar_info(g_bench_info);
+}
+
+static const struct {
+    const char *name;
+    BenchFn     fn;
+} benches[] = {
+    { "read_proc_stat", bench_proc_stat },
+    { "read_proc_meminfo", bench_meminfo },
+    { "read_proc_loadavg", bench_loadavg },
+    { "read_proc_vmstat", bench_vmstat },
+    { "read_ktables_stat", bench_ktables },
+    { "read_net_sock_stat", bench_net_sock },
+    { "read_net_proto_stat", bench_net_proto },
+    { "read_softnet_stat", bench_softnet },
+    { "read_schedstat", bench_schedstat },
+    { "read_psi_stat", bench_psi },
+    { "read_node_stat", bench_node },
+    { "read_cpufreq_stat", bench_cpufreq },
+    { "read_net_nfs_stat", bench_nfs },
+    { "read_net_nfsd_stat", bench_nfsd },
+    { "read_diskstats_stat", bench_diskstats },
+    { "read_net_dev_stat", bench_net_dev },
+    { "read_stats", bench_read_stats },
+    { "get_itv_value", bench_itv },
+    { "check_iface_reg (all)", bench_iface_reg },
+    { "check_disk_reg (all)", bench_disk_reg },
+    { "rates (export_*)", bench_rates },
+    { "get_sar_info", bench_sample }
+};
+
+int main(int argc, char *argv[])
+{
+    std::string root = "fixtures";
+    unsigned int nr = 2000;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:n:")) != -1) {
+        switch (opt) {
+        case 'r':
+            root = optarg;
+            break;
+        case 'n':
+            nr = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-r root] [-n iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    SarConfig config;
+    config.proc_root = root + "/proc";
+    config.sys_root = root + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    set_sar_config(config);
+    SarClock clock;
+    clock.sleep_ms = no_sleep;
+    set_sar_clock(clock);
+    if (init() < 0) {
+        fprintf(stderr, "%s: unusable tree\n", root.c_str());
+        return 1;
+    }
+    printf("%s: %d cpus, %d interfaces, %d disks, %u iterations\n", root.c_str(),
+            g_cpu_nr, g_iface_nr, g_disk_nr, nr);
+    printf("%-24s %10s %8s %10s %7s %7s %7s\n", "", "ns/call", "allocs",
+            "bytes", "opens", "reads", "closes");
+
+    for (size_t b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+        unsigned int iters = benches[b].fn == bench_sample ? nr / 10 + 1 : nr;
+        /* Warm up: first calls map files, size tables... */
+        for (unsigned int i = 0; i < 4; i++) {
+            benches[b].fn(i);
+        }
+
+        unsigned long long allocs = g_allocs, bytes = g_alloc_bytes;
+        unsigned long long opens = g_opens, closes = g_closes;
+        unsigned long long reads = read_syscalls();
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned int i = 0; i < iters; i++) {
+            benches[b].fn(i);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        /* Less the read of /proc/self/io itself */
+        reads = read_syscalls() - reads - 1;
+
+        double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+        printf("%-24s %10.0f %8.1f %10.0f %7.1f %7.1f %7.1f\n", benches[b].name,
+                ns / iters, (double) (g_allocs - allocs) / iters,
+                (double) (g_alloc_bytes - bytes) / iters,
+                (double) (g_opens - opens) / iters, (double) reads / iters,
+                (double) (g_closes - closes) / iters);
+    }
+    return 0;
+}
@@ -0,0 +1,373 @@
+/* Reads the collector state (device counts, limits): build sar.cpp here */
+#include "sar.cpp"
+
+#include <malloc.h>
+#include <cstdarg>
+
+
+/*
+ * Large host scaling benchmark. Synthetic /proc and /sys trees are written
+ * for growing numbers of CPUs, interfaces and disks, then sampled through
+ * proc_root/sys_root, to see where the collector stops coping: the fixed
+ * stats arrays (MAX_CPU_NR, MAX_DISK_NR, and MAX_NET_DEV_NR, past which
+ * interfaces are dropped), the quadratic matching of
+ * check_iface_reg()/check_disk_reg(), and the 8 kB line buffers of
+ * /proc/stat.
+ *     bench_scale [-n samples]    run the size ladder
+ *     bench_scale -g dir [-c cpus] [-i interfaces] [-d disks]
+ *                                 only write a tree, for proc_root/sys_root
+ */
+
+/* Sizes of a synthetic tree */
+struct TreeSize {
+    int cpus;
+    int ifaces;
+    int disks;
+};
+
+/* Longest line written, against the line buffers of the readers */
+static size_t g_longest_line;
+static std::string g_longest_file;
+
+static void make_dirs(const std::string &path)
+{
+    for (size_t pos = 1; (pos = path.find('/', pos)) != std::string::npos; pos++) {
+        mkdir(path.substr(0, pos).c_str(), 0755);
+    }
+    mkdir(path.c_str(), 0755);
+}
+
+/* Write @data to @root/@path, creating the directories */
+static void write_file(const std::string &root, const std::string &path,
+        const std::string &data)
+{
+    std::string full = root + "/" + path;
+    make_dirs(full.substr(0, full.rfind('/')));
+    FILE *fp;
+    if ((fp = fopen(full.c_str(), "w")) == NULL) {
+        perror(full.c_str());
+        exit(1);
+    }
+    fwrite(data.data(), 1, data.size(), fp);
+    fclose(fp);
+
+    size_t start = 0, end;
+    while ((end = data.find('\n', start)) != std::string::npos) {
+        if (end - start + 1 > g_longest_line) {
+            g_longest_line = end - start + 1;
+            g_longest_file = path;
+        }
+        start = end + 1;
+    }
+}
+
+/* Append a printf() formatted string to @s */
+static void append(std::string &s, const char *fmt, ...)
+{
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    s += buf;
+}
+
+/* Interface @i: the loopback, then eth0, eth1... */
+static std::string iface_name(int i)
+{
+    return i ? "eth" + std::to_string(i - 1) : "lo";
+}
+
+static void write_tree(const std::string &root, const TreeSize &size)
+{
+    g_longest_line = 0;
+    std::string s;
+    /* Big hosts have a few interrupts per CPU (queues of NICs and NVMe) */
+    int irqs = 64 + size.cpus * 4;
+
+    /* /proc/stat */
+    s.clear();
+    append(s, "cpu  %llu 0 %llu %llu %llu 0 %llu 0 0 0\n", 120000ULL * size.cpus,
+            15000ULL * size.cpus, 900000ULL * size.cpus, 700ULL * size.cpus,
+            150ULL * size.cpus);
+    for (int i = 0; i < size.cpus; i++) {
+        append(s, "cpu%d %d %d %d %d %d 0 %d 0 0 0\n", i, 120000 + i, i % 7,
+                15000 + i, 900000 - i, 700, 150);
+    }
+    append(s, "intr %llu", 1000ULL * irqs);
+    for (int i = 0; i < irqs; i++) {
+        append(s, " %d", i * 7919 % 100000);
+    }
+    s += "\nctxt 40576851\nbtime 1792378814\nprocesses 98270\n"
+        "procs_running 3\nprocs_blocked 0\nsoftirq 7410751 0 895963 2 5544130 0 0 1 0 0 970630\n";
+    write_file(root, "proc/stat", s);
+
+    /* /proc/interrupts: a row per interrupt, a column per CPU */
+    s = "     ";
+    for (int i = 0; i < size.cpus; i++) {
+        append(s, "       CPU%-3d", i);
+    }
+    s += "\n";
+    for (int n = 0; n < std::min(irqs, 64 + size.cpus / 4); n++) {
+        append(s, "%4d:", n);
+        for (int i = 0; i < size.cpus; i++) {
+            append(s, " %10d", (n * 131 + i * 17) % 99991);
+        }
+        append(s, "  PCI-MSI %d-edge      queue%d\n", n, n);
+    }
+    write_file(root, "proc/interrupts", s);
+
+    /* /proc/net/softnet_stat and /proc/schedstat, a line per CPU */
+    s.clear();
+    for (int i = 0; i < size.cpus; i++) {
+        append(s, "%08x 00000000 %08x 00000000 00000000 00000000 00000000 00000000 "
+                "00000000 00000000 00000000 %08x 00000000\n", 100000 + i * 977, i % 3, i);
+    }
+    write_file(root, "proc/net/softnet_stat", s);
+    s = "version 15\ntimestamp 4295892\n";
+    for (int i = 0; i < size.cpus; i++) {
+        append(s, "cpu%d 0 0 0 0 0 0 %d %d %d\n", i, 1000000000 + i, 20000000 + i,
+                500000 + i);
+    }
+    write_file(root, "proc/schedstat", s);
+
+    /* /proc/net/dev */
+    s = "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n";
+    for (int i = 0; i < size.ifaces; i++) {
+        append(s, "%6s: %llu %llu 0 0 0 0 0 %d %llu %llu 0 0 0 0 0 0\n",
+                iface_name(i).c_str(), 224437284ULL * (i + 1), 1107043ULL * (i + 1),
+                i % 5, 112218642ULL * (i + 1), 553521ULL * (i + 1));
+    }
+    write_file(root, "proc/net/dev", s);
+    for (int i = 0; i < size.ifaces; i++) {
+        append(s = "", "%d\n", i + 1);
+        write_file(root, "sys/class/net/" + iface_name(i) + "/ifindex", s);
+    }
+
+    /* /proc/diskstats, whole disks with /sys/block entries */
+    s.clear();
+    for (int i = 0; i < size.disks; i++) {
+        append(s, "%4d %7d nvme%dn1 %d 3984 %d 6420 %d 3543 %d 44696 0 12136 54859 "
+                "0 0 0 0 0 0\n", 259, i, i, 6537 + i, 1518330 + i, 11188 + i, 19830152 + i);
+    }
+    write_file(root, "proc/diskstats", s);
+    for (int i = 0; i < size.disks; i++) {
+        char dir[64];
+        snprintf(dir, sizeof(dir), "sys/block/nvme%dn1/", i);
+        append(s = "", "259:%d\n", i);
+        write_file(root, std::string(dir) + "dev", s);
+        write_file(root, std::string(dir) + "device/model", "SYNTHETIC NVME\n");
+    }
+
+    for (int i = 0; i < size.cpus; i++) {
+        char dir[64];
+        snprintf(dir, sizeof(dir), "sys/devices/system/cpu/cpu%d/topology/", i);
+        append(s = "", "%d\n", i / 2);
+        write_file(root, std::string(dir) + "core_id", s);
+        append(s = "", "%d\n", i / 64);
+        write_file(root, std::string(dir) + "physical_package_id", s);
+    }
+
+    /* Memory */
+    s.clear();
+    append(s, "MemTotal:       %llu kB\nMemFree:        %llu kB\n"
+            "MemAvailable:   %llu kB\nBuffers:         524288 kB\n"
+            "Cached:         %llu kB\nSwapCached:            0 kB\n"
+            "SwapTotal:       8388608 kB\nSwapFree:        8388608 kB\n",
+            4194304ULL * size.cpus, 2097152ULL * size.cpus, 3145728ULL * size.cpus,
+            1048576ULL * size.cpus);
+    write_file(root, "proc/meminfo", s);
+    s.clear();
+    append(s, "nr_free_pages %llu\npgpgin 1518330\npgpgout 19830152\npswpin 0\n"
+            "pswpout 0\npgfault 98823412\npgmajfault 1203\npgfree 912345678\n",
+            524288ULL * size.cpus);
+    write_file(root, "proc/vmstat", s);
+    write_file(root, "proc/loadavg", "0.52 0.58 0.59 2/389 12345\n");
+}
+
+static void remove_tree(const std::string &root)
+{
+    std::string cmd = "rm -rf '" + root + "'";
+    if (system(cmd.c_str()) != 0) {
+        fprintf(stderr, "cannot remove %s\n", root.c_str());
+    }
+}
+
+/* Resident set size, kB */
+static long rss_kb()
+{
+    FILE *fp;
+    long pages = 0, rss = 0;
+    if ((fp = fopen("/proc/self/statm", "r")) != NULL) {
+        if (fscanf(fp, "%ld %ld", &pages, &rss) != 2) {
+            rss = 0;
+        }
+        fclose(fp);
+    }
+    return rss * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static double elapsed_us(const struct timespec &start)
+{
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+}
+
+static void no_sleep(int)
+{
+}
+
+/* Sample a tree of size @size, print a row of results */
+static void run_size(const TreeSize &size, unsigned int nr)
+{
+    char root[] = "/tmp/bench_scale.XXXXXX";
+    if (mkdtemp(root) == NULL) {
+        perror("mkdtemp");
+        exit(1);
+    }
+    write_tree(root, size);
+
+    SarConfig config;
+    config.proc_root = std::string(root) + "/proc";
+    config.sys_root = std::string(root) + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    set_sar_config(config);
+
+    /* Lines longer than the buffers of read_proc_stat() are read in pieces */
+    printf("%5d %6d %5d %6zu%c", size.cpus, size.ifaces, size.disks, g_longest_line,
+            g_longest_line > 8192 ? '!' : ' ');
+    fflush(stdout);
+
+    /* Which limit of init() fails, if any */
+    std::string limits;
+    if (init() < 0) {
+        if (g_cpu_nr > MAX_CPU_NR) {
+            limits += " MAX_CPU_NR";
+        }
+        if (g_disk_nr > MAX_DISK_NR) {
+            limits += " MAX_DISK_NR";
+        }
+    }
+
+    SarInfo sar_info;
+    double sample_us = 0, match_us = 0;
+    int ok = 0;
+    size_t heap = 0;
+    long rss = 0;
+    if (limits.empty()) {
+        get_sar_info(sar_info);    /* warm up */
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned int i = 0; i < nr; i++) {
+            sar_info.Clear();
+            /* Missing optional sources (nfs...) give a negative return */
+            get_sar_info(sar_info);
+            ok += sar_info.has_cpu_idle();
+        }
+        sample_us = elapsed_us(start) / nr;
+
+        /* Matching of a sample: every device against the previous ones */
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned int i = 0; i < nr; i++) {
+            for (int j = 0; j < g_iface_nr; j++) {
+                check_iface_reg(stats_net_dev, 1, 0, j);
+            }
+            for (int j = 0; j < g_disk_nr; j++) {
+                check_disk_reg(disk_stats, 1, 0, j);
+            }
+        }
+        match_us = elapsed_us(start) / nr;
+        heap = mallinfo2().uordblks;
+        rss = rss_kb();
+    }
+
+    if (!limits.empty()) {
+        printf("  init() failed:%s\n", limits.c_str());
+    }
+    else {
+        /* Interfaces read, at most the slots */
+        int ifs = 0;
+        for (int j = 0; j < g_iface_nr; j++) {
+            ifs += stats_net_dev[1][j].interface[0] &&
+                strcmp(stats_net_dev[1][j].interface, "?");
+        }
+        printf(" %10.0f %8.1f %8zu %7ld %4d/%-4d %5d %4d/%d\n", sample_us, match_us,
+                heap / 1024, rss, sar_info.sar_cpu_info_size(), g_cpu_nr,
+                ifs, sar_info.sar_disk_info_size(),
+                g_disk_nr - NR_DISK_PREALLOC);
+        if (ok != (int) nr) {
+            printf("      %u samples failed\n", nr - ok);
+        }
+    }
+    remove_tree(root);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *gen_dir = NULL;
+    TreeSize gen = { 1024, 4096, 1000 };
+    unsigned int nr = 20;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "g:c:i:d:n:")) != -1) {
+        switch (opt) {
+        case 'g':
+            gen_dir = optarg;
+            break;
+        case 'c':
+            gen.cpus = atoi(optarg);
+            break;
+        case 'i':
+            gen.ifaces = atoi(optarg);
+            break;
+        case 'd':
+            gen.disks = atoi(optarg);
+            break;
+        case 'n':
+            nr = std::max(atoi(optarg), 1);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n samples]\n"
+                    "       %s -g dir [-c cpus] [-i interfaces] [-d disks]\n",
+                    argv[0], argv[0]);
+            return 1;
+        }
+    }
+    if (gen_dir != NULL) {
+        write_tree(gen_dir, gen);
+        printf("%s: %d cpus, %d interfaces, %d disks, longest line %zu bytes (%s)\n",
+                gen_dir, gen.cpus, gen.ifaces, gen.disks, g_longest_line,
+                g_longest_file.c_str());
+        return 0;
+    }
+
+    SarClock clock;
+    clock.sleep_ms = no_sleep;
+    set_sar_clock(clock);
+
+    printf("limits: MAX_CPU_NR %d, MAX_NET_DEV_NR %d (%d preallocated), "
+            "MAX_DISK_NR %d (%d preallocated); /proc/stat lines read in %d bytes\n",
+            MAX_CPU_NR, MAX_NET_DEV_NR, NR_IFACE_PREALLOC, MAX_DISK_NR,
+            NR_DISK_PREALLOC, 8192);
+    printf("static stats arrays: %zu kB\n", (sizeof(stats_one_cpu) +
+                sizeof(stats_net_dev) + sizeof(disk_stats) + sizeof(stats_softnet) +
+                sizeof(stats_sched_cpu) + sizeof(stats_cpufreq)) / 1024);
+    printf("%5s %6s %5s %7s %10s %8s %8s %7s %9s %5s %6s\n", "cpus", "ifaces",
+            "disks", "line", "us/sample", "match us", "heap kB", "rss kB",
+            "cpu seen", "ifs", "disks");
+
+    /* One dimension at a time from a small host, then all at once */
+    static const TreeSize sizes[] = {
+        { 8, 4, 8 },
+        { 64, 4, 8 }, { 127, 4, 8 }, { 128, 4, 8 }, { 256, 4, 8 }, { 1024, 4, 8 },
+        { 8, 8, 8 }, { 8, 14, 8 }, { 8, 15, 8 }, { 8, 64, 8 }, { 8, 4096, 8 },
+        { 8, 4, 32 }, { 8, 4, 61 }, { 8, 4, 62 }, { 8, 4, 250 }, { 8, 4, 1000 },
+        { 1024, 4096, 1000 }
+    };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        run_size(sizes[i], nr);
+    }
+    return 0;
+}
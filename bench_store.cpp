@@ -0,0 +1,305 @@
+#include "sar.h"
+#include "sar_store.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <cmath>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <vector>
+
+
+/*
+ * Columnar store benchmark: a number of samples are collected live (or
+ * replayed from a capture file), then replayed in a loop as one sample
+ * per second over some days, counters carrying on from one loop to the
+ * next, to be written to a store, decoded back, and queried:
+ *     bench_store [-c capture] [-n samples] [days]
+ * Looped samples favour the delta-of-delta and XOR codecs: only a capture
+ * covering the whole period gives a ratio to go by.
+ */
+
+static const char *ARCHIVE_TMP = "/tmp/bench_store.sa";
+static const char *STORE_TMP = "/tmp/bench_store.db";
+
+static void sleep_100ms(int)
+{
+    usleep(100000);
+}
+
+static double elapsed_ms(const struct timespec &start)
+{
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+ * Value of series @s at row @r of the replay: integers that never go
+ * down over the samples are counters, shifted by what they grew in the
+ * previous loops; anything else is replayed as is.
+ */
+static bool value_at(const SarStore &samples, unsigned int s, unsigned int nr,
+        unsigned long long r, unsigned long long &value)
+{
+    const SarStoreBuffer &buf = samples.buffers[s];
+    unsigned int j = r % nr;
+
+    if (buf.rows.size() != nr) {
+        /* Not in every sample */
+        return false;
+    }
+    value = buf.values[j];
+    if (samples.series[s].type != SERIES_INTEGER || nr < 2) {
+        return true;
+    }
+    for (unsigned int i = 1; i < nr; i++) {
+        if (buf.values[i] < buf.values[i - 1]) {
+            return true;
+        }
+    }
+    unsigned long long loop = buf.values[nr - 1] - buf.values[0] +
+        buf.values[1] - buf.values[0];
+    value += (r / nr) * loop;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *capture = NULL;
+    unsigned int nr = 30;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:n:")) != -1) {
+        switch (opt) {
+        case 'c':
+            capture = optarg;
+            break;
+        case 'n':
+            nr = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-c capture] [-n samples] [days]\n", argv[0]);
+            return 1;
+        }
+    }
+    double days = optind < argc ? atof(argv[optind]) : 7;
+    unsigned long long rows = days * 86400;
+
+    /* Samples: raw stats through an archive, and their SarInfo */
+    unlink(ARCHIVE_TMP);
+    if (sar_archive_open(ARCHIVE_TMP) < 0) {
+        perror(ARCHIVE_TMP);
+        return 1;
+    }
+    if (capture != NULL) {
+        if (sar_replay_open(capture) < 0) {
+            perror(capture);
+            return 1;
+        }
+        nr = -1U;
+    }
+    else {
+        SarClock clock;
+        clock.sleep_ms = sleep_100ms;
+        set_sar_clock(clock);
+    }
+    std::vector<SarInfo> infos;
+    std::vector<size_t> info_sizes;
+    for (unsigned int i = 0; i < nr; i++) {
+        SarInfo si;
+        get_sar_info(si);
+        if (!si.has_cpu_idle()) {
+            break;
+        }
+        infos.push_back(si);
+    }
+    sar_source_close();
+    sar_archive_close();
+
+    SarArchive ar;
+    if (sar_archive_map(ARCHIVE_TMP, ar) < 0) {
+        perror(ARCHIVE_TMP);
+        return 1;
+    }
+    nr = std::min((size_t) ar.nr_records, infos.size());
+    if (nr < 2) {
+        fprintf(stderr, "not enough samples\n");
+        return 1;
+    }
+
+    SarStore samples;
+    samples.block_rows = -1U;
+    size_t info_bytes = 0;
+    for (unsigned int i = 0; i < nr; i++) {
+        sar_store_begin_row(samples, i);
+        sar_store_set_record(samples, ar, i);
+        sar_store_set_info(samples, infos[i]);
+        sar_store_end_row(samples);
+        info_bytes += infos[i].ByteSizeLong();
+    }
+    unsigned int record_size = ar.hdr->record_size;
+    sar_archive_unmap(ar);
+    unlink(ARCHIVE_TMP);
+
+    unsigned int nr_series = samples.series.size();
+    printf("%u samples, %u series, %llu rows (%.1f days)\n", nr, nr_series,
+            rows, days);
+
+    /* Encode */
+    unlink(STORE_TMP);
+    SarStore st;
+    if (sar_store_open(st, STORE_TMP) < 0) {
+        perror(STORE_TMP);
+        return 1;
+    }
+    long long t0 = (long long) time(NULL) * 1000;
+    unsigned long long nr_values = 0;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long long r = 0; r < rows; r++) {
+        /* Jitter of a few ms on the sampling time */
+        sar_store_begin_row(st, t0 + r * 1000 + (r * 7919) % 5);
+        for (unsigned int s = 0; s < nr_series; s++) {
+            unsigned long long v;
+            if (!value_at(samples, s, nr, r, v)) {
+                continue;
+            }
+            if (samples.series[s].type == SERIES_DOUBLE) {
+                double d;
+                memcpy(&d, &v, sizeof(d));
+                sar_store_set_double(st, samples.series[s].name, d);
+            }
+            else {
+                sar_store_set_integer(st, samples.series[s].name, v);
+            }
+            nr_values++;
+        }
+        if (sar_store_end_row(st) < 0) {
+            perror(STORE_TMP);
+            return 1;
+        }
+    }
+    if (sar_store_close(st) < 0) {
+        perror(STORE_TMP);
+        return 1;
+    }
+    double encode_ms = elapsed_ms(start);
+
+    struct stat sb;
+    stat(STORE_TMP, &sb);
+    double raw_bytes = (double) rows * (record_size + (double) info_bytes / nr);
+    printf("encode: %.0f ms, %.1f ns/value\n", encode_ms, encode_ms * 1e6 / nr_values);
+    printf("size: %lld bytes, %.2f bits/value\n", (long long) sb.st_size,
+            sb.st_size * 8.0 / nr_values);
+    printf("ratio: %.1fx archive records + SarInfo messages, %.1fx 8-byte values\n",
+            raw_bytes / sb.st_size, nr_values * 8.0 / sb.st_size);
+    if (nr < rows) {
+        printf("note: %u samples looped %.0f times: periodic data compresses better\n"
+                "than a real period, the ratio is an upper bound; replay a capture\n"
+                "of at least %llu samples (-c) for a real one\n",
+                nr, (double) rows / nr, rows);
+    }
+
+    /* Sequential decode of every column */
+    SarStoreReader rd;
+    if (sar_store_map(STORE_TMP, rd) < 0) {
+        perror(STORE_TMP);
+        return 1;
+    }
+    std::vector<long long> ts;
+    std::vector<unsigned int> col_rows;
+    std::vector<double> values;
+    unsigned long long decoded = 0;
+    double sum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t b = 0; b < rd.blocks.size(); b++) {
+        sar_store_decode_ts(rd, b, ts);
+        for (unsigned int c = 0; c < rd.blocks[b].hdr.nr_columns; c++) {
+            sar_store_decode_column(rd, b, &rd.blocks[b].columns[c], col_rows, values);
+            decoded += values.size();
+            sum += values.empty() ? 0 : values.back();
+        }
+    }
+    double decode_ms = elapsed_ms(start);
+    printf("decode: %.0f ms, %.1f ns/value, %.0f Mvalues/s (%llu values, %zu blocks)\n",
+            decode_ms, decode_ms * 1e6 / decoded, decoded / decode_ms / 1e3,
+            decoded, rd.blocks.size());
+
+    /* Check the decoded values against the replay */
+    unsigned long long errors = 0;
+    unsigned long long base = 0;
+    for (size_t b = 0; b < rd.blocks.size(); b++) {
+        sar_store_decode_ts(rd, b, ts);
+        for (size_t i = 0; i < ts.size(); i++) {
+            unsigned long long r = base + i;
+            if (ts[i] != (long long) (t0 + r * 1000 + (r * 7919) % 5)) {
+                errors++;
+            }
+        }
+        for (unsigned int c = 0; c < rd.blocks[b].hdr.nr_columns; c++) {
+            const SarStoreColumn *col = &rd.blocks[b].columns[c];
+            unsigned int s = samples.ids[rd.series[col->series].name];
+            sar_store_decode_column(rd, b, col, col_rows, values);
+            for (size_t i = 0; i < values.size(); i++) {
+                unsigned long long v;
+                value_at(samples, s, nr, base + (col_rows.empty() ? i : col_rows[i]), v);
+                double expected;
+                if (samples.series[s].type == SERIES_DOUBLE) {
+                    memcpy(&expected, &v, sizeof(expected));
+                }
+                else {
+                    expected = (double) (long long) v;
+                }
+                if (values[i] != expected && !(std::isnan(values[i]) && std::isnan(expected))) {
+                    errors++;
+                }
+            }
+        }
+        base += rd.blocks[b].hdr.nr_rows;
+    }
+    printf("check: %llu rows, %llu errors\n", base, errors);
+
+    /* Queries over the whole range */
+    static const struct {
+        const char *series;
+        long long   step_ms;
+        int         agg;
+        bool        rate;
+    } queries[] = {
+        { "info.sar_disk_info.*.await", 60000, SAR_AGG_PERCENTILE, false },
+        { "info.cpu_user", 3600000, SAR_AGG_AVG, false },
+        { "info.cpu_user", 0, SAR_AGG_MAX, false },
+        { "stat.context_swtch", 60000, SAR_AGG_MAX, true },
+        { "net.*.rx_bytes", 300000, SAR_AGG_LAST, true }
+    };
+    for (size_t i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+        SarStoreQuery q;
+        q.series = queries[i].series;
+        q.t_start = t0;
+        q.t_end = t0 + rows * 1000;
+        q.step_ms = queries[i].step_ms;
+        q.agg = queries[i].agg;
+        q.rate = queries[i].rate;
+        std::vector<SarStoreResult> results;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        sar_store_query(rd, q, results);
+        double query_ms = elapsed_ms(start);
+        size_t points = 0;
+        for (size_t k = 0; k < results.size(); k++) {
+            points += results[k].values.size();
+        }
+        printf("query %s step %llds agg %d%s: %.1f ms, %zu series, %zu points\n",
+                q.series.c_str(), q.step_ms / 1000, q.agg, q.rate ? " rate" : "",
+                query_ms, results.size(), points);
+    }
+
+    sar_store_unmap(rd);
+    unlink(STORE_TMP);
+    return errors || base != rows ? 1 : 0;
+}
@@ -38,6 +38,7 @@
 #endif
 
 static unsigned int ioc_parsed = 0;
+static char ioc_path[IOC_PATHLEN + 1] = IOCONF;
 static struct ioc_entry *ioconf[MAX_BLKDEV + 1];
 
 /*
@@ -150,7 +151,7 @@ int ioc_init(void)
     struct ioc_entry  *iocp = NULL;
     struct blk_config *blkp = NULL;
 
-    if ((fp = fopen(IOCONF, "r")) == NULL)
+    if ((fp = fopen(ioc_path, "r")) == NULL)
         return 0;
 
     while (fgets(buf, IOC_LINESIZ, fp)) {
@@ -182,14 +183,14 @@ int ioc_init(void)
             }
             if (indirect >= MAX_BLKDEV) {
                 fprintf(stderr, "%s: Indirect major #%u out of range\n",
-                        IOCONF, indirect);
+                        ioc_path, indirect);
                 continue;
             }
             if (ioconf[indirect] == NULL) {
                 fprintf(stderr,
                         "%s: Indirect record '%u:%u:%u:...'"
                         " references not yet seen major %u\n",
-                        IOCONF, major, indirect, iocp->ctrlno, major);
+                        ioc_path, major, indirect, iocp->ctrlno, major);
                 continue;
             }
             /*
@@ -225,7 +226,7 @@ int ioc_init(void)
 
         if (i != 9) {
             fprintf(stderr, "%s: Malformed %d field record: %s\n",
-                    IOCONF, i, buf);
+                    ioc_path, i, buf);
             continue;
         }
 
@@ -249,7 +250,7 @@ int ioc_init(void)
             if (ioconf[major] == NULL) {
                 fprintf(stderr, "%s: type 'x' record for"
                         " major #%u must follow the base record - ignored\n",
-                        IOCONF, major);
+                        ioc_path, major);
                 continue;
             }
             xblkp = ioconf[major]->blkp;
@@ -262,7 +263,7 @@ int ioc_init(void)
                  */
                 fprintf(stderr, "%s: duplicate 'x' record for"
                         " major #%u - ignored\ninput line: %s\n",
-                        IOCONF, major, buf);
+                        ioc_path, major, buf);
                 continue;
             }
             /*
@@ -436,3 +437,27 @@ int ioc_iswhole(unsigned int major, unsigned int minor)
 
     return (IS_WHOLE(major, minor));
 }
+
+
+/*
+ ***************************************************************************
+ * ioc_set_path() - use another ioconf file
+ *
+ * given:    path of the file, NULL for IOCONF
+ * does:     forgets the file parsed so far if the path changes, so that
+ *           the new one gets parsed at next use
+ ***************************************************************************
+ */
+void ioc_set_path(const char *path)
+{
+    if (path == NULL)
+        path = IOCONF;
+
+    if (!strcmp(path, ioc_path))
+        return;
+
+    ioc_free();
+    ioc_parsed = 0;
+    strncpy(ioc_path, path, IOC_PATHLEN);
+    ioc_path[IOC_PATHLEN] = '\0';
+}
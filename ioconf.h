@@ -15,6 +15,7 @@
 #define IOC_LINESIZ    255
 #define IOC_PARTLEN    7
 #define IOC_FMTLEN    15
+#define IOC_PATHLEN    1023
 
 #ifndef MAX_BLKDEV
 #define MAX_BLKDEV    255
@@ -78,5 +79,6 @@ struct ioc_entry {
 
 extern int   ioc_iswhole(unsigned int, unsigned int);
 extern char *ioc_name(unsigned int, unsigned int);
+extern void  ioc_set_path(const char *);
 
 #endif
@@ -1,28 +1,47 @@
 
 
 #include "sar.h"
+#include "sar_stats.h"
 #include "ioconf.h"
 
 #include <cstdio>
 #include <ctime>
 #include <cstring>
+#include <cmath>
 
 #include <unistd.h>
+#include <fcntl.h>
+#include <cstdlib>
+#include <cctype>
 #include <sys/types.h>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/mman.h>
+#include <sys/utsname.h>
 #include <net/if.h>
 #include <poll.h>
+#include <sys/syscall.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <fnmatch.h>
+#include <cerrno>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
 
 #include <algorithm>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
-/* Get IFNAMSIZ */
-#ifndef IFNAMSIZ
-#define IFNAMSIZ    16
-#endif
-
-/* Maximum length of network interface name */
-const int MAX_IFACE_LEN = IFNAMSIZ;
 const int MAX_NAME_LEN = 16;
 
 /* Maximum length of disk name */
@@ -31,184 +50,748 @@ const int MAX_DISK_LEN = 16;
 const int MAX_CPU_NR = 128;
 const int MAX_NET_DEV_NR = 16;
 const int MAX_DISK_NR = 64;
+const int MAX_SCHED_TASK_NR = 64;
+const int MAX_PSI_TRIGGER_NR = 16;
+const int MAX_CGROUP_NR = 16384;
+const int MAX_NETNS_NR = 4096;
+const int MAX_MOUNT_NR = 4096;
+const int MAX_NODE_NR = 64;
+/* Slot width (s) and number of slots of the rollup levels */
+const struct {
+    int step;
+    int slots;
+    int offset;    /* of the level in the slots of a series */
+} ROLLUP_LEVELS[SAR_ROLLUP_LEVELS] = {
+    { 1, 600, 0 },
+    { 60, 1440, 600 },
+    { 3600, 720, 600 + 1440 }
+};
+const int ROLLUP_SLOTS_NR = 600 + 1440 + 720;
+/* Maximum number of interfaces read per network namespace */
+const int MAX_NETNS_IFACE_NR = 64;
+
+/* Size of the buffer receiving /proc directory entries */
+const int GETDENTS_BUF_SIZE = 65536;
 
 const int MAX_PF_NAME = 1024;
 
+/* Size of the buffer receiving a rtnetlink dump datagram */
+const int RTNL_BUF_SIZE = 32768;
+
+/* Maximum number of block devices registered in /sys/block */
+const int MAX_BLK_DEV_NR = 256;
+/* Maximum length of a device-mapper name (DM_NAME_LEN) */
+const int MAX_DM_NAME_LEN = 128;
+
 const int NR_IFACE_PREALLOC = 2;
 const int NR_DEV_PREALLOC = 4;
 const int NR_DISK_PREALLOC = 3;
 
-const bool ALLOW_VIRTUAL = false;
-
 /* Files */
-const char * const STAT = "/proc/stat";
-const char * const PPARTITIONS = "/proc/partitions";
-const char * const DISKSTATS = "/proc/diskstats";
-const char * const INTERRUPTS = "/proc/interrupts";
-const char * const SYSFS_BLOCK = "/sys/block";
-const char * const SYSFS_DEVCPU = "/sys/devices/system/cpu";
+static const char *STAT = "/proc/stat";
+static const char *PPARTITIONS = "/proc/partitions";
+static const char *DISKSTATS = "/proc/diskstats";
+static const char *INTERRUPTS = "/proc/interrupts";
+static const char *SYSFS_BLOCK = "/sys/block";
+static const char *SYSFS_DEVCPU = "/sys/devices/system/cpu";
+static const char *SYSFS_DEVNODE = "/sys/devices/system/node";
+const char * const S_CORE_ID = "topology/core_id";
+const char * const S_PACKAGE_ID = "topology/physical_package_id";
+const char * const S_CPULIST = "cpulist";
+const char * const S_NODE_MEMINFO = "meminfo";
+const char * const S_NUMASTAT = "numastat";
+const char * const S_CUR_FREQ = "cpufreq/scaling_cur_freq";
+const char * const S_MAX_FREQ = "cpufreq/cpuinfo_max_freq";
+const char * const S_CORE_THROTTLE = "thermal_throttle/core_throttle_count";
+const char * const S_PACKAGE_THROTTLE = "thermal_throttle/package_throttle_count";
 const char * const S_STAT = "stat";
-
-const char * const PROC = "/proc";
+const char * const S_DEV = "dev";
+const char * const S_DM_NAME = "dm/name";
+const char * const S_HOLDERS = "holders";
+static const char *SYSFS_CLASS_NET = "/sys/class/net";
+const char * const S_IFINDEX = "ifindex";
+const char * const S_STATISTICS = "statistics";
+
+static const char *PROC = "/proc";
 const char * const PSTAT = "stat";
-const char * const MEMINFO = "/proc/meminfo";
-const char * const PID_STAT = "/proc/%ld/stat";
-const char * const SERIAL = "/proc/tty/driver/serial";
-const char * const FDENTRY_STATE = "/proc/sys/fs/dentry-state";
-const char * const FFILE_NR    = "/proc/sys/fs/file-nr";
-const char * const FINODE_STATE = "/proc/sys/fs/inode-state";
-const char * const FDQUOT_NR = "/proc/sys/fs/dquot-nr";
-const char * const FDQUOT_MAX = "/proc/sys/fs/dquot-max";
-const char * const FSUPER_NR = "/proc/sys/fs/super-nr";
-const char * const FSUPER_MAX = "/proc/sys/fs/super-max";
-const char * const FRTSIG_NR = "/proc/sys/kernel/rtsig-nr";
-const char * const FRTSIG_MAX = "/proc/sys/kernel/rtsig-max";
-const char * const NET_DEV = "/proc/net/dev";
-const char * const NET_SOCKSTAT = "/proc/net/sockstat";
-const char * const NET_RPC_NFS = "/proc/net/rpc/nfs";
-const char * const NET_RPC_NFSD = "/proc/net/rpc/nfsd";
+static const char *MEMINFO = "/proc/meminfo";
+static const char *PID_STAT = "/proc/%ld/stat";
+const char * const PID_STATM = "%ld/statm";
+const char * const PID_IO = "%ld/io";
+const char * const PID_STAT_REL = "%ld/stat";
+static const char *PID_SCHEDSTAT = "/proc/%ld/schedstat";
+static const char *PID_COMM = "/proc/%ld/comm";
+static const char *SCHEDSTAT = "/proc/schedstat";
+static const char *PRESSURE = "/proc/pressure";
+static const char *SERIAL = "/proc/tty/driver/serial";
+static const char *FDENTRY_STATE = "/proc/sys/fs/dentry-state";
+static const char *FFILE_NR = "/proc/sys/fs/file-nr";
+static const char *FINODE_STATE = "/proc/sys/fs/inode-state";
+static const char *FDQUOT_NR = "/proc/sys/fs/dquot-nr";
+static const char *FDQUOT_MAX = "/proc/sys/fs/dquot-max";
+static const char *FSUPER_NR = "/proc/sys/fs/super-nr";
+static const char *FSUPER_MAX = "/proc/sys/fs/super-max";
+static const char *FRTSIG_NR = "/proc/sys/kernel/rtsig-nr";
+static const char *FRTSIG_MAX = "/proc/sys/kernel/rtsig-max";
+static const char *NET_DEV = "/proc/net/dev";
+const char * const NETNS_RUN = "/run/netns";
+static const char *MOUNTINFO = "/proc/self/mountinfo";
+const char * const PID_NS_NET = "ns/net";
+const char * const PID_NET_DEV = "net/dev";
+static const char *SELF_NS_NET = "/proc/self/ns/net";
+static const char *THREAD_NET_DEV = "/proc/thread-self/net/dev";
+static const char *NET_SOCKSTAT = "/proc/net/sockstat";
+static const char *NET_SNMP = "/proc/net/snmp";
+static const char *NET_NETSTAT = "/proc/net/netstat";
+static const char *NET_SOFTNET = "/proc/net/softnet_stat";
+static const char *NET_RPC_NFS = "/proc/net/rpc/nfs";
+static const char *NET_RPC_NFSD = "/proc/net/rpc/nfsd";
 const char * const SADC ="sadc";
-const char * const LOADAVG = "/proc/loadavg";
-const char * const VMSTAT = "/proc/vmstat";
-
-struct FileStats {
-    /* --- LONG LONG --- */
-    /* Machine uptime (multiplied by the # of proc) */
-    unsigned long long uptime            __attribute__ ((aligned (16)));
-    /* Uptime reduced to one processor. Set *only* on SMP machines */
-    unsigned long long uptime0            __attribute__ ((aligned (16)));
-    unsigned long long context_swtch        __attribute__ ((aligned (16)));
-    unsigned long long cpu_user            __attribute__ ((aligned (16)));
-    unsigned long long cpu_nice            __attribute__ ((aligned (16)));
-    unsigned long long cpu_system        __attribute__ ((aligned (16)));
-    unsigned long long cpu_idle            __attribute__ ((aligned (16)));
-    unsigned long long cpu_iowait        __attribute__ ((aligned (16)));
-    unsigned long long cpu_steal            __attribute__ ((aligned (16)));
-    unsigned long long irq_sum            __attribute__ ((aligned (16)));
-    /* --- LONG --- */
-    /* Time stamp (number of seconds since the epoch) */
-    unsigned long ust_time            __attribute__ ((aligned (16)));
-    unsigned long processes            __attribute__ ((aligned (8)));
-    unsigned long pgpgin                __attribute__ ((aligned (8)));
-    unsigned long pgpgout            __attribute__ ((aligned (8)));
-    unsigned long pswpin                __attribute__ ((aligned (8)));
-    unsigned long pswpout            __attribute__ ((aligned (8)));
-    /* Memory stats in kB */
-    unsigned long frmkb                __attribute__ ((aligned (8)));
-    unsigned long bufkb                __attribute__ ((aligned (8)));
-    unsigned long camkb                __attribute__ ((aligned (8)));
-    unsigned long tlmkb                __attribute__ ((aligned (8)));
-    unsigned long frskb                __attribute__ ((aligned (8)));
-    unsigned long tlskb                __attribute__ ((aligned (8)));
-    unsigned long caskb                __attribute__ ((aligned (8)));
-    unsigned long nr_running            __attribute__ ((aligned (8)));
-    unsigned long pgfault            __attribute__ ((aligned (8)));
-    unsigned long pgmajfault            __attribute__ ((aligned (8)));
-    /* --- INT --- */
-    unsigned int  dk_drive            __attribute__ ((aligned (8)));
-    unsigned int  dk_drive_rio            __attribute__ ((packed));
-    unsigned int  dk_drive_wio            __attribute__ ((packed));
-    unsigned int  dk_drive_rblk            __attribute__ ((packed));
-    unsigned int  dk_drive_wblk            __attribute__ ((packed));
-    unsigned int  file_used            __attribute__ ((packed));
-    unsigned int  inode_used            __attribute__ ((packed));
-    unsigned int  super_used            __attribute__ ((packed));
-    unsigned int  super_max            __attribute__ ((packed));
-    unsigned int  dquot_used            __attribute__ ((packed));
-    unsigned int  dquot_max            __attribute__ ((packed));
-    unsigned int  rtsig_queued            __attribute__ ((packed));
-    unsigned int  rtsig_max            __attribute__ ((packed));
-    unsigned int  sock_inuse            __attribute__ ((packed));
-    unsigned int  tcp_inuse            __attribute__ ((packed));
-    unsigned int  udp_inuse            __attribute__ ((packed));
-    unsigned int  raw_inuse            __attribute__ ((packed));
-    unsigned int  frag_inuse            __attribute__ ((packed));
-    unsigned int  dentry_stat            __attribute__ ((packed));
-    unsigned int  load_avg_1            __attribute__ ((packed));
-    unsigned int  load_avg_5            __attribute__ ((packed));
-    unsigned int  load_avg_15            __attribute__ ((packed));
-    unsigned int  nr_threads            __attribute__ ((packed));
-    unsigned int  nfs_rpccnt            __attribute__ ((packed));
-    unsigned int  nfs_rpcretrans            __attribute__ ((packed));
-    unsigned int  nfs_readcnt            __attribute__ ((packed));
-    unsigned int  nfs_writecnt            __attribute__ ((packed));
-    unsigned int  nfs_accesscnt            __attribute__ ((packed));
-    unsigned int  nfs_getattcnt            __attribute__ ((packed));
-    unsigned int  nfsd_rpccnt            __attribute__ ((packed));
-    unsigned int  nfsd_rpcbad            __attribute__ ((packed));
-    unsigned int  nfsd_netcnt            __attribute__ ((packed));
-    unsigned int  nfsd_netudpcnt            __attribute__ ((packed));
-    unsigned int  nfsd_nettcpcnt            __attribute__ ((packed));
-    unsigned int  nfsd_rchits            __attribute__ ((packed));
-    unsigned int  nfsd_rcmisses            __attribute__ ((packed));
-    unsigned int  nfsd_readcnt            __attribute__ ((packed));
-    unsigned int  nfsd_writecnt            __attribute__ ((packed));
-    unsigned int  nfsd_accesscnt            __attribute__ ((packed));
-    unsigned int  nfsd_getattcnt            __attribute__ ((packed));
-    /* --- CHAR --- */
-    /* Record type: R_STATS or R_DUMMY */
-    /* unsigned char record_type; */
-    /*
-     * Time stamp: hour, minute and second.
-     * Used to determine TRUE time (immutable, non locale dependent time).
-     */
-    unsigned char hour;        /* (0-23) */
-    unsigned char minute;        /* (0-59) */
-    unsigned char second;        /* (0-59) */
+static const char *LOADAVG = "/proc/loadavg";
+static const char *VMSTAT = "/proc/vmstat";
+
+/* Pseudo source recording the block devices found by discover_blk_devs() */
+const char * const BLK_DEVS_SOURCE = "@blk_devs";
+
+/* Magic number of capture files */
+const char * const CAPTURE_MAGIC = "SARCAP01";
+
+/* Paths above, resolved under SarConfig::proc_root/sys_root */
+struct RootedPath {
+    const char **path;
+    const char  *def;    /* compiled-in path, saved at first resolution */
+    std::string  buf;
+};
+static RootedPath rooted_paths[] = {
+    { &STAT, NULL, "" },
+    { &PPARTITIONS, NULL, "" },
+    { &DISKSTATS, NULL, "" },
+    { &INTERRUPTS, NULL, "" },
+    { &SYSFS_BLOCK, NULL, "" },
+    { &SYSFS_DEVCPU, NULL, "" },
+    { &SYSFS_DEVNODE, NULL, "" },
+    { &SYSFS_CLASS_NET, NULL, "" },
+    { &PROC, NULL, "" },
+    { &MEMINFO, NULL, "" },
+    { &PID_STAT, NULL, "" },
+    { &PID_SCHEDSTAT, NULL, "" },
+    { &PID_COMM, NULL, "" },
+    { &SCHEDSTAT, NULL, "" },
+    { &PRESSURE, NULL, "" },
+    { &SERIAL, NULL, "" },
+    { &FDENTRY_STATE, NULL, "" },
+    { &FFILE_NR, NULL, "" },
+    { &FINODE_STATE, NULL, "" },
+    { &FDQUOT_NR, NULL, "" },
+    { &FDQUOT_MAX, NULL, "" },
+    { &FSUPER_NR, NULL, "" },
+    { &FSUPER_MAX, NULL, "" },
+    { &FRTSIG_NR, NULL, "" },
+    { &FRTSIG_MAX, NULL, "" },
+    { &NET_DEV, NULL, "" },
+    { &MOUNTINFO, NULL, "" },
+    { &SELF_NS_NET, NULL, "" },
+    { &THREAD_NET_DEV, NULL, "" },
+    { &NET_SOCKSTAT, NULL, "" },
+    { &NET_SNMP, NULL, "" },
+    { &NET_NETSTAT, NULL, "" },
+    { &NET_SOFTNET, NULL, "" },
+    { &NET_RPC_NFS, NULL, "" },
+    { &NET_RPC_NFSD, NULL, "" },
+    { &LOADAVG, NULL, "" },
+    { &VMSTAT, NULL, "" },
+};
+
+
+
+/* Place of a CPU in the machine topology, -1 when unknown */
+struct CpuTopology {
+    int core_id;
+    int package_id;
+    int node;
+};
+
+/* cpufreq and thermal_throttle files of a CPU, kept open (-1: absent) */
+struct CpuFreqFiles {
+    int           cur_freq_fd;
+    int           core_throttle_fd;
+    int           package_throttle_fd;
+    unsigned long max_freq;    /* kHz, 0 if unknown */
+};
+
+/* Per-CPU clock and thermal throttling stats */
+struct StatsCpuFreq {
+    unsigned long long cur_freq            __attribute__ ((aligned (8)));    /* kHz */
+    unsigned long long core_throttle        __attribute__ ((aligned (8)));
+    unsigned long long package_throttle        __attribute__ ((aligned (8)));
+    /* Set when scaling_cur_freq or a throttle count could be read */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* NUMA node, with its meminfo and numastat files kept open */
+struct NumaNode {
+    int id;
+    int meminfo_fd;
+    int numastat_fd;
+};
+
+/* Per-node memory stats from /sys/devices/system/node/nodeN */
+struct StatsNode {
+    unsigned long long mem_total        __attribute__ ((aligned (8)));    /* kB */
+    unsigned long long mem_free        __attribute__ ((aligned (8)));    /* kB */
+    unsigned long long numa_hit        __attribute__ ((aligned (8)));
+    unsigned long long numa_miss        __attribute__ ((aligned (8)));
+    unsigned long long numa_foreign        __attribute__ ((aligned (8)));
+    unsigned long long local_node        __attribute__ ((aligned (8)));
+    unsigned long long other_node        __attribute__ ((aligned (8)));
+    /* Set when the node files could be read */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* CPU time spent in each mode between two samples, in jiffies */
+struct CpuTimes {
+    unsigned long long user;
+    unsigned long long nice;
+    unsigned long long system;
+    unsigned long long iowait;
+    unsigned long long steal;
+    unsigned long long idle;
+    unsigned long long total;
+    int                nr_cpus;
+};
+
+/* Per-CPU network packet processing stats from /proc/net/softnet_stat */
+struct StatsSoftnet {
+    unsigned long long processed        __attribute__ ((aligned (8)));
+    unsigned long long dropped        __attribute__ ((aligned (8)));
+    unsigned long long time_squeeze        __attribute__ ((aligned (8)));
+    unsigned long long received_rps        __attribute__ ((aligned (8)));
+    unsigned long long flow_limit        __attribute__ ((aligned (8)));
+    /* Set when the CPU has a line in /proc/net/softnet_stat */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* Scheduler stats (in ns) of a CPU or task from /proc/schedstat files */
+struct StatsSched {
+    unsigned long long run_time        __attribute__ ((aligned (8)));
+    unsigned long long run_delay        __attribute__ ((aligned (8)));
+    unsigned long long pcount            __attribute__ ((aligned (8)));
+    /* Set when stats could be read for this CPU or task */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* Process watched through /proc/<pid>/schedstat */
+struct SchedTask {
+    long pid;
+    char comm[MAX_NAME_LEN];
+};
+
+/* Pressure stall information of a resource, from /proc/pressure/<resource> */
+struct StatsPsi {
+    unsigned long long some_total        __attribute__ ((aligned (8)));
+    unsigned long long full_total        __attribute__ ((aligned (8)));
+    double             some_avg[3]        __attribute__ ((aligned (8)));
+    double             full_avg[3]        __attribute__ ((aligned (8)));
+    /* Set when stats could be read for this resource */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* PSI resources */
+enum {
+    PSI_CPU = 0,
+    PSI_MEMORY,
+    PSI_IO,
+    NR_PSI_RES
+};
+
+static const char * const PSI_RES_NAMES[NR_PSI_RES] = { "cpu", "memory", "io" };
+
+/* Files read for each cgroup */
+enum {
+    CG_CPU_STAT = 0,
+    CG_MEMORY_CURRENT,
+    CG_MEMORY_STAT,
+    CG_IO_STAT,
+    CG_CPU_PRESSURE,
+    CG_MEMORY_PRESSURE,
+    CG_IO_PRESSURE,
+    NR_CGROUP_FILES
+};
+
+static const char * const CGROUP_FILES[NR_CGROUP_FILES] = {
+    "cpu.stat", "memory.current", "memory.stat", "io.stat",
+    "cpu.pressure", "memory.pressure", "io.pressure"
+};
+
+/* cgroup fd state, besides a valid fd */
+const int CG_FD_CLOSED = -1;    /* could not be kept open (eg. EMFILE) */
+const int CG_FD_ABSENT = -2;    /* controller not enabled for this cgroup */
+
+/* Stats of a cgroup from its cgroup v2 interface files */
+struct StatsCgroup {
+    unsigned long long usage_usec        __attribute__ ((aligned (8)));
+    unsigned long long user_usec        __attribute__ ((aligned (8)));
+    unsigned long long system_usec        __attribute__ ((aligned (8)));
+    unsigned long long nr_throttled        __attribute__ ((aligned (8)));
+    unsigned long long throttled_usec        __attribute__ ((aligned (8)));
+    unsigned long long memory_current        __attribute__ ((aligned (8)));
+    unsigned long long anon            __attribute__ ((aligned (8)));
+    unsigned long long file            __attribute__ ((aligned (8)));
+    unsigned long long pgfault            __attribute__ ((aligned (8)));
+    unsigned long long pgmajfault        __attribute__ ((aligned (8)));
+    unsigned long long rbytes            __attribute__ ((aligned (8)));
+    unsigned long long wbytes            __attribute__ ((aligned (8)));
+    unsigned long long rios            __attribute__ ((aligned (8)));
+    unsigned long long wios            __attribute__ ((aligned (8)));
+    StatsPsi           psi[NR_PSI_RES];
+    /* Set when the cgroup could be read */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* cgroup of the watched subtree, with its interface files kept open */
+struct CgroupEntry {
+    std::string path;    /* relative to SarConfig::cgroup_path */
+    int         fd[NR_CGROUP_FILES];
+    unsigned int gen;    /* discovery generation it was last seen in */
+    StatsCgroup stats[2];
+};
+
+/* Per-process stats from /proc/<pid>/{stat,statm,io} */
+struct StatsProcess {
+    unsigned long long utime            __attribute__ ((aligned (8)));
+    unsigned long long stime            __attribute__ ((aligned (8)));
+    unsigned long long minflt            __attribute__ ((aligned (8)));
+    unsigned long long majflt            __attribute__ ((aligned (8)));
+    unsigned long long read_bytes        __attribute__ ((aligned (8)));
+    unsigned long long write_bytes        __attribute__ ((aligned (8)));
+    /* Set when the process was seen in this sample */
+    unsigned int       online            __attribute__ ((aligned (8)));
+};
+
+/* Process of the delta table, keyed by pid and start time */
+struct ProcessEntry {
+    long         pid;
+    unsigned int gen;    /* last sample generation it was seen in */
+    unsigned long rss;    /* in pages */
+    unsigned long shared;    /* in pages */
+    char         comm[MAX_NAME_LEN];
+    StatsProcess stats[2];
+};
+
+/* Ranking of a process for top-N selection */
+struct ProcessRank {
+    double        key;
+    ProcessEntry *proc;
+    bool operator<(const ProcessRank &other) const {
+        /* Highest keys first */
+        return key > other.key;
+    }
+};
+
+
+
+
+/* Network namespace, keyed by its nsfs inode */
+struct NetnsEntry {
+    std::string name;    /* name in /run/netns, empty if found through a pid */
+    long         pid;    /* process found in it, 0 if named */
+    unsigned int gen;    /* discovery generation it was last seen in */
+    /* Set when the namespace could be read */
+    unsigned int online[2];
+    std::vector<StatsNetDev> stats[2];
+};
+
+/*
+ * Worker threads reading the namespaces, kept between samples. A batch
+ * is handed out by bumping batch; jobs are taken in order until next
+ * reaches jobs.size().
+ */
+struct NetnsPool {
+    std::vector<std::thread> threads;
+    std::mutex               lock;
+    std::condition_variable  work;
+    std::condition_variable  done;
+    std::vector<NetnsEntry *> jobs;
+    std::vector<ino_t>       inodes;
+    unsigned int             batch;
+    size_t                   next;
+    int                      busy;
+    int                      curr;
+    bool                     stop;
+
+    NetnsPool() : batch(0), next(0), busy(0), curr(0), stop(false) {}
+};
+
+
+/* Capacity of a mounted filesystem, from statvfs() */
+struct StatsFs {
+    unsigned long long blocks            __attribute__ ((aligned (8)));
+    unsigned long long bfree            __attribute__ ((aligned (8)));
+    unsigned long long bavail            __attribute__ ((aligned (8)));
+    unsigned long long files            __attribute__ ((aligned (8)));
+    unsigned long long ffree            __attribute__ ((aligned (8)));
+    unsigned long long frsize            __attribute__ ((aligned (8)));
+    /* Set when the filesystem could be read */
+    unsigned int       online            __attribute__ ((aligned (8)));
 };
 
-struct StatsOneCpu {
-    unsigned long long per_cpu_idle        __attribute__ ((aligned (16)));
-    unsigned long long per_cpu_iowait        __attribute__ ((aligned (16)));
-    unsigned long long per_cpu_user        __attribute__ ((aligned (16)));
-    unsigned long long per_cpu_nice        __attribute__ ((aligned (16)));
-    unsigned long long per_cpu_system        __attribute__ ((aligned (16)));
-    unsigned long long per_cpu_steal        __attribute__ ((aligned (16)));
-    unsigned long long pad            __attribute__ ((aligned (16)));
+/* Mount of /proc/self/mountinfo, keyed by its mount ID */
+struct MountEntry {
+    std::string  mnt_point;
+    std::string  fs_type;
+    std::string  source;
+    unsigned int gen;    /* mount table generation it was last seen in */
+    StatsFs      stats[2];
 };
 
 
-struct StatsNetDev {
-    unsigned long rx_packets            __attribute__ ((aligned (8)));
-    unsigned long tx_packets            __attribute__ ((aligned (8)));
-    unsigned long rx_bytes            __attribute__ ((aligned (8)));
-    unsigned long tx_bytes            __attribute__ ((aligned (8)));
-    unsigned long rx_compressed            __attribute__ ((aligned (8)));
-    unsigned long tx_compressed            __attribute__ ((aligned (8)));
-    unsigned long multicast            __attribute__ ((aligned (8)));
-    unsigned long collisions            __attribute__ ((aligned (8)));
-    unsigned long rx_errors            __attribute__ ((aligned (8)));
-    unsigned long tx_errors            __attribute__ ((aligned (8)));
-    unsigned long rx_dropped            __attribute__ ((aligned (8)));
-    unsigned long tx_dropped            __attribute__ ((aligned (8)));
-    unsigned long rx_fifo_errors            __attribute__ ((aligned (8)));
-    unsigned long tx_fifo_errors            __attribute__ ((aligned (8)));
-    unsigned long rx_frame_errors        __attribute__ ((aligned (8)));
-    unsigned long tx_carrier_errors        __attribute__ ((aligned (8)));
-    char         interface[MAX_IFACE_LEN]    __attribute__ ((aligned (8)));
+/* Where the collector sources are read from */
+enum {
+    SRC_LIVE = 0,
+    SRC_CAPTURE,    /* live, with a copy of everything read into a capture file */
+    SRC_REPLAY      /* from a capture file */
 };
 
+/*
+ * Capture file records. A frame holds the sources read for one sample,
+ * each read of a source being a record, in read order.
+ */
+enum {
+    REC_FRAME = 'F',    /* u64 timestamp (ms) */
+    REC_SOURCE = 'S'    /* u32 path length, path, u32 data length, data */
+};
+const unsigned int REC_ABSENT = 0xffffffff;    /* data length of a missing source */
+
+/* Reads of a source in a replayed frame, NULL data when it was missing */
+typedef std::deque<std::pair<bool, std::string> > SourceReads;
+
+
+
+
+/* Block device found in /sys/block at discovery time */
+struct BlkDevInfo {
+    unsigned int major;
+    unsigned int minor;
+    int          is_virtual;    /* no /sys/block/<dev>/device link */
+    int          holder;        /* index of holder device, -1 if none */
+    int          nr_members;    /* number of whole-disk members it holds */
+    char         kname[MAX_NAME_LEN];        /* name in /proc/diskstats */
+    char         name[MAX_DM_NAME_LEN];      /* name used for display */
+};
+
+/* Name pattern kinds, cheapest first */
+enum {
+    PAT_EXACT = 0,
+    PAT_PREFIX,
+    PAT_GLOB
+};
+
+struct NamePattern {
+    int         type;
+    std::string str;    /* name, prefix without its '*', or glob */
+};
+
+/* Include/exclude patterns compiled once when the config is set */
+struct NameFilter {
+    std::vector<NamePattern> include;
+    std::vector<NamePattern> exclude;
+};
+
+/* Files of /sys/class/net/<if>/statistics read by the sysfs backend */
+enum {
+    SNS_RX_BYTES = 0,
+    SNS_RX_PACKETS,
+    SNS_RX_ERRORS,
+    SNS_RX_DROPPED,
+    SNS_RX_MISSED_ERRORS,
+    SNS_RX_FIFO_ERRORS,
+    SNS_RX_LENGTH_ERRORS,
+    SNS_RX_OVER_ERRORS,
+    SNS_RX_CRC_ERRORS,
+    SNS_RX_FRAME_ERRORS,
+    SNS_RX_COMPRESSED,
+    SNS_MULTICAST,
+    SNS_TX_BYTES,
+    SNS_TX_PACKETS,
+    SNS_TX_ERRORS,
+    SNS_TX_DROPPED,
+    SNS_TX_FIFO_ERRORS,
+    SNS_COLLISIONS,
+    SNS_TX_CARRIER_ERRORS,
+    SNS_TX_ABORTED_ERRORS,
+    SNS_TX_WINDOW_ERRORS,
+    SNS_TX_HEARTBEAT_ERRORS,
+    SNS_TX_COMPRESSED,
+    NR_SYSFS_NET_STATS
+};
+
+static const char * const SYSFS_NET_STAT_FILES[NR_SYSFS_NET_STATS] = {
+    "rx_bytes", "rx_packets", "rx_errors", "rx_dropped", "rx_missed_errors",
+    "rx_fifo_errors", "rx_length_errors", "rx_over_errors", "rx_crc_errors",
+    "rx_frame_errors", "rx_compressed", "multicast",
+    "tx_bytes", "tx_packets", "tx_errors", "tx_dropped", "tx_fifo_errors",
+    "collisions", "tx_carrier_errors", "tx_aborted_errors",
+    "tx_window_errors", "tx_heartbeat_errors", "tx_compressed"
+};
+
+/* Watched interface of the sysfs backend, with its statistics files kept open */
+struct SysfsNetDev {
+    char interface[MAX_IFACE_LEN];
+    int  ifindex;
+    int  fd[NR_SYSFS_NET_STATS];    /* -1 when the interface is not present */
+};
+
+/* Protocol counters collected from /proc/net/snmp and /proc/net/netstat */
+enum {
+    NP_TCP_ACTIVE_OPENS = 0,
+    NP_TCP_PASSIVE_OPENS,
+    NP_TCP_ATTEMPT_FAILS,
+    NP_TCP_ESTAB_RESETS,
+    NP_TCP_IN_SEGS,
+    NP_TCP_OUT_SEGS,
+    NP_TCP_RETRANS_SEGS,
+    NP_TCP_IN_ERRS,
+    NP_TCP_OUT_RSTS,
+    NP_UDP_IN_DATAGRAMS,
+    NP_UDP_NO_PORTS,
+    NP_UDP_IN_ERRORS,
+    NP_UDP_OUT_DATAGRAMS,
+    NP_UDP_RCVBUF_ERRORS,
+    NP_UDP_SNDBUF_ERRORS,
+    NP_TCP_TIMEOUTS,
+    NP_TCP_SYN_RETRANS,
+    NP_LISTEN_OVERFLOWS,
+    NP_LISTEN_DROPS,
+    NP_REQ_QFULL_DROP,
+    NP_SYNCOOKIES_SENT,
+    NP_TCP_MEMORY_PRESSURES,
+    NP_TCP_ABORT_ON_MEMORY,
+    NP_PRUNE_CALLED,
+    NP_RCV_PRUNED,
+    NR_NET_PROTO_STATS
+};
+
+/* Section and column name of each NP_* counter */
+static const struct {
+    const char *section;
+    const char *column;
+} NET_PROTO_FIELDS[NR_NET_PROTO_STATS] = {
+    { "Tcp:", "ActiveOpens" },
+    { "Tcp:", "PassiveOpens" },
+    { "Tcp:", "AttemptFails" },
+    { "Tcp:", "EstabResets" },
+    { "Tcp:", "InSegs" },
+    { "Tcp:", "OutSegs" },
+    { "Tcp:", "RetransSegs" },
+    { "Tcp:", "InErrs" },
+    { "Tcp:", "OutRsts" },
+    { "Udp:", "InDatagrams" },
+    { "Udp:", "NoPorts" },
+    { "Udp:", "InErrors" },
+    { "Udp:", "OutDatagrams" },
+    { "Udp:", "RcvbufErrors" },
+    { "Udp:", "SndbufErrors" },
+    { "TcpExt:", "TCPTimeouts" },
+    { "TcpExt:", "TCPSynRetrans" },
+    { "TcpExt:", "ListenOverflows" },
+    { "TcpExt:", "ListenDrops" },
+    { "TcpExt:", "TCPReqQFullDrop" },
+    { "TcpExt:", "SyncookiesSent" },
+    { "TcpExt:", "TCPMemoryPressures" },
+    { "TcpExt:", "TCPAbortOnMemory" },
+    { "TcpExt:", "PruneCalled" },
+    { "TcpExt:", "RcvPruned" }
+};
 
-struct DiskStats {
-    unsigned long long rd_sect            __attribute__ ((aligned (16)));
-    unsigned long long wr_sect            __attribute__ ((aligned (16)));
-    unsigned long rd_ticks            __attribute__ ((aligned (16)));
-    unsigned long wr_ticks            __attribute__ ((aligned (8)));
-    unsigned long tot_ticks            __attribute__ ((aligned (8)));
-    unsigned long rq_ticks            __attribute__ ((aligned (8)));
-    unsigned long nr_ios                __attribute__ ((aligned (8)));
-    unsigned int  major                __attribute__ ((aligned (8)));
-    unsigned int  minor                __attribute__ ((packed));
+/*
+ * Column to counter mapping of a "Section:" header/value line pair,
+ * built once from the header line.
+ */
+struct NetProtoSection {
+    std::string      name;     /* "Tcp:", "TcpExt:"... */
+    std::vector<int> slots;    /* NP_* counter of each column, -1 if unused */
 };
 
 
 static StatsOneCpu stats_one_cpu[2][MAX_CPU_NR];
+static StatsSoftnet stats_softnet[2][MAX_CPU_NR];
+static StatsSched stats_sched_cpu[2][MAX_CPU_NR];
+static StatsSched stats_sched_task[2][MAX_SCHED_TASK_NR];
+static SchedTask sched_task[MAX_SCHED_TASK_NR];
+static StatsPsi stats_psi[2][NR_PSI_RES];
+static CpuTopology cpu_topology[MAX_CPU_NR];
+static NumaNode numa_node[MAX_NODE_NR];
+static StatsNode stats_node[2][MAX_NODE_NR];
+static CpuFreqFiles cpu_freq_files[MAX_CPU_NR];
+static StatsCpuFreq stats_cpufreq[2][MAX_CPU_NR];
+static int psi_trigger_fd[MAX_PSI_TRIGGER_NR];
+/* Stand-in fds of add_sar_trigger_fd(), owned by the caller */
+static int ext_trigger_fd[MAX_PSI_TRIGGER_NR];
+/* cgroups keyed by inode, so that a re-created cgroup starts afresh */
+static std::unordered_map<ino_t, CgroupEntry> g_cgroups;
+static std::vector<ino_t> g_cgroup_order;    /* walk order of g_cgroups */
+/* Processes keyed by (start time << 22 | pid), so that pid reuse is detected */
+static std::unordered_map<unsigned long long, ProcessEntry> g_processes;
+static std::unordered_map<ino_t, NetnsEntry> g_netns;
+static std::vector<ino_t> g_netns_order;    /* discovery order of g_netns */
+static std::unordered_map<int, MountEntry> g_mounts;
+static std::vector<int> g_mount_order;    /* selected mounts, in table order */
 static StatsNetDev stats_net_dev[2][MAX_NET_DEV_NR];
 static DiskStats disk_stats[2][MAX_DISK_NR];
+static BlkDevInfo blk_dev_info[MAX_BLK_DEV_NR];
+static SysfsNetDev sysfs_net_dev[MAX_NET_DEV_NR];
+static unsigned long long net_proto_stats[2][NR_NET_PROTO_STATS];
+static std::vector<NetProtoSection> g_snmp_map;
+static std::vector<NetProtoSection> g_netstat_map;
+static bool g_net_proto_mapped;
+
+static SarConfig g_config;
+static NameFilter g_iface_filter;
+static NameFilter g_disk_filter;
+static NameFilter g_mount_filter;
 
 static int g_cpu_nr;        /* number of processors on this machine */ 
 static int g_disk_nr;    /* number of devices in /proc/stat */
 static int g_iface_nr;    /* number of network devices (interfaces) */
+static int g_blk_dev_nr;    /* number of block devices in /sys/block */
+static int g_rtnl_fd = -1;    /* rtnetlink socket, kept open between samples */
+static unsigned int g_rtnl_seq;
+static int g_net_dev_backend = NET_DEV_PROCFS;    /* resolved NET_DEV_* backend */
+static int g_sysfs_iface_nr;    /* number of interfaces watched through sysfs */
+static int g_sched_task_nr;    /* number of processes watched through schedstat */
+static int g_psi_epfd = -1;    /* epoll instance waiting on PSI triggers */
+static int g_psi_trigger_nr;    /* number of PSI trigger fds we own */
+static int g_ext_trigger_nr;    /* number of stand-in trigger fds */
+static int g_trigger_nr;    /* number of fds registered in g_psi_epfd */
+static bool g_sampled;    /* last get_sar_info() exported a sample */
+static int g_cgroup_root_fd = -1;    /* dirfd of SarConfig::cgroup_path */
+static unsigned int g_cgroup_gen;    /* cgroup discovery generation */
+static long long g_cgroup_walk_ms;    /* time of the last cgroup walk */
+static bool g_cgroup_stale;    /* a watched cgroup went away since */
+static int g_proc_dirfd = -1;    /* /proc dirfd, kept open between samples */
+static unsigned int g_proc_gen;    /* process sample generation */
+static unsigned int g_netns_gen;    /* netns discovery generation */
+static long long g_netns_scan_ms;    /* time of the last netns discovery */
+static bool g_netns_stale = true;    /* a namespace could not be read since */
+/* Never destroyed: its threads may still wait on it at exit */
+static NetnsPool *g_netns_pool;
+static int g_mountinfo_fd = -1;    /* /proc/self/mountinfo, polled for changes */
+static unsigned int g_mount_gen;    /* mount table generation */
+static int g_topology_cpu_nr = -1;    /* g_cpu_nr the topology was read for */
+static int g_node_nr;    /* number of NUMA nodes in /sys/devices/system/node */
+static int g_cpufreq_cpu_nr = -1;    /* g_cpu_nr the cpufreq files were opened for */
+static int g_source_mode = SRC_LIVE;
+static FILE *g_source_fp;    /* capture file, written or replayed */
+static bool g_frame_open;    /* a capture/replay frame is in progress */
+static bool g_replay_eof;    /* no frame left to replay */
+static long long g_frame_time;    /* timestamp of the current frame (ms) */
+static std::unordered_map<std::string, SourceReads> g_frame_sources;
+static std::deque<std::string> g_source_bufs;    /* fmemopen() buffers of the frame */
+static SarClock g_clock;
+static int g_archive_fd = -1;    /* archive file records are appended to */
+static bool g_archive_new;    /* header not written yet */
+static unsigned int g_archive_nr;    /* number of records in the archive */
+static SarArchiveHeader g_archive_hdr;
+static std::vector<SarArchiveDisk> g_archive_disks;
+static std::vector<SarArchiveIface> g_archive_ifaces;
+
+/* Raw counters of a sample, kept in the rate history */
+struct CounterSnapshot {
+    long long   t_ms;
+    FileStats   file_stats;
+    int         cpu_nr;
+    int         iface_nr;
+    int         disk_nr;
+    StatsOneCpu cpus[MAX_CPU_NR];
+    StatsNetDev ifaces[MAX_NET_DEV_NR];
+    DiskStats   disks[MAX_DISK_NR];
+};
+
+/* Rate history: ring of the last samples */
+static std::vector<CounterSnapshot> g_history;
+static unsigned int g_history_head;    /* next slot written */
+static unsigned int g_history_nr;
+
+/* In-memory rollups, ROLLUP_SLOTS_NR slots per series */
+static NameFilter g_rollup_filter;
+static unsigned int g_rollup_max;
+static std::vector<SarRollupPoint> g_rollup_slots;
+static std::vector<long long> g_rollup_last;    /* last sample of each series */
+static std::vector<std::string> g_rollup_names;
+static std::unordered_map<std::string, unsigned int> g_rollup_ids;
+/* Fields of the last sample, for the rollups and summaries */
+static std::vector<SarInfoValue> g_info_values;
+
+/* Bucket counts of a DDSketch, for indexes offset to offset + size - 1 */
+struct SketchStore {
+    std::vector<unsigned int> counts;
+    int                       offset;
+
+    SketchStore() : offset(0) {}
+};
+
+/*
+ * DDSketch (Masson et al., VLDB 2019): values are counted in buckets of
+ * logarithmically growing width gamma^(i-1) to gamma^i, so that quantiles
+ * are returned within a relative error alpha, with gamma = (1 + alpha) /
+ * (1 - alpha). Values can be taken back out, for sliding windows.
+ */
+struct DDSketch {
+    double             gamma;
+    double             inv_log_gamma;
+    SketchStore        positive;
+    SketchStore        negative;    /* magnitudes of negative values */
+    unsigned long long zero;
+    unsigned long long count;
+
+    DDSketch() : gamma(0), inv_log_gamma(0), zero(0), count(0) {}
+};
+
+/* Summary of the last samples of a series */
+struct RollingSummary {
+    std::vector<double> window;    /* ring of the last values */
+    unsigned int        head;    /* next slot written */
+    unsigned int        nr;
+    unsigned long long  seq;    /* samples added so far */
+    /* Monotonic queues of (seq, value): increasing for min, decreasing for max */
+    std::deque<std::pair<unsigned long long, double> > mins;
+    std::deque<std::pair<unsigned long long, double> > maxs;
+    double              mean;
+    double              m2;    /* sum of squared deviations from the mean */
+    DDSketch            sketch;
+
+    RollingSummary() : head(0), nr(0), seq(0), mean(0), m2(0) {}
+};
+
+/* Values of a sample added to a window sketch */
+struct SketchSample {
+    std::vector<double> values;
+    double              min;
+    double              max;
+    double              sum;
+};
+
+/* Sketch of the fields matching a pattern over the last samples */
+struct WindowSketch {
+    std::string               name;    /* the pattern */
+    NameFilter                filter;
+    std::vector<SketchSample> samples;    /* ring of the last samples */
+    unsigned int              head;    /* next slot written */
+    unsigned int              nr;
+    DDSketch                  sketch;
+
+    WindowSketch() : head(0), nr(0) {}
+};
+
+/* Sketches exported in SarInfo */
+static std::vector<WindowSketch> g_sketches;
+
+/* Rolling summaries */
+static NameFilter g_summary_filter;
+static unsigned int g_summary_max;
+static std::vector<RollingSummary> g_summaries;
+static std::unordered_map<std::string, unsigned int> g_summary_ids;
+static std::vector<std::string> g_summary_names;
 static int g_hz;
 static int g_shift;
 
@@ -217,6 +800,313 @@ static int g_shift;
  * Page size depends on machine architecture (4 kB, 8 kB, 16 kB, 64 kB...)
  */
 #define PG(k)    ((k) >> (g_shift))
+/* Number of pages -> kB */
+#define PAGES_TO_KB(p)    ((p) << (g_shift))
+
+/* Default clock: real time, poll() sleep */
+static void real_sleep_ms(int ms)
+{
+    poll(NULL, 0, ms);
+}
+
+static long long real_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (long long) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Replay default: no wait, rates come from the recorded uptimes */
+static void no_sleep_ms(int ms)
+{
+    (void) ms;
+}
+
+static bool source_is_live()
+{
+    return g_source_mode != SRC_REPLAY && g_source_mode != SRC_CAPTURE;
+}
+
+static void write_u32(FILE *fp, unsigned int v)
+{
+    fwrite(&v, sizeof(v), 1, fp);
+}
+
+static bool read_u32(FILE *fp, unsigned int *v)
+{
+    return fread(v, sizeof(*v), 1, fp) == 1;
+}
+
+/* Append a source record to the capture file, data NULL if missing */
+static void capture_source(const char *path, const std::string *data)
+{
+    if (!g_frame_open) {
+        long long now = g_clock.now_ms ? g_clock.now_ms() : real_now_ms();
+        fputc(REC_FRAME, g_source_fp);
+        fwrite(&now, sizeof(now), 1, g_source_fp);
+        g_frame_open = true;
+    }
+    fputc(REC_SOURCE, g_source_fp);
+    write_u32(g_source_fp, strlen(path));
+    fputs(path, g_source_fp);
+    if (data == NULL) {
+        write_u32(g_source_fp, REC_ABSENT);
+        return;
+    }
+    write_u32(g_source_fp, data->size());
+    fwrite(data->data(), 1, data->size(), g_source_fp);
+}
+
+/*
+ * Load the next frame of the replayed file into g_frame_sources.
+ * RETURNS: 0 on success, -1 at end of file or on a truncated frame.
+ */
+static int load_replay_frame()
+{
+    g_frame_sources.clear();
+    int c = fgetc(g_source_fp);
+    if (c != REC_FRAME ||
+            fread(&g_frame_time, sizeof(g_frame_time), 1, g_source_fp) != 1) {
+        g_replay_eof = true;
+        return -1;
+    }
+
+    while ((c = fgetc(g_source_fp)) == REC_SOURCE) {
+        unsigned int len;
+        std::string path, data;
+        if (!read_u32(g_source_fp, &len)) {
+            break;
+        }
+        path.resize(len);
+        if (fread(&path[0], 1, len, g_source_fp) != len || !read_u32(g_source_fp, &len)) {
+            break;
+        }
+        if (len == REC_ABSENT) {
+            g_frame_sources[path].push_back(std::make_pair(false, std::string()));
+            continue;
+        }
+        data.resize(len);
+        if (len && fread(&data[0], 1, len, g_source_fp) != len) {
+            break;
+        }
+        g_frame_sources[path].push_back(std::make_pair(true, data));
+    }
+    if (c == REC_FRAME) {
+        ungetc(c, g_source_fp);
+    }
+    else if (c != EOF) {
+        g_replay_eof = true;
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Open a source read in the current frame as a memory stream */
+static FILE *open_frame_source(const std::string &data)
+{
+    g_source_bufs.push_back(data);
+    std::string &buf = g_source_bufs.back();
+    /* fmemopen() wants a buffer, even for an empty source */
+    buf.reserve(1);
+    return fmemopen(&buf[0], buf.size(), "r");
+}
+
+/*
+ * fopen() of the collectors. When capturing, the source is read whole
+ * and recorded before being parsed from memory; when replaying, it is
+ * the next recorded read of the same path.
+ */
+static FILE *source_fopen(const char *path, const char *mode)
+{
+    if (g_source_mode == SRC_LIVE) {
+        return fopen(path, mode);
+    }
+
+    if (g_source_mode == SRC_CAPTURE) {
+        FILE *fp = fopen(path, mode);
+        if (fp == NULL) {
+            capture_source(path, NULL);
+            return NULL;
+        }
+        std::string data;
+        char buf[4096];
+        size_t len;
+        while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            data.append(buf, len);
+        }
+        fclose(fp);
+        capture_source(path, &data);
+        return open_frame_source(data);
+    }
+
+    if (!g_frame_open) {
+        if (g_replay_eof || load_replay_frame() < 0) {
+            errno = ENOENT;
+            return NULL;
+        }
+        g_frame_open = true;
+    }
+    std::unordered_map<std::string, SourceReads>::iterator it =
+        g_frame_sources.find(path);
+    if (it == g_frame_sources.end() || it->second.empty()) {
+        errno = ENOENT;
+        return NULL;
+    }
+    std::pair<bool, std::string> read = it->second.front();
+    it->second.pop_front();
+    if (!read.first) {
+        errno = ENOENT;
+        return NULL;
+    }
+    return open_frame_source(read.second);
+}
+
+/* End the frame of the current sample */
+static void end_source_frame()
+{
+    if (g_source_mode == SRC_CAPTURE && g_frame_open) {
+        fflush(g_source_fp);
+    }
+    g_frame_open = false;
+    g_frame_sources.clear();
+    g_source_bufs.clear();
+}
+
+/*
+ * Point the /proc and /sys paths under SarConfig::proc_root and sys_root,
+ * which replace their leading "/proc" or "/sys". This is only done when
+ * the configuration changes, never per sample.
+ */
+static void resolve_paths()
+{
+    for (size_t i = 0; i < sizeof(rooted_paths) / sizeof(rooted_paths[0]); i++) {
+        RootedPath &rp = rooted_paths[i];
+        if (rp.def == NULL) {
+            rp.def = *rp.path;
+        }
+        bool proc = !strncmp(rp.def, "/proc", 5);
+        const std::string &root = proc ? g_config.proc_root : g_config.sys_root;
+        if (root.empty()) {
+            *rp.path = rp.def;
+            continue;
+        }
+
+        rp.buf.clear();
+        for (size_t j = 0; j < root.size(); j++) {
+            /* Some paths are printf formats */
+            if (root[j] == '%' && strchr(rp.def, '%')) {
+                rp.buf += '%';
+            }
+            rp.buf += root[j];
+        }
+        rp.buf += rp.def + (proc ? 5 : 4);
+        *rp.path = rp.buf.c_str();
+    }
+
+    ioc_set_path(g_config.ioconf_path.empty() ? NULL : g_config.ioconf_path.c_str());
+}
+
+/* Classify patterns so that exact names and prefixes avoid fnmatch() */
+static void compile_patterns(const std::vector<std::string> &patterns,
+        std::vector<NamePattern> &compiled)
+{
+    compiled.clear();
+    for (size_t i = 0; i < patterns.size(); i++) {
+        const std::string &p = patterns[i];
+        if (p.empty()) {
+            continue;
+        }
+
+        NamePattern pat;
+        size_t wild = p.find_first_of("*?[\\");
+        if (wild == std::string::npos) {
+            pat.type = PAT_EXACT;
+            pat.str = p;
+        }
+        else if (wild == p.size() - 1 && p[wild] == '*') {
+            pat.type = PAT_PREFIX;
+            pat.str = p.substr(0, wild);
+        }
+        else {
+            pat.type = PAT_GLOB;
+            pat.str = p;
+        }
+        compiled.push_back(pat);
+    }
+}
+
+static void compile_name_filter(const std::vector<std::string> &include,
+        const std::vector<std::string> &exclude, NameFilter &filter)
+{
+    compile_patterns(include, filter.include);
+    compile_patterns(exclude, filter.exclude);
+}
+
+/* Test name (not necessarily null terminated) against a list of patterns */
+static bool match_patterns(const std::vector<NamePattern> &patterns,
+        const char *name, size_t len)
+{
+    char buf[MAX_PF_NAME];
+    bool terminated = false;
+
+    for (size_t i = 0; i < patterns.size(); i++) {
+        const NamePattern &pat = patterns[i];
+        switch (pat.type) {
+        case PAT_EXACT:
+            if (pat.str.size() == len && !memcmp(pat.str.data(), name, len)) {
+                return true;
+            }
+            break;
+        case PAT_PREFIX:
+            if (pat.str.size() <= len &&
+                    !memcmp(pat.str.data(), name, pat.str.size())) {
+                return true;
+            }
+            break;
+        default:
+            if (!terminated) {
+                len = std::min(len, sizeof(buf) - 1);
+                memcpy(buf, name, len);
+                buf[len] = '\0';
+                terminated = true;
+            }
+            if (!fnmatch(pat.str.c_str(), buf, 0)) {
+                return true;
+            }
+            break;
+        }
+    }
+    return false;
+}
+
+/* Return true if name passes the include/exclude filter */
+static bool match_name_filter(const NameFilter &filter,
+        const char *name, size_t len)
+{
+    if (!filter.include.empty() && !match_patterns(filter.include, name, len)) {
+        return false;
+    }
+    return !match_patterns(filter.exclude, name, len);
+}
+
+/*
+ * Locate the device name in a /proc/diskstats line ("major minor name ...")
+ * without converting any number.
+ * RETURNS: pointer to the name (and its length in @len), NULL if not found.
+ */
+static const char *diskstats_name(const char *line, size_t *len)
+{
+    const char *p = line;
+    for (int field = 0; field < 2; field++) {
+        p += strspn(p, " \t");
+        p += strcspn(p, " \t\n");
+    }
+    p += strspn(p, " \t");
+    *len = strcspn(p, " \t\n");
+
+    return *len ? p : NULL;
+}
 
 /* Get page shift in kB */
 static int get_kb_shift()
@@ -257,7 +1147,15 @@ static long get_HZ()
 static time_t get_time(struct tm &rectime)
 {
     time_t timer = 0;
-    time(&timer);
+    if (g_source_mode == SRC_REPLAY) {
+        timer = g_frame_time / 1000;
+    }
+    else if (g_clock.now_ms) {
+        timer = g_clock.now_ms() / 1000;
+    }
+    else {
+        time(&timer);
+    }
 
     struct tm *ptm = gmtime(&timer);
     rectime = (*ptm);
@@ -302,7 +1200,7 @@ static int get_sys_cpu_nr()
 static int get_proc_cpu_nr()
 {
     FILE *fp;
-    if ((fp = fopen(STAT, "r")) == NULL) {
+    if ((fp = source_fopen(STAT, "r")) == NULL) {
         /* fprintf(stderr, _("Cannot open %s: %s\n"), STAT, strerror(errno)); */
         /* exit(1); */
         return 0;
@@ -337,7 +1235,8 @@ static int get_cpu_nr()
 {
     int cpu_nr = 0;
 
-    if ((cpu_nr = get_sys_cpu_nr()) == 0) {
+    /* /sys directories are not captured: count CPUs in /proc/stat then */
+    if (!source_is_live() || (cpu_nr = get_sys_cpu_nr()) == 0) {
         /* /sys may be not mounted. Use /proc/stat instead */
         cpu_nr = get_proc_cpu_nr();
     }
@@ -451,37 +1350,257 @@ static int is_device(char *name, int allow_virtual)
     return !(access(syspath, F_OK));
 }
 
+/*
+ * Same as is_device(), from the block devices found at discovery time
+ * instead of a sysfs lookup.
+ */
+static int is_blk_dev(int blk, int allow_virtual)
+{
+    return blk >= 0 && (allow_virtual || !blk_dev_info[blk].is_virtual);
+}
 
 /*
- * Find number of devices and partitions available in /proc/diskstats.
- * Args: count_part : set to TRUE if devices _and_ partitions are to be
- *        counted.
- *       only_used_dev : when counting devices, set to TRUE if only devices
- *        with non zero stats are to be counted.
+ * Read the first line of a small sysfs file, without its trailing newline.
+ * RETURNS: 0 on success, -1 if the file cannot be read.
  */
-static int get_diskstats_dev_nr(int count_part, int only_used_dev)
+static int read_sysfs_line(const char *path, char *buf, int len)
 {
-    FILE *fp = NULL;
-    if ((fp = fopen(DISKSTATS, "r")) == NULL) {
-        /* File non-existent */
-        return 0;
+    FILE *fp;
+    if ((fp = source_fopen(path, "r")) == NULL) {
+        return -1;
     }
 
-    /*
-     * Counting devices and partitions is simply a matter of counting
-     * the number of lines...
-     */
-    int dev = 0;
-    char line[256];
-	char dev_name[MAX_NAME_LEN];
-    while (fgets(line, 256, fp) != NULL) {
-        if (!count_part) {
-            unsigned long rd_ios, wr_ios;
-            int i = sscanf(line, "%*d %*d %s %lu %*u %*u %*u %lu",
-                    dev_name, &rd_ios, &wr_ios);
-            if (i == 2 || !is_device(dev_name, ALLOW_VIRTUAL)) {
-                /* It was a partition and not a device */
-                continue;
+    if (fgets(buf, len, fp) == NULL) {
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+
+    buf[strcspn(buf, "\n")] = '\0';
+
+    return 0;
+}
+
+/* Find block device by its major and minor numbers. Return -1 if unknown */
+static int find_blk_dev(unsigned int major, unsigned int minor)
+{
+    for (int i = 0; i < g_blk_dev_nr; i++) {
+        if ((blk_dev_info[i].major == major) && (blk_dev_info[i].minor == minor)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Find block device by its /sys/block entry name. Return -1 if unknown */
+static int find_blk_dev_by_sysname(const char *sysname)
+{
+    char kname[MAX_NAME_LEN];
+    strncpy(kname, sysname, MAX_NAME_LEN - 1);
+    kname[MAX_NAME_LEN - 1] = '\0';
+
+    char *slash;
+    while ((slash = strchr(kname, '!'))) {
+        *slash = '/';
+    }
+
+    for (int i = 0; i < g_blk_dev_nr; i++) {
+        if (!strcmp(blk_dev_info[i].kname, kname)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Follow the holder chain of a block device up to its topmost holder */
+static int get_top_holder(int blk)
+{
+    /* Bounded walk: a holder loop would be a sysfs inconsistency */
+    for (int depth = 0; depth < g_blk_dev_nr && blk_dev_info[blk].holder >= 0; depth++) {
+        blk = blk_dev_info[blk].holder;
+    }
+    return blk;
+}
+
+/*
+ * Record the block device table into the capture file, or load it from
+ * the replayed one, as directory scans are not captured.
+ */
+static void capture_blk_devs()
+{
+    std::string data;
+    char line[MAX_PF_NAME];
+    for (int i = 0; i < g_blk_dev_nr; i++) {
+        const BlkDevInfo *blk = blk_dev_info + i;
+        snprintf(line, sizeof(line), "%u %u %d %d %d %s %s\n",
+                blk->major, blk->minor, blk->is_virtual, blk->holder,
+                blk->nr_members, blk->kname, blk->name);
+        data += line;
+    }
+    capture_source(BLK_DEVS_SOURCE, &data);
+}
+
+static int replay_blk_devs()
+{
+    FILE *fp;
+    if ((fp = source_fopen(BLK_DEVS_SOURCE, "r")) == NULL) {
+        return 0;
+    }
+    char line[MAX_PF_NAME];
+    while (fgets(line, sizeof(line), fp) != NULL && g_blk_dev_nr < MAX_BLK_DEV_NR) {
+        BlkDevInfo *blk = blk_dev_info + g_blk_dev_nr;
+        memset(blk, 0, sizeof(BlkDevInfo));
+        int pos = 0;
+        if (sscanf(line, "%u %u %d %d %d %15s %n", &blk->major, &blk->minor,
+                    &blk->is_virtual, &blk->holder, &blk->nr_members,
+                    blk->kname, &pos) < 6 || !pos) {
+            continue;
+        }
+        line[strcspn(line, "\n")] = '\0';
+        strncpy(blk->name, line + pos, MAX_DM_NAME_LEN - 1);
+        g_blk_dev_nr++;
+    }
+    fclose(fp);
+
+    return g_blk_dev_nr;
+}
+
+/*
+ * Register the block devices present in /sys/block, once per discovery:
+ * major/minor numbers, virtual flag, display name (device-mapper devices
+ * are named after /sys/block/dm-N/dm/name) and holder relationship.
+ * RETURNS: number of block devices registered.
+ */
+static int discover_blk_devs()
+{
+    g_blk_dev_nr = 0;
+    if (g_source_mode == SRC_REPLAY) {
+        return replay_blk_devs();
+    }
+
+    DIR *dir = NULL;
+    if ((dir = opendir(SYSFS_BLOCK)) == NULL) {
+        return 0;
+    }
+
+    struct dirent *drd = NULL;
+    char line[MAX_PF_NAME], buf[MAX_DM_NAME_LEN];
+    while (((drd = readdir(dir)) != NULL) && (g_blk_dev_nr < MAX_BLK_DEV_NR)) {
+        if (drd->d_name[0] == '.') {
+            continue;
+        }
+
+        unsigned int major, minor;
+        snprintf(line, sizeof(line), "%s/%s/%s", SYSFS_BLOCK, drd->d_name, S_DEV);
+        if (read_sysfs_line(line, buf, sizeof(buf)) < 0 ||
+                sscanf(buf, "%u:%u", &major, &minor) != 2) {
+            continue;
+        }
+
+        BlkDevInfo *blk = blk_dev_info + g_blk_dev_nr++;
+        memset(blk, 0, sizeof(BlkDevInfo));
+        blk->major = major;
+        blk->minor = minor;
+        blk->holder = -1;
+
+        /* Some devices may have a slash in their name (eg. cciss/c0d0...) */
+        snprintf(blk->kname, sizeof(blk->kname), "%.*s", MAX_NAME_LEN - 1, drd->d_name);
+        char *slash;
+        while ((slash = strchr(blk->kname, '!'))) {
+            *slash = '/';
+        }
+        strcpy(blk->name, blk->kname);
+
+        blk->is_virtual = !is_device(drd->d_name, 0);
+
+        if (!strncmp(drd->d_name, "dm-", 3)) {
+            snprintf(line, sizeof(line), "%s/%s/%s",
+                    SYSFS_BLOCK, drd->d_name, S_DM_NAME);
+            if (!read_sysfs_line(line, buf, sizeof(buf)) && buf[0]) {
+                strcpy(blk->name, buf);
+            }
+        }
+    }
+    closedir(dir);
+
+    /* Now that every device is known, link whole-disk members to holders */
+    for (int i = 0; i < g_blk_dev_nr; i++) {
+        char sysname[MAX_NAME_LEN];
+        strcpy(sysname, blk_dev_info[i].kname);
+        char *slash;
+        while ((slash = strchr(sysname, '/'))) {
+            *slash = '!';
+        }
+
+        snprintf(line, sizeof(line), "%s/%s/%s", SYSFS_BLOCK, sysname, S_HOLDERS);
+        if ((dir = opendir(line)) == NULL) {
+            continue;
+        }
+        while ((drd = readdir(dir)) != NULL) {
+            if (drd->d_name[0] == '.') {
+                continue;
+            }
+            int holder = find_blk_dev_by_sysname(drd->d_name);
+            if (holder >= 0 && holder != i) {
+                /* A member with several holders is folded into the first one */
+                blk_dev_info[i].holder = holder;
+                break;
+            }
+        }
+        closedir(dir);
+    }
+
+    for (int i = 0; i < g_blk_dev_nr; i++) {
+        if (blk_dev_info[i].holder >= 0) {
+            blk_dev_info[get_top_holder(i)].nr_members++;
+        }
+    }
+
+    if (g_source_mode == SRC_CAPTURE) {
+        capture_blk_devs();
+    }
+
+    return g_blk_dev_nr;
+}
+
+
+/*
+ * Find number of devices and partitions available in /proc/diskstats.
+ * Args: count_part : set to TRUE if devices _and_ partitions are to be
+ *        counted.
+ *       only_used_dev : when counting devices, set to TRUE if only devices
+ *        with non zero stats are to be counted.
+ */
+static int get_diskstats_dev_nr(int count_part, int only_used_dev)
+{
+    FILE *fp = NULL;
+    if ((fp = source_fopen(DISKSTATS, "r")) == NULL) {
+        /* File non-existent */
+        return 0;
+    }
+
+    /*
+     * Counting devices and partitions is simply a matter of counting
+     * the number of lines...
+     */
+    int dev = 0;
+    char line[256];
+	char dev_name[MAX_NAME_LEN];
+    while (fgets(line, 256, fp) != NULL) {
+        size_t len;
+        const char *name = diskstats_name(line, &len);
+        if (name == NULL || !match_name_filter(g_disk_filter, name, len)) {
+            continue;
+        }
+        if (!count_part) {
+            unsigned int major, minor;
+            unsigned long rd_ios, wr_ios;
+            int i = sscanf(line, "%u %u %s %lu %*u %*u %*u %lu",
+                    &major, &minor, dev_name, &rd_ios, &wr_ios);
+            if (i == 4 || !is_blk_dev(find_blk_dev(major, minor),
+                        g_config.allow_virtual)) {
+                /* It was a partition and not a device */
+                continue;
             }
             if (only_used_dev && !rd_ios && !wr_ios) {
                 /* Unused device */
@@ -507,7 +1626,7 @@ int get_ppartitions_dev_nr(int count_part)
     int dev = 0;
     unsigned int major, minor, tmp;
 
-    if ((fp = fopen(PPARTITIONS, "r")) == NULL) {
+    if ((fp = source_fopen(PPARTITIONS, "r")) == NULL) {
         return 0;
     }
 
@@ -539,7 +1658,7 @@ int get_ppartitions_dev_nr(int count_part)
 static int get_disk_io_nr()
 {
     FILE *fp = NULL;
-    if ((fp = fopen(STAT, "r")) == NULL) {
+    if ((fp = source_fopen(STAT, "r")) == NULL) {
         /* fprintf(stderr, _("Cannot open %s: %s\n"), STAT, strerror(errno)); */
         /* exit(2); */
         return 0;
@@ -589,14 +1708,19 @@ static int get_disk_nr()
 static int get_net_dev(void)
 {
     FILE *fp;
-    if ((fp = fopen(NET_DEV, "r")) == NULL) {
+    if ((fp = source_fopen(NET_DEV, "r")) == NULL) {
         return 0;        /* No network device file */
     }
 
     char line[128];
     int dev = 0;
     while (fgets(line, 128, fp) != NULL) {
-        if (strchr(line, ':')) {
+        char *colon = strchr(line, ':');
+        if (colon == NULL) {
+            continue;
+        }
+        const char *name = line + strspn(line, " ");
+        if (match_name_filter(g_iface_filter, name, colon - name)) {
             dev++;
         }
     }
@@ -619,6 +1743,11 @@ static char *get_devname(unsigned int major, unsigned int minor, int pretty)
 
     snprintf(buf, MAX_DISK_LEN, "dev%d-%d", major, minor);
 
+    /* Virtual devices are named at discovery (eg. dm-N after dm/name) */
+    int blk = find_blk_dev(major, minor);
+    if (blk >= 0 && blk_dev_info[blk].is_virtual) {
+        return (blk_dev_info[blk].name);
+    }
 
     if (!pretty) {
         return (buf);
@@ -636,7 +1765,7 @@ static char *get_devname(unsigned int major, unsigned int minor, int pretty)
 static int read_proc_stat(FileStats &file_stats, int curr)
 {
     FILE *fp;
-    if ((fp = fopen(STAT, "r")) == NULL) {
+    if ((fp = source_fopen(STAT, "r")) == NULL) {
         return -1;
     }
 
@@ -753,7 +1882,7 @@ static int read_proc_stat(FileStats &file_stats, int curr)
 static int read_proc_meminfo(FileStats &file_stats)
 {
     FILE *fp;
-    if ((fp = fopen(MEMINFO, "r")) == NULL) {
+    if ((fp = source_fopen(MEMINFO, "r")) == NULL) {
         return -1;
     }
 
@@ -799,7 +1928,7 @@ static int read_proc_meminfo(FileStats &file_stats)
 static int read_proc_loadavg(FileStats &file_stats)
 {
     FILE *fp;
-    if ((fp = fopen(LOADAVG, "r")) == NULL) {
+    if ((fp = source_fopen(LOADAVG, "r")) == NULL) {
         return -1;
     }
 
@@ -828,7 +1957,7 @@ static int read_proc_loadavg(FileStats &file_stats)
 static int read_proc_vmstat(FileStats &file_stats)
 {
     FILE *fp;
-    if ((fp = fopen(VMSTAT, "r")) == NULL) {
+    if ((fp = source_fopen(VMSTAT, "r")) == NULL) {
         return -1;
     }
 
@@ -877,13 +2006,13 @@ static int read_ktables_stat(FileStats &file_stats)
 {
     FILE *fp;
     /* Open /proc/sys/fs/dentry-state file */
-    if ((fp = fopen(FDENTRY_STATE, "r")) != NULL) {
+    if ((fp = source_fopen(FDENTRY_STATE, "r")) != NULL) {
         fscanf(fp, "%*d %u", &(file_stats.dentry_stat));
         fclose(fp);
     }
 
     /* Open /proc/sys/fs/file-nr file */
-    if ((fp = fopen(FFILE_NR, "r")) != NULL) {
+    if ((fp = source_fopen(FFILE_NR, "r")) != NULL) {
         unsigned int parm;
         fscanf(fp, "%u %u", &(file_stats.file_used), &parm);
         fclose(fp);
@@ -895,7 +2024,7 @@ static int read_ktables_stat(FileStats &file_stats)
     }
 
     /* Open /proc/sys/fs/inode-state file */
-    if ((fp = fopen(FINODE_STATE, "r")) != NULL) {
+    if ((fp = source_fopen(FINODE_STATE, "r")) != NULL) {
         unsigned int parm;
         fscanf(fp, "%u %u", &(file_stats.inode_used), &parm);
         fclose(fp);
@@ -907,36 +2036,36 @@ static int read_ktables_stat(FileStats &file_stats)
     }
 
     /* Open /proc/sys/fs/super-max file */
-    if ((fp = fopen(FSUPER_MAX, "r")) != NULL) {
+    if ((fp = source_fopen(FSUPER_MAX, "r")) != NULL) {
         fscanf(fp, "%u\n", &(file_stats.super_max));
         fclose(fp);
 
         /* Open /proc/sys/fs/super-nr file */
-        if ((fp = fopen(FSUPER_NR, "r")) != NULL) {
+        if ((fp = source_fopen(FSUPER_NR, "r")) != NULL) {
             fscanf(fp, "%u\n", &(file_stats.super_used));
             fclose(fp);
         }
     }
 
     /* Open /proc/sys/fs/dquot-max file */
-    if ((fp = fopen(FDQUOT_MAX, "r")) != NULL) {
+    if ((fp = source_fopen(FDQUOT_MAX, "r")) != NULL) {
         fscanf(fp, "%u\n", &(file_stats.dquot_max));
         fclose(fp);
 
         /* Open /proc/sys/fs/dquot-nr file */
-        if ((fp = fopen(FDQUOT_NR, "r")) != NULL) {
+        if ((fp = source_fopen(FDQUOT_NR, "r")) != NULL) {
             fscanf(fp, "%u", &(file_stats.dquot_used));
             fclose(fp);
         }
     }
 
     /* Open /proc/sys/kernel/rtsig-max file */
-    if ((fp = fopen(FRTSIG_MAX, "r")) != NULL) {
+    if ((fp = source_fopen(FRTSIG_MAX, "r")) != NULL) {
         fscanf(fp, "%u\n", &(file_stats.rtsig_max));
         fclose(fp);
 
         /* Open /proc/sys/kernel/rtsig-nr file */
-        if ((fp = fopen(FRTSIG_NR, "r")) != NULL) {
+        if ((fp = source_fopen(FRTSIG_NR, "r")) != NULL) {
             fscanf(fp, "%u\n", &(file_stats.rtsig_queued));
             fclose(fp);
         }
@@ -945,28 +2074,51 @@ static int read_ktables_stat(FileStats &file_stats)
     return 0;
 }
 
-/* Read stats from /proc/net/dev */
-static int read_net_dev_stat(FileStats &file_stats, int curr)
+/* Mark interface structures from @dev to the end of the array as unused */
+static void reset_net_dev_stat(int curr, int dev)
 {
-    FILE *fp;
-    if ((fp = fopen(NET_DEV, "r")) == NULL) {
-        return -1;
+    if (dev < g_iface_nr) {
+        /* Reset unused structures */
+        memset(stats_net_dev[curr] + dev, 0, sizeof(StatsNetDev) * (g_iface_nr - dev));
+
+        while (dev < g_iface_nr) {
+            /*
+             * Nb of network interfaces has changed, or appending data to an
+             * old file with more interfaces than are actually available now.
+             */
+            StatsNetDev *stats_net_dev_i = stats_net_dev[curr] + dev++;
+            strcpy(stats_net_dev_i->interface, "?");
+        }
     }
+}
 
+/*
+ * Parse interface lines of a /proc/net/dev file into @stats_net_dev,
+ * up to @max interfaces. Safe to call from several threads at once.
+ * RETURNS: number of interfaces read.
+ */
+static int parse_net_dev_file(FILE *fp, StatsNetDev *stats_net_dev_a, int max)
+{
     int dev = 0;
-    static char line[256];
+    char line[256];
     char iface[MAX_IFACE_LEN];
-    while ((fgets(line, 256, fp) != NULL) && (dev < g_iface_nr)) {
+    while ((fgets(line, 256, fp) != NULL) && (dev < max)) {
         int pos = strcspn(line, ":");
         StatsNetDev *stats_net_dev_i = NULL;
         if (pos < (int)strlen(line)) {
-            stats_net_dev_i = stats_net_dev[curr] + dev;
+            /* Filter on the name token before parsing any counter */
+            int skip = strspn(line, " ");
+            if (!match_name_filter(g_iface_filter, line + skip, pos - skip)) {
+                continue;
+            }
+            stats_net_dev_i = stats_net_dev_a + dev;
             strncpy(iface, line, std::min(pos, MAX_IFACE_LEN - 1));
             iface[std::min(pos, MAX_IFACE_LEN - 1)] = '\0';
             /* Skip heading spaces */
             sscanf(iface, "%s", stats_net_dev_i->interface); 
-            sscanf(line + pos + 1, "%lu %lu %lu %lu %lu %lu %lu %lu %lu %lu "
-                    "%lu %lu %lu %lu %lu %lu",
+            stats_net_dev_i->ifindex = 0;
+            sscanf(line + pos + 1, "%llu %llu %llu %llu %llu %llu %llu %llu "
+                    "%llu %llu %llu %llu %llu %llu %llu %llu",
                     &(stats_net_dev_i->rx_bytes),
                     &(stats_net_dev_i->rx_packets),
                     &(stats_net_dev_i->rx_errors),
@@ -987,277 +2139,2149 @@ static int read_net_dev_stat(FileStats &file_stats, int curr)
         }
     }
 
+    return dev;
+}
+
+/* Read stats from /proc/net/dev */
+static int read_net_dev_stat(FileStats &file_stats, int curr)
+{
+    FILE *fp;
+    if ((fp = source_fopen(NET_DEV, "r")) == NULL) {
+        return -1;
+    }
+
+    int dev = parse_net_dev_file(fp, stats_net_dev[curr], g_iface_nr);
+
     fclose(fp);
 
-    if (dev < g_iface_nr) {
-        /* Reset unused structures */
-        memset(stats_net_dev[curr] + dev, 0, sizeof(StatsNetDev) * (g_iface_nr - dev));
+    reset_net_dev_stat(curr, dev);
 
-        while (dev < g_iface_nr) {
-            /*
-             * Nb of network interfaces has changed, or appending data to an
-             * old file with more interfaces than are actually available now.
-             */
-            StatsNetDev *stats_net_dev_i = stats_net_dev[curr] + dev++;
-            strcpy(stats_net_dev_i->interface, "?");
-        }
-    }
     return 0;
 }
 
-
-/* Read stats from /proc/net/sockstat */
-static int read_net_sock_stat(FileStats &file_stats)
+/* Open the rtnetlink socket used by the netlink backend, once */
+static int open_rtnl_socket()
 {
-    FILE *fp;
-    if ((fp = fopen(NET_SOCKSTAT, "r")) == NULL) {
+    if (g_rtnl_fd >= 0) {
+        return g_rtnl_fd;
+    }
+
+    int fd;
+    if ((fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE)) < 0) {
         return -1;
     }
 
-    static char line[96];
-    while (fgets(line, 96, fp) != NULL) {
-        if (!strncmp(line, "sockets:", 8)) {
-            /* Sockets */
-            sscanf(line + 14, "%u", &(file_stats.sock_inuse));
-        }
-        else if (!strncmp(line, "TCP:", 4)) {
-            /* TCP sockets */
-            sscanf(line + 11, "%u", &(file_stats.tcp_inuse));
-        }
-        else if (!strncmp(line, "UDP:", 4)) {
-            /* UDP sockets */
-            sscanf(line + 11, "%u", &(file_stats.udp_inuse));
-        }
-        else if (!strncmp(line, "RAW:", 4)) {
-            /* RAW sockets */
-            sscanf(line + 11, "%u", &(file_stats.raw_inuse));
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    g_rtnl_fd = fd;
+    return fd;
+}
+
+/*
+ * Fill interface structure from a RTM_NEWLINK message.
+ * Fields are aggregated the same way as in /proc/net/dev, so that both
+ * backends report the same values.
+ * RETURNS: 1 if the interface was kept, 0 otherwise.
+ */
+static int parse_rtnl_link(struct nlmsghdr *nlh, StatsNetDev *stats_net_dev_i)
+{
+    struct ifinfomsg *ifm = (struct ifinfomsg *) NLMSG_DATA(nlh);
+    int len = nlh->nlmsg_len - NLMSG_LENGTH(sizeof(*ifm));
+    if (len < 0) {
+        return 0;
+    }
+
+    const char *name = NULL;
+    const struct rtnl_link_stats64 *st = NULL;
+    for (struct rtattr *rta = IFLA_RTA(ifm); RTA_OK(rta, len);
+            rta = RTA_NEXT(rta, len)) {
+        if (rta->rta_type == IFLA_IFNAME) {
+            name = (const char *) RTA_DATA(rta);
         }
-        else if (!strncmp(line, "FRAG:", 5)) {
-            /* FRAGments */
-            sscanf(line + 12, "%u", &(file_stats.frag_inuse));
+        else if (rta->rta_type == IFLA_STATS64 &&
+                RTA_PAYLOAD(rta) >= sizeof(struct rtnl_link_stats64)) {
+            st = (const struct rtnl_link_stats64 *) RTA_DATA(rta);
         }
     }
-    fclose(fp);
+    if (name == NULL || st == NULL ||
+            !match_name_filter(g_iface_filter, name, strlen(name))) {
+        return 0;
+    }
 
-    return 0;
+    /* IFLA_STATS64 payload may be unaligned for 64-bit loads */
+    struct rtnl_link_stats64 s;
+    memcpy(&s, st, sizeof(s));
+
+    strncpy(stats_net_dev_i->interface, name, MAX_IFACE_LEN - 1);
+    stats_net_dev_i->interface[MAX_IFACE_LEN - 1] = '\0';
+    stats_net_dev_i->ifindex = ifm->ifi_index;
+    stats_net_dev_i->rx_bytes = s.rx_bytes;
+    stats_net_dev_i->rx_packets = s.rx_packets;
+    stats_net_dev_i->rx_errors = s.rx_errors;
+    stats_net_dev_i->rx_dropped = s.rx_dropped + s.rx_missed_errors;
+    stats_net_dev_i->rx_fifo_errors = s.rx_fifo_errors;
+    stats_net_dev_i->rx_frame_errors = s.rx_length_errors + s.rx_over_errors +
+        s.rx_crc_errors + s.rx_frame_errors;
+    stats_net_dev_i->rx_compressed = s.rx_compressed;
+    stats_net_dev_i->multicast = s.multicast;
+    stats_net_dev_i->tx_bytes = s.tx_bytes;
+    stats_net_dev_i->tx_packets = s.tx_packets;
+    stats_net_dev_i->tx_errors = s.tx_errors;
+    stats_net_dev_i->tx_dropped = s.tx_dropped;
+    stats_net_dev_i->tx_fifo_errors = s.tx_fifo_errors;
+    stats_net_dev_i->collisions = s.collisions;
+    stats_net_dev_i->tx_carrier_errors = s.tx_carrier_errors +
+        s.tx_aborted_errors + s.tx_window_errors + s.tx_heartbeat_errors;
+    stats_net_dev_i->tx_compressed = s.tx_compressed;
+
+    return 1;
 }
 
-/* Read stats from /proc/net/rpc/nfs */
-static int read_net_nfs_stat(FileStats &file_stats)
+/*
+ * Read interface stats with a RTM_GETLINK dump over rtnetlink.
+ * Counters are the binary 64-bit IFLA_STATS64 ones, and interfaces are
+ * identified by their ifindex in addition to their name.
+ * RETURNS: 0 on success, -1 if the dump could not be done.
+ */
+static int read_net_dev_netlink(int curr)
 {
-    FILE *fp;
-    if ((fp = fopen(NET_RPC_NFS, "r")) == NULL) {
+    int fd;
+    if ((fd = open_rtnl_socket()) < 0) {
         return -1;
     }
 
-    static char line[256];
-    while (fgets(line, 256, fp) != NULL) {
-        if (!strncmp(line, "rpc", 3))
-            sscanf(line + 3, "%u %u",
-                    &(file_stats.nfs_rpccnt), &(file_stats.nfs_rpcretrans));
+    struct {
+        struct nlmsghdr  nlh;
+        struct ifinfomsg ifm;
+    } req;
+    memset(&req, 0, sizeof(req));
+    req.nlh.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    req.nlh.nlmsg_type = RTM_GETLINK;
+    req.nlh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.nlh.nlmsg_seq = ++g_rtnl_seq;
+    req.ifm.ifi_family = AF_UNSPEC;
+
+    if (send(fd, &req, req.nlh.nlmsg_len, 0) < 0) {
+        return -1;
+    }
 
-        else if (!strncmp(line, "proc3", 5))
-            sscanf(line + 5, "%*u %*u %u %*u %*u %u %*u %u %u",
-                    &(file_stats.nfs_getattcnt), &(file_stats.nfs_accesscnt),
-                    &(file_stats.nfs_readcnt), &(file_stats.nfs_writecnt));
+    /* The kernel packs as many links as fit in each datagram */
+    static char buf[RTNL_BUF_SIZE] __attribute__ ((aligned (8)));
+    int dev = 0;
+    int done = 0;
+    while (!done) {
+        struct sockaddr_nl addr;
+        struct iovec iov = { buf, sizeof(buf) };
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &addr;
+        msg.msg_namelen = sizeof(addr);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+
+        ssize_t len = recvmsg(fd, &msg, 0);
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (len == 0 || (msg.msg_flags & MSG_TRUNC)) {
+            return -1;
+        }
+
+        for (struct nlmsghdr *nlh = (struct nlmsghdr *) buf;
+                NLMSG_OK(nlh, (unsigned int) len); nlh = NLMSG_NEXT(nlh, len)) {
+            if (nlh->nlmsg_seq != g_rtnl_seq) {
+                /* Reply to an older, interrupted dump */
+                continue;
+            }
+            if (nlh->nlmsg_type == NLMSG_DONE) {
+                done = 1;
+                break;
+            }
+            if (nlh->nlmsg_type == NLMSG_ERROR) {
+                return -1;
+            }
+            if (nlh->nlmsg_type != RTM_NEWLINK || dev >= g_iface_nr) {
+                /* Keep draining the dump even when the array is full */
+                continue;
+            }
+            dev += parse_rtnl_link(nlh, stats_net_dev[curr] + dev);
+        }
     }
 
-    fclose(fp);
+    reset_net_dev_stat(curr, dev);
 
     return 0;
 }
 
-/* Read stats from /proc/net/rpc/nfsd */
-static int read_net_nfsd_stat(FileStats &file_stats)
+
+/* Close the statistics files of a watched interface */
+static void close_sysfs_net_dev(SysfsNetDev *snd)
 {
-    FILE *fp;
-    if ((fp = fopen(NET_RPC_NFSD, "r")) == NULL) {
+    for (int i = 0; i < NR_SYSFS_NET_STATS; i++) {
+        if (snd->fd[i] >= 0) {
+            close(snd->fd[i]);
+        }
+        snd->fd[i] = -1;
+    }
+}
+
+/*
+ * Open the statistics files of a watched interface. They are kept open,
+ * so that a sample only costs one pread() per counter.
+ * RETURNS: 0 on success, -1 if the interface is not present.
+ */
+static int open_sysfs_net_dev(SysfsNetDev *snd)
+{
+    char path[MAX_PF_NAME], buf[32];
+    snprintf(path, sizeof(path), "%s/%s/%s",
+            SYSFS_CLASS_NET, snd->interface, S_IFINDEX);
+    if (read_sysfs_line(path, buf, sizeof(buf)) < 0) {
         return -1;
     }
+    snd->ifindex = atoi(buf);
+
+    for (int i = 0; i < NR_SYSFS_NET_STATS; i++) {
+        snprintf(path, sizeof(path), "%s/%s/%s/%s", SYSFS_CLASS_NET,
+                snd->interface, S_STATISTICS, SYSFS_NET_STAT_FILES[i]);
+        if ((snd->fd[i] = open(path, O_RDONLY | O_CLOEXEC)) < 0) {
+            close_sysfs_net_dev(snd);
+            return -1;
+        }
+    }
+    return 0;
+}
 
-    static char line[256];
-    while (fgets(line, 256, fp) != NULL) {
-        if (!strncmp(line, "rc", 2))
-            sscanf(line + 2, "%u %u",
-                    &(file_stats.nfsd_rchits), &(file_stats.nfsd_rcmisses));
+/*
+ * Select the interface statistics backend and, for the sysfs one, build
+ * the watch list from the exact names of the include filter.
+ */
+static void setup_net_dev_backend()
+{
+    for (int i = 0; i < g_sysfs_iface_nr; i++) {
+        close_sysfs_net_dev(sysfs_net_dev + i);
+    }
+    g_sysfs_iface_nr = 0;
 
-        else if (!strncmp(line, "net", 3))
-            sscanf(line + 3, "%u %u %u",
-                    &(file_stats.nfsd_netcnt), &(file_stats.nfsd_netudpcnt),
-                    &(file_stats.nfsd_nettcpcnt));
+    int exact_nr = 0;
+    for (size_t i = 0; i < g_iface_filter.include.size(); i++) {
+        exact_nr += (g_iface_filter.include[i].type == PAT_EXACT);
+    }
 
-        else if (!strncmp(line, "rpc", 3))
-            sscanf(line + 3, "%u %u",
-                    &(file_stats.nfsd_rpccnt), &(file_stats.nfsd_rpcbad));
+    g_net_dev_backend = g_config.net_dev_backend;
+    if (!source_is_live()) {
+        /* Only /proc/net/dev is captured */
+        g_net_dev_backend = NET_DEV_PROCFS;
+        return;
+    }
+    if (g_net_dev_backend == NET_DEV_AUTO) {
+        bool watch_list = exact_nr &&
+            exact_nr == (int) g_iface_filter.include.size() &&
+            exact_nr <= g_config.sysfs_watch_max &&
+            g_iface_filter.exclude.empty();
+        g_net_dev_backend = watch_list ? NET_DEV_SYSFS : NET_DEV_PROCFS;
+    }
+    if (g_net_dev_backend != NET_DEV_SYSFS) {
+        return;
+    }
 
-        else if (!strncmp(line, "proc3", 5))
-            sscanf(line + 5, "%*u %*u %u %*u %*u %u %*u %u %u",
-                    &(file_stats.nfsd_getattcnt), &(file_stats.nfsd_accesscnt),
-                    &(file_stats.nfsd_readcnt), &(file_stats.nfsd_writecnt));
+    for (size_t i = 0; i < g_iface_filter.include.size(); i++) {
+        const NamePattern &pat = g_iface_filter.include[i];
+        if (pat.type != PAT_EXACT || g_sysfs_iface_nr >= MAX_NET_DEV_NR ||
+                !match_name_filter(g_iface_filter, pat.str.data(), pat.str.size())) {
+            continue;
+        }
+        SysfsNetDev *snd = sysfs_net_dev + g_sysfs_iface_nr++;
+        memset(snd, 0, sizeof(SysfsNetDev));
+        strncpy(snd->interface, pat.str.c_str(), MAX_IFACE_LEN - 1);
+        for (int j = 0; j < NR_SYSFS_NET_STATS; j++) {
+            snd->fd[j] = -1;
+        }
+        open_sysfs_net_dev(snd);
     }
 
-    fclose(fp);
+    if (!g_sysfs_iface_nr) {
+        /* Nothing to watch by name */
+        g_net_dev_backend = NET_DEV_PROCFS;
+    }
+}
+
+/*
+ * Read stats of the watched interfaces from
+ * /sys/class/net/<if>/statistics/<counter>. The cost does not depend on the
+ * number of interfaces registered on the host.
+ */
+static int read_net_dev_sysfs(int curr)
+{
+    int dev = 0;
+    char buf[32];
+    unsigned long long v[NR_SYSFS_NET_STATS];
+
+    for (int i = 0; i < g_sysfs_iface_nr && dev < g_iface_nr; i++) {
+        SysfsNetDev *snd = sysfs_net_dev + i;
+        if (snd->fd[0] < 0 && open_sysfs_net_dev(snd) < 0) {
+            /* Interface not (yet) registered */
+            continue;
+        }
+
+        int j;
+        for (j = 0; j < NR_SYSFS_NET_STATS; j++) {
+            ssize_t len = pread(snd->fd[j], buf, sizeof(buf) - 1, 0);
+            if (len <= 0) {
+                break;
+            }
+            buf[len] = '\0';
+            v[j] = strtoull(buf, NULL, 10);
+        }
+        if (j < NR_SYSFS_NET_STATS) {
+            /* Interface was unregistered: reopen it at next sample */
+            close_sysfs_net_dev(snd);
+            continue;
+        }
+
+        /* Same aggregation as /proc/net/dev */
+        StatsNetDev *stats_net_dev_i = stats_net_dev[curr] + dev++;
+        strcpy(stats_net_dev_i->interface, snd->interface);
+        stats_net_dev_i->ifindex = snd->ifindex;
+        stats_net_dev_i->rx_bytes = v[SNS_RX_BYTES];
+        stats_net_dev_i->rx_packets = v[SNS_RX_PACKETS];
+        stats_net_dev_i->rx_errors = v[SNS_RX_ERRORS];
+        stats_net_dev_i->rx_dropped = v[SNS_RX_DROPPED] + v[SNS_RX_MISSED_ERRORS];
+        stats_net_dev_i->rx_fifo_errors = v[SNS_RX_FIFO_ERRORS];
+        stats_net_dev_i->rx_frame_errors = v[SNS_RX_LENGTH_ERRORS] +
+            v[SNS_RX_OVER_ERRORS] + v[SNS_RX_CRC_ERRORS] + v[SNS_RX_FRAME_ERRORS];
+        stats_net_dev_i->rx_compressed = v[SNS_RX_COMPRESSED];
+        stats_net_dev_i->multicast = v[SNS_MULTICAST];
+        stats_net_dev_i->tx_bytes = v[SNS_TX_BYTES];
+        stats_net_dev_i->tx_packets = v[SNS_TX_PACKETS];
+        stats_net_dev_i->tx_errors = v[SNS_TX_ERRORS];
+        stats_net_dev_i->tx_dropped = v[SNS_TX_DROPPED];
+        stats_net_dev_i->tx_fifo_errors = v[SNS_TX_FIFO_ERRORS];
+        stats_net_dev_i->collisions = v[SNS_COLLISIONS];
+        stats_net_dev_i->tx_carrier_errors = v[SNS_TX_CARRIER_ERRORS] +
+            v[SNS_TX_ABORTED_ERRORS] + v[SNS_TX_WINDOW_ERRORS] +
+            v[SNS_TX_HEARTBEAT_ERRORS];
+        stats_net_dev_i->tx_compressed = v[SNS_TX_COMPRESSED];
+    }
+
+    reset_net_dev_stat(curr, dev);
 
     return 0;
 }
 
-/* Init dk_drive* counters (used for sar -b) */
-static void init_dk_drive_stat(FileStats &file_stats)
+/*
+ * Register a network namespace found at @ino. Named namespaces win over
+ * those found through a pid, which may exit at any time.
+ */
+static void add_netns(ino_t ino, const char *name, long pid)
 {
-    file_stats.dk_drive = 0;
-    file_stats.dk_drive_rio  = file_stats.dk_drive_wio  = 0;
-    file_stats.dk_drive_rblk = file_stats.dk_drive_wblk = 0;
+    if ((int) g_netns_order.size() >= MAX_NETNS_NR) {
+        return;
+    }
+
+    NetnsEntry &ns = g_netns[ino];
+    if (ns.gen == g_netns_gen) {
+        /* Already seen in this discovery */
+        return;
+    }
+    if (ns.gen == 0) {
+        /* New namespace */
+        ns.online[0] = ns.online[1] = 0;
+    }
+    ns.name = name ? name : "";
+    ns.pid = pid;
+    ns.gen = g_netns_gen;
+    g_netns_order.push_back(ino);
 }
 
-/* Read stats from /proc/diskstats */
-static int read_diskstats_stat(FileStats &file_stats, int curr)
+/*
+ * Register the network namespaces of the host other than ours, from
+ * /run/netns and from /proc/<pid>/ns/net, as enabled by
+ * SarConfig::netns_sources. Those that disappeared are dropped. The scan
+ * is only redone every netns_rescan_sec, or once a namespace could not
+ * be read.
+ */
+static void discover_netns()
 {
-    FILE *fp;
-    if ((fp = fopen(DISKSTATS, "r")) == NULL) {
-        return 0;
+    if (!g_config.netns_sources || !source_is_live()) {
+        if (!g_netns.empty()) {
+            g_netns.clear();
+            g_netns_order.clear();
+        }
+        g_netns_stale = true;
+        return;
     }
 
-    init_dk_drive_stat(file_stats);
+    long long now = g_clock.now_ms ? g_clock.now_ms() : real_now_ms();
+    if (!g_netns_stale &&
+            now - g_netns_scan_ms < g_config.netns_rescan_sec * 1000LL) {
+        return;
+    }
+    g_netns_scan_ms = now;
+    g_netns_stale = false;
 
-    int dsk = 0;
-    char line[256];
-    char dev_name[MAX_NAME_LEN];
-    while ((fgets(line, 256, fp) != NULL) && (dsk < g_disk_nr)) {
-        unsigned int major, minor;
-        unsigned long rd_ios, wr_ios, rd_ticks, wr_ticks;
-        unsigned long tot_ticks, rq_ticks;
-        unsigned long long rd_sec, wr_sec;
-        if (sscanf(line, "%u %u %s %lu %*u %llu %lu %lu %*u %llu"
-                    " %lu %*u %lu %lu",
-                    &major, &minor,
-                    dev_name,
-                    &rd_ios, &rd_sec, &rd_ticks, &wr_ios, &wr_sec, &wr_ticks,
-                    &tot_ticks, &rq_ticks) == 11) {
-            /* It's a device and not a partition */
-            if (!rd_ios && !wr_ios) {
-                /* Unused device: ignore it */
+    struct stat st;
+    ino_t self_ino = 0;
+    if (stat(SELF_NS_NET, &st) == 0) {
+        self_ino = st.st_ino;
+    }
+
+    g_netns_gen++;
+    g_netns_order.clear();
+
+    DIR *dir;
+    struct dirent *drd;
+    char path[MAX_PF_NAME];
+    if ((g_config.netns_sources & NETNS_SRC_NAMED) &&
+            (dir = opendir(NETNS_RUN)) != NULL) {
+        while ((drd = readdir(dir)) != NULL) {
+            if (drd->d_name[0] == '.') {
                 continue;
             }
+            snprintf(path, sizeof(path), "%s/%s", NETNS_RUN, drd->d_name);
+            /* The bind mount of a namespace has the inode of its nsfs file */
+            if (stat(path, &st) == 0 && st.st_ino != self_ino) {
+                add_netns(st.st_ino, drd->d_name, 0);
+            }
+        }
+        closedir(dir);
+    }
 
-            if (!is_device(dev_name, ALLOW_VIRTUAL)) {
-                /* not read patitions */;
+    if ((g_config.netns_sources & NETNS_SRC_PID) &&
+            (dir = opendir(PROC)) != NULL) {
+        while ((drd = readdir(dir)) != NULL) {
+            if (!isdigit(drd->d_name[0])) {
                 continue;
             }
-            DiskStats *disk_stats_i = disk_stats[curr] + dsk++;
-            disk_stats_i->major = major;
-            disk_stats_i->minor = minor;
-            disk_stats_i->nr_ios = rd_ios + wr_ios;
-            disk_stats_i->rd_sect = rd_sec;
-            disk_stats_i->wr_sect = wr_sec;
-            disk_stats_i->rd_ticks = rd_ticks;
-            disk_stats_i->wr_ticks = wr_ticks;
-            disk_stats_i->tot_ticks = tot_ticks;
-            disk_stats_i->rq_ticks = rq_ticks;
+            snprintf(path, sizeof(path), "%s/%s/%s", PROC, drd->d_name, PID_NS_NET);
+            /* Fails for processes we may not ptrace */
+            if (stat(path, &st) == 0 && st.st_ino != self_ino) {
+                add_netns(st.st_ino, NULL, atol(drd->d_name));
+            }
+        }
+        closedir(dir);
+    }
 
-            file_stats.dk_drive += rd_ios + wr_ios;
-            file_stats.dk_drive_rio += rd_ios;
-            file_stats.dk_drive_rblk += (unsigned int) rd_sec;
-            file_stats.dk_drive_wio += wr_ios;
-            file_stats.dk_drive_wblk += (unsigned int) wr_sec;
+    for (std::unordered_map<ino_t, NetnsEntry>::iterator it = g_netns.begin();
+            it != g_netns.end(); ) {
+        if (it->second.gen != g_netns_gen) {
+            it = g_netns.erase(it);
+        }
+        else {
+            ++it;
         }
     }
+}
 
-    fclose(fp);
+/*
+ * Open /proc/net/dev as seen from namespace @ino: through
+ * /proc/<pid>/net/dev, once checked that the pid was not recycled into
+ * another namespace, or by entering a named namespace with setns().
+ * setns() only moves the calling thread, which must be a worker thread
+ * never returning to the caller.
+ */
+static FILE *open_netns_dev(ino_t ino, const NetnsEntry &ns)
+{
+    char path[MAX_PF_NAME];
+    int fd;
+
+    if (ns.pid) {
+        snprintf(path, sizeof(path), "%s/%ld", PROC, ns.pid);
+        int dirfd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirfd < 0) {
+            return NULL;
+        }
+        struct stat st;
+        fd = -1;
+        if (fstatat(dirfd, PID_NS_NET, &st, 0) == 0 && st.st_ino == ino) {
+            fd = openat(dirfd, PID_NET_DEV, O_RDONLY | O_CLOEXEC);
+        }
+        close(dirfd);
+    }
+    else {
+        snprintf(path, sizeof(path), "%s/%s", NETNS_RUN, ns.name.c_str());
+        int nsfd = open(path, O_RDONLY | O_CLOEXEC);
+        if (nsfd < 0) {
+            return NULL;
+        }
+        /* Needs CAP_SYS_ADMIN */
+        int rc = setns(nsfd, CLONE_NEWNET);
+        close(nsfd);
+        if (rc < 0) {
+            return NULL;
+        }
+        fd = open(THREAD_NET_DEV, O_RDONLY | O_CLOEXEC);
+    }
 
-    while (dsk < g_disk_nr) {
-        /*
-         * Nb of disks has changed, or appending data to an old file
-         * with more disks than are actually available now.
-         */
-        DiskStats *disk_stats_i = disk_stats[curr] + dsk++;
-        disk_stats_i->major = disk_stats_i->minor = 0;
+    if (fd < 0) {
+        return NULL;
     }
-    return 0;
+    FILE *fp = fdopen(fd, "r");
+    if (fp == NULL) {
+        close(fd);
+    }
+    return fp;
 }
 
-/* Read stats from /proc/partitions */
-/* TODO */
-/* static int read_ppartitions_stat(FileStats &file_stats) */
+/* Read interface stats of one namespace, from a worker thread */
+static void read_netns_dev(ino_t ino, NetnsEntry &ns, int curr)
+{
+    StatsNetDev st_net_dev[MAX_NETNS_IFACE_NR];
+    int dev = 0;
 
-static int read_stats(FileStats &file_stats, int curr)
+    FILE *fp = open_netns_dev(ino, ns);
+    if (fp != NULL) {
+        dev = parse_net_dev_file(fp, st_net_dev, MAX_NETNS_IFACE_NR);
+        fclose(fp);
+    }
+
+    ns.online[curr] = (fp != NULL);
+    ns.stats[curr].assign(st_net_dev, st_net_dev + dev);
+}
+
+/*
+ * Worker of the netns pool. It stays in the last namespace it entered,
+ * and never runs code of the caller.
+ */
+static void netns_worker(NetnsPool *pool)
 {
-    int ret = 0;
-    ret += read_proc_stat(file_stats, curr);
-    ret += read_proc_meminfo(file_stats);
-    ret += read_proc_loadavg(file_stats);
-    ret += read_proc_vmstat(file_stats);
-    ret += read_ktables_stat(file_stats);
-    ret += read_net_sock_stat(file_stats);
-    ret += read_net_nfs_stat(file_stats);
-    ret += read_net_nfsd_stat(file_stats);
-    ret += read_diskstats_stat(file_stats, curr);
-    ret += read_net_dev_stat(file_stats, curr);
+    unsigned int seen = 0;
+    std::unique_lock<std::mutex> lk(pool->lock);
+    for (;;) {
+        while (!pool->stop && pool->batch == seen) {
+            pool->work.wait(lk);
+        }
+        if (pool->stop) {
+            return;
+        }
+        seen = pool->batch;
+        pool->busy++;
+        while (pool->next < pool->jobs.size()) {
+            size_t i = pool->next++;
+            lk.unlock();
+            read_netns_dev(pool->inodes[i], *pool->jobs[i], pool->curr);
+            lk.lock();
+        }
+        if (--pool->busy == 0) {
+            pool->done.notify_all();
+        }
+    }
+}
 
-    return ret;
+/* Stop and join the netns workers */
+static void stop_netns_pool()
+{
+    if (g_netns_pool == NULL) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lk(g_netns_pool->lock);
+        g_netns_pool->stop = true;
+    }
+    g_netns_pool->work.notify_all();
+    for (size_t w = 0; w < g_netns_pool->threads.size(); w++) {
+        g_netns_pool->threads[w].join();
+    }
+    delete g_netns_pool;
+    g_netns_pool = NULL;
 }
 
+/*
+ * Read interface stats of all registered namespaces. Namespaces are
+ * handed out to a pool of SarConfig::netns_workers threads, started once,
+ * so that entering hundreds of them is not serialized behind each other.
+ */
+static int read_netns_stat(int curr)
+{
+    int nr = g_netns_order.size();
+    if (!nr) {
+        return 0;
+    }
+
+    size_t workers = std::max(1, g_config.netns_workers);
+    if (g_netns_pool != NULL && g_netns_pool->threads.size() != workers) {
+        stop_netns_pool();
+    }
+    if (g_netns_pool == NULL) {
+        g_netns_pool = new NetnsPool();
+        for (size_t w = 0; w < workers; w++) {
+            g_netns_pool->threads.push_back(std::thread(netns_worker, g_netns_pool));
+        }
+    }
+
+    NetnsPool *pool = g_netns_pool;
+    std::unique_lock<std::mutex> lk(pool->lock);
+    pool->jobs.resize(nr);
+    for (int i = 0; i < nr; i++) {
+        pool->jobs[i] = &g_netns[g_netns_order[i]];
+    }
+    pool->inodes = g_netns_order;
+    pool->next = 0;
+    pool->curr = curr;
+    pool->batch++;
+    pool->work.notify_all();
+    while (pool->next < pool->jobs.size() || pool->busy) {
+        pool->done.wait(lk);
+    }
+
+    for (int i = 0; i < nr; i++) {
+        if (!pool->jobs[i]->online[curr]) {
+            /* Gone, or its process exited: look the namespaces up again */
+            g_netns_stale = true;
+        }
+    }
 
+    return 0;
+}
 
 /*
- * Set interval value.
- * g_itv is the interval in jiffies multiplied by the # of proc.
- * itv is the interval in jiffies.
+ * Decode the octal escapes (\040 for a space...) of a mountinfo field,
+ * in place.
  */
-static void get_itv_value(
-        const FileStats &file_stats_curr,
-        const FileStats &file_stats_prev,
-        int nr_proc,
-        unsigned long long *itv, unsigned long long *g_itv)
+static void unescape_mount_field(char *str)
 {
-    /* Interval value in jiffies */
-    if (!file_stats_prev.uptime) {
-        /*
-         * Stats from boot time to be displayed: only in this case we admit
-         * that the interval (which is unsigned long long) may be greater
-         * than 0xffffffff, else it was an overflow.
-         */
-        *g_itv = file_stats_curr.uptime;
+    char *d = str;
+    for (char *p = str; *p; p++) {
+        if (p[0] == '\\' && p[1] >= '0' && p[1] <= '3' &&
+                p[2] >= '0' && p[2] <= '7' && p[3] >= '0' && p[3] <= '7') {
+            *d++ = ((p[1] - '0') << 6) | ((p[2] - '0') << 3) | (p[3] - '0');
+            p += 3;
+        }
+        else {
+            *d++ = *p;
+        }
     }
-    else {
-        *g_itv = (file_stats_curr.uptime - file_stats_prev.uptime) & 0xffffffff;
+    *d = '\0';
+}
+
+/* Close /proc/self/mountinfo and forget about all mounts */
+static void close_mounts()
+{
+    if (g_mountinfo_fd >= 0) {
+        close(g_mountinfo_fd);
+        g_mountinfo_fd = -1;
+    }
+    g_mounts.clear();
+    g_mount_order.clear();
+}
+
+/*
+ * Parse /proc/self/mountinfo into g_mounts. Mounts filtered out, and
+ * the other mounts of an already selected device (bind mounts), are
+ * not selected. Known mounts keep their stats.
+ */
+static void parse_mountinfo()
+{
+    std::string table;
+    char buf[4096];
+    ssize_t len;
+    if (lseek(g_mountinfo_fd, 0, SEEK_SET) < 0) {
+        return;
+    }
+    while ((len = read(g_mountinfo_fd, buf, sizeof(buf))) > 0) {
+        table.append(buf, len);
+    }
+    if (len < 0) {
+        return;
     }
 
-    if (!(*g_itv)) {
-        /* Paranoia checking */
-        *g_itv = 1;
+    g_mount_gen++;
+    g_mount_order.clear();
+    std::vector<unsigned int> devs;
+
+    char *saveptr;
+    for (char *line = strtok_r(&table[0], "\n", &saveptr); line != NULL &&
+            (int) g_mount_order.size() < MAX_MOUNT_NR;
+            line = strtok_r(NULL, "\n", &saveptr)) {
+        /*
+         * 36 35 98:0 /mnt1 /mnt2 rw,noatime master:1 - ext3 /dev/root rw
+         * Optional fields end with a lone "-".
+         */
+        int id;
+        unsigned int major, minor;
+        char *fields[5];
+        char *ctx;
+        char *tok = strtok_r(line, " ", &ctx);
+        int nr = 0;
+        for (; tok != NULL && nr < 5; tok = strtok_r(NULL, " ", &ctx)) {
+            fields[nr++] = tok;
+        }
+        while (tok != NULL && strcmp(tok, "-")) {
+            tok = strtok_r(NULL, " ", &ctx);
+        }
+        char *fs_type = strtok_r(NULL, " ", &ctx);
+        char *source = strtok_r(NULL, " ", &ctx);
+        if (nr < 5 || fs_type == NULL || source == NULL ||
+                sscanf(fields[0], "%d", &id) != 1 ||
+                sscanf(fields[2], "%u:%u", &major, &minor) != 2) {
+            continue;
+        }
+
+        char *mnt_point = fields[4];
+        unescape_mount_field(mnt_point);
+        if (!match_name_filter(g_mount_filter, mnt_point, strlen(mnt_point))) {
+            continue;
+        }
+        unsigned int dev = (major << 20) | minor;
+        if (std::find(devs.begin(), devs.end(), dev) != devs.end()) {
+            continue;
+        }
+        devs.push_back(dev);
+
+        MountEntry &mnt = g_mounts[id];
+        if (mnt.gen == 0 || mnt.mnt_point != mnt_point) {
+            /* New mount, or mount ID reused */
+            unescape_mount_field(source);
+            mnt.mnt_point = mnt_point;
+            mnt.fs_type = fs_type;
+            mnt.source = source;
+            memset(mnt.stats, 0, sizeof(mnt.stats));
+        }
+        mnt.gen = g_mount_gen;
+        g_mount_order.push_back(id);
     }
 
-    if (nr_proc > 1) {
-        if (!file_stats_prev.uptime0) {
-            *itv = file_stats_curr.uptime0;
+    for (std::unordered_map<int, MountEntry>::iterator it = g_mounts.begin();
+            it != g_mounts.end(); ) {
+        if (it->second.gen != g_mount_gen) {
+            it = g_mounts.erase(it);
         }
         else {
-            *itv = (file_stats_curr.uptime0 - file_stats_prev.uptime0) 
-                & 0xffffffff;
+            ++it;
         }
+    }
+}
 
-        if (!(*itv)) {
-            *itv = 1;
+/*
+ * Keep the list of mounts up to date. The mount table is parsed again
+ * only when the kernel reports a change (POLLPRI on mountinfo).
+ */
+static void discover_mounts()
+{
+    if (!g_config.collect_fs || !source_is_live()) {
+        if (g_mountinfo_fd >= 0) {
+            close_mounts();
         }
+        return;
     }
-    else {
-        *itv = *g_itv;
+
+    if (g_mountinfo_fd < 0) {
+        if ((g_mountinfo_fd = open(MOUNTINFO, O_RDONLY | O_CLOEXEC)) < 0) {
+            return;
+        }
+        parse_mountinfo();
+        return;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = g_mountinfo_fd;
+    pfd.events = POLLPRI;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLPRI | POLLERR))) {
+        parse_mountinfo();
     }
 }
 
+/* Read the capacity of the selected mounts */
+static int read_fs_stat(int curr)
+{
+    struct statvfs buf;
+
+    for (size_t n = 0; n < g_mount_order.size(); n++) {
+        MountEntry &mnt = g_mounts[g_mount_order[n]];
+        StatsFs *st_fs = mnt.stats + curr;
+        /* Pseudo filesystems (proc, sysfs, cgroup...) have no blocks */
+        if (statvfs(mnt.mnt_point.c_str(), &buf) < 0 || !buf.f_blocks) {
+            st_fs->online = 0;
+            continue;
+        }
+        st_fs->blocks = buf.f_blocks;
+        st_fs->bfree = buf.f_bfree;
+        st_fs->bavail = buf.f_bavail;
+        st_fs->files = buf.f_files;
+        st_fs->ffree = buf.f_ffree;
+        st_fs->frsize = buf.f_frsize ? buf.f_frsize : buf.f_bsize;
+        st_fs->online = 1;
+    }
 
-static int check_iface_reg(StatsNetDev st_net_dev[][MAX_NET_DEV_NR],
-                            short curr, short ref, unsigned int pos)
+    return 0;
+}
+
+/* Read stats from /proc/net/sockstat */
+static int read_net_sock_stat(FileStats &file_stats)
 {
-    StatsNetDev *st_net_dev_i, *st_net_dev_j;
-    st_net_dev_i = st_net_dev[curr] + pos;
+    FILE *fp;
+    if ((fp = source_fopen(NET_SOCKSTAT, "r")) == NULL) {
+        return -1;
+    }
 
-    int index = 0;
-    while (index < g_iface_nr) {
-        st_net_dev_j = st_net_dev[ref] + index;
-        if (!strcmp(st_net_dev_i->interface, st_net_dev_j->interface)) {
-            /*
-             * Network interface found.
+    static char line[96];
+    while (fgets(line, 96, fp) != NULL) {
+        if (!strncmp(line, "sockets:", 8)) {
+            /* Sockets */
+            sscanf(line + 14, "%u", &(file_stats.sock_inuse));
+        }
+        else if (!strncmp(line, "TCP:", 4)) {
+            /* TCP sockets */
+            sscanf(line + 11, "%u", &(file_stats.tcp_inuse));
+        }
+        else if (!strncmp(line, "UDP:", 4)) {
+            /* UDP sockets */
+            sscanf(line + 11, "%u", &(file_stats.udp_inuse));
+        }
+        else if (!strncmp(line, "RAW:", 4)) {
+            /* RAW sockets */
+            sscanf(line + 11, "%u", &(file_stats.raw_inuse));
+        }
+        else if (!strncmp(line, "FRAG:", 5)) {
+            /* FRAGments */
+            sscanf(line + 12, "%u", &(file_stats.frag_inuse));
+        }
+    }
+    fclose(fp);
+
+    return 0;
+}
+
+/*
+ * Build the column to counter mapping of a /proc/net/{snmp,netstat} file
+ * from its header lines. Only sections with collected counters are kept.
+ */
+static void map_net_proto_file(const char *file, std::vector<NetProtoSection> &map)
+{
+    map.clear();
+
+    FILE *fp;
+    if ((fp = source_fopen(file, "r")) == NULL) {
+        return;
+    }
+
+    static char line[8192];
+    bool header = true;
+    while (fgets(line, 8192, fp) != NULL) {
+        /* Lines come in pairs: column names, then values */
+        bool is_header = header;
+        header = !header;
+        if (!is_header) {
+            continue;
+        }
+
+        char *tok = strtok(line, " \n");
+        if (tok == NULL) {
+            continue;
+        }
+        NetProtoSection section;
+        section.name = tok;
+
+        bool used = false;
+        while ((tok = strtok(NULL, " \n")) != NULL) {
+            int slot = -1;
+            for (int i = 0; i < NR_NET_PROTO_STATS; i++) {
+                if (section.name == NET_PROTO_FIELDS[i].section &&
+                        !strcmp(tok, NET_PROTO_FIELDS[i].column)) {
+                    slot = i;
+                    used = true;
+                    break;
+                }
+            }
+            section.slots.push_back(slot);
+        }
+        if (used) {
+            map.push_back(section);
+        }
+    }
+
+    fclose(fp);
+}
+
+/*
+ * Read the value lines of a /proc/net/{snmp,netstat} file into the
+ * counters given by the mapping. Header lines are not parsed again.
+ */
+static int read_net_proto_file(const char *file,
+        const std::vector<NetProtoSection> &map, int curr)
+{
+    FILE *fp;
+    if ((fp = source_fopen(file, "r")) == NULL) {
+        return -1;
+    }
+
+    static char line[8192];
+    while (fgets(line, 8192, fp) != NULL) {
+        const NetProtoSection *section = NULL;
+        for (size_t i = 0; i < map.size(); i++) {
+            if (!strncmp(line, map[i].name.c_str(), map[i].name.size())) {
+                section = &map[i];
+                break;
+            }
+        }
+        char *p = line + (section ? section->name.size() : 0);
+        if (section == NULL || p[0] != ' ' ||
+                !(isdigit((unsigned char) p[1]) || p[1] == '-')) {
+            /* Section not collected, or header line */
+            continue;
+        }
+
+        for (size_t col = 0; col < section->slots.size(); col++) {
+            char *end;
+            unsigned long long value = strtoull(p, &end, 10);
+            if (end == p) {
+                break;
+            }
+            if (section->slots[col] >= 0) {
+                net_proto_stats[curr][section->slots[col]] = value;
+            }
+            p = end;
+        }
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/* Read TCP/UDP stats from /proc/net/snmp and /proc/net/netstat */
+static int read_net_proto_stat(int curr)
+{
+    if (!g_net_proto_mapped) {
+        /* Columns only change with the kernel: map them once */
+        map_net_proto_file(NET_SNMP, g_snmp_map);
+        map_net_proto_file(NET_NETSTAT, g_netstat_map);
+        g_net_proto_mapped = true;
+    }
+
+    memset(net_proto_stats[curr], 0, sizeof(net_proto_stats[curr]));
+
+    int ret = read_net_proto_file(NET_SNMP, g_snmp_map, curr);
+    /* /proc/net/netstat may not exist on old kernels */
+    read_net_proto_file(NET_NETSTAT, g_netstat_map, curr);
+
+    return ret;
+}
+
+/*
+ * Read per-CPU stats from /proc/net/softnet_stat.
+ * There is one line per online CPU, with hexadecimal counters. Recent
+ * kernels give the CPU number in the 13th column, else lines are assumed
+ * to be in CPU order.
+ */
+static int read_softnet_stat(int curr)
+{
+    FILE *fp;
+    if ((fp = source_fopen(NET_SOFTNET, "r")) == NULL) {
+        return -1;
+    }
+
+    memset(stats_softnet[curr], 0, sizeof(StatsSoftnet) * MAX_CPU_NR);
+
+    static char line[256];
+    int nr = 0;
+    while (fgets(line, 256, fp) != NULL) {
+        unsigned long long col[13];
+        char *p = line, *end;
+        int nr_col = 0;
+        while (nr_col < 13) {
+            col[nr_col] = strtoull(p, &end, 16);
+            if (end == p) {
+                break;
+            }
+            p = end;
+            nr_col++;
+        }
+        if (nr_col < 3) {
+            continue;
+        }
+
+        int cpu = (nr_col == 13) ? (int) col[12] : nr;
+        nr++;
+        if (cpu >= MAX_CPU_NR) {
+            continue;
+        }
+
+        StatsSoftnet *st_softnet_i = stats_softnet[curr] + cpu;
+        st_softnet_i->processed = col[0];
+        st_softnet_i->dropped = col[1];
+        st_softnet_i->time_squeeze = col[2];
+        st_softnet_i->received_rps = (nr_col > 9) ? col[9] : 0;
+        st_softnet_i->flow_limit = (nr_col > 10) ? col[10] : 0;
+        st_softnet_i->online = 1;
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/*
+ * Read per-CPU scheduler stats from /proc/schedstat.
+ * Each "cpuN" line ends with the time spent running, the time spent
+ * waiting on the run queue (both in ns) and the number of timeslices run.
+ */
+static int read_schedstat(int curr)
+{
+    FILE *fp;
+    if ((fp = source_fopen(SCHEDSTAT, "r")) == NULL) {
+        /* Kernel built without CONFIG_SCHEDSTATS */
+        return -1;
+    }
+
+    memset(stats_sched_cpu[curr], 0, sizeof(StatsSched) * MAX_CPU_NR);
+
+    static char line[512];
+    while (fgets(line, 512, fp) != NULL) {
+        if (strncmp(line, "cpu", 3)) {
+            continue;
+        }
+
+        int cpu;
+        unsigned long long run_time, run_delay, pcount;
+        if (sscanf(line + 3, "%d %*u %*u %*u %*u %*u %*u %llu %llu %llu",
+                    &cpu, &run_time, &run_delay, &pcount) != 4 ||
+                cpu < 0 || cpu >= MAX_CPU_NR) {
+            continue;
+        }
+
+        StatsSched *st_sched_i = stats_sched_cpu[curr] + cpu;
+        st_sched_i->run_time = run_time;
+        st_sched_i->run_delay = run_delay;
+        st_sched_i->pcount = pcount;
+        st_sched_i->online = 1;
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/* Register the processes watched through /proc/<pid>/schedstat */
+static void discover_sched_tasks()
+{
+    g_sched_task_nr = 0;
+
+    char path[MAX_PF_NAME];
+    for (size_t i = 0; i < g_config.sched_pids.size() &&
+            g_sched_task_nr < MAX_SCHED_TASK_NR; i++) {
+        SchedTask *task = sched_task + g_sched_task_nr++;
+        task->pid = g_config.sched_pids[i];
+
+        snprintf(path, sizeof(path), PID_COMM, task->pid);
+        if (read_sysfs_line(path, task->comm, MAX_NAME_LEN) < 0) {
+            strcpy(task->comm, "?");
+        }
+    }
+}
+
+/* Read scheduler stats of the watched processes */
+static int read_pid_schedstat(int curr)
+{
+    char path[MAX_PF_NAME];
+    for (int i = 0; i < g_sched_task_nr; i++) {
+        StatsSched *st_sched_i = stats_sched_task[curr] + i;
+        memset(st_sched_i, 0, sizeof(StatsSched));
+
+        FILE *fp;
+        snprintf(path, sizeof(path), PID_SCHEDSTAT, sched_task[i].pid);
+        if ((fp = source_fopen(path, "r")) == NULL) {
+            /* Process has exited */
+            continue;
+        }
+        if (fscanf(fp, "%llu %llu %llu", &(st_sched_i->run_time),
+                    &(st_sched_i->run_delay), &(st_sched_i->pcount)) == 3) {
+            st_sched_i->online = 1;
+        }
+        fclose(fp);
+    }
+
+    return 0;
+}
+
+/*
+ * Parse the "some" and "full" lines of a PSI file:
+ * some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ */
+static int parse_psi_buf(const char *buf, StatsPsi *st_psi)
+{
+    memset(st_psi, 0, sizeof(StatsPsi));
+
+    for (const char *line = buf; line && *line; line = strchr(line, '\n')) {
+        line += (*line == '\n');
+
+        double avg[3];
+        unsigned long long total;
+        if (strlen(line) < 4 ||
+                sscanf(line + 4, " avg10=%lf avg60=%lf avg300=%lf total=%llu",
+                    &avg[0], &avg[1], &avg[2], &total) != 4) {
+            continue;
+        }
+        if (!strncmp(line, "some", 4)) {
+            memcpy(st_psi->some_avg, avg, sizeof(avg));
+            st_psi->some_total = total;
+            st_psi->online = 1;
+        }
+        else if (!strncmp(line, "full", 4)) {
+            memcpy(st_psi->full_avg, avg, sizeof(avg));
+            st_psi->full_total = total;
+        }
+    }
+
+    return st_psi->online ? 0 : -1;
+}
+
+/* Read pressure stall information from /proc/pressure/{cpu,memory,io} */
+static int read_psi_stat(int curr)
+{
+    char path[MAX_PF_NAME];
+    for (int i = 0; i < NR_PSI_RES; i++) {
+        snprintf(path, sizeof(path), "%s/%s", PRESSURE, PSI_RES_NAMES[i]);
+
+        FILE *fp;
+        if ((fp = source_fopen(path, "r")) == NULL) {
+            /* Kernel without PSI, or PSI disabled */
+            memset(stats_psi[curr] + i, 0, sizeof(StatsPsi));
+            continue;
+        }
+        static char buf[256];
+        size_t len = fread(buf, 1, sizeof(buf) - 1, fp);
+        buf[len] = '\0';
+        fclose(fp);
+
+        parse_psi_buf(buf, stats_psi[curr] + i);
+    }
+
+    return 0;
+}
+
+/* Close the interface files of a cgroup */
+static void close_cgroup(CgroupEntry &cg)
+{
+    for (int i = 0; i < NR_CGROUP_FILES; i++) {
+        if (cg.fd[i] >= 0) {
+            close(cg.fd[i]);
+        }
+        cg.fd[i] = CG_FD_CLOSED;
+    }
+}
+
+/* Close all cgroups and the subtree root */
+static void close_cgroups()
+{
+    for (std::unordered_map<ino_t, CgroupEntry>::iterator it = g_cgroups.begin();
+            it != g_cgroups.end(); ++it) {
+        close_cgroup(it->second);
+    }
+    g_cgroups.clear();
+    g_cgroup_order.clear();
+
+    if (g_cgroup_root_fd >= 0) {
+        close(g_cgroup_root_fd);
+        g_cgroup_root_fd = -1;
+    }
+}
+
+/*
+ * Walk a cgroup directory and its descendants: cgroups seen for the first
+ * time get their interface files opened, known ones are kept as is.
+ */
+static void walk_cgroup_dir(int dirfd, const std::string &path, int depth)
+{
+    if ((int) g_cgroup_order.size() >= MAX_CGROUP_NR) {
+        return;
+    }
+
+    struct stat st;
+    if (fstat(dirfd, &st) < 0) {
+        return;
+    }
+
+    CgroupEntry &cg = g_cgroups[st.st_ino];
+    if (cg.gen == 0) {
+        /* New cgroup */
+        cg.path = path;
+        memset(cg.stats, 0, sizeof(cg.stats));
+        for (int i = 0; i < NR_CGROUP_FILES; i++) {
+            cg.fd[i] = openat(dirfd, CGROUP_FILES[i], O_RDONLY | O_CLOEXEC);
+            if (cg.fd[i] < 0) {
+                cg.fd[i] = (errno == ENOENT) ? CG_FD_ABSENT : CG_FD_CLOSED;
+            }
+        }
+    }
+    cg.gen = g_cgroup_gen;
+    g_cgroup_order.push_back(st.st_ino);
+
+    if (g_config.cgroup_max_depth >= 0 && depth >= g_config.cgroup_max_depth) {
+        return;
+    }
+
+    int fd = dup(dirfd);
+    DIR *dir;
+    if (fd < 0 || (dir = fdopendir(fd)) == NULL) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return;
+    }
+    /* The dup shares the offset of the kept root fd, left at the end */
+    rewinddir(dir);
+
+    struct dirent *drd;
+    while ((drd = readdir(dir)) != NULL) {
+        if (drd->d_type != DT_DIR || drd->d_name[0] == '.') {
+            continue;
+        }
+        int child;
+        if ((child = openat(dirfd, drd->d_name,
+                        O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0) {
+            continue;
+        }
+        walk_cgroup_dir(child, path.empty() ? std::string(drd->d_name) :
+                path + "/" + drd->d_name, depth + 1);
+        close(child);
+    }
+    closedir(dir);
+}
+
+/*
+ * Register the cgroups of the watched subtree. Those that disappeared
+ * since the previous discovery are dropped. The walk is only redone every
+ * cgroup_rescan_sec, or once a watched cgroup went away.
+ */
+static void discover_cgroups()
+{
+    if (g_config.cgroup_path.empty() || !source_is_live()) {
+        if (!g_cgroups.empty() || g_cgroup_root_fd >= 0) {
+            close_cgroups();
+        }
+        return;
+    }
+
+    long long now = g_clock.now_ms ? g_clock.now_ms() : real_now_ms();
+    if (g_cgroup_root_fd >= 0) {
+        if (!g_cgroup_stale &&
+                now - g_cgroup_walk_ms < g_config.cgroup_rescan_sec * 1000LL) {
+            return;
+        }
+    }
+    else if ((g_cgroup_root_fd = open(g_config.cgroup_path.c_str(),
+                                      O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0) {
+        return;
+    }
+    g_cgroup_walk_ms = now;
+    g_cgroup_stale = false;
+
+    g_cgroup_gen++;
+    g_cgroup_order.clear();
+    walk_cgroup_dir(g_cgroup_root_fd, "", 0);
+
+    for (std::unordered_map<ino_t, CgroupEntry>::iterator it = g_cgroups.begin();
+            it != g_cgroups.end(); ) {
+        if (it->second.gen != g_cgroup_gen) {
+            close_cgroup(it->second);
+            it = g_cgroups.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+/*
+ * Read a cgroup interface file, with pread() on the kept fd, or by
+ * opening it for this read only when it could not be kept open.
+ * RETURNS: number of bytes read, -1 on error.
+ */
+static ssize_t read_cgroup_file(CgroupEntry &cg, int file, char *buf, size_t len)
+{
+    if (cg.fd[file] == CG_FD_ABSENT) {
+        return -1;
+    }
+
+    int fd = cg.fd[file];
+    if (fd == CG_FD_CLOSED) {
+        std::string path = cg.path.empty() ? std::string(CGROUP_FILES[file]) :
+            cg.path + "/" + CGROUP_FILES[file];
+        if ((fd = openat(g_cgroup_root_fd, path.c_str(), O_RDONLY | O_CLOEXEC)) < 0) {
+            g_cgroup_stale |= (errno == ENOENT);
+            return -1;
+        }
+    }
+
+    ssize_t n = pread(fd, buf, len - 1, 0);
+    int err = errno;
+    if (fd != cg.fd[file]) {
+        close(fd);
+    }
+    if (n < 0) {
+        /* Files of a removed cgroup fail with ENODEV */
+        g_cgroup_stale |= (err == ENODEV);
+        return -1;
+    }
+    buf[n] = '\0';
+
+    return n;
+}
+
+/*
+ * Get the values of some keys from a "key value" per line buffer
+ * (cpu.stat, memory.stat...). Values of missing keys are left unchanged.
+ */
+static void parse_kv_buf(const char *buf, const char * const keys[],
+        unsigned long long *values[], int nr_keys)
+{
+    for (const char *line = buf; line && *line; line = strchr(line, '\n')) {
+        line += (*line == '\n');
+        for (int i = 0; i < nr_keys; i++) {
+            size_t len = strlen(keys[i]);
+            if (!strncmp(line, keys[i], len) && line[len] == ' ') {
+                *values[i] = strtoull(line + len + 1, NULL, 10);
+                break;
+            }
+        }
+    }
+}
+
+/* Sum the per-device lines of io.stat ("8:0 rbytes=... wbytes=...") */
+static void parse_cgroup_io_stat(const char *buf, StatsCgroup *st_cg)
+{
+    for (const char *p = buf; (p = strchr(p, '=')) != NULL; p++) {
+        const char *key = p;
+        while (key > buf && key[-1] != ' ') {
+            key--;
+        }
+        unsigned long long value = strtoull(p + 1, NULL, 10);
+        size_t len = p - key;
+        if (len == 6 && !strncmp(key, "rbytes", 6)) {
+            st_cg->rbytes += value;
+        }
+        else if (len == 6 && !strncmp(key, "wbytes", 6)) {
+            st_cg->wbytes += value;
+        }
+        else if (len == 4 && !strncmp(key, "rios", 4)) {
+            st_cg->rios += value;
+        }
+        else if (len == 4 && !strncmp(key, "wios", 4)) {
+            st_cg->wios += value;
+        }
+    }
+}
+
+/* Read stats of every cgroup of the watched subtree */
+static int read_cgroup_stat(int curr)
+{
+    static char buf[16384];
+    for (size_t n = 0; n < g_cgroup_order.size(); n++) {
+        CgroupEntry &cg = g_cgroups[g_cgroup_order[n]];
+        StatsCgroup *st_cg = cg.stats + curr;
+        memset(st_cg, 0, sizeof(StatsCgroup));
+
+        if (read_cgroup_file(cg, CG_CPU_STAT, buf, sizeof(buf)) >= 0) {
+            static const char * const keys[] = {
+                "usage_usec", "user_usec", "system_usec",
+                "nr_throttled", "throttled_usec"
+            };
+            unsigned long long *values[] = {
+                &st_cg->usage_usec, &st_cg->user_usec, &st_cg->system_usec,
+                &st_cg->nr_throttled, &st_cg->throttled_usec
+            };
+            parse_kv_buf(buf, keys, values, 5);
+            st_cg->online = 1;
+        }
+        if (read_cgroup_file(cg, CG_MEMORY_CURRENT, buf, sizeof(buf)) >= 0) {
+            st_cg->memory_current = strtoull(buf, NULL, 10);
+            st_cg->online = 1;
+        }
+        if (read_cgroup_file(cg, CG_MEMORY_STAT, buf, sizeof(buf)) >= 0) {
+            static const char * const keys[] = {
+                "anon", "file", "pgfault", "pgmajfault"
+            };
+            unsigned long long *values[] = {
+                &st_cg->anon, &st_cg->file, &st_cg->pgfault, &st_cg->pgmajfault
+            };
+            parse_kv_buf(buf, keys, values, 4);
+        }
+        if (read_cgroup_file(cg, CG_IO_STAT, buf, sizeof(buf)) >= 0) {
+            parse_cgroup_io_stat(buf, st_cg);
+        }
+        for (int i = 0; i < NR_PSI_RES; i++) {
+            if (read_cgroup_file(cg, CG_CPU_PRESSURE + i, buf, sizeof(buf)) >= 0) {
+                parse_psi_buf(buf, st_cg->psi + i);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Parse a CPU list ("0-3,8-11") and set @node for the CPUs it holds.
+ */
+static void set_cpulist_node(const char *list, int node)
+{
+    const char *p = list;
+    while (*p) {
+        char *end;
+        long first = strtol(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+        }
+        for (long cpu = first; cpu <= last && cpu < MAX_CPU_NR; cpu++) {
+            if (cpu >= 0) {
+                cpu_topology[cpu].node = node;
+            }
+        }
+        p = (*end == ',') ? end + 1 : end;
+        if (p == end && *p) {
+            break;
+        }
+    }
+}
+
+/* Close the files of all NUMA nodes */
+static void close_numa_nodes()
+{
+    for (int i = 0; i < g_node_nr; i++) {
+        if (numa_node[i].meminfo_fd >= 0) {
+            close(numa_node[i].meminfo_fd);
+        }
+        if (numa_node[i].numastat_fd >= 0) {
+            close(numa_node[i].numastat_fd);
+        }
+    }
+    g_node_nr = 0;
+}
+
+/*
+ * Read core, package and NUMA node of every CPU, and open the meminfo
+ * and numastat files of every node. This is done again only when the
+ * number of CPUs changes.
+ */
+static void discover_topology()
+{
+    if (g_topology_cpu_nr == g_cpu_nr) {
+        return;
+    }
+    g_topology_cpu_nr = g_cpu_nr;
+
+    char path[MAX_PF_NAME];
+    char line[64];
+    for (int i = 0; i < MAX_CPU_NR; i++) {
+        CpuTopology *topo = cpu_topology + i;
+        topo->core_id = topo->package_id = topo->node = -1;
+        if (i >= g_cpu_nr) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/cpu%d/%s", SYSFS_DEVCPU, i, S_CORE_ID);
+        if (read_sysfs_line(path, line, sizeof(line)) == 0) {
+            topo->core_id = atoi(line);
+        }
+        snprintf(path, sizeof(path), "%s/cpu%d/%s", SYSFS_DEVCPU, i, S_PACKAGE_ID);
+        if (read_sysfs_line(path, line, sizeof(line)) == 0) {
+            topo->package_id = atoi(line);
+        }
+    }
+
+    close_numa_nodes();
+    DIR *dir;
+    if (!source_is_live() || (dir = opendir(SYSFS_DEVNODE)) == NULL) {
+        /* Kernel built without NUMA support */
+        return;
+    }
+    struct dirent *drd;
+    char cpulist[MAX_PF_NAME];
+    while ((drd = readdir(dir)) != NULL && g_node_nr < MAX_NODE_NR) {
+        int id;
+        if (sscanf(drd->d_name, "node%d", &id) != 1) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s/%s", SYSFS_DEVNODE, drd->d_name, S_CPULIST);
+        if (read_sysfs_line(path, cpulist, sizeof(cpulist)) == 0) {
+            set_cpulist_node(cpulist, id);
+        }
+
+        NumaNode *nn = numa_node + g_node_nr++;
+        nn->id = id;
+        snprintf(path, sizeof(path), "%s/%s/%s", SYSFS_DEVNODE, drd->d_name, S_NODE_MEMINFO);
+        nn->meminfo_fd = open(path, O_RDONLY | O_CLOEXEC);
+        snprintf(path, sizeof(path), "%s/%s/%s", SYSFS_DEVNODE, drd->d_name, S_NUMASTAT);
+        nn->numastat_fd = open(path, O_RDONLY | O_CLOEXEC);
+    }
+    closedir(dir);
+}
+
+/* Read free memory and NUMA allocation stats of every node */
+static int read_node_stat(int curr)
+{
+    static const char * const NUMASTAT_KEYS[] = { "numa_hit", "numa_miss",
+        "numa_foreign", "local_node", "other_node" };
+    char buf[4096];
+
+    for (int i = 0; i < g_node_nr; i++) {
+        NumaNode *nn = numa_node + i;
+        StatsNode *st_node = stats_node[curr] + i;
+        st_node->online = 0;
+
+        ssize_t len;
+        if (nn->meminfo_fd < 0 ||
+                (len = pread(nn->meminfo_fd, buf, sizeof(buf) - 1, 0)) <= 0) {
+            continue;
+        }
+        buf[len] = '\0';
+        for (const char *line = buf; line && *line; line = strchr(line, '\n')) {
+            line += (*line == '\n');
+            /* Node 0 MemFree:         3698804 kB */
+            char key[32];
+            unsigned long long value;
+            if (sscanf(line, "Node %*d %31[^:]: %llu", key, &value) != 2) {
+                continue;
+            }
+            if (!strcmp(key, "MemTotal")) {
+                st_node->mem_total = value;
+            }
+            else if (!strcmp(key, "MemFree")) {
+                st_node->mem_free = value;
+            }
+        }
+
+        unsigned long long *numa[] = { &st_node->numa_hit, &st_node->numa_miss,
+            &st_node->numa_foreign, &st_node->local_node, &st_node->other_node };
+        if (nn->numastat_fd >= 0 &&
+                (len = pread(nn->numastat_fd, buf, sizeof(buf) - 1, 0)) > 0) {
+            buf[len] = '\0';
+            parse_kv_buf(buf, NUMASTAT_KEYS, numa, 5);
+        }
+        st_node->online = 1;
+    }
+
+    return 0;
+}
+
+/* Close the cpufreq and thermal_throttle files of all CPUs */
+static void close_cpufreq()
+{
+    for (int i = 0; i < MAX_CPU_NR && g_cpufreq_cpu_nr >= 0; i++) {
+        CpuFreqFiles *cff = cpu_freq_files + i;
+        if (cff->cur_freq_fd >= 0) {
+            close(cff->cur_freq_fd);
+        }
+        if (cff->core_throttle_fd >= 0) {
+            close(cff->core_throttle_fd);
+        }
+        if (cff->package_throttle_fd >= 0) {
+            close(cff->package_throttle_fd);
+        }
+    }
+    g_cpufreq_cpu_nr = -1;
+}
+
+/* Open a file of /sys/devices/system/cpu/cpu<cpu> */
+static int open_cpu_file(int cpu, const char *file)
+{
+    char path[MAX_PF_NAME];
+    snprintf(path, sizeof(path), "%s/cpu%d/%s", SYSFS_DEVCPU, cpu, file);
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+/* Read the unsigned integer a sysfs attribute fd holds, with pread() */
+static int pread_ull(int fd, unsigned long long *value)
+{
+    char buf[32];
+    ssize_t len = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (len <= 0) {
+        return -1;
+    }
+    buf[len] = '\0';
+    *value = strtoull(buf, NULL, 10);
+    return 0;
+}
+
+/*
+ * Open the scaling_cur_freq and thermal_throttle count files of every
+ * CPU, where the drivers provide them. This is done again only when the
+ * number of CPUs changes.
+ */
+static void discover_cpufreq()
+{
+    if (g_cpufreq_cpu_nr == g_cpu_nr) {
+        return;
+    }
+    close_cpufreq();
+    g_cpufreq_cpu_nr = g_cpu_nr;
+
+    for (int i = 0; i < MAX_CPU_NR; i++) {
+        CpuFreqFiles *cff = cpu_freq_files + i;
+        cff->cur_freq_fd = cff->core_throttle_fd = cff->package_throttle_fd = -1;
+        cff->max_freq = 0;
+        if (i >= g_cpu_nr || !source_is_live()) {
+            /* Kept open files are not captured */
+            continue;
+        }
+        cff->cur_freq_fd = open_cpu_file(i, S_CUR_FREQ);
+        cff->core_throttle_fd = open_cpu_file(i, S_CORE_THROTTLE);
+        cff->package_throttle_fd = open_cpu_file(i, S_PACKAGE_THROTTLE);
+
+        int fd = open_cpu_file(i, S_MAX_FREQ);
+        unsigned long long max_freq;
+        if (fd >= 0) {
+            if (pread_ull(fd, &max_freq) == 0) {
+                cff->max_freq = max_freq;
+            }
+            close(fd);
+        }
+    }
+}
+
+/* Read current clock and thermal throttling counts of every CPU */
+static int read_cpufreq_stat(int curr)
+{
+    for (int i = 0; i < g_cpufreq_cpu_nr && i < MAX_CPU_NR; i++) {
+        CpuFreqFiles *cff = cpu_freq_files + i;
+        StatsCpuFreq *st_freq = stats_cpufreq[curr] + i;
+        int nr = 0;
+        nr += (cff->cur_freq_fd >= 0 &&
+                pread_ull(cff->cur_freq_fd, &st_freq->cur_freq) == 0);
+        nr += (cff->core_throttle_fd >= 0 &&
+                pread_ull(cff->core_throttle_fd, &st_freq->core_throttle) == 0);
+        nr += (cff->package_throttle_fd >= 0 &&
+                pread_ull(cff->package_throttle_fd, &st_freq->package_throttle) == 0);
+        st_freq->online = (nr > 0);
+    }
+
+    return 0;
+}
+
+/* Read a small file relative to /proc with openat() */
+static ssize_t read_proc_file(const char *rel, char *buf, size_t len)
+{
+    int fd;
+    if ((fd = openat(g_proc_dirfd, rel, O_RDONLY | O_CLOEXEC)) < 0) {
+        return -1;
+    }
+    ssize_t n = read(fd, buf, len - 1);
+    close(fd);
+    if (n < 0) {
+        return -1;
+    }
+    buf[n] = '\0';
+
+    return n;
+}
+
+/* Read resident and shared memory (in pages) from /proc/<pid>/statm */
+static void read_pid_statm(ProcessEntry &proc)
+{
+    char rel[32], buf[128];
+    snprintf(rel, sizeof(rel), PID_STATM, proc.pid);
+    if (read_proc_file(rel, buf, sizeof(buf)) > 0) {
+        sscanf(buf, "%*u %lu %lu", &proc.rss, &proc.shared);
+    }
+}
+
+/* Read storage I/O from /proc/<pid>/io (needs ptrace access to the process) */
+static void read_pid_io(ProcessEntry &proc, StatsProcess *st_proc)
+{
+    char rel[32], buf[256];
+    snprintf(rel, sizeof(rel), PID_IO, proc.pid);
+    if (read_proc_file(rel, buf, sizeof(buf)) > 0) {
+        static const char * const keys[] = { "read_bytes:", "write_bytes:" };
+        for (int i = 0; i < 2; i++) {
+            const char *p = strstr(buf, keys[i]);
+            if (p) {
+                unsigned long long v = strtoull(p + strlen(keys[i]), NULL, 10);
+                if (i) {
+                    st_proc->write_bytes = v;
+                }
+                else {
+                    st_proc->read_bytes = v;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Parse /proc/<pid>/stat. The command name may contain spaces and
+ * parentheses: fields are counted from its last closing parenthesis.
+ * RETURNS: 0 on success, -1 on error.
+ */
+static int parse_pid_stat(char *buf, char *comm, StatsProcess *st_proc,
+        unsigned long long *starttime, unsigned long *rss)
+{
+    char *open = strchr(buf, '(');
+    char *close = strrchr(buf, ')');
+    if (open == NULL || close == NULL || close < open) {
+        return -1;
+    }
+    size_t len = std::min((size_t) (close - open - 1), (size_t) MAX_NAME_LEN - 1);
+    memcpy(comm, open + 1, len);
+    comm[len] = '\0';
+
+    /* Field 3 is the state, then numbers from field 4 (ppid) on */
+    char *p = close + 2;
+    if (*p) {
+        p++;
+    }
+    unsigned long long field[25];
+    for (int i = 4; i <= 24; i++) {
+        char *end;
+        field[i] = strtoull(p, &end, 10);
+        if (end == p) {
+            return -1;
+        }
+        p = end;
+    }
+
+    st_proc->minflt = field[10];
+    st_proc->majflt = field[12];
+    st_proc->utime = field[14];
+    st_proc->stime = field[15];
+    *starttime = field[22];
+    *rss = field[24];
+
+    return 0;
+}
+
+/*
+ * Read stats of every process: /proc is listed with getdents64() on a
+ * cached dirfd, and /proc/<pid>/stat read through openat().
+ * Ranking on RSS uses the rss field of stat: statm is only read for the
+ * selected top processes, and io only when ranking on I/O.
+ */
+static int read_process_stat(int curr)
+{
+    if (g_config.proc_top_n <= 0 || !source_is_live()) {
+        return 0;
+    }
+    if (g_proc_dirfd < 0 &&
+            (g_proc_dirfd = open(PROC, O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0) {
+        return -1;
+    }
+    if (lseek(g_proc_dirfd, 0, SEEK_SET) < 0) {
+        return -1;
+    }
+
+    g_proc_gen++;
+
+    static char dents[GETDENTS_BUF_SIZE] __attribute__ ((aligned (8)));
+    char rel[32], buf[1024], comm[MAX_NAME_LEN];
+    long n;
+    while ((n = syscall(SYS_getdents64, g_proc_dirfd, dents, sizeof(dents))) > 0) {
+        for (long off = 0; off < n; ) {
+            struct dirent64 *d = (struct dirent64 *) (dents + off);
+            off += d->d_reclen;
+            if (d->d_name[0] < '1' || d->d_name[0] > '9') {
+                continue;
+            }
+
+            long pid = strtol(d->d_name, NULL, 10);
+            snprintf(rel, sizeof(rel), PID_STAT_REL, pid);
+            if (read_proc_file(rel, buf, sizeof(buf)) <= 0) {
+                /* Process has exited */
+                continue;
+            }
+
+            StatsProcess st_proc;
+            memset(&st_proc, 0, sizeof(st_proc));
+            unsigned long long starttime;
+            unsigned long rss;
+            if (parse_pid_stat(buf, comm, &st_proc, &starttime, &rss) < 0) {
+                continue;
+            }
+
+            ProcessEntry &proc = g_processes[(starttime << 22) | pid];
+            if (!proc.gen) {
+                /* New process */
+                memset(proc.stats, 0, sizeof(proc.stats));
+                proc.pid = pid;
+            }
+            strcpy(proc.comm, comm);
+            proc.gen = g_proc_gen;
+            proc.rss = rss;
+            proc.shared = 0;
+
+            if (g_config.proc_sort_key == PROC_SORT_IO) {
+                read_pid_io(proc, &st_proc);
+            }
+            st_proc.online = 1;
+            proc.stats[curr] = st_proc;
+        }
+    }
+
+    /* Drop processes that have exited */
+    for (std::unordered_map<unsigned long long, ProcessEntry>::iterator it =
+            g_processes.begin(); it != g_processes.end(); ) {
+        if (it->second.gen != g_proc_gen) {
+            it = g_processes.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    return 0;
+}
+
+/* Read stats from /proc/net/rpc/nfs */
+static int read_net_nfs_stat(FileStats &file_stats)
+{
+    FILE *fp;
+    if ((fp = source_fopen(NET_RPC_NFS, "r")) == NULL) {
+        return -1;
+    }
+
+    static char line[256];
+    while (fgets(line, 256, fp) != NULL) {
+        if (!strncmp(line, "rpc", 3))
+            sscanf(line + 3, "%u %u",
+                    &(file_stats.nfs_rpccnt), &(file_stats.nfs_rpcretrans));
+
+        else if (!strncmp(line, "proc3", 5))
+            sscanf(line + 5, "%*u %*u %u %*u %*u %u %*u %u %u",
+                    &(file_stats.nfs_getattcnt), &(file_stats.nfs_accesscnt),
+                    &(file_stats.nfs_readcnt), &(file_stats.nfs_writecnt));
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/* Read stats from /proc/net/rpc/nfsd */
+static int read_net_nfsd_stat(FileStats &file_stats)
+{
+    FILE *fp;
+    if ((fp = source_fopen(NET_RPC_NFSD, "r")) == NULL) {
+        return -1;
+    }
+
+    static char line[256];
+    while (fgets(line, 256, fp) != NULL) {
+        if (!strncmp(line, "rc", 2))
+            sscanf(line + 2, "%u %u",
+                    &(file_stats.nfsd_rchits), &(file_stats.nfsd_rcmisses));
+
+        else if (!strncmp(line, "net", 3))
+            sscanf(line + 3, "%u %u %u",
+                    &(file_stats.nfsd_netcnt), &(file_stats.nfsd_netudpcnt),
+                    &(file_stats.nfsd_nettcpcnt));
+
+        else if (!strncmp(line, "rpc", 3))
+            sscanf(line + 3, "%u %u",
+                    &(file_stats.nfsd_rpccnt), &(file_stats.nfsd_rpcbad));
+
+        else if (!strncmp(line, "proc3", 5))
+            sscanf(line + 5, "%*u %*u %u %*u %*u %u %*u %u %u",
+                    &(file_stats.nfsd_getattcnt), &(file_stats.nfsd_accesscnt),
+                    &(file_stats.nfsd_readcnt), &(file_stats.nfsd_writecnt));
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+/* Init dk_drive* counters (used for sar -b) */
+static void init_dk_drive_stat(FileStats &file_stats)
+{
+    file_stats.dk_drive = 0;
+    file_stats.dk_drive_rio  = file_stats.dk_drive_wio  = 0;
+    file_stats.dk_drive_rblk = file_stats.dk_drive_wblk = 0;
+}
+
+/*
+ * Return the slot of disk_stats[curr] used for device (@major, @minor),
+ * allocating a new one (and incrementing @dsk) if it was not used yet.
+ * RETURNS: NULL if there is no free slot left.
+ */
+static DiskStats *get_disk_slot(int curr, int *dsk,
+        unsigned int major, unsigned int minor)
+{
+    for (int i = 0; i < *dsk; i++) {
+        DiskStats *disk_stats_i = disk_stats[curr] + i;
+        if ((disk_stats_i->major == major) && (disk_stats_i->minor == minor)) {
+            return disk_stats_i;
+        }
+    }
+    if (*dsk >= g_disk_nr) {
+        return NULL;
+    }
+
+    DiskStats *disk_stats_i = disk_stats[curr] + (*dsk)++;
+    memset(disk_stats_i, 0, sizeof(DiskStats));
+    disk_stats_i->major = major;
+    disk_stats_i->minor = minor;
+    return disk_stats_i;
+}
+
+/* Read stats from /proc/diskstats */
+static int read_diskstats_stat(FileStats &file_stats, int curr)
+{
+    FILE *fp;
+    if ((fp = source_fopen(DISKSTATS, "r")) == NULL) {
+        return 0;
+    }
+
+    init_dk_drive_stat(file_stats);
+
+    int dsk = 0;
+    /* Slots whose busy time was read from the holder's own line */
+    bool own_ticks[MAX_DISK_NR] = { false };
+    char line[256];
+    char dev_name[MAX_NAME_LEN];
+    while ((fgets(line, 256, fp) != NULL) && (dsk < g_disk_nr)) {
+        /* Filter on the name token before parsing any counter */
+        size_t len;
+        const char *name = diskstats_name(line, &len);
+        if (name == NULL || !match_name_filter(g_disk_filter, name, len)) {
+            continue;
+        }
+
+        unsigned int major, minor;
+        unsigned long rd_ios, wr_ios, rd_ticks, wr_ticks;
+        unsigned long tot_ticks, rq_ticks;
+        unsigned long long rd_sec, wr_sec;
+        if (sscanf(line, "%u %u %s %lu %*u %llu %lu %lu %*u %llu"
+                    " %lu %*u %lu %lu",
+                    &major, &minor,
+                    dev_name,
+                    &rd_ios, &rd_sec, &rd_ticks, &wr_ios, &wr_sec, &wr_ticks,
+                    &tot_ticks, &rq_ticks) == 11) {
+            /* It's a device and not a partition */
+            if (!rd_ios && !wr_ios) {
+                /* Unused device: ignore it */
+                continue;
+            }
+
+            int blk = find_blk_dev(major, minor);
+            if (!is_blk_dev(blk, g_config.allow_virtual)) {
+                /* not read patitions */;
+                continue;
+            }
+
+            if (blk < 0 || !blk_dev_info[blk].is_virtual) {
+                /*
+                 * Global I/O stats only account for physical devices,
+                 * else I/O going through dm or md would be counted twice.
+                 */
+                file_stats.dk_drive += rd_ios + wr_ios;
+                file_stats.dk_drive_rio += rd_ios;
+                file_stats.dk_drive_rblk += (unsigned int) rd_sec;
+                file_stats.dk_drive_wio += wr_ios;
+                file_stats.dk_drive_wblk += (unsigned int) wr_sec;
+            }
+
+            /*
+             * A rolled up holder keeps its own busy time (the only correct
+             * one, members being busy concurrently) and gets the I/O counts
+             * of its members. Nested holders (eg. LVM on md) only count in
+             * the topmost one.
+             */
+            bool rollup = g_config.allow_virtual && g_config.rollup_holders &&
+                blk >= 0 && (blk_dev_info[blk].nr_members ||
+                             blk_dev_info[blk].holder >= 0);
+            bool holder = rollup && blk_dev_info[blk].nr_members;
+            if (holder && blk_dev_info[blk].holder >= 0) {
+                continue;
+            }
+            if (rollup && !holder) {
+                int top = get_top_holder(blk);
+                major = blk_dev_info[top].major;
+                minor = blk_dev_info[top].minor;
+            }
+
+            DiskStats *disk_stats_i = get_disk_slot(curr, &dsk, major, minor);
+            if (disk_stats_i == NULL) {
+                break;
+            }
+            if (holder) {
+                own_ticks[disk_stats_i - disk_stats[curr]] = true;
+                disk_stats_i->tot_ticks = tot_ticks;
+                disk_stats_i->rq_ticks = rq_ticks;
+                continue;
+            }
+            disk_stats_i->nr_ios += rd_ios + wr_ios;
+            disk_stats_i->rd_sect += rd_sec;
+            disk_stats_i->wr_sect += wr_sec;
+            disk_stats_i->rd_ticks += rd_ticks;
+            disk_stats_i->wr_ticks += wr_ticks;
+            if (!rollup) {
+                disk_stats_i->tot_ticks += tot_ticks;
+                disk_stats_i->rq_ticks += rq_ticks;
+            }
+            else if (!own_ticks[disk_stats_i - disk_stats[curr]]) {
+                /* Until the holder line is read: the busiest member */
+                disk_stats_i->tot_ticks = std::max(disk_stats_i->tot_ticks, tot_ticks);
+                disk_stats_i->rq_ticks += rq_ticks;
+            }
+        }
+    }
+
+    fclose(fp);
+
+    while (dsk < g_disk_nr) {
+        /*
+         * Nb of disks has changed, or appending data to an old file
+         * with more disks than are actually available now.
+         */
+        DiskStats *disk_stats_i = disk_stats[curr] + dsk++;
+        disk_stats_i->major = disk_stats_i->minor = 0;
+    }
+    return 0;
+}
+
+/* Read stats from /proc/partitions */
+/* TODO */
+/* static int read_ppartitions_stat(FileStats &file_stats) */
+
+/*
+ * Read the counters kept in the rate history: FileStats and the per-CPU,
+ * disk and interface tables.
+ */
+static int read_counter_stats(FileStats &file_stats, int curr)
+{
+    int ret = 0;
+    ret += read_proc_stat(file_stats, curr);
+    ret += read_proc_meminfo(file_stats);
+    ret += read_proc_loadavg(file_stats);
+    ret += read_proc_vmstat(file_stats);
+    ret += read_ktables_stat(file_stats);
+    ret += read_net_sock_stat(file_stats);
+    ret += read_net_nfs_stat(file_stats);
+    ret += read_net_nfsd_stat(file_stats);
+    ret += read_diskstats_stat(file_stats, curr);
+    if (g_net_dev_backend == NET_DEV_SYSFS) {
+        ret += read_net_dev_sysfs(curr);
+    }
+    else if (g_net_dev_backend != NET_DEV_NETLINK ||
+            read_net_dev_netlink(curr) < 0) {
+        /* Fall back to /proc/net/dev if rtnetlink is not available */
+        ret += read_net_dev_stat(file_stats, curr);
+    }
+
+    return ret;
+}
+
+/* Timestamp a sample, once all its sources are read */
+static void end_stats(FileStats &file_stats)
+{
+    struct tm rectime;
+    file_stats.ust_time = get_time(rectime);
+    file_stats.hour = rectime.tm_hour;
+    file_stats.minute = rectime.tm_min;
+    file_stats.second = rectime.tm_sec;
+    file_stats.record_type = R_STATS;
+    end_source_frame();
+}
+
+static int read_stats(FileStats &file_stats, int curr)
+{
+    int ret = read_counter_stats(file_stats, curr);
+    ret += read_net_proto_stat(curr);
+    read_softnet_stat(curr);
+    read_schedstat(curr);
+    read_pid_schedstat(curr);
+    read_psi_stat(curr);
+    read_cgroup_stat(curr);
+    read_process_stat(curr);
+    read_netns_stat(curr);
+    read_fs_stat(curr);
+    read_node_stat(curr);
+    read_cpufreq_stat(curr);
+    end_stats(file_stats);
+
+    return ret;
+}
+
+
+
+/*
+ * Set interval value.
+ * g_itv is the interval in jiffies multiplied by the # of proc.
+ * itv is the interval in jiffies.
+ */
+static void get_itv_value(
+        const FileStats &file_stats_curr,
+        const FileStats &file_stats_prev,
+        int nr_proc,
+        unsigned long long *itv, unsigned long long *g_itv)
+{
+    /* Interval value in jiffies */
+    if (!file_stats_prev.uptime) {
+        /*
+         * Stats from boot time to be displayed: only in this case we admit
+         * that the interval (which is unsigned long long) may be greater
+         * than 0xffffffff, else it was an overflow.
+         */
+        *g_itv = file_stats_curr.uptime;
+    }
+    else {
+        *g_itv = (file_stats_curr.uptime - file_stats_prev.uptime) & 0xffffffff;
+    }
+
+    if (!(*g_itv)) {
+        /* Paranoia checking */
+        *g_itv = 1;
+    }
+
+    if (nr_proc > 1) {
+        if (!file_stats_prev.uptime0) {
+            *itv = file_stats_curr.uptime0;
+        }
+        else {
+            *itv = (file_stats_curr.uptime0 - file_stats_prev.uptime0) 
+                & 0xffffffff;
+        }
+
+        if (!(*itv)) {
+            *itv = 1;
+        }
+    }
+    else {
+        *itv = *g_itv;
+    }
+}
+
+
+static int check_iface_reg(StatsNetDev st_net_dev[][MAX_NET_DEV_NR],
+                            short curr, short ref, unsigned int pos)
+{
+    StatsNetDev *st_net_dev_i, *st_net_dev_j;
+    st_net_dev_i = st_net_dev[curr] + pos;
+
+    int index = 0;
+    while (index < g_iface_nr) {
+        st_net_dev_j = st_net_dev[ref] + index;
+        if (!strcmp(st_net_dev_i->interface, st_net_dev_j->interface)) {
+            if (st_net_dev_i->ifindex && st_net_dev_j->ifindex) {
+                /*
+                 * Interface identity is known (netlink backend): a new
+                 * ifindex, or any decreasing 64-bit counter, means that
+                 * the interface was unregistered then registered again.
+                 */
+                if ((st_net_dev_i->ifindex != st_net_dev_j->ifindex) ||
+                        (st_net_dev_i->rx_packets < st_net_dev_j->rx_packets) ||
+                        (st_net_dev_i->tx_packets < st_net_dev_j->tx_packets) ||
+                        (st_net_dev_i->rx_bytes < st_net_dev_j->rx_bytes) ||
+                        (st_net_dev_i->tx_bytes < st_net_dev_j->tx_bytes)) {
+                    memset(st_net_dev_j, 0, sizeof(StatsNetDev));
+                    strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
+                    st_net_dev_j->ifindex = st_net_dev_i->ifindex;
+                }
+                return index;
+            }
+            /*
+             * Network interface found.
              * If a counter has decreased, then we may assume that the
              * corresponding interface was unregistered, then registered again.
              */
@@ -1278,231 +4302,1540 @@ static int check_iface_reg(StatsNetDev st_net_dev[][MAX_NET_DEV_NR],
                     (st_net_dev_i->rx_fifo_errors < st_net_dev_j->rx_fifo_errors) ||
                     (st_net_dev_i->tx_fifo_errors < st_net_dev_j->tx_fifo_errors)) {
 
-                /*
-                 * Special processing for rx_bytes (_packets) and tx_bytes (_packets)
-                 * counters: If the number of bytes (packets) has decreased, whereas
-                 * the number of packets (bytes) has increased, then assume that the
-                 * relevant counter has met an overflow condition, and that the
-                 * interface was not unregistered, which is all the more plausible
-                 * that the previous value for the counter was > ULONG_MAX/2.
-                 * NB: the average value displayed will be wrong in this case...
-                 *
-                 * If such an overflow is detected, just set the flag. There is no
-                 * need to handle this in a special way: the difference is still
-                 * properly calculated if the result is of the same type (i.e.
-                 * unsigned long) as the two values.
-                 */
-                bool ovfw = false;
+                /*
+                 * Special processing for rx_bytes (_packets) and tx_bytes (_packets)
+                 * counters: If the number of bytes (packets) has decreased, whereas
+                 * the number of packets (bytes) has increased, then assume that the
+                 * relevant counter has met an overflow condition, and that the
+                 * interface was not unregistered, which is all the more plausible
+                 * that the previous value for the counter was > ULONG_MAX/2.
+                 * NB: the average value displayed will be wrong in this case...
+                 *
+                 * If such an overflow is detected, just set the flag. There is no
+                 * need to handle this in a special way: the difference is still
+                 * properly calculated if the result is of the same type (i.e.
+                 * unsigned long) as the two values.
+                 */
+                bool ovfw = false;
+
+                if ((st_net_dev_i->rx_bytes < st_net_dev_j->rx_bytes) &&
+                        (st_net_dev_i->rx_packets > st_net_dev_j->rx_packets) &&
+                        (st_net_dev_j->rx_bytes > (~0UL >> 1))) {
+                    ovfw = true;
+                }
+                if ((st_net_dev_i->tx_bytes < st_net_dev_j->tx_bytes) &&
+                        (st_net_dev_i->tx_packets > st_net_dev_j->tx_packets) &&
+                        (st_net_dev_j->tx_bytes > (~0UL >> 1))) {
+                    ovfw = true;
+                }
+                if ((st_net_dev_i->rx_packets < st_net_dev_j->rx_packets) &&
+                        (st_net_dev_i->rx_bytes > st_net_dev_j->rx_bytes) &&
+                        (st_net_dev_j->rx_packets > (~0UL >> 1))) {
+                    ovfw = true;
+                }
+                if ((st_net_dev_i->tx_packets < st_net_dev_j->tx_packets) &&
+                        (st_net_dev_i->tx_bytes > st_net_dev_j->tx_bytes) &&
+                        (st_net_dev_j->tx_packets > (~0UL >> 1))) {
+                    ovfw = true;
+                }
+
+                if (!ovfw) {
+                    /* OK: assume here that the device was actually unregistered */
+                    memset(st_net_dev_j, 0, sizeof(StatsNetDev));
+                    strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
+                }
+            }
+            return index;
+        }
+        index++;
+    }
+
+    /* Network interface not found: Look for the first free structure */
+    for (index = 0; index < g_iface_nr; index++) {
+        st_net_dev_j = st_net_dev[ref] + index;
+        if (!strcmp(st_net_dev_j->interface, "?")) {
+            memset(st_net_dev_j, 0, sizeof(StatsNetDev));
+            strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
+            break;
+        }
+    }
+    if (index >= g_iface_nr) {
+        /* No free structure: Default is structure of same rank */
+        index = pos;
+    }
+
+    st_net_dev_j = st_net_dev[ref] + index;
+    /* Since the name is not the same, reset all the structure */
+    memset(st_net_dev_j, 0, sizeof(StatsNetDev));
+    strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
+
+    return  index;
+}
+
+
+/*
+ * Disks may be registered dynamically (true in /proc/stat file).
+ * This is what we try to guess here.
+ */
+static int check_disk_reg(DiskStats st_disk[][MAX_DISK_NR],
+           short curr, short ref, int pos)
+{
+    DiskStats *st_disk_i, *st_disk_j;
+    int index = 0;
+
+    st_disk_i = st_disk[curr] + pos;
+
+    while (index < g_disk_nr) {
+        st_disk_j = st_disk[ref] + index;
+        if ((st_disk_i->major == st_disk_j->major) &&
+                (st_disk_i->minor == st_disk_j->minor)) {
+            /*
+             * Disk found.
+             * If a counter has decreased, then we may assume that the
+             * corresponding device was unregistered, then registered again.
+             * NB: AFAIK, such a device cannot be unregistered with current
+             * kernels.
+             */
+            if ((st_disk_i->nr_ios < st_disk_j->nr_ios) ||
+                    (st_disk_i->rd_sect < st_disk_j->rd_sect) ||
+                    (st_disk_i->wr_sect < st_disk_j->wr_sect)) {
+
+                memset(st_disk_j, 0, sizeof(DiskStats));
+                st_disk_j->major = st_disk_i->major;
+                st_disk_j->minor = st_disk_i->minor;
+            }
+            return index;
+        }
+        index++;
+    }
+
+    /* Disk not found: Look for the first free structure */
+    for (index = 0; index < g_disk_nr; index++) {
+        st_disk_j = st_disk[ref] + index;
+        if (!(st_disk_j->major + st_disk_j->minor)) {
+            memset(st_disk_j, 0, sizeof(DiskStats));
+            st_disk_j->major = st_disk_i->major;
+            st_disk_j->minor = st_disk_i->minor;
+            break;
+        }
+    }
+    if (index >= g_disk_nr) {
+        /* No free structure found: Default is structure of same rank */
+        index = pos;
+    }
+
+    st_disk_j = st_disk[ref] + index;
+    /* Since the device is not the same, reset all the structure */
+    memset(st_disk_j, 0, sizeof(DiskStats));
+    st_disk_j->major = st_disk_i->major;
+    st_disk_j->minor = st_disk_i->minor;
+
+    return index;
+}
+
+
+/* Size the CPU, disk and interface tables kept in the rate history */
+static int init_counters()
+{
+    memset(stats_one_cpu, 0, sizeof(stats_one_cpu));
+    memset(stats_net_dev, 0, sizeof(stats_net_dev));
+    memset(disk_stats, 0, sizeof(disk_stats));
+
+    g_cpu_nr = get_cpu_nr();
+    discover_blk_devs();
+    g_disk_nr = get_disk_nr();
+    if (g_net_dev_backend == NET_DEV_SYSFS) {
+        /* Watched interfaces are known: no need to scan /proc/net/dev */
+        g_iface_nr = g_sysfs_iface_nr + NR_IFACE_PREALLOC;
+    }
+    else {
+        g_iface_nr = get_net_dev();
+    }
+    /* Interfaces past the slots are not collected (eg. veth of containers) */
+    g_iface_nr = std::min(g_iface_nr, MAX_NET_DEV_NR);
+
+    g_hz = get_HZ();
+    g_shift = get_kb_shift();
+
+    if (g_cpu_nr > MAX_CPU_NR || g_disk_nr > MAX_DISK_NR || 
+        g_hz <= 0 || g_shift < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int init()
+{
+    if (init_counters() < 0) {
+        return -1;
+    }
+    memset(net_proto_stats, 0, sizeof(net_proto_stats));
+    memset(stats_softnet, 0, sizeof(stats_softnet));
+    memset(stats_sched_cpu, 0, sizeof(stats_sched_cpu));
+    memset(stats_sched_task, 0, sizeof(stats_sched_task));
+    memset(stats_psi, 0, sizeof(stats_psi));
+    memset(stats_node, 0, sizeof(stats_node));
+    memset(stats_cpufreq, 0, sizeof(stats_cpufreq));
+
+    discover_topology();
+    discover_cpufreq();
+    discover_sched_tasks();
+    discover_cgroups();
+    discover_netns();
+    discover_mounts();
+
+    return 0;
+}
+
+template <typename T, typename U, typename Q>
+double s_value(T m, U n, Q p)
+{
+    return (((double) ((n) - (m))) / (p) * g_hz);
+}
+template <typename T, typename U, typename Q>
+double sp_value(T m, U n, Q p)
+{
+    return (((double) ((n) - (m))) / (p) * 100);
+}
+
+/*
+ * Handle overflow conditions properly for counters which are read as
+ * unsigned long long, but which can be unsigned long long or
+ * unsigned long only depending on the kernel version used.
+ * @value1 and @value2 being two values successively read for this
+ * counter, if @value2 < @value1 and @value1 <= 0xffffffff, then we can
+ * assume that the counter's type was unsigned long and has overflown, and
+ * so the difference @value2 - @value1 must be casted to this type.
+ * NOTE: These functions should no longer be necessary to handle a particular
+ * stat counter when we can assume that everybody is using a recent kernel
+ * (defining this counter as unsigned long long).
+ */
+static double ll_sp_value(unsigned long long value1, unsigned long long value2,
+        unsigned long long itv)
+{
+    if ((value2 < value1) && (value1 <= 0xffffffff)) {
+        /* Counter's type was unsigned long and has overflown */
+        return ((double) ((value2 - value1) & 0xffffffff)) / itv * 100;
+    }
+    else {
+        return sp_value(value1, value2, itv);
+    }
+}
+static double ll_s_value(unsigned long long value1, unsigned long long value2,
+        unsigned long long itv)
+{
+    if ((value2 < value1) && (value1 <= 0xffffffff)) {
+        /* Counter's type was unsigned long and has overflown */
+        return ((double) ((value2 - value1) & 0xffffffff)) / itv * g_hz;
+    }
+    else {
+        return s_value(value1, value2, itv);
+    }
+}
+
+
+/*
+ * Get the time spent by CPU @cpu in each mode between two samples.
+ * RETURNS: false if the CPU was offline.
+ */
+static bool get_cpu_times(int cpu, int curr, int prev, CpuTimes *t)
+{
+    const StatsOneCpu *sci = stats_one_cpu[curr] + cpu;
+    const StatsOneCpu *scj = stats_one_cpu[prev] + cpu;
+    unsigned long long tot_i = sci->per_cpu_user + sci->per_cpu_nice +
+        sci->per_cpu_system + sci->per_cpu_iowait + sci->per_cpu_steal +
+        sci->per_cpu_idle;
+    unsigned long long tot_j = scj->per_cpu_user + scj->per_cpu_nice +
+        scj->per_cpu_system + scj->per_cpu_iowait + scj->per_cpu_steal +
+        scj->per_cpu_idle;
+    if (tot_i <= tot_j) {
+        /* Offline, or set back online between the samples */
+        return false;
+    }
+
+    t->user = sci->per_cpu_user - scj->per_cpu_user;
+    t->nice = sci->per_cpu_nice - scj->per_cpu_nice;
+    t->system = sci->per_cpu_system - scj->per_cpu_system;
+    t->iowait = sci->per_cpu_iowait - scj->per_cpu_iowait;
+    t->steal = sci->per_cpu_steal - scj->per_cpu_steal;
+    t->idle = sci->per_cpu_idle - scj->per_cpu_idle;
+    t->total = tot_i - tot_j;
+    t->nr_cpus = 1;
+    return true;
+}
+
+static void add_cpu_times(CpuTimes &sum, const CpuTimes &t)
+{
+    sum.user += t.user;
+    sum.nice += t.nice;
+    sum.system += t.system;
+    sum.iowait += t.iowait;
+    sum.steal += t.steal;
+    sum.idle += t.idle;
+    sum.total += t.total;
+    sum.nr_cpus += t.nr_cpus;
+}
+
+/* Set CPU usage of a CPU or group of CPUs, in percent of its time */
+template <typename T>
+void set_cpu_times(T *info, const CpuTimes &t)
+{
+    info->set_cpu_user( sp_value(0ULL, t.user, t.total) );
+    info->set_cpu_nice( sp_value(0ULL, t.nice, t.total) );
+    info->set_cpu_system( sp_value(0ULL, t.system, t.total) );
+    info->set_cpu_iowait( sp_value(0ULL, t.iowait, t.total) );
+    info->set_cpu_steal( sp_value(0ULL, t.steal, t.total) );
+    info->set_cpu_idle( sp_value(0ULL, t.idle, t.total) );
+}
+
+/* Fill PSI message from two successive samples */
+static void set_psi_info(SarInfo_SarPsiInfo *psi, const StatsPsi *spj,
+        const StatsPsi *spi, unsigned long long itv)
+{
+    psi->set_some_avg10( spi->some_avg[0] );
+    psi->set_some_avg60( spi->some_avg[1] );
+    psi->set_some_avg300( spi->some_avg[2] );
+    psi->set_full_avg10( spi->full_avg[0] );
+    psi->set_full_avg60( spi->full_avg[1] );
+    psi->set_full_avg300( spi->full_avg[2] );
+    /* total is in us: this is us of stall per second */
+    psi->set_some_stall( s_value(spj->some_total, spi->some_total, itv) );
+    psi->set_full_stall( s_value(spj->full_total, spi->full_total, itv) );
+}
+
+/* Close PSI trigger fds and the epoll instance waiting on them */
+static void close_psi_triggers()
+{
+    for (int i = 0; i < g_psi_trigger_nr; i++) {
+        close(psi_trigger_fd[i]);
+    }
+    g_psi_trigger_nr = 0;
+    g_trigger_nr = 0;
+
+    if (g_psi_epfd >= 0) {
+        close(g_psi_epfd);
+        g_psi_epfd = -1;
+    }
+}
+
+/* Add fd to the epoll instance waiting for triggers, creating it if needed */
+static int add_trigger_epoll(int fd, unsigned int events)
+{
+    if (g_psi_epfd < 0 && (g_psi_epfd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        return -1;
+    }
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.fd = fd;
+    if (epoll_ctl(g_psi_epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        return -1;
+    }
+    g_trigger_nr++;
+
+    return 0;
+}
+
+/* Unregister a trigger fd flagged with EPOLLERR, closing it if we own it */
+static void remove_trigger(int fd)
+{
+    epoll_ctl(g_psi_epfd, EPOLL_CTL_DEL, fd, NULL);
+    g_trigger_nr--;
+
+    for (int i = 0; i < g_psi_trigger_nr; i++) {
+        if (psi_trigger_fd[i] == fd) {
+            close(fd);
+            psi_trigger_fd[i] = psi_trigger_fd[--g_psi_trigger_nr];
+            return;
+        }
+    }
+    for (int i = 0; i < g_ext_trigger_nr; i++) {
+        if (ext_trigger_fd[i] == fd) {
+            ext_trigger_fd[i] = ext_trigger_fd[--g_ext_trigger_nr];
+            return;
+        }
+    }
+}
+
+/*
+ * Register the configured PSI triggers: each one is written to its own
+ * /proc/pressure/<resource> fd, which the kernel then flags with POLLPRI
+ * whenever the stall threshold is crossed within the window. Stand-in fds
+ * are registered again in the new epoll instance.
+ */
+static void setup_psi_triggers()
+{
+    close_psi_triggers();
+
+    int ext_nr = 0;
+    for (int i = 0; i < g_ext_trigger_nr; i++) {
+        if (add_trigger_epoll(ext_trigger_fd[i], EPOLLPRI | EPOLLIN) == 0) {
+            ext_trigger_fd[ext_nr++] = ext_trigger_fd[i];
+        }
+    }
+    g_ext_trigger_nr = ext_nr;
+
+    char path[MAX_PF_NAME];
+    for (size_t i = 0; i < g_config.psi_triggers.size() &&
+            g_psi_trigger_nr < MAX_PSI_TRIGGER_NR; i++) {
+        const std::string &trigger = g_config.psi_triggers[i];
+        size_t sep = trigger.find(' ');
+        if (sep == std::string::npos) {
+            continue;
+        }
+        std::string res = trigger.substr(0, sep);
+        snprintf(path, sizeof(path), "%s/%s", PRESSURE, res.c_str());
+
+        int fd;
+        if ((fd = open(path, O_RDWR | O_NONBLOCK | O_CLOEXEC)) < 0) {
+            continue;
+        }
+        /* The kernel expects the terminating null byte */
+        const char *spec = trigger.c_str() + sep + 1;
+        if (write(fd, spec, strlen(spec) + 1) < 0 ||
+                add_trigger_epoll(fd, EPOLLPRI) < 0) {
+            close(fd);
+            continue;
+        }
+        psi_trigger_fd[g_psi_trigger_nr++] = fd;
+    }
+}
+
+int add_sar_trigger_fd(int fd)
+{
+    if (g_ext_trigger_nr >= MAX_PSI_TRIGGER_NR ||
+            add_trigger_epoll(fd, EPOLLPRI | EPOLLIN) < 0) {
+        return -1;
+    }
+    ext_trigger_fd[g_ext_trigger_nr++] = fd;
+
+    return 0;
+}
+
+/* Integer field @f of @m as a string */
+static std::string integer_field(const google::protobuf::Message &m,
+        const google::protobuf::FieldDescriptor *f)
+{
+    using google::protobuf::FieldDescriptor;
+    const google::protobuf::Reflection *refl = m.GetReflection();
+
+    switch (f->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+        return std::to_string(refl->GetInt32(m, f));
+    case FieldDescriptor::CPPTYPE_UINT32:
+        return std::to_string(refl->GetUInt32(m, f));
+    case FieldDescriptor::CPPTYPE_INT64:
+        return std::to_string(refl->GetInt64(m, f));
+    default:
+        return std::to_string(refl->GetUInt64(m, f));
+    }
+}
+
+/*
+ * Repeated entries not keyed on their first field: processes and tasks
+ * (comm is not unique) on their pid, namespaces on their inode (pid is 0
+ * for named ones, and any process of the namespace), and cores on their
+ * package and core id (core ids restart on each package).
+ */
+static const struct {
+    const char *field;
+    const char *key[2];
+} entry_keys[] = {
+    { "sar_process_info", { "pid", NULL } },
+    { "sar_task_sched_info", { "pid", NULL } },
+    { "sar_netns_info", { "inode", NULL } },
+    { "sar_core_info", { "package_id", "id" } }
+};
+
+/*
+ * Key of entry @m of repeated field @field: the fields of entry_keys,
+ * joined by '-', else first string field, else first integer field.
+ */
+static std::string entry_key(const google::protobuf::FieldDescriptor *field,
+        const google::protobuf::Message &m)
+{
+    using google::protobuf::FieldDescriptor;
+    const google::protobuf::Descriptor *desc = m.GetDescriptor();
+    const google::protobuf::Reflection *refl = m.GetReflection();
+    const FieldDescriptor *integer = NULL;
+
+    for (size_t i = 0; i < sizeof(entry_keys) / sizeof(entry_keys[0]); i++) {
+        if (field->name() != entry_keys[i].field) {
+            continue;
+        }
+        std::string key;
+        for (int j = 0; j < 2 && entry_keys[i].key[j] != NULL; j++) {
+            const FieldDescriptor *f = desc->FindFieldByName(entry_keys[i].key[j]);
+            if (f == NULL || !refl->HasField(m, f)) {
+                return "";
+            }
+            key += (j ? "-" : "") + integer_field(m, f);
+        }
+        return key;
+    }
+
+    for (int i = 0; i < desc->field_count(); i++) {
+        const FieldDescriptor *f = desc->field(i);
+        if (f->is_repeated() || !refl->HasField(m, f)) {
+            continue;
+        }
+        if (f->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+            return refl->GetString(m, f);
+        }
+        if (integer == NULL && (f->cpp_type() == FieldDescriptor::CPPTYPE_INT32 ||
+                    f->cpp_type() == FieldDescriptor::CPPTYPE_UINT32 ||
+                    f->cpp_type() == FieldDescriptor::CPPTYPE_INT64 ||
+                    f->cpp_type() == FieldDescriptor::CPPTYPE_UINT64)) {
+            integer = f;
+        }
+    }
+    return integer != NULL ? integer_field(m, integer) : "";
+}
+
+static void add_integer_value(std::vector<SarInfoValue> &values,
+        const std::string &name, unsigned long long v, bool is_signed)
+{
+    SarInfoValue val;
+    val.name = name;
+    val.integer = true;
+    val.ivalue = v;
+    val.value = is_signed ? (double) (long long) v : (double) v;
+    values.push_back(val);
+}
+
+static void get_message_values(const std::string &prefix,
+        const google::protobuf::Message &m, std::vector<SarInfoValue> &values)
+{
+    using google::protobuf::FieldDescriptor;
+    const google::protobuf::Reflection *refl = m.GetReflection();
+    std::vector<const FieldDescriptor *> fields;
+
+    refl->ListFields(m, &fields);
+    for (size_t i = 0; i < fields.size(); i++) {
+        const FieldDescriptor *f = fields[i];
+        std::string name = prefix + f->name();
+
+        if (f->is_repeated()) {
+            if (f->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+                continue;
+            }
+            int n = refl->FieldSize(m, f);
+            for (int j = 0; j < n; j++) {
+                const google::protobuf::Message &e = refl->GetRepeatedMessage(m, f, j);
+                std::string key = entry_key(f, e);
+                get_message_values(name + "." + (key.empty() ? std::to_string(j) : key) +
+                        ".", e, values);
+            }
+            continue;
+        }
+
+        SarInfoValue val;
+        switch (f->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            val.name = name;
+            val.integer = false;
+            val.ivalue = 0;
+            val.value = f->cpp_type() == FieldDescriptor::CPPTYPE_DOUBLE ?
+                refl->GetDouble(m, f) : refl->GetFloat(m, f);
+            values.push_back(val);
+            break;
+        case FieldDescriptor::CPPTYPE_INT32:
+            add_integer_value(values, name, (long long) refl->GetInt32(m, f), true);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            add_integer_value(values, name, refl->GetUInt32(m, f), false);
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            add_integer_value(values, name, refl->GetInt64(m, f), true);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            add_integer_value(values, name, refl->GetUInt64(m, f), false);
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            add_integer_value(values, name, refl->GetBool(m, f), false);
+            break;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            get_message_values(name + ".", refl->GetMessage(m, f), values);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void get_sar_info_values(const SarInfo &sar_info, std::vector<SarInfoValue> &values)
+{
+    values.clear();
+    get_message_values("info.", sar_info, values);
+}
+
+/* (Re)allocate the rollup rings, dropping what they held */
+static void setup_rollups()
+{
+    g_rollup_slots.clear();
+    g_rollup_slots.shrink_to_fit();
+    g_rollup_last.clear();
+    g_rollup_names.clear();
+    g_rollup_ids.clear();
+    g_rollup_max = 0;
+    compile_name_filter(g_config.rollup_series, std::vector<std::string>(),
+            g_rollup_filter);
+    if (g_config.rollup_series.empty() || g_config.rollup_max_series <= 0) {
+        return;
+    }
+
+    g_rollup_max = g_config.rollup_max_series;
+    g_rollup_slots.assign((size_t) g_rollup_max * ROLLUP_SLOTS_NR, SarRollupPoint());
+    g_rollup_last.reserve(g_rollup_max);
+    g_rollup_names.reserve(g_rollup_max);
+}
+
+/* Fold the fields @values of a sample taken at @t into the rollups */
+static void add_rollup_sample(const std::vector<SarInfoValue> &values, long long t)
+{
+    for (size_t i = 0; i < values.size(); i++) {
+        const SarInfoValue &val = values[i];
+        unsigned int id;
+        std::unordered_map<std::string, unsigned int>::const_iterator it =
+            g_rollup_ids.find(val.name);
+        if (it != g_rollup_ids.end()) {
+            id = it->second;
+        }
+        else {
+            if (g_rollup_names.size() >= g_rollup_max ||
+                    !match_name_filter(g_rollup_filter, val.name.data(),
+                        val.name.size())) {
+                continue;
+            }
+            id = g_rollup_names.size();
+            g_rollup_ids[val.name] = id;
+            g_rollup_names.push_back(val.name);
+            g_rollup_last.push_back(t);
+        }
+        g_rollup_last[id] = t;
+
+        SarRollupPoint *series = &g_rollup_slots[(size_t) id * ROLLUP_SLOTS_NR];
+        double v = val.value;
+        for (int l = 0; l < SAR_ROLLUP_LEVELS; l++) {
+            long long start = t - t % ROLLUP_LEVELS[l].step;
+            SarRollupPoint &p = series[ROLLUP_LEVELS[l].offset +
+                (start / ROLLUP_LEVELS[l].step) % ROLLUP_LEVELS[l].slots];
+            if (p.t != start || !p.count) {
+                /* Slot reused for a new period */
+                p.t = start;
+                p.count = 0;
+                p.min = p.max = v;
+                p.sum = 0;
+            }
+            p.count++;
+            p.min = v < p.min ? v : p.min;
+            p.max = v > p.max ? v : p.max;
+            p.sum += v;
+            p.last = v;
+        }
+    }
+}
+
+int get_sar_rollup(const std::string &series, int level,
+        std::vector<SarRollupPoint> &points)
+{
+    points.clear();
+    std::unordered_map<std::string, unsigned int>::const_iterator it =
+        g_rollup_ids.find(series);
+    if (it == g_rollup_ids.end() || level < 0 || level >= SAR_ROLLUP_LEVELS) {
+        return -1;
+    }
+
+    int step = ROLLUP_LEVELS[level].step;
+    int slots = ROLLUP_LEVELS[level].slots;
+    const SarRollupPoint *ring = &g_rollup_slots[(size_t) it->second * ROLLUP_SLOTS_NR +
+        ROLLUP_LEVELS[level].offset];
+    long long last = g_rollup_last[it->second];
+    long long newest = last - last % step;
+    for (long long start = newest - (long long) (slots - 1) * step; start <= newest;
+            start += step) {
+        const SarRollupPoint &p = ring[(start / step) % slots];
+        if (p.count && p.t == start) {
+            points.push_back(p);
+        }
+    }
+    return 0;
+}
+
+void get_sar_rollup_series(std::vector<std::string> &series)
+{
+    series = g_rollup_names;
+}
+
+/* Smaller magnitudes are counted as 0, larger ones clamped */
+const double SKETCH_MIN_VALUE = 1e-9;
+const double SKETCH_MAX_VALUE = 1e18;
+
+static void sketch_init(DDSketch &sk, double alpha)
+{
+    sk = DDSketch();
+    sk.gamma = (1 + alpha) / (1 - alpha);
+    sk.inv_log_gamma = 1 / log(sk.gamma);
+}
+
+/* Add @n (1, or -1 to take back) to bucket @i */
+static void sketch_store_add(SketchStore &st, int i, int n)
+{
+    int size = st.counts.size();
+    if (!size) {
+        st.offset = i;
+        st.counts.assign(1, 0);
+    }
+    else if (i < st.offset) {
+        /* Grow downwards with some slack, values tend to drift */
+        int grow = st.offset - i + size / 2;
+        st.counts.insert(st.counts.begin(), grow, 0);
+        st.offset -= grow;
+    }
+    else if (i >= st.offset + size) {
+        st.counts.resize(i - st.offset + 1, 0);
+    }
+    st.counts[i - st.offset] += n;
+}
+
+static void sketch_add(DDSketch &sk, double v, int n)
+{
+    double mag = fabs(v);
+    if (mag < SKETCH_MIN_VALUE) {
+        sk.zero += n;
+    }
+    else {
+        int i = (int) ceil(log(std::min(mag, SKETCH_MAX_VALUE)) * sk.inv_log_gamma);
+        sketch_store_add(v > 0 ? sk.positive : sk.negative, i, n);
+    }
+    sk.count += n;
+}
+
+/*
+ * Value of the @q quantile (0-1) of the @count values of a non empty
+ * sketch, from its negative buckets, zero count and positive buckets.
+ */
+template <typename T>
+static double bucket_quantile(double gamma, const T *neg, int neg_nr, int neg_offset,
+        unsigned long long zero, const T *pos, int pos_nr, int pos_offset,
+        unsigned long long count, double q)
+{
+    q = std::min(std::max(q, 0.0), 1.0);
+    unsigned long long rank = (unsigned long long) (q * (count - 1));
+    unsigned long long seen = 0;
+
+    /* Negative values first, largest magnitude first */
+    for (int i = neg_nr; i-- > 0; ) {
+        seen += neg[i];
+        if (seen > rank) {
+            return -2 * pow(gamma, i + neg_offset) / (gamma + 1);
+        }
+    }
+    seen += zero;
+    if (seen > rank) {
+        return 0;
+    }
+    for (int i = 0; i < pos_nr; i++) {
+        seen += pos[i];
+        if (seen > rank) {
+            return 2 * pow(gamma, i + pos_offset) / (gamma + 1);
+        }
+    }
+    return 2 * pow(gamma, pos_nr - 1 + pos_offset) / (gamma + 1);
+}
+
+static double sketch_quantile(const DDSketch &sk, double q)
+{
+    return bucket_quantile(sk.gamma, sk.negative.counts.data(),
+            (int) sk.negative.counts.size(), sk.negative.offset, sk.zero,
+            sk.positive.counts.data(), (int) sk.positive.counts.size(),
+            sk.positive.offset, sk.count, q);
+}
+
+/* Copy the non zero range of buckets @st to a sketch message */
+static void sketch_store_export(const SketchStore &st, google::protobuf::int32 *offset,
+        google::protobuf::RepeatedField<uint64_t> *counts)
+{
+    size_t lo = 0;
+    size_t hi = st.counts.size();
+    while (lo < hi && !st.counts[lo]) {
+        lo++;
+    }
+    while (hi > lo && !st.counts[hi - 1]) {
+        hi--;
+    }
+    *offset = st.offset + (int) lo;
+    counts->Reserve(hi - lo);
+    for (size_t i = lo; i < hi; i++) {
+        counts->AddAlreadyReserved(st.counts[i]);
+    }
+}
+
+/* Drop the window sketches, to start over with the current config */
+static void setup_sketches()
+{
+    g_sketches.clear();
+    if (g_config.summary_window <= 0 || !(g_config.summary_accuracy > 0) ||
+            !(g_config.summary_accuracy < 1)) {
+        return;
+    }
+
+    g_sketches.resize(g_config.sketch_series.size());
+    for (size_t i = 0; i < g_sketches.size(); i++) {
+        WindowSketch &ws = g_sketches[i];
+        ws.name = g_config.sketch_series[i];
+        compile_name_filter(std::vector<std::string>(1, ws.name),
+                std::vector<std::string>(), ws.filter);
+        ws.samples.resize(g_config.summary_window);
+        sketch_init(ws.sketch, g_config.summary_accuracy);
+    }
+}
+
+/* Add the fields @values of a sample to the window sketches, export them */
+static void add_sketch_sample(const std::vector<SarInfoValue> &values, SarInfo &sar_info)
+{
+    for (size_t k = 0; k < g_sketches.size(); k++) {
+        WindowSketch &ws = g_sketches[k];
+        unsigned int size = ws.samples.size();
+        SketchSample &smp = ws.samples[ws.head];
+
+        if (ws.nr == size) {
+            /* Drop the oldest sample */
+            for (size_t i = 0; i < smp.values.size(); i++) {
+                sketch_add(ws.sketch, smp.values[i], -1);
+            }
+        }
+        else {
+            ws.nr++;
+        }
+        smp.values.clear();
+        smp.min = INFINITY;
+        smp.max = -INFINITY;
+        smp.sum = 0;
+        for (size_t i = 0; i < values.size(); i++) {
+            double v = values[i].value;
+            if (!std::isfinite(v) || !match_name_filter(ws.filter,
+                        values[i].name.data(), values[i].name.size())) {
+                continue;
+            }
+            smp.values.push_back(v);
+            smp.min = std::min(smp.min, v);
+            smp.max = std::max(smp.max, v);
+            smp.sum += v;
+            sketch_add(ws.sketch, v, 1);
+        }
+        ws.head = (ws.head + 1) % size;
+        if (!ws.sketch.count) {
+            continue;
+        }
+
+        SarInfo::SarSketch *sketch = sar_info.add_sar_sketch();
+        double min = INFINITY;
+        double max = -INFINITY;
+        double sum = 0;
+        for (unsigned int i = 0; i < size; i++) {
+            if (!ws.samples[i].values.empty()) {
+                min = std::min(min, ws.samples[i].min);
+                max = std::max(max, ws.samples[i].max);
+                sum += ws.samples[i].sum;
+            }
+        }
+        sketch->set_name(ws.name);
+        sketch->set_relative_accuracy(g_config.summary_accuracy);
+        sketch->set_count(ws.sketch.count);
+        sketch->set_sum(sum);
+        sketch->set_min(min);
+        sketch->set_max(max);
+        sketch->set_zero_count(ws.sketch.zero);
+        google::protobuf::int32 offset;
+        if (!ws.sketch.positive.counts.empty()) {
+            sketch_store_export(ws.sketch.positive, &offset, sketch->mutable_counts());
+            sketch->set_offset(offset);
+        }
+        if (!ws.sketch.negative.counts.empty()) {
+            sketch_store_export(ws.sketch.negative, &offset,
+                    sketch->mutable_negative_counts());
+            sketch->set_negative_offset(offset);
+        }
+    }
+}
+
+/* Add buckets @from, starting at index @from_offset, to buckets @into */
+static void merge_sketch_buckets(google::protobuf::RepeatedField<uint64_t> &into,
+        int &offset, const google::protobuf::RepeatedField<uint64_t> &from,
+        int from_offset)
+{
+    if (from.empty()) {
+        return;
+    }
+    if (into.empty()) {
+        into = from;
+        offset = from_offset;
+        return;
+    }
+
+    int lo = std::min(offset, from_offset);
+    int hi = std::max(offset + into.size(), from_offset + from.size());
+    if (lo < offset || hi > offset + into.size()) {
+        /* Widen @into to both ranges */
+        google::protobuf::RepeatedField<uint64_t> wide;
+        wide.Resize(hi - lo, 0);
+        std::copy(into.begin(), into.end(), wide.begin() + (offset - lo));
+        into.Swap(&wide);
+        offset = lo;
+    }
+    uint64_t *dst = into.mutable_data() + (from_offset - offset);
+    const uint64_t *src = from.data();
+    for (int i = 0; i < from.size(); i++) {
+        dst[i] += src[i];
+    }
+}
+
+int merge_sar_sketch(SarInfo::SarSketch &into, const SarInfo::SarSketch &from)
+{
+    if (!from.count()) {
+        return 0;
+    }
+    if (!into.count()) {
+        std::string name = into.name();
+        into = from;
+        if (!name.empty()) {
+            into.set_name(name);
+        }
+        return 0;
+    }
+    if (into.relative_accuracy() != from.relative_accuracy()) {
+        return -1;
+    }
+
+    into.set_count(into.count() + from.count());
+    into.set_sum(into.sum() + from.sum());
+    into.set_min(std::min(into.min(), from.min()));
+    into.set_max(std::max(into.max(), from.max()));
+    into.set_zero_count(into.zero_count() + from.zero_count());
+    int offset = into.offset();
+    merge_sketch_buckets(*into.mutable_counts(), offset, from.counts(), from.offset());
+    into.set_offset(offset);
+    offset = into.negative_offset();
+    merge_sketch_buckets(*into.mutable_negative_counts(), offset, from.negative_counts(),
+            from.negative_offset());
+    into.set_negative_offset(offset);
+    return 0;
+}
 
-                if ((st_net_dev_i->rx_bytes < st_net_dev_j->rx_bytes) &&
-                        (st_net_dev_i->rx_packets > st_net_dev_j->rx_packets) &&
-                        (st_net_dev_j->rx_bytes > (~0UL >> 1))) {
-                    ovfw = true;
-                }
-                if ((st_net_dev_i->tx_bytes < st_net_dev_j->tx_bytes) &&
-                        (st_net_dev_i->tx_packets > st_net_dev_j->tx_packets) &&
-                        (st_net_dev_j->tx_bytes > (~0UL >> 1))) {
-                    ovfw = true;
-                }
-                if ((st_net_dev_i->rx_packets < st_net_dev_j->rx_packets) &&
-                        (st_net_dev_i->rx_bytes > st_net_dev_j->rx_bytes) &&
-                        (st_net_dev_j->rx_packets > (~0UL >> 1))) {
-                    ovfw = true;
-                }
-                if ((st_net_dev_i->tx_packets < st_net_dev_j->tx_packets) &&
-                        (st_net_dev_i->tx_bytes > st_net_dev_j->tx_bytes) &&
-                        (st_net_dev_j->tx_packets > (~0UL >> 1))) {
-                    ovfw = true;
-                }
+double get_sar_sketch_quantile(const SarInfo::SarSketch &sketch, double q)
+{
+    double alpha = sketch.relative_accuracy();
+    if (!sketch.count() || !(alpha > 0) || !(alpha < 1)) {
+        return 0;
+    }
 
-                if (!ovfw) {
-                    /* OK: assume here that the device was actually unregistered */
-                    memset(st_net_dev_j, 0, sizeof(StatsNetDev));
-                    strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
-                }
+    double v = bucket_quantile((1 + alpha) / (1 - alpha), sketch.negative_counts().data(),
+            sketch.negative_counts_size(), sketch.negative_offset(), sketch.zero_count(),
+            sketch.counts().data(), sketch.counts_size(), sketch.offset(), sketch.count(), q);
+    /* The extremes are known exactly */
+    return std::min(std::max(v, sketch.min()), sketch.max());
+}
+
+/* Drop the summaries, to start over with the current config */
+static void setup_summaries()
+{
+    g_summaries.clear();
+    g_summaries.shrink_to_fit();
+    g_summary_ids.clear();
+    g_summary_names.clear();
+    g_summary_max = 0;
+    compile_name_filter(g_config.summary_series, std::vector<std::string>(),
+            g_summary_filter);
+    if (g_config.summary_series.empty() || g_config.summary_max_series <= 0 ||
+            g_config.summary_window <= 0 || !(g_config.summary_accuracy > 0) ||
+            !(g_config.summary_accuracy < 1)) {
+        return;
+    }
+
+    g_summary_max = g_config.summary_max_series;
+    g_summaries.reserve(g_summary_max);
+    g_summary_names.reserve(g_summary_max);
+}
+
+/* Slide the window of @sum by one value */
+static void add_summary_value(RollingSummary &sum, double v)
+{
+    unsigned int size = sum.window.size();
+    unsigned long long seq = sum.seq++;
+
+    if (sum.nr < size) {
+        sum.nr++;
+        double d = v - sum.mean;
+        sum.mean += d / sum.nr;
+        sum.m2 += d * (v - sum.mean);
+    }
+    else {
+        /* Replace the oldest value */
+        double old = sum.window[sum.head];
+        double mean = sum.mean;
+        sum.mean += (v - old) / size;
+        sum.m2 += (v - old) * (v - sum.mean + old - mean);
+        sketch_add(sum.sketch, old, -1);
+    }
+    sum.window[sum.head] = v;
+    sketch_add(sum.sketch, v, 1);
+    if (++sum.head == size) {
+        sum.head = 0;
+        if (sum.nr == size) {
+            /* Once per window, start again from exact sums against drift */
+            double total = 0;
+            for (unsigned int i = 0; i < size; i++) {
+                total += sum.window[i];
+            }
+            sum.mean = total / size;
+            sum.m2 = 0;
+            for (unsigned int i = 0; i < size; i++) {
+                double d = sum.window[i] - sum.mean;
+                sum.m2 += d * d;
             }
-            return index;
         }
-        index++;
     }
 
-    /* Network interface not found: Look for the first free structure */
-    for (index = 0; index < g_iface_nr; index++) {
-        st_net_dev_j = st_net_dev[ref] + index;
-        if (!strcmp(st_net_dev_j->interface, "?")) {
-            memset(st_net_dev_j, 0, sizeof(StatsNetDev));
-            strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
-            break;
+    while (!sum.mins.empty() && sum.mins.back().second >= v) {
+        sum.mins.pop_back();
+    }
+    sum.mins.push_back(std::make_pair(seq, v));
+    while (!sum.maxs.empty() && sum.maxs.back().second <= v) {
+        sum.maxs.pop_back();
+    }
+    sum.maxs.push_back(std::make_pair(seq, v));
+    if (sum.mins.front().first + size <= seq) {
+        sum.mins.pop_front();
+    }
+    if (sum.maxs.front().first + size <= seq) {
+        sum.maxs.pop_front();
+    }
+}
+
+/* Add the fields @values of a sample to the summaries */
+static void add_summary_sample(const std::vector<SarInfoValue> &values)
+{
+    for (size_t i = 0; i < values.size(); i++) {
+        const SarInfoValue &val = values[i];
+        if (!std::isfinite(val.value)) {
+            continue;
+        }
+        unsigned int id;
+        std::unordered_map<std::string, unsigned int>::const_iterator it =
+            g_summary_ids.find(val.name);
+        if (it != g_summary_ids.end()) {
+            id = it->second;
+        }
+        else {
+            if (g_summary_names.size() >= g_summary_max ||
+                    !match_name_filter(g_summary_filter, val.name.data(),
+                        val.name.size())) {
+                continue;
+            }
+            id = g_summary_names.size();
+            g_summary_ids[val.name] = id;
+            g_summary_names.push_back(val.name);
+            g_summaries.push_back(RollingSummary());
+            g_summaries[id].window.assign(g_config.summary_window, 0);
+            sketch_init(g_summaries[id].sketch, g_config.summary_accuracy);
         }
+        add_summary_value(g_summaries[id], val.value);
     }
-    if (index >= g_iface_nr) {
-        /* No free structure: Default is structure of same rank */
-        index = pos;
+}
+
+int get_sar_summary(const std::string &series, const std::vector<double> &quantiles,
+        SarSummary &summary)
+{
+    summary = SarSummary();
+    std::unordered_map<std::string, unsigned int>::const_iterator it =
+        g_summary_ids.find(series);
+    if (it == g_summary_ids.end()) {
+        return -1;
     }
 
-    st_net_dev_j = st_net_dev[ref] + index;
-    /* Since the name is not the same, reset all the structure */
-    memset(st_net_dev_j, 0, sizeof(StatsNetDev));
-    strcpy(st_net_dev_j->interface, st_net_dev_i->interface);
+    const RollingSummary &sum = g_summaries[it->second];
+    summary.count = sum.nr;
+    summary.min = sum.mins.front().second;
+    summary.max = sum.maxs.front().second;
+    summary.mean = sum.mean;
+    summary.stddev = sqrt(std::max(sum.m2, 0.0) / sum.nr);
+    for (size_t i = 0; i < quantiles.size(); i++) {
+        /* The extremes are known exactly */
+        double v = sketch_quantile(sum.sketch, quantiles[i]);
+        summary.quantiles.push_back(std::min(std::max(v, summary.min), summary.max));
+    }
+    return 0;
+}
 
-    return  index;
+void get_sar_summary_series(std::vector<std::string> &series)
+{
+    series = g_summary_names;
 }
 
+void set_sar_config(const SarConfig &config)
+{
+    bool new_roots = config.proc_root != g_config.proc_root ||
+        config.sys_root != g_config.sys_root;
+    bool new_rollups = config.rollup_series != g_config.rollup_series ||
+        config.rollup_max_series != g_config.rollup_max_series;
+    bool new_history = config.rate_history != g_config.rate_history;
+    bool new_summaries = config.summary_series != g_config.summary_series ||
+        config.summary_window != g_config.summary_window ||
+        config.summary_max_series != g_config.summary_max_series ||
+        config.summary_accuracy != g_config.summary_accuracy;
+    bool new_sketches = config.sketch_series != g_config.sketch_series ||
+        config.summary_window != g_config.summary_window ||
+        config.summary_accuracy != g_config.summary_accuracy;
+    g_config = config;
+    resolve_paths();
+    if (new_roots) {
+        /* Drop what was discovered or kept open under the previous roots */
+        g_net_proto_mapped = false;
+        g_snmp_map.clear();
+        g_netstat_map.clear();
+        g_topology_cpu_nr = -1;
+        close_numa_nodes();
+        if (g_proc_dirfd >= 0) {
+            close(g_proc_dirfd);
+            g_proc_dirfd = -1;
+        }
+        g_processes.clear();
+    }
+
+    compile_name_filter(config.iface_include, config.iface_exclude,
+            g_iface_filter);
+    compile_name_filter(config.disk_include, config.disk_exclude,
+            g_disk_filter);
+    compile_name_filter(config.mount_include, config.mount_exclude,
+            g_mount_filter);
+
+    setup_net_dev_backend();
+    setup_psi_triggers();
+
+    /* The watched subtree may have changed: walk it again from scratch */
+    close_cgroups();
+    /* Same for the namespaces, whose workers are only kept while enabled */
+    g_netns_stale = true;
+    if (!config.netns_sources) {
+        stop_netns_pool();
+    }
+    /* Same for the mount selection */
+    close_mounts();
+    close_cpufreq();
+
+    if (new_rollups) {
+        setup_rollups();
+    }
+    if (new_summaries) {
+        setup_summaries();
+    }
+    if (new_sketches) {
+        setup_sketches();
+    }
+    if (new_history) {
+        g_history.assign(std::max(g_config.rate_history, 0), CounterSnapshot());
+        g_history.shrink_to_fit();
+        g_history_head = g_history_nr = 0;
+    }
+}
 
 /*
- * Disks may be registered dynamically (true in /proc/stat file).
- * This is what we try to guess here.
+ * Size of the records of an archive: padded so that the FileStats of the
+ * next record stays 16-byte aligned after the StatsNetDev
  */
-static int check_disk_reg(DiskStats st_disk[][MAX_DISK_NR],
-           short curr, short ref, int pos)
+static unsigned int archive_record_size(const SarArchiveHeader &hdr)
 {
-    DiskStats *st_disk_i, *st_disk_j;
-    int index = 0;
+    size_t size = sizeof(FileStats) + hdr.cpu_nr * sizeof(StatsOneCpu) +
+        hdr.disk_nr * sizeof(DiskStats) + hdr.iface_nr * sizeof(StatsNetDev);
+    return (size + 15) & ~15UL;
+}
 
-    st_disk_i = st_disk[curr] + pos;
+/*
+ * Check the header of an archive of @size bytes: the inventory and the
+ * records it describes must lie within the file.
+ */
+static bool archive_header_valid(const SarArchiveHeader &hdr, off_t size)
+{
+    if (memcmp(hdr.magic, SAR_ARCHIVE_MAGIC, sizeof(hdr.magic)) ||
+            hdr.version != SAR_ARCHIVE_VERSION ||
+            hdr.cpu_nr < 0 || hdr.cpu_nr > MAX_CPU_NR ||
+            hdr.disk_nr < 0 || hdr.disk_nr > MAX_DISK_NR ||
+            hdr.iface_nr < 0 || hdr.iface_nr > MAX_NET_DEV_NR ||
+            hdr.record_size != archive_record_size(hdr)) {
+        return false;
+    }
+    size_t inventory = sizeof(hdr) + hdr.disk_nr * sizeof(SarArchiveDisk) +
+        hdr.iface_nr * sizeof(SarArchiveIface);
+    return inventory <= hdr.header_size && (off_t) hdr.header_size <= size;
+}
 
-    while (index < g_disk_nr) {
-        st_disk_j = st_disk[ref] + index;
-        if ((st_disk_i->major == st_disk_j->major) &&
-                (st_disk_i->minor == st_disk_j->minor)) {
-            /*
-             * Disk found.
-             * If a counter has decreased, then we may assume that the
-             * corresponding device was unregistered, then registered again.
-             * NB: AFAIK, such a device cannot be unregistered with current
-             * kernels.
-             */
-            if ((st_disk_i->nr_ios < st_disk_j->nr_ios) ||
-                    (st_disk_i->rd_sect < st_disk_j->rd_sect) ||
-                    (st_disk_i->wr_sect < st_disk_j->wr_sect)) {
+/*
+ * Write the header of a new archive, with the devices of the sample
+ * @curr as inventory.
+ */
+static int write_archive_header(const FileStats &file_stats, int curr)
+{
+    SarArchiveHeader &hdr = g_archive_hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, SAR_ARCHIVE_MAGIC, sizeof(hdr.magic));
+    hdr.version = SAR_ARCHIVE_VERSION;
+    hdr.hz = g_hz;
+    hdr.cpu_nr = std::min(g_cpu_nr, MAX_CPU_NR);
+    hdr.day_start = file_stats.ust_time - file_stats.ust_time % 86400;
+    struct utsname uts;
+    if (uname(&uts) == 0) {
+        snprintf(hdr.nodename, sizeof(hdr.nodename), "%s", uts.nodename);
+        snprintf(hdr.sysname, sizeof(hdr.sysname), "%s", uts.sysname);
+        snprintf(hdr.release, sizeof(hdr.release), "%s", uts.release);
+        snprintf(hdr.machine, sizeof(hdr.machine), "%s", uts.machine);
+    }
 
-                memset(st_disk_j, 0, sizeof(DiskStats));
-                st_disk_j->major = st_disk_i->major;
-                st_disk_j->minor = st_disk_i->minor;
-            }
-            return index;
+    g_archive_disks.clear();
+    for (int i = 0; i < g_disk_nr; i++) {
+        const DiskStats *sdi = disk_stats[curr] + i;
+        if (!sdi->major && !sdi->minor) {
+            continue;
         }
-        index++;
+        SarArchiveDisk disk;
+        memset(&disk, 0, sizeof(disk));
+        disk.major = sdi->major;
+        disk.minor = sdi->minor;
+        strncpy(disk.name, get_devname(sdi->major, sdi->minor, 1),
+                SAR_ARCHIVE_NAME_LEN - 1);
+        g_archive_disks.push_back(disk);
+    }
+    g_archive_ifaces.clear();
+    for (int i = 0; i < g_iface_nr; i++) {
+        const StatsNetDev *sndi = stats_net_dev[curr] + i;
+        if (!sndi->interface[0] || !strcmp(sndi->interface, "?")) {
+            continue;
+        }
+        SarArchiveIface iface;
+        memset(&iface, 0, sizeof(iface));
+        strcpy(iface.name, sndi->interface);
+        g_archive_ifaces.push_back(iface);
+    }
+    hdr.disk_nr = g_archive_disks.size();
+    hdr.iface_nr = g_archive_ifaces.size();
+
+    /* Keep records 16-byte aligned, as FileStats is */
+    size_t inventory = hdr.disk_nr * sizeof(SarArchiveDisk) +
+        hdr.iface_nr * sizeof(SarArchiveIface);
+    hdr.header_size = (sizeof(hdr) + inventory + 15) & ~15UL;
+    hdr.record_size = archive_record_size(hdr);
+
+    std::vector<char> buf(hdr.header_size, 0);
+    memcpy(&buf[0], &hdr, sizeof(hdr));
+    if (hdr.disk_nr) {
+        memcpy(&buf[sizeof(hdr)], &g_archive_disks[0],
+                hdr.disk_nr * sizeof(SarArchiveDisk));
+    }
+    if (hdr.iface_nr) {
+        memcpy(&buf[sizeof(hdr) + hdr.disk_nr * sizeof(SarArchiveDisk)],
+                &g_archive_ifaces[0], hdr.iface_nr * sizeof(SarArchiveIface));
+    }
+    if (pwrite(g_archive_fd, &buf[0], buf.size(), 0) != (ssize_t) buf.size()) {
+        return -1;
+    }
+    g_archive_new = false;
+    return 0;
+}
+
+/*
+ * Append a record to the archive: @file_stats, and the per-CPU, disk and
+ * interface stats of sample @curr, laid out after the inventory. A NULL
+ * @file_stats appends a restart (R_DUMMY) record dated now.
+ */
+static int append_archive_record(const FileStats *file_stats, int curr)
+{
+    if (file_stats != NULL && g_archive_new &&
+            write_archive_header(*file_stats, curr) < 0) {
+        return -1;
     }
+    const SarArchiveHeader &hdr = g_archive_hdr;
+    std::vector<char> buf(hdr.record_size, 0);
+    FileStats *fs = (FileStats *) &buf[0];
+
+    if (file_stats == NULL) {
+        struct tm rectime;
+        fs->ust_time = get_time(rectime);
+        fs->hour = rectime.tm_hour;
+        fs->minute = rectime.tm_min;
+        fs->second = rectime.tm_sec;
+        fs->record_type = R_DUMMY;
+    }
+    else {
+        *fs = *file_stats;
+        StatsOneCpu *cpus = (StatsOneCpu *) (fs + 1);
+        memcpy(cpus, stats_one_cpu[curr],
+                std::min(hdr.cpu_nr, MAX_CPU_NR) * sizeof(StatsOneCpu));
+
+        DiskStats *disks = (DiskStats *) (cpus + hdr.cpu_nr);
+        for (int slot = 0; slot < hdr.disk_nr; slot++) {
+            for (int i = 0; i < g_disk_nr; i++) {
+                const DiskStats *sdi = disk_stats[curr] + i;
+                if (sdi->major == g_archive_disks[slot].major &&
+                        sdi->minor == g_archive_disks[slot].minor) {
+                    disks[slot] = *sdi;
+                    break;
+                }
+            }
+        }
 
-    /* Disk not found: Look for the first free structure */
-    for (index = 0; index < g_disk_nr; index++) {
-        st_disk_j = st_disk[ref] + index;
-        if (!(st_disk_j->major + st_disk_j->minor)) {
-            memset(st_disk_j, 0, sizeof(DiskStats));
-            st_disk_j->major = st_disk_i->major;
-            st_disk_j->minor = st_disk_i->minor;
-            break;
+        StatsNetDev *ifaces = (StatsNetDev *) (disks + hdr.disk_nr);
+        for (int slot = 0; slot < hdr.iface_nr; slot++) {
+            for (int i = 0; i < g_iface_nr; i++) {
+                const StatsNetDev *sndi = stats_net_dev[curr] + i;
+                if (!strcmp(sndi->interface, g_archive_ifaces[slot].name)) {
+                    ifaces[slot] = *sndi;
+                    break;
+                }
+            }
         }
     }
-    if (index >= g_disk_nr) {
-        /* No free structure found: Default is structure of same rank */
-        index = pos;
+
+    off_t off = hdr.header_size + (off_t) g_archive_nr * hdr.record_size;
+    if (pwrite(g_archive_fd, &buf[0], buf.size(), off) != (ssize_t) buf.size()) {
+        return -1;
     }
 
-    st_disk_j = st_disk[ref] + index;
-    /* Since the device is not the same, reset all the structure */
-    memset(st_disk_j, 0, sizeof(DiskStats));
-    st_disk_j->major = st_disk_i->major;
-    st_disk_j->minor = st_disk_i->minor;
+    long long minute = ((long long) fs->ust_time - hdr.day_start) / 60;
+    if (minute >= 0 && minute < SAR_ARCHIVE_INDEX_NR && !hdr.index[minute]) {
+        g_archive_hdr.index[minute] = g_archive_nr + 1;
+        pwrite(g_archive_fd, &g_archive_hdr.index[minute], sizeof(unsigned int),
+                offsetof(SarArchiveHeader, index) + minute * sizeof(unsigned int));
+    }
+    g_archive_nr++;
+    return 0;
+}
 
-    return index;
+int sar_archive_open(const char *path)
+{
+    sar_archive_close();
+
+    int fd;
+    if ((fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644)) < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+    g_archive_fd = fd;
+    g_archive_nr = 0;
+    if (st.st_size == 0) {
+        /* Inventory is taken from the first sample */
+        g_archive_new = true;
+        return 0;
+    }
+
+    /* Append to an existing archive, with its inventory */
+    SarArchiveHeader &hdr = g_archive_hdr;
+    if (pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+            !archive_header_valid(hdr, st.st_size)) {
+        sar_archive_close();
+        errno = EINVAL;
+        return -1;
+    }
+    g_archive_disks.resize(hdr.disk_nr);
+    g_archive_ifaces.resize(hdr.iface_nr);
+    ssize_t disks_len = hdr.disk_nr * sizeof(SarArchiveDisk);
+    ssize_t ifaces_len = hdr.iface_nr * sizeof(SarArchiveIface);
+    if ((disks_len && pread(fd, &g_archive_disks[0], disks_len,
+                    sizeof(hdr)) != disks_len) ||
+            (ifaces_len && pread(fd, &g_archive_ifaces[0], ifaces_len,
+                    sizeof(hdr) + disks_len) != ifaces_len)) {
+        sar_archive_close();
+        errno = EINVAL;
+        return -1;
+    }
+    /* A partly written last record is dropped */
+    g_archive_nr = (st.st_size - hdr.header_size) / hdr.record_size;
+    g_archive_new = false;
+
+    return append_archive_record(NULL, 0);
 }
 
+void sar_archive_close()
+{
+    if (g_archive_fd >= 0) {
+        close(g_archive_fd);
+        g_archive_fd = -1;
+    }
+    g_archive_new = false;
+    g_archive_nr = 0;
+    g_archive_disks.clear();
+    g_archive_ifaces.clear();
+}
 
-static int init()
+int sar_archive_map(const char *path, SarArchive &ar)
 {
-    memset(stats_one_cpu, 0, sizeof(stats_one_cpu));
-    memset(stats_net_dev, 0, sizeof(stats_net_dev));
-    memset(disk_stats, 0, sizeof(disk_stats));
+    memset(&ar, 0, sizeof(ar));
+    if ((ar.fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) {
+        return -1;
+    }
+    struct stat st;
+    void *base;
+    if (fstat(ar.fd, &st) < 0 || st.st_size < (off_t) sizeof(SarArchiveHeader) ||
+            (base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, ar.fd, 0)) ==
+            MAP_FAILED) {
+        close(ar.fd);
+        ar.fd = -1;
+        errno = errno ? errno : EINVAL;
+        return -1;
+    }
+    ar.base = (const char *) base;
+    ar.size = st.st_size;
+    ar.hdr = (const SarArchiveHeader *) base;
+    if (!archive_header_valid(*ar.hdr, ar.size)) {
+        sar_archive_unmap(ar);
+        errno = EINVAL;
+        return -1;
+    }
+    ar.nr_records = (ar.size - ar.hdr->header_size) / ar.hdr->record_size;
+    return 0;
+}
 
-    g_cpu_nr = get_cpu_nr();
-    g_disk_nr = get_disk_nr();
-    g_iface_nr = get_net_dev();
+void sar_archive_unmap(SarArchive &ar)
+{
+    if (ar.base != NULL) {
+        munmap((void *) ar.base, ar.size);
+    }
+    if (ar.fd >= 0) {
+        close(ar.fd);
+    }
+    memset(&ar, 0, sizeof(ar));
+    ar.fd = -1;
+}
 
-    g_hz = get_HZ();
-    g_shift = get_kb_shift();
+const SarArchiveDisk *sar_archive_disks(const SarArchive &ar)
+{
+    return (const SarArchiveDisk *) (ar.base + sizeof(SarArchiveHeader));
+}
 
-    if (g_cpu_nr > MAX_CPU_NR || g_disk_nr > MAX_DISK_NR || 
-        g_iface_nr > MAX_IFACE_LEN || g_hz <= 0 || g_shift < 0) {
-        return -1;
+const SarArchiveIface *sar_archive_ifaces(const SarArchive &ar)
+{
+    return (const SarArchiveIface *) (sar_archive_disks(ar) + ar.hdr->disk_nr);
+}
+
+const FileStats *sar_archive_record(const SarArchive &ar, unsigned int i)
+{
+    return (const FileStats *) (ar.base + ar.hdr->header_size +
+            (size_t) i * ar.hdr->record_size);
+}
+
+const StatsOneCpu *sar_archive_cpus(const SarArchive &ar, unsigned int i)
+{
+    return (const StatsOneCpu *) (sar_archive_record(ar, i) + 1);
+}
+
+const DiskStats *sar_archive_disk_stats(const SarArchive &ar, unsigned int i)
+{
+    return (const DiskStats *) (sar_archive_cpus(ar, i) + ar.hdr->cpu_nr);
+}
+
+const StatsNetDev *sar_archive_iface_stats(const SarArchive &ar, unsigned int i)
+{
+    return (const StatsNetDev *) (sar_archive_disk_stats(ar, i) + ar.hdr->disk_nr);
+}
+
+unsigned int sar_archive_find(const SarArchive &ar, time_t t)
+{
+    /* Start from the first record of the minute, or of the next one indexed */
+    unsigned int i = 0;
+    long long minute = ((long long) t - ar.hdr->day_start) / 60;
+    if (minute >= SAR_ARCHIVE_INDEX_NR) {
+        minute = SAR_ARCHIVE_INDEX_NR - 1;
+    }
+    for (long long m = minute; m >= 0 && m < SAR_ARCHIVE_INDEX_NR; m++) {
+        if (ar.hdr->index[m]) {
+            i = ar.hdr->index[m] - 1;
+            break;
+        }
+    }
+    if (i >= ar.nr_records) {
+        i = 0;
     }
-    return 0;
+    while (i > 0 && (time_t) sar_archive_record(ar, i - 1)->ust_time >= t) {
+        i--;
+    }
+    while (i < ar.nr_records && (time_t) sar_archive_record(ar, i)->ust_time < t) {
+        i++;
+    }
+    return i;
 }
 
-template <typename T, typename U, typename Q>
-double s_value(T m, U n, Q p)
-{
-    return (((double) ((n) - (m))) / (p) * g_hz);
-}
-template <typename T, typename U, typename Q>
-double sp_value(T m, U n, Q p)
+void set_sar_clock(const SarClock &clock)
 {
-    return (((double) ((n) - (m))) / (p) * 100);
+    g_clock = clock;
 }
 
 /*
- * Handle overflow conditions properly for counters which are read as
- * unsigned long long, but which can be unsigned long long or
- * unsigned long only depending on the kernel version used.
- * @value1 and @value2 being two values successively read for this
- * counter, if @value2 < @value1 and @value1 <= 0xffffffff, then we can
- * assume that the counter's type was unsigned long and has overflown, and
- * so the difference @value2 - @value1 must be casted to this type.
- * NOTE: These functions should no longer be necessary to handle a particular
- * stat counter when we can assume that everybody is using a recent kernel
- * (defining this counter as unsigned long long).
+ * Switch to another source mode: what was discovered or kept open in
+ * the previous one is dropped, so that capture and replay read the same
+ * sources in the same order.
  */
-static double ll_sp_value(unsigned long long value1, unsigned long long value2,
-        unsigned long long itv)
+static void set_source_mode(int mode, FILE *fp)
 {
-    if ((value2 < value1) && (value1 <= 0xffffffff)) {
-        /* Counter's type was unsigned long and has overflown */
-        return ((double) ((value2 - value1) & 0xffffffff)) / itv * 100;
-    }
-    else {
-        return sp_value(value1, value2, itv);
+    if (g_source_fp != NULL) {
+        fclose(g_source_fp);
     }
+    g_source_fp = fp;
+    g_source_mode = mode;
+    g_frame_open = false;
+    g_replay_eof = false;
+    g_frame_sources.clear();
+    g_source_bufs.clear();
+
+    g_net_proto_mapped = false;
+    g_snmp_map.clear();
+    g_netstat_map.clear();
+    g_topology_cpu_nr = -1;
+    close_cpufreq();
+    setup_net_dev_backend();
 }
-static double ll_s_value(unsigned long long value1, unsigned long long value2,
-        unsigned long long itv)
+
+int sar_capture_open(const char *path)
 {
-    if ((value2 < value1) && (value1 <= 0xffffffff)) {
-        /* Counter's type was unsigned long and has overflown */
-        return ((double) ((value2 - value1) & 0xffffffff)) / itv * g_hz;
-    }
-    else {
-        return s_value(value1, value2, itv);
+    FILE *fp;
+    if ((fp = fopen(path, "w")) == NULL) {
+        return -1;
     }
+    fputs(CAPTURE_MAGIC, fp);
+    set_source_mode(SRC_CAPTURE, fp);
+    return 0;
 }
 
-
-int get_sar_info(SarInfo &sar_info) {
-    if (init() < 0) {
-        /* fatal error */
+int sar_replay_open(const char *path)
+{
+    FILE *fp;
+    if ((fp = fopen(path, "r")) == NULL) {
         return -1;
     }
-
-    int ret = 0;
-    FileStats file_stats[2];
-    memset(file_stats, 0, sizeof(file_stats));
-
-    int curr = 1, prev = 0;
-
-    ret += read_stats(file_stats[prev], prev);
-    poll(NULL, 0, 500);
-    ret += read_stats(file_stats[curr], curr);
-
-    /* all data is collected */
-    const FileStats &f_prev = file_stats[prev];
-    const FileStats &f_curr = file_stats[curr];
-    unsigned long long itv = 0, g_itv = 0;
-
-    get_itv_value(f_curr, f_prev, g_cpu_nr, &itv, &g_itv);
-    if (itv == 0 || g_itv == 0) {
+    char magic[8];
+    if (fread(magic, 1, sizeof(magic), fp) != sizeof(magic) ||
+            memcmp(magic, CAPTURE_MAGIC, sizeof(magic))) {
+        fclose(fp);
+        errno = EINVAL;
         return -1;
     }
+    set_source_mode(SRC_REPLAY, fp);
+    return 0;
+}
+
+void sar_source_close()
+{
+    set_source_mode(SRC_LIVE, NULL);
+}
 
+/* Rates of the system-wide counters of FileStats */
+static void export_system_stats(SarInfo &sar_info, const FileStats &f_prev,
+        const FileStats &f_curr, unsigned long long itv, unsigned long long g_itv)
+{
     /* number of context switches per second */
     double nr_processes = ll_s_value(f_prev.context_swtch, 
             f_curr.context_swtch, itv);
@@ -1560,7 +5893,12 @@ int get_sar_info(SarInfo &sar_info) {
     sar_info.set_bufpg( bufpg );
     double campg = s_value((double) PG(f_prev.camkb), (double) PG(f_curr.camkb), itv);
     sar_info.set_campg( campg );
+}
 
+/* Rates of the network interfaces, summed */
+static void export_net_dev_stats(SarInfo &sar_info, int curr, int prev,
+        unsigned long long itv)
+{
     /* network interface statistics */
     double rxpck = 0;
     double txpck = 0;
@@ -1622,7 +5960,12 @@ int get_sar_info(SarInfo &sar_info) {
     sar_info.set_rxfram( rxfram );
     sar_info.set_rxfifo( rxfifo );
     sar_info.set_txfifo( txfifo );
+}
 
+/* Rates of the disks */
+static void export_disk_stats(SarInfo &sar_info, int curr, int prev,
+        unsigned long long itv)
+{
     /* disk statistics */
     DiskStats *sdi = disk_stats[curr], *sdj;
     for (int i = 0; i < g_disk_nr; i++, ++sdi) {
@@ -1669,9 +6012,676 @@ int get_sar_info(SarInfo &sar_info) {
             sar_disk_info->set_dev_name( dev_name );
         }
     }
+}
 
-    return ret;
+/* Timestamp (ms) of the sample being read */
+static long long get_time_ms()
+{
+    if (g_source_mode == SRC_REPLAY) {
+        return g_frame_time;
+    }
+    return g_clock.now_ms ? g_clock.now_ms() : real_now_ms();
+}
+
+/* Add the counters of sample @curr to the rate history */
+static void add_history_snapshot(const FileStats &file_stats, int curr)
+{
+    CounterSnapshot &snap = g_history[g_history_head];
+    snap.t_ms = get_time_ms();
+    snap.file_stats = file_stats;
+    snap.cpu_nr = g_cpu_nr;
+    snap.iface_nr = g_iface_nr;
+    snap.disk_nr = g_disk_nr;
+    memcpy(snap.cpus, stats_one_cpu[curr], sizeof(snap.cpus));
+    memcpy(snap.ifaces, stats_net_dev[curr], sizeof(snap.ifaces));
+    memcpy(snap.disks, disk_stats[curr], sizeof(snap.disks));
+
+    g_history_head = (g_history_head + 1) % g_history.size();
+    if (g_history_nr < g_history.size()) {
+        g_history_nr++;
+    }
+}
+
+/* Snapshot @k samples older than the newest one */
+static const CounterSnapshot &history_snapshot(unsigned int k)
+{
+    size_t size = g_history.size();
+    return g_history[(g_history_head + size - 1 - k) % size];
+}
+
+int sar_sample()
+{
+    /* Only what the history keeps is read */
+    if (g_history.empty() || init_counters() < 0) {
+        return -1;
+    }
+
+    FileStats file_stats;
+    memset(&file_stats, 0, sizeof(file_stats));
+    int ret = read_counter_stats(file_stats, 1);
+    end_stats(file_stats);
+    if (g_source_mode == SRC_REPLAY && g_replay_eof) {
+        return -1;
+    }
+    add_history_snapshot(file_stats, 1);
+    return ret < 0 ? -1 : 0;
+}
+
+long long get_sar_rates(long long window_ms, SarInfo &sar_info)
+{
+    if (g_history_nr < 2 || window_ms <= 0) {
+        return -1;
+    }
+
+    const CounterSnapshot &newest = history_snapshot(0);
+    long long span = newest.t_ms - history_snapshot(g_history_nr - 1).t_ms;
+    if (window_ms > span + span / (g_history_nr - 1) / 2) {
+        return -1;
+    }
+    /* Ages grow with k: stop once past the window */
+    const CounterSnapshot *oldest = NULL;
+    long long best = 0;
+    for (unsigned int k = 1; k < g_history_nr; k++) {
+        const CounterSnapshot &snap = history_snapshot(k);
+        long long age = newest.t_ms - snap.t_ms;
+        long long diff = age > window_ms ? age - window_ms : window_ms - age;
+        if (oldest == NULL || diff < best) {
+            oldest = &snap;
+            best = diff;
+        }
+        if (age >= window_ms) {
+            break;
+        }
+    }
+
+    /*
+     * Both samples within the same uptime tick (eg. back-to-back
+     * sar_sample()): get_itv_value() would make it one tick.
+     */
+    if (newest.file_stats.uptime == oldest->file_stats.uptime ||
+            (newest.cpu_nr > 1 &&
+             newest.file_stats.uptime0 == oldest->file_stats.uptime0)) {
+        return -1;
+    }
+
+    /* Load the two samples in the slots read by the export helpers */
+    int curr = 1, prev = 0;
+    int cpu_nr = g_cpu_nr, iface_nr = g_iface_nr, disk_nr = g_disk_nr;
+    memcpy(stats_one_cpu[prev], oldest->cpus, sizeof(oldest->cpus));
+    memcpy(stats_one_cpu[curr], newest.cpus, sizeof(newest.cpus));
+    memcpy(stats_net_dev[prev], oldest->ifaces, sizeof(oldest->ifaces));
+    memcpy(stats_net_dev[curr], newest.ifaces, sizeof(newest.ifaces));
+    memcpy(disk_stats[prev], oldest->disks, sizeof(oldest->disks));
+    memcpy(disk_stats[curr], newest.disks, sizeof(newest.disks));
+    g_cpu_nr = newest.cpu_nr;
+    g_iface_nr = newest.iface_nr;
+    g_disk_nr = newest.disk_nr;
+
+    unsigned long long itv = 0, g_itv = 0;
+    get_itv_value(newest.file_stats, oldest->file_stats, g_cpu_nr, &itv, &g_itv);
+    export_system_stats(sar_info, oldest->file_stats, newest.file_stats, itv, g_itv);
+    export_net_dev_stats(sar_info, curr, prev, itv);
+    for (int i = 0; i < g_cpu_nr && i < MAX_CPU_NR; i++) {
+        CpuTimes times;
+        if (!get_cpu_times(i, curr, prev, &times)) {
+            continue;
+        }
+        SarInfo_SarCpuInfo *sar_cpu_info = sar_info.add_sar_cpu_info();
+        sar_cpu_info->set_cpu( i );
+        set_cpu_times(sar_cpu_info, times);
+    }
+    export_disk_stats(sar_info, curr, prev, itv);
+
+    g_cpu_nr = cpu_nr;
+    g_iface_nr = iface_nr;
+    g_disk_nr = disk_nr;
+    return newest.t_ms - oldest->t_ms;
+}
+
+int get_sar_info(SarInfo &sar_info) {
+    g_sampled = false;
+    if (init() < 0) {
+        /* fatal error */
+        return -1;
+    }
+
+    int ret = 0;
+    FileStats file_stats[2];
+    memset(file_stats, 0, sizeof(file_stats));
+
+    int curr = 1, prev = 0;
+
+    ret += read_stats(file_stats[prev], prev);
+    if (g_clock.sleep_ms) {
+        g_clock.sleep_ms(500);
+    }
+    else {
+        (g_source_mode == SRC_REPLAY ? no_sleep_ms : real_sleep_ms)(500);
+    }
+    ret += read_stats(file_stats[curr], curr);
+    if (g_source_mode == SRC_REPLAY && g_replay_eof) {
+        /* Capture file exhausted */
+        return -1;
+    }
+    /* The sample is still exported if it could not be archived */
+    bool archive_failed = g_archive_fd >= 0 &&
+        append_archive_record(file_stats + curr, curr) < 0;
+    if (!g_history.empty()) {
+        add_history_snapshot(file_stats[curr], curr);
+    }
+
+    /* all data is collected */
+    const FileStats &f_prev = file_stats[prev];
+    const FileStats &f_curr = file_stats[curr];
+    unsigned long long itv = 0, g_itv = 0;
+
+    get_itv_value(f_curr, f_prev, g_cpu_nr, &itv, &g_itv);
+    if (itv == 0 || g_itv == 0) {
+        return -1;
+    }
+
+    export_system_stats(sar_info, f_prev, f_curr, itv, g_itv);
+    export_net_dev_stats(sar_info, curr, prev, itv);
+
+    /* network interface statistics of the other namespaces */
+    for (size_t n = 0; n < g_netns_order.size(); n++) {
+        NetnsEntry &ns = g_netns[g_netns_order[n]];
+        if (!ns.online[curr] || !ns.online[prev]) {
+            continue;
+        }
+
+        SarInfo_SarNetnsInfo *ns_info = sar_info.add_sar_netns_info();
+        ns_info->set_name( ns.name );
+        ns_info->set_inode( g_netns_order[n] );
+        ns_info->set_pid( ns.pid );
+        double ns_rxpck = 0, ns_txpck = 0, ns_rxbyt = 0, ns_txbyt = 0;
+        double ns_rxerr = 0, ns_txerr = 0, ns_rxdrop = 0, ns_txdrop = 0;
+        for (size_t i = 0; i < ns.stats[curr].size(); i++) {
+            const StatsNetDev *nsi = &ns.stats[curr][i];
+            const StatsNetDev *nsj = NULL;
+            for (size_t j = 0; j < ns.stats[prev].size(); j++) {
+                if (!strcmp(nsi->interface, ns.stats[prev][j].interface)) {
+                    nsj = &ns.stats[prev][j];
+                    break;
+                }
+            }
+            if (nsj == NULL ||
+                    (nsi->rx_packets < nsj->rx_packets) ||
+                    (nsi->tx_packets < nsj->tx_packets) ||
+                    (nsi->rx_bytes < nsj->rx_bytes) ||
+                    (nsi->tx_bytes < nsj->tx_bytes)) {
+                /* New, or unregistered then registered again */
+                continue;
+            }
+
+            SarInfo_SarIfaceInfo *if_info = ns_info->add_iface();
+            if_info->set_name( nsi->interface );
+            if_info->set_rxpck( s_value(nsj->rx_packets, nsi->rx_packets, itv) );
+            if_info->set_txpck( s_value(nsj->tx_packets, nsi->tx_packets, itv) );
+            if_info->set_rxbyt( s_value(nsj->rx_bytes, nsi->rx_bytes, itv) );
+            if_info->set_txbyt( s_value(nsj->tx_bytes, nsi->tx_bytes, itv) );
+            if_info->set_rxerr( s_value(nsj->rx_errors, nsi->rx_errors, itv) );
+            if_info->set_txerr( s_value(nsj->tx_errors, nsi->tx_errors, itv) );
+            if_info->set_rxdrop( s_value(nsj->rx_dropped, nsi->rx_dropped, itv) );
+            if_info->set_txdrop( s_value(nsj->tx_dropped, nsi->tx_dropped, itv) );
+            ns_rxpck += if_info->rxpck();
+            ns_txpck += if_info->txpck();
+            ns_rxbyt += if_info->rxbyt();
+            ns_txbyt += if_info->txbyt();
+            ns_rxerr += if_info->rxerr();
+            ns_txerr += if_info->txerr();
+            ns_rxdrop += if_info->rxdrop();
+            ns_txdrop += if_info->txdrop();
+        }
+        ns_info->set_rxpck( ns_rxpck );
+        ns_info->set_txpck( ns_txpck );
+        ns_info->set_rxbyt( ns_rxbyt );
+        ns_info->set_txbyt( ns_txbyt );
+        ns_info->set_rxerr( ns_rxerr );
+        ns_info->set_txerr( ns_txerr );
+        ns_info->set_rxdrop( ns_rxdrop );
+        ns_info->set_txdrop( ns_txdrop );
+    }
+
+    /* filesystem usage */
+    for (size_t n = 0; n < g_mount_order.size(); n++) {
+        MountEntry &mnt = g_mounts[g_mount_order[n]];
+        const StatsFs *sfi = mnt.stats + curr;
+        const StatsFs *sfj = mnt.stats + prev;
+        if (!sfi->online || !sfj->online) {
+            continue;
+        }
+
+        SarInfo_SarFsInfo *fs_info = sar_info.add_sar_fs_info();
+        fs_info->set_mount_point( mnt.mnt_point );
+        fs_info->set_fs_type( mnt.fs_type );
+        fs_info->set_source( mnt.source );
+        /* Same as df: reserved blocks count neither as used nor as free */
+        unsigned long long used = sfi->blocks - sfi->bfree;
+        unsigned long long usable = used + sfi->bavail;
+        fs_info->set_size( sfi->blocks * sfi->frsize );
+        fs_info->set_used( used * sfi->frsize );
+        fs_info->set_avail( sfi->bavail * sfi->frsize );
+        fs_info->set_used_pct( usable ? (double) used / usable * 100 : 0.0 );
+        fs_info->set_free_pct( usable ? (double) sfi->bavail / usable * 100 : 0.0 );
+        fs_info->set_inode_used_pct( sfi->files ?
+                (double) (sfi->files - sfi->ffree) / sfi->files * 100 : 0.0 );
+        /* Signed: filesystems also shrink */
+        double growth = s_value((long long) (sfj->blocks - sfj->bfree),
+                (long long) used, itv) * sfi->frsize;
+        fs_info->set_growth( growth );
+        fs_info->set_time_to_full( growth > 0 ?
+                (double) (sfi->bavail * sfi->frsize) / growth : 0.0 );
+    }
+
+    /* TCP/UDP protocol statistics */
+    const unsigned long long *npi = net_proto_stats[curr];
+    const unsigned long long *npj = net_proto_stats[prev];
+    SarInfo_SarNetProtoInfo *net_proto = sar_info.mutable_net_proto();
+    net_proto->set_tcp_active_opens( s_value(npj[NP_TCP_ACTIVE_OPENS],
+                npi[NP_TCP_ACTIVE_OPENS], itv) );
+    net_proto->set_tcp_passive_opens( s_value(npj[NP_TCP_PASSIVE_OPENS],
+                npi[NP_TCP_PASSIVE_OPENS], itv) );
+    net_proto->set_tcp_attempt_fails( s_value(npj[NP_TCP_ATTEMPT_FAILS],
+                npi[NP_TCP_ATTEMPT_FAILS], itv) );
+    net_proto->set_tcp_estab_resets( s_value(npj[NP_TCP_ESTAB_RESETS],
+                npi[NP_TCP_ESTAB_RESETS], itv) );
+    net_proto->set_tcp_in_segs( s_value(npj[NP_TCP_IN_SEGS],
+                npi[NP_TCP_IN_SEGS], itv) );
+    net_proto->set_tcp_out_segs( s_value(npj[NP_TCP_OUT_SEGS],
+                npi[NP_TCP_OUT_SEGS], itv) );
+    net_proto->set_tcp_retrans_segs( s_value(npj[NP_TCP_RETRANS_SEGS],
+                npi[NP_TCP_RETRANS_SEGS], itv) );
+    unsigned long long out_segs = npi[NP_TCP_OUT_SEGS] - npj[NP_TCP_OUT_SEGS];
+    net_proto->set_tcp_retrans_pct( out_segs ?
+            sp_value(npj[NP_TCP_RETRANS_SEGS], npi[NP_TCP_RETRANS_SEGS], out_segs) : 0.0 );
+    net_proto->set_tcp_in_errs( s_value(npj[NP_TCP_IN_ERRS],
+                npi[NP_TCP_IN_ERRS], itv) );
+    net_proto->set_tcp_out_rsts( s_value(npj[NP_TCP_OUT_RSTS],
+                npi[NP_TCP_OUT_RSTS], itv) );
+    net_proto->set_tcp_timeouts( s_value(npj[NP_TCP_TIMEOUTS],
+                npi[NP_TCP_TIMEOUTS], itv) );
+    net_proto->set_tcp_syn_retrans( s_value(npj[NP_TCP_SYN_RETRANS],
+                npi[NP_TCP_SYN_RETRANS], itv) );
+    net_proto->set_listen_overflows( s_value(npj[NP_LISTEN_OVERFLOWS],
+                npi[NP_LISTEN_OVERFLOWS], itv) );
+    net_proto->set_listen_drops( s_value(npj[NP_LISTEN_DROPS],
+                npi[NP_LISTEN_DROPS], itv) );
+    net_proto->set_syn_drops( s_value(npj[NP_REQ_QFULL_DROP],
+                npi[NP_REQ_QFULL_DROP], itv) );
+    net_proto->set_syncookies_sent( s_value(npj[NP_SYNCOOKIES_SENT],
+                npi[NP_SYNCOOKIES_SENT], itv) );
+    net_proto->set_tcp_memory_pressures( s_value(npj[NP_TCP_MEMORY_PRESSURES],
+                npi[NP_TCP_MEMORY_PRESSURES], itv) );
+    net_proto->set_tcp_abort_on_memory( s_value(npj[NP_TCP_ABORT_ON_MEMORY],
+                npi[NP_TCP_ABORT_ON_MEMORY], itv) );
+    net_proto->set_tcp_prune_called( s_value(npj[NP_PRUNE_CALLED],
+                npi[NP_PRUNE_CALLED], itv) );
+    net_proto->set_tcp_rcv_pruned( s_value(npj[NP_RCV_PRUNED],
+                npi[NP_RCV_PRUNED], itv) );
+    net_proto->set_udp_in_datagrams( s_value(npj[NP_UDP_IN_DATAGRAMS],
+                npi[NP_UDP_IN_DATAGRAMS], itv) );
+    net_proto->set_udp_out_datagrams( s_value(npj[NP_UDP_OUT_DATAGRAMS],
+                npi[NP_UDP_OUT_DATAGRAMS], itv) );
+    net_proto->set_udp_no_ports( s_value(npj[NP_UDP_NO_PORTS],
+                npi[NP_UDP_NO_PORTS], itv) );
+    net_proto->set_udp_in_errors( s_value(npj[NP_UDP_IN_ERRORS],
+                npi[NP_UDP_IN_ERRORS], itv) );
+    net_proto->set_udp_rcvbuf_errors( s_value(npj[NP_UDP_RCVBUF_ERRORS],
+                npi[NP_UDP_RCVBUF_ERRORS], itv) );
+    net_proto->set_udp_sndbuf_errors( s_value(npj[NP_UDP_SNDBUF_ERRORS],
+                npi[NP_UDP_SNDBUF_ERRORS], itv) );
+
+    /* per-CPU softnet and scheduler statistics */
+    double softnet_processed = 0;
+    double softnet_dropped = 0;
+    double softnet_time_squeeze = 0;
+    int softnet_squeezed_cpus = 0;
+    double sched_run_delay = 0;
+    /* CPU time rolled up per core (package, core), package and node */
+    std::map<std::pair<int, int>, CpuTimes> core_times;
+    std::map<int, CpuTimes> package_times;
+    std::map<int, CpuTimes> node_times;
+    for (int i = 0; i < MAX_CPU_NR; i++) {
+        const StatsSoftnet *ssi = stats_softnet[curr] + i;
+        const StatsSoftnet *ssj = stats_softnet[prev] + i;
+        const StatsSched *schi = stats_sched_cpu[curr] + i;
+        const StatsSched *schj = stats_sched_cpu[prev] + i;
+        bool softnet = ssi->online && ssj->online;
+        bool sched = schi->online && schj->online;
+        CpuTimes times;
+        bool cpu = i < g_cpu_nr && get_cpu_times(i, curr, prev, &times);
+        const StatsCpuFreq *sfi = stats_cpufreq[curr] + i;
+        const StatsCpuFreq *sfj = stats_cpufreq[prev] + i;
+        bool freq = sfi->online && sfj->online;
+        if (!softnet && !sched && !cpu && !freq) {
+            continue;
+        }
+
+        SarInfo_SarCpuInfo *sar_cpu_info = sar_info.add_sar_cpu_info();
+        sar_cpu_info->set_cpu( i );
+
+        if (cpu) {
+            const CpuTopology *topo = cpu_topology + i;
+            set_cpu_times(sar_cpu_info, times);
+            sar_cpu_info->set_core_id( topo->core_id );
+            sar_cpu_info->set_package_id( topo->package_id );
+            sar_cpu_info->set_node( topo->node );
+
+            if (topo->core_id >= 0) {
+                add_cpu_times(core_times[std::make_pair(topo->package_id,
+                            topo->core_id)], times);
+            }
+            if (topo->package_id >= 0) {
+                add_cpu_times(package_times[topo->package_id], times);
+            }
+            if (topo->node >= 0) {
+                add_cpu_times(node_times[topo->node], times);
+            }
+        }
+
+        if (freq) {
+            const CpuFreqFiles *cff = cpu_freq_files + i;
+            if (cff->cur_freq_fd >= 0) {
+                /* kHz to MHz */
+                sar_cpu_info->set_cur_freq( sfi->cur_freq / 1000.0 );
+                if (cff->max_freq) {
+                    sar_cpu_info->set_max_freq( cff->max_freq / 1000.0 );
+                }
+            }
+            if (cff->core_throttle_fd >= 0) {
+                sar_cpu_info->set_core_throttle(
+                        s_value(sfj->core_throttle, sfi->core_throttle, itv) );
+            }
+            if (cff->package_throttle_fd >= 0) {
+                sar_cpu_info->set_package_throttle(
+                        s_value(sfj->package_throttle, sfi->package_throttle, itv) );
+            }
+        }
+
+        if (softnet) {
+            /* softnet_stat columns are 32-bit counters */
+            double processed = ll_s_value(ssj->processed, ssi->processed, itv);
+            sar_cpu_info->set_softnet_processed( processed );
+            double dropped = ll_s_value(ssj->dropped, ssi->dropped, itv);
+            sar_cpu_info->set_softnet_dropped( dropped );
+            double time_squeeze = ll_s_value(ssj->time_squeeze, ssi->time_squeeze, itv);
+            sar_cpu_info->set_softnet_time_squeeze( time_squeeze );
+            sar_cpu_info->set_softnet_received_rps(
+                    ll_s_value(ssj->received_rps, ssi->received_rps, itv) );
+            sar_cpu_info->set_softnet_flow_limit(
+                    ll_s_value(ssj->flow_limit, ssi->flow_limit, itv) );
+            bool squeezed = time_squeeze > g_config.softnet_squeeze_threshold;
+            sar_cpu_info->set_softnet_squeezed( squeezed );
+
+            softnet_processed += processed;
+            softnet_dropped += dropped;
+            softnet_time_squeeze += time_squeeze;
+            softnet_squeezed_cpus += squeezed;
+        }
+
+        if (sched) {
+            /* ns of run queue wait per second of wall time */
+            double run_delay = s_value(schj->run_delay, schi->run_delay, itv);
+            sar_cpu_info->set_sched_run_delay( run_delay );
+            sar_cpu_info->set_sched_run_time(
+                    s_value(schj->run_time, schi->run_time, itv) );
+            sar_cpu_info->set_sched_timeslices(
+                    s_value(schj->pcount, schi->pcount, itv) );
+
+            sched_run_delay += run_delay;
+        }
+    }
+    for (std::map<std::pair<int, int>, CpuTimes>::iterator it = core_times.begin();
+            it != core_times.end(); ++it) {
+        SarInfo_SarCpuGroupInfo *core_info = sar_info.add_sar_core_info();
+        core_info->set_id( it->first.second );
+        core_info->set_package_id( it->first.first );
+        core_info->set_nr_cpus( it->second.nr_cpus );
+        set_cpu_times(core_info, it->second);
+    }
+    for (std::map<int, CpuTimes>::iterator it = package_times.begin();
+            it != package_times.end(); ++it) {
+        SarInfo_SarCpuGroupInfo *socket_info = sar_info.add_sar_socket_info();
+        socket_info->set_id( it->first );
+        socket_info->set_package_id( it->first );
+        socket_info->set_nr_cpus( it->second.nr_cpus );
+        set_cpu_times(socket_info, it->second);
+    }
+
+    /* NUMA nodes */
+    for (int i = 0; i < g_node_nr; i++) {
+        const StatsNode *sni = stats_node[curr] + i;
+        const StatsNode *snj = stats_node[prev] + i;
+        if (!sni->online || !snj->online) {
+            continue;
+        }
+
+        SarInfo_SarNodeInfo *node_info = sar_info.add_sar_node_info();
+        node_info->set_node( numa_node[i].id );
+        std::map<int, CpuTimes>::iterator it = node_times.find(numa_node[i].id);
+        if (it != node_times.end()) {
+            node_info->set_nr_cpus( it->second.nr_cpus );
+            set_cpu_times(node_info, it->second);
+        }
+        node_info->set_mem_total( sni->mem_total );
+        node_info->set_mem_free( sni->mem_free );
+        node_info->set_numa_hit( s_value(snj->numa_hit, sni->numa_hit, itv) );
+        node_info->set_numa_miss( s_value(snj->numa_miss, sni->numa_miss, itv) );
+        node_info->set_numa_foreign( s_value(snj->numa_foreign, sni->numa_foreign, itv) );
+        node_info->set_local_node( s_value(snj->local_node, sni->local_node, itv) );
+        node_info->set_other_node( s_value(snj->other_node, sni->other_node, itv) );
+    }
+
+    sar_info.set_softnet_processed( softnet_processed );
+    sar_info.set_softnet_dropped( softnet_dropped );
+    sar_info.set_softnet_time_squeeze( softnet_time_squeeze );
+    sar_info.set_softnet_squeezed_cpus( softnet_squeezed_cpus );
+    sar_info.set_sched_run_delay( sched_run_delay );
+
+    /* scheduler statistics of the watched processes */
+    for (int i = 0; i < g_sched_task_nr; i++) {
+        const StatsSched *schi = stats_sched_task[curr] + i;
+        const StatsSched *schj = stats_sched_task[prev] + i;
+        if (!schi->online || !schj->online) {
+            continue;
+        }
+
+        SarInfo_SarTaskSchedInfo *task_info = sar_info.add_sar_task_sched_info();
+        task_info->set_pid( sched_task[i].pid );
+        task_info->set_comm( sched_task[i].comm );
+        task_info->set_run_time( s_value(schj->run_time, schi->run_time, itv) );
+        task_info->set_run_delay( s_value(schj->run_delay, schi->run_delay, itv) );
+        task_info->set_timeslices( s_value(schj->pcount, schi->pcount, itv) );
+        unsigned long long pcount = schi->pcount - schj->pcount;
+        task_info->set_avg_delay( pcount ?
+                (double) (schi->run_delay - schj->run_delay) / pcount : 0.0 );
+    }
+
+    /* pressure stall information */
+    for (int i = 0; i < NR_PSI_RES; i++) {
+        const StatsPsi *spi = stats_psi[curr] + i;
+        const StatsPsi *spj = stats_psi[prev] + i;
+        if (!spi->online || !spj->online) {
+            continue;
+        }
+        SarInfo_SarPsiInfo *psi = (i == PSI_CPU) ? sar_info.mutable_psi_cpu() :
+            (i == PSI_MEMORY) ? sar_info.mutable_psi_memory() :
+            sar_info.mutable_psi_io();
+        set_psi_info(psi, spj, spi, itv);
+    }
+
+    /* cgroup statistics */
+    for (size_t n = 0; n < g_cgroup_order.size(); n++) {
+        CgroupEntry &cg = g_cgroups[g_cgroup_order[n]];
+        const StatsCgroup *sci = cg.stats + curr;
+        const StatsCgroup *scj = cg.stats + prev;
+        if (!sci->online || !scj->online) {
+            continue;
+        }
+
+        SarInfo_SarCgroupInfo *cg_info = sar_info.add_sar_cgroup_info();
+        cg_info->set_path( cg.path );
+        cg_info->set_inode( g_cgroup_order[n] );
+        /* usec per second, to percent of one CPU */
+        cg_info->set_cpu_usage( s_value(scj->usage_usec, sci->usage_usec, itv) / 10000.0 );
+        cg_info->set_cpu_user( s_value(scj->user_usec, sci->user_usec, itv) / 10000.0 );
+        cg_info->set_cpu_system( s_value(scj->system_usec, sci->system_usec, itv) / 10000.0 );
+        cg_info->set_nr_throttled( s_value(scj->nr_throttled, sci->nr_throttled, itv) );
+        cg_info->set_throttled_time( s_value(scj->throttled_usec, sci->throttled_usec, itv) );
+        cg_info->set_memory_current( sci->memory_current );
+        cg_info->set_memory_anon( sci->anon );
+        cg_info->set_memory_file( sci->file );
+        cg_info->set_pgfault( s_value(scj->pgfault, sci->pgfault, itv) );
+        cg_info->set_pgmajfault( s_value(scj->pgmajfault, sci->pgmajfault, itv) );
+        cg_info->set_io_rbytes( s_value(scj->rbytes, sci->rbytes, itv) );
+        cg_info->set_io_wbytes( s_value(scj->wbytes, sci->wbytes, itv) );
+        cg_info->set_io_rios( s_value(scj->rios, sci->rios, itv) );
+        cg_info->set_io_wios( s_value(scj->wios, sci->wios, itv) );
+        if (sci->psi[PSI_CPU].online && scj->psi[PSI_CPU].online) {
+            set_psi_info(cg_info->mutable_psi_cpu(),
+                    scj->psi + PSI_CPU, sci->psi + PSI_CPU, itv);
+        }
+        if (sci->psi[PSI_MEMORY].online && scj->psi[PSI_MEMORY].online) {
+            set_psi_info(cg_info->mutable_psi_memory(),
+                    scj->psi + PSI_MEMORY, sci->psi + PSI_MEMORY, itv);
+        }
+        if (sci->psi[PSI_IO].online && scj->psi[PSI_IO].online) {
+            set_psi_info(cg_info->mutable_psi_io(),
+                    scj->psi + PSI_IO, sci->psi + PSI_IO, itv);
+        }
+    }
+
+    /* top processes */
+    if (g_config.proc_top_n > 0) {
+        std::vector<ProcessRank> ranks;
+        ranks.reserve(g_processes.size());
+        for (std::unordered_map<unsigned long long, ProcessEntry>::iterator it =
+                g_processes.begin(); it != g_processes.end(); ++it) {
+            ProcessEntry &proc = it->second;
+            const StatsProcess *spi = proc.stats + curr;
+            const StatsProcess *spj = proc.stats + prev;
+            if (!spi->online || !spj->online) {
+                continue;
+            }
+
+            ProcessRank rank;
+            rank.proc = &proc;
+            if (g_config.proc_sort_key == PROC_SORT_RSS) {
+                rank.key = proc.rss;
+            }
+            else if (g_config.proc_sort_key == PROC_SORT_IO) {
+                rank.key = (double) ((spi->read_bytes - spj->read_bytes) +
+                        (spi->write_bytes - spj->write_bytes));
+            }
+            else {
+                rank.key = (double) ((spi->utime - spj->utime) +
+                        (spi->stime - spj->stime));
+            }
+            ranks.push_back(rank);
+        }
+
+        /* Only the top N processes need to be sorted */
+        size_t top_n = std::min(ranks.size(), (size_t) g_config.proc_top_n);
+        std::partial_sort(ranks.begin(), ranks.begin() + top_n, ranks.end());
+
+        for (size_t i = 0; i < top_n; i++) {
+            ProcessEntry &proc = *ranks[i].proc;
+            const StatsProcess *spi = proc.stats + curr;
+            const StatsProcess *spj = proc.stats + prev;
+            read_pid_statm(proc);
+
+            SarInfo_SarProcessInfo *proc_info = sar_info.add_sar_process_info();
+            proc_info->set_pid( proc.pid );
+            proc_info->set_comm( proc.comm );
+            proc_info->set_cpu_user( sp_value(spj->utime, spi->utime, itv) );
+            proc_info->set_cpu_system( sp_value(spj->stime, spi->stime, itv) );
+            proc_info->set_cpu( proc_info->cpu_user() + proc_info->cpu_system() );
+            proc_info->set_rss( PAGES_TO_KB(proc.rss) );
+            proc_info->set_shared( PAGES_TO_KB(proc.shared) );
+            proc_info->set_minflt( s_value(spj->minflt, spi->minflt, itv) );
+            proc_info->set_majflt( s_value(spj->majflt, spi->majflt, itv) );
+            if (g_config.proc_sort_key == PROC_SORT_IO) {
+                /* I/O counters are only read for all processes when ranked on */
+                proc_info->set_read_bytes( s_value(spj->read_bytes, spi->read_bytes, itv) );
+                proc_info->set_write_bytes( s_value(spj->write_bytes, spi->write_bytes, itv) );
+            }
+        }
+    }
+
+    export_disk_stats(sar_info, curr, prev, itv);
+
+    if (!g_rollup_slots.empty() || g_summary_max || !g_sketches.empty()) {
+        get_sar_info_values(sar_info, g_info_values);
+        if (!g_rollup_slots.empty()) {
+            add_rollup_sample(g_info_values, f_curr.ust_time);
+        }
+        if (g_summary_max) {
+            add_summary_sample(g_info_values);
+        }
+        if (!g_sketches.empty()) {
+            add_sketch_sample(g_info_values, sar_info);
+        }
+    }
+    g_sampled = true;
+
+    return archive_failed ? -1 : ret;
+}
+
+int get_sar_info_on_stall(SarInfo &sar_info, int timeout_ms)
+{
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    struct epoll_event events[MAX_PSI_TRIGGER_NR];
+    int fired = 0;
+    while (!fired) {
+        if (g_psi_epfd < 0 || !g_trigger_nr) {
+            /* No trigger registered, or all of them destroyed */
+            return -1;
+        }
+
+        int wait_ms = timeout_ms;
+        if (timeout_ms > 0) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            long long elapsed = (now.tv_sec - start.tv_sec) * 1000LL +
+                (now.tv_nsec - start.tv_nsec) / 1000000;
+            wait_ms = elapsed < timeout_ms ? (int) (timeout_ms - elapsed) : 0;
+        }
+        int nr = epoll_wait(g_psi_epfd, events, MAX_PSI_TRIGGER_NR, wait_ms);
+        if (nr < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (!nr) {
+            return 0;
+        }
+        for (int i = 0; i < nr; i++) {
+            if (events[i].events & EPOLLERR) {
+                /*
+                 * Trigger destroyed, eg. the pressure file went away: the
+                 * error is level-triggered, keep waiting on the others only.
+                 */
+                remove_trigger(events[i].data.fd);
+            }
+            else {
+                fired++;
+            }
+        }
+    }
+
+    /* Unreadable optional files are already reported by get_sar_info() */
+    get_sar_info(sar_info);
+    if (!g_sampled) {
+        return -1;
+    }
+
+    return 1;
 }
 
 #undef PG
+#undef PAGES_TO_KB
 
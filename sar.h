@@ -4,6 +4,356 @@
 
 #include "SarInfo.pb.h"
 
+#include <string>
+#include <vector>
+
+/* Network interface statistics backends */
+enum {
+    NET_DEV_AUTO = 0,       /* sysfs for a short explicit watch list, else procfs */
+    NET_DEV_PROCFS,         /* parse /proc/net/dev */
+    NET_DEV_NETLINK,        /* RTM_GETLINK dump with IFLA_STATS64 counters */
+    NET_DEV_SYSFS           /* /sys/class/net/<if>/statistics/<counter> of watched interfaces */
+};
+
+/* Sources of network namespaces, ORed together */
+enum {
+    NETNS_SRC_NAMED = 1,    /* /run/netns/<name>, read after setns() */
+    NETNS_SRC_PID = 2       /* /proc/<pid>/ns/net, read from /proc/<pid>/net/dev */
+};
+
+/* Keys processes are ranked on */
+enum {
+    PROC_SORT_CPU = 0,
+    PROC_SORT_RSS,
+    PROC_SORT_IO
+};
+
+/* Collector configuration, applied by the next get_sar_info() call */
+struct SarConfig {
+    /*
+     * Also collect virtual block devices (dm-*, md*, loop, rbd...).
+     * Device-mapper devices are reported under their /sys/block/dm-N/dm/name.
+     */
+    bool allow_virtual;
+    /*
+     * Fold the stats of whole-disk members (eg. md or multipath legs)
+     * into their holder device instead of reporting them separately.
+     * The holder gets the I/O counts of its members and keeps its own busy
+     * time. Only whole disks are folded: partitions are not block devices
+     * of /sys/block, so eg. LVM on partitions is never rolled up.
+     * Only used when allow_virtual is set.
+     */
+    bool rollup_holders;
+
+    /*
+     * Interface and disk name filters. Patterns are exact names, prefixes
+     * ("veth*") or shell globs ("eth[0-3]"). A name is kept if it matches
+     * one include pattern (or if there are none) and no exclude pattern.
+     * Disks are matched on their kernel name as found in /proc/diskstats.
+     */
+    std::vector<std::string> iface_include;
+    std::vector<std::string> iface_exclude;
+    std::vector<std::string> disk_include;
+    std::vector<std::string> disk_exclude;
+
+    /*
+     * Network interface statistics backend (NET_DEV_*).
+     * The watch list of the sysfs backend is made of the exact names in
+     * iface_include. NET_DEV_AUTO picks sysfs when iface_include only holds
+     * exact names, at most sysfs_watch_max of them, and iface_exclude is empty.
+     */
+    int net_dev_backend;
+    int sysfs_watch_max;
+
+    /* Flag CPUs whose softnet time_squeeze rate (per second) is above this */
+    double softnet_squeeze_threshold;
+
+    /* Processes whose scheduler latency is read from /proc/<pid>/schedstat */
+    std::vector<int> sched_pids;
+
+    /*
+     * PSI triggers waited on by get_sar_info_on_stall(), written as
+     * "<cpu|memory|io> <some|full> <stall us> <window us>",
+     * eg. "memory some 150000 1000000". Without CAP_SYS_RESOURCE, the
+     * kernel only accepts windows that are a multiple of 2 s.
+     */
+    std::vector<std::string> psi_triggers;
+
+    /*
+     * cgroup v2 subtree to collect per-cgroup stats from (eg.
+     * "/sys/fs/cgroup/kubepods.slice"), empty to disable. Descendants are
+     * walked down to cgroup_max_depth levels (-1: no limit). The subtree
+     * is walked again every cgroup_rescan_sec seconds (0: every sample),
+     * or at the next sample once a watched cgroup went away: new cgroups
+     * may show up to cgroup_rescan_sec late.
+     */
+    std::string cgroup_path;
+    int cgroup_max_depth;
+    int cgroup_rescan_sec;
+
+    /* Report the top proc_top_n processes (0: none) ranked on PROC_SORT_* */
+    int proc_top_n;
+    int proc_sort_key;
+
+    /*
+     * Also collect interface stats of the other network namespaces found
+     * through netns_sources (NETNS_SRC_*, 0: none), read by a pool of
+     * netns_workers threads kept between samples. Named namespaces need
+     * CAP_SYS_ADMIN, pid ones need to be allowed to ptrace a process of
+     * the namespace. Interfaces go through the iface_include/iface_exclude
+     * filter. Namespaces are looked up again every netns_rescan_sec
+     * seconds (0: every sample), or at the next sample once one could not
+     * be read.
+     */
+    int netns_sources;
+    int netns_workers;
+    int netns_rescan_sec;
+
+    /*
+     * Report capacity and inode usage of mounted filesystems. Mounts are
+     * selected on their mount point with mount_include/mount_exclude
+     * (same patterns as iface_include); pseudo filesystems and bind
+     * mounts of an already selected device are skipped. Note that
+     * statvfs() may block on an unresponsive network filesystem.
+     */
+    bool collect_fs;
+    std::vector<std::string> mount_include;
+    std::vector<std::string> mount_exclude;
+
+    /*
+     * Directories read in place of /proc and /sys ("": the real ones),
+     * eg. "/host/proc" in a container, or a captured tree for tests.
+     * The netlink backend still reads the network namespace of the
+     * caller. ioconf_path replaces /etc/sysconfig/sysstat.ioconf.
+     */
+    std::string proc_root;
+    std::string sys_root;
+    std::string ioconf_path;
+
+    /*
+     * Keep in-memory rollups of the SarInfo fields whose name (see
+     * get_sar_info_values()) matches one of rollup_series (same patterns
+     * as iface_include, none: no rollups), for the first rollup_max_series
+     * of them: every sample is folded into 1 s slots for 10 minutes, 1 min
+     * slots for a day and 1 h slots for 30 days. Rings are allocated when
+     * the config is applied, (600 + 1440 + 720) SarRollupPoint per series,
+     * about 130 kB. They are kept as long as these two settings are not
+     * changed.
+     */
+    std::vector<std::string> rollup_series;
+    int rollup_max_series;
+
+    /*
+     * Keep the raw counters (system-wide, per CPU, disk and interface)
+     * of the last rate_history samples (0: none) for get_sar_rates(),
+     * about 25 kB each. The history is cleared when the size changes.
+     */
+    int rate_history;
+
+    /*
+     * Keep rolling summaries over the last summary_window samples of the
+     * SarInfo fields matching summary_series (as rollup_series), for the
+     * first summary_max_series of them, eg. "info.sar_disk_info.*.await"
+     * and a window of 300 for the p99 await of each disk over 5 minutes
+     * at 1 s. Min and max are exact, quantiles within a relative error of
+     * summary_accuracy. A sample costs O(1) per series. Summaries start
+     * over when any of these settings changes.
+     */
+    std::vector<std::string> summary_series;
+    int summary_window;
+    int summary_max_series;
+    double summary_accuracy;
+
+    /*
+     * Add to each SarInfo a DDSketch (sar_sketch) per pattern of
+     * sketch_series, of the values of all the fields matching it (as
+     * rollup_series) over the last summary_window samples, of relative
+     * accuracy summary_accuracy, eg. "info.sar_disk_info.*.await" for the
+     * latency of every disk. Sketches of any number of hosts combine with
+     * merge_sar_sketch().
+     */
+    std::vector<std::string> sketch_series;
+
+    SarConfig()
+        : allow_virtual(false),
+          rollup_holders(false),
+          net_dev_backend(NET_DEV_AUTO),
+          sysfs_watch_max(8),
+          softnet_squeeze_threshold(1.0),
+          cgroup_max_depth(-1),
+          cgroup_rescan_sec(10),
+          proc_top_n(0),
+          proc_sort_key(PROC_SORT_CPU),
+          netns_sources(0),
+          netns_workers(4),
+          netns_rescan_sec(10),
+          collect_fs(false),
+          rollup_max_series(64),
+          rate_history(0),
+          summary_window(300),
+          summary_max_series(64),
+          summary_accuracy(0.01) {}
+};
+
+void set_sar_config(const SarConfig &config);
+
+/*
+ * Clock of get_sar_info(): sleep_ms() waits between its two samples, and
+ * now_ms() (ms since the epoch) dates the frames of a capture file. NULL
+ * members keep the real clock, except that a replay does not wait.
+ */
+struct SarClock {
+    void (*sleep_ms)(int ms);
+    long long (*now_ms)();
+
+    SarClock() : sleep_ms(NULL), now_ms(NULL) {}
+};
+
+void set_sar_clock(const SarClock &clock);
+
+/*
+ * Record everything the collectors read into a capture file, one frame
+ * per sample, or feed a capture file back through the parsers instead of
+ * /proc and /sys. Only sources read as whole files are captured: the
+ * cgroup, process, netns, mount and cpufreq collectors, NUMA nodes, and
+ * the netlink and sysfs interface backends are off in both modes, so
+ * that a replay reads exactly what was captured. Once a replay is
+ * exhausted, get_sar_info() returns -1.
+ * RETURNS: 0 on success, -1 on error.
+ */
+int sar_capture_open(const char *path);
+int sar_replay_open(const char *path);
+/* Close the capture file and go back to live collection */
+void sar_source_close();
+
 int get_sar_info(SarInfo &sar_info);
 
+/*
+ * Read the counters once into the rate history, without waiting. Only
+ * the sources of the history are read (no cgroup, process, netns...).
+ * get_sar_info() also adds its second sample to the history.
+ * RETURNS: 0 on success, -1 on error or without a history.
+ */
+int sar_sample();
+
+/*
+ * Set the system-wide, per-CPU time, interface and disk rates of
+ * @sar_info between the newest sample of the rate history and the one
+ * whose age is the closest to @window_ms. Nothing is read: any number
+ * of windows can be asked for on the same history.
+ * RETURNS: the window used (ms), -1 if the history is shorter than
+ * @window_ms by more than half a sampling interval, or if both samples
+ * are within the same uptime tick.
+ */
+long long get_sar_rates(long long window_ms, SarInfo &sar_info);
+
+/* Numeric field of a SarInfo */
+struct SarInfoValue {
+    std::string        name;
+    bool               integer;    /* integer field, exact in ivalue */
+    unsigned long long ivalue;
+    double             value;
+};
+
+/*
+ * List the numeric fields set in @sar_info, named after their path in the
+ * message: "info.<field>", "info.<message>.<field>", and for repeated
+ * messages "info.<repeated>.<key>.<field>", the key being the pid of
+ * process and task entries (their comm is not unique), else the first
+ * string field of the entry (device, interface name...), else its first
+ * integer field (cpu number...), else its index.
+ */
+void get_sar_info_values(const SarInfo &sar_info, std::vector<SarInfoValue> &values);
+
+/* Rollup levels */
+enum {
+    SAR_ROLLUP_1S = 0,    /* 600 slots of 1 s */
+    SAR_ROLLUP_1M,        /* 1440 slots of 1 min */
+    SAR_ROLLUP_1H,        /* 720 slots of 1 h */
+    SAR_ROLLUP_LEVELS
+};
+
+/* Aggregate of the samples of a rollup slot */
+struct SarRollupPoint {
+    long long    t;    /* start of the slot, seconds since the epoch */
+    unsigned int count;
+    double       min;
+    double       max;
+    double       sum;    /* average: sum / count */
+    double       last;
+};
+
+/*
+ * Get the slots of a rolled up series at @level (SAR_ROLLUP_*), oldest
+ * first, over the span of the level up to the last sample of the series.
+ * Slots without samples are left out.
+ * RETURNS: 0 on success, -1 if the series is not rolled up.
+ */
+int get_sar_rollup(const std::string &series, int level,
+        std::vector<SarRollupPoint> &points);
+/* Names of the rolled up series */
+void get_sar_rollup_series(std::vector<std::string> &series);
+
+/* Rolling summary of a series over its last samples */
+struct SarSummary {
+    unsigned int        count;    /* samples in the window */
+    double              min;
+    double              max;
+    double              mean;
+    double              stddev;
+    std::vector<double> quantiles;
+
+    SarSummary() : count(0), min(0), max(0), mean(0), stddev(0) {}
+};
+
+/*
+ * Get the rolling summary of @series, with the value of each quantile
+ * (0-1, eg. 0.99) of @quantiles.
+ * RETURNS: 0 on success, -1 if the series is not summarized.
+ */
+int get_sar_summary(const std::string &series, const std::vector<double> &quantiles,
+        SarSummary &summary);
+/* Names of the summarized series */
+void get_sar_summary_series(std::vector<std::string> &series);
+
+/*
+ * Merge sketch @from into @into, which may be empty, eg. the sar_sketch of
+ * the same name of many hosts, for quantiles over the whole fleet.
+ * RETURNS: 0 on success, -1 if their relative accuracies differ.
+ */
+int merge_sar_sketch(SarInfo::SarSketch &into, const SarInfo::SarSketch &from);
+
+/* Value of quantile @q (0-1) of @sketch, within its accuracy, 0 if empty */
+double get_sar_sketch_quantile(const SarInfo::SarSketch &sketch, double q);
+
+/*
+ * Also append the raw stats of the second sample of every get_sar_info()
+ * call to the archive file @path (see sar_stats.h), created if needed,
+ * else appended to after a restart record. The device inventory of a new
+ * archive is the one of its first sample: open one archive per day.
+ * When a record cannot be appended (eg. full disk), get_sar_info()
+ * returns -1, sar_info being still set.
+ * RETURNS: 0 on success, -1 on error.
+ */
+int sar_archive_open(const char *path);
+void sar_archive_close();
+
+/*
+ * Register a stand-in fd, waited on like a PSI trigger (EPOLLPRI or
+ * EPOLLIN), at most 16. The caller owns the fd, and drains it after an
+ * event. It stays registered across set_sar_config(), and is dropped
+ * (not closed) once it reports an error (EPOLLERR).
+ * RETURNS: 0 on success, -1 on error.
+ */
+int add_sar_trigger_fd(int fd);
+
+/*
+ * Wait up to @timeout_ms (-1: forever) for a PSI trigger to fire, then
+ * capture sar_info, so that stalls are sampled exactly when they occur.
+ * Triggers reporting an error are dropped, and the others still waited on.
+ * RETURNS: 1 if a stall was captured, 0 on timeout, -1 on error (no
+ * trigger left, or the sample failed).
+ */
+int get_sar_info_on_stall(SarInfo &sar_info, int timeout_ms);
+
 #endif 	/* _SAR_H */
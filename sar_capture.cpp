@@ -0,0 +1,62 @@
+#include "sar.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+
+/*
+ * Record the sources of a number of samples into a capture file:
+ *     sar_capture <file> [samples]
+ * or replay a capture file through the collector, at full speed:
+ *     sar_capture -r <file>
+ */
+int main(int argc, char *argv[])
+{
+    if (argc >= 3 && !strcmp(argv[1], "-r")) {
+        if (sar_replay_open(argv[2]) < 0) {
+            perror(argv[2]);
+            return 1;
+        }
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        int samples = 0;
+        SarInfo si;
+        /* Nothing is set once the capture file is exhausted */
+        while (get_sar_info(si), si.has_cpu_idle()) {
+            printf("sample %d: user %5.2f system %5.2f idle %5.2f"
+                    " rxpck %8.2f txpck %8.2f tps %8.2f\n",
+                    samples, si.cpu_user(), si.cpu_system(), si.cpu_idle(),
+                    si.rxpck(), si.txpck(), si.tps());
+            samples++;
+            si.Clear();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        printf("%d samples replayed in %.3f ms\n", samples,
+                (end.tv_sec - start.tv_sec) * 1e3 +
+                (end.tv_nsec - start.tv_nsec) / 1e6);
+        sar_source_close();
+        return 0;
+    }
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <file> [samples]\n"
+                "       %s -r <file>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    int samples = argc >= 3 ? atoi(argv[2]) : 10;
+    if (sar_capture_open(argv[1]) < 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    for (int i = 0; i < samples; i++) {
+        SarInfo si;
+        get_sar_info(si);
+    }
+    sar_source_close();
+
+    return 0;
+}
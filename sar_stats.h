@@ -0,0 +1,231 @@
+#ifndef _SAR_STATS_H
+#define _SAR_STATS_H
+
+/*
+ * Raw statistics of a sample, as read by the collectors, and the layout
+ * of the archive files they are appended to.
+ */
+
+#include <ctime>
+#include <cstddef>
+#include <net/if.h>
+
+/* Get IFNAMSIZ */
+#ifndef IFNAMSIZ
+#define IFNAMSIZ    16
+#endif
+
+/* Maximum length of network interface name */
+const int MAX_IFACE_LEN = IFNAMSIZ;
+
+/* Record types */
+const unsigned char R_STATS = 1;    /* sample */
+const unsigned char R_DUMMY = 2;    /* collector restart: no delta across it */
+
+struct FileStats {
+    /* --- LONG LONG --- */
+    /* Machine uptime (multiplied by the # of proc) */
+    unsigned long long uptime            __attribute__ ((aligned (16)));
+    /* Uptime reduced to one processor. Set *only* on SMP machines */
+    unsigned long long uptime0            __attribute__ ((aligned (16)));
+    unsigned long long context_swtch        __attribute__ ((aligned (16)));
+    unsigned long long cpu_user            __attribute__ ((aligned (16)));
+    unsigned long long cpu_nice            __attribute__ ((aligned (16)));
+    unsigned long long cpu_system        __attribute__ ((aligned (16)));
+    unsigned long long cpu_idle            __attribute__ ((aligned (16)));
+    unsigned long long cpu_iowait        __attribute__ ((aligned (16)));
+    unsigned long long cpu_steal            __attribute__ ((aligned (16)));
+    unsigned long long irq_sum            __attribute__ ((aligned (16)));
+    /* --- LONG --- */
+    /* Time stamp (number of seconds since the epoch) */
+    unsigned long ust_time            __attribute__ ((aligned (16)));
+    unsigned long processes            __attribute__ ((aligned (8)));
+    unsigned long pgpgin                __attribute__ ((aligned (8)));
+    unsigned long pgpgout            __attribute__ ((aligned (8)));
+    unsigned long pswpin                __attribute__ ((aligned (8)));
+    unsigned long pswpout            __attribute__ ((aligned (8)));
+    /* Memory stats in kB */
+    unsigned long frmkb                __attribute__ ((aligned (8)));
+    unsigned long bufkb                __attribute__ ((aligned (8)));
+    unsigned long camkb                __attribute__ ((aligned (8)));
+    unsigned long tlmkb                __attribute__ ((aligned (8)));
+    unsigned long frskb                __attribute__ ((aligned (8)));
+    unsigned long tlskb                __attribute__ ((aligned (8)));
+    unsigned long caskb                __attribute__ ((aligned (8)));
+    unsigned long nr_running            __attribute__ ((aligned (8)));
+    unsigned long pgfault            __attribute__ ((aligned (8)));
+    unsigned long pgmajfault            __attribute__ ((aligned (8)));
+    /* --- INT --- */
+    unsigned int  dk_drive            __attribute__ ((aligned (8)));
+    unsigned int  dk_drive_rio            __attribute__ ((packed));
+    unsigned int  dk_drive_wio            __attribute__ ((packed));
+    unsigned int  dk_drive_rblk            __attribute__ ((packed));
+    unsigned int  dk_drive_wblk            __attribute__ ((packed));
+    unsigned int  file_used            __attribute__ ((packed));
+    unsigned int  inode_used            __attribute__ ((packed));
+    unsigned int  super_used            __attribute__ ((packed));
+    unsigned int  super_max            __attribute__ ((packed));
+    unsigned int  dquot_used            __attribute__ ((packed));
+    unsigned int  dquot_max            __attribute__ ((packed));
+    unsigned int  rtsig_queued            __attribute__ ((packed));
+    unsigned int  rtsig_max            __attribute__ ((packed));
+    unsigned int  sock_inuse            __attribute__ ((packed));
+    unsigned int  tcp_inuse            __attribute__ ((packed));
+    unsigned int  udp_inuse            __attribute__ ((packed));
+    unsigned int  raw_inuse            __attribute__ ((packed));
+    unsigned int  frag_inuse            __attribute__ ((packed));
+    unsigned int  dentry_stat            __attribute__ ((packed));
+    unsigned int  load_avg_1            __attribute__ ((packed));
+    unsigned int  load_avg_5            __attribute__ ((packed));
+    unsigned int  load_avg_15            __attribute__ ((packed));
+    unsigned int  nr_threads            __attribute__ ((packed));
+    unsigned int  nfs_rpccnt            __attribute__ ((packed));
+    unsigned int  nfs_rpcretrans            __attribute__ ((packed));
+    unsigned int  nfs_readcnt            __attribute__ ((packed));
+    unsigned int  nfs_writecnt            __attribute__ ((packed));
+    unsigned int  nfs_accesscnt            __attribute__ ((packed));
+    unsigned int  nfs_getattcnt            __attribute__ ((packed));
+    unsigned int  nfsd_rpccnt            __attribute__ ((packed));
+    unsigned int  nfsd_rpcbad            __attribute__ ((packed));
+    unsigned int  nfsd_netcnt            __attribute__ ((packed));
+    unsigned int  nfsd_netudpcnt            __attribute__ ((packed));
+    unsigned int  nfsd_nettcpcnt            __attribute__ ((packed));
+    unsigned int  nfsd_rchits            __attribute__ ((packed));
+    unsigned int  nfsd_rcmisses            __attribute__ ((packed));
+    unsigned int  nfsd_readcnt            __attribute__ ((packed));
+    unsigned int  nfsd_writecnt            __attribute__ ((packed));
+    unsigned int  nfsd_accesscnt            __attribute__ ((packed));
+    unsigned int  nfsd_getattcnt            __attribute__ ((packed));
+    /* --- CHAR --- */
+    /* Record type: R_STATS or R_DUMMY */
+    unsigned char record_type;
+    /*
+     * Time stamp: hour, minute and second.
+     * Used to determine TRUE time (immutable, non locale dependent time).
+     */
+    unsigned char hour;        /* (0-23) */
+    unsigned char minute;        /* (0-59) */
+    unsigned char second;        /* (0-59) */
+};
+
+struct StatsOneCpu {
+    unsigned long long per_cpu_idle        __attribute__ ((aligned (16)));
+    unsigned long long per_cpu_iowait        __attribute__ ((aligned (16)));
+    unsigned long long per_cpu_user        __attribute__ ((aligned (16)));
+    unsigned long long per_cpu_nice        __attribute__ ((aligned (16)));
+    unsigned long long per_cpu_system        __attribute__ ((aligned (16)));
+    unsigned long long per_cpu_steal        __attribute__ ((aligned (16)));
+    unsigned long long pad            __attribute__ ((aligned (16)));
+};
+
+struct DiskStats {
+    unsigned long long rd_sect            __attribute__ ((aligned (16)));
+    unsigned long long wr_sect            __attribute__ ((aligned (16)));
+    unsigned long rd_ticks            __attribute__ ((aligned (16)));
+    unsigned long wr_ticks            __attribute__ ((aligned (8)));
+    unsigned long tot_ticks            __attribute__ ((aligned (8)));
+    unsigned long rq_ticks            __attribute__ ((aligned (8)));
+    unsigned long nr_ios                __attribute__ ((aligned (8)));
+    unsigned int  major                __attribute__ ((aligned (8)));
+    unsigned int  minor                __attribute__ ((packed));
+};
+
+struct StatsNetDev {
+    unsigned long long rx_packets            __attribute__ ((aligned (8)));
+    unsigned long long tx_packets            __attribute__ ((aligned (8)));
+    unsigned long long rx_bytes            __attribute__ ((aligned (8)));
+    unsigned long long tx_bytes            __attribute__ ((aligned (8)));
+    unsigned long long rx_compressed            __attribute__ ((aligned (8)));
+    unsigned long long tx_compressed            __attribute__ ((aligned (8)));
+    unsigned long long multicast            __attribute__ ((aligned (8)));
+    unsigned long long collisions            __attribute__ ((aligned (8)));
+    unsigned long long rx_errors            __attribute__ ((aligned (8)));
+    unsigned long long tx_errors            __attribute__ ((aligned (8)));
+    unsigned long long rx_dropped            __attribute__ ((aligned (8)));
+    unsigned long long tx_dropped            __attribute__ ((aligned (8)));
+    unsigned long long rx_fifo_errors            __attribute__ ((aligned (8)));
+    unsigned long long tx_fifo_errors            __attribute__ ((aligned (8)));
+    unsigned long long rx_frame_errors        __attribute__ ((aligned (8)));
+    unsigned long long tx_carrier_errors        __attribute__ ((aligned (8)));
+    /* Interface index, 0 when not known (/proc/net/dev backend) */
+    int          ifindex                __attribute__ ((aligned (8)));
+    char         interface[MAX_IFACE_LEN]    __attribute__ ((aligned (8)));
+};
+
+/*
+ * Archive files: a header, the device inventory, then one fixed-size
+ * record per sample, appended as they are taken. A record is a FileStats
+ * followed by a StatsOneCpu per CPU, then the DiskStats and StatsNetDev
+ * of each inventory slot (zeroed when the device is gone). Like sa
+ * files, an archive holds one day, and its index gives the first record
+ * of each minute of that day.
+ */
+#define SAR_ARCHIVE_MAGIC    "SARARC01"
+const unsigned int SAR_ARCHIVE_VERSION = 1;
+const int SAR_ARCHIVE_INDEX_NR = 24 * 60;
+const int SAR_ARCHIVE_NAME_LEN = 128;
+
+struct SarArchiveHeader {
+    char         magic[8];
+    unsigned int version;
+    unsigned int header_size;    /* offset of the first record */
+    unsigned int record_size;
+    int          hz;
+    int          cpu_nr;
+    int          disk_nr;    /* number of SarArchiveDisk after the header */
+    int          iface_nr;    /* number of SarArchiveIface after the disks */
+    long long    day_start;    /* 00:00:00 UTC of the archived day */
+    char         nodename[65];
+    char         sysname[65];
+    char         release[65];
+    char         machine[65];
+    /* 1 + number of the first record of each minute, 0: no record */
+    unsigned int index[SAR_ARCHIVE_INDEX_NR];
+};
+
+/* Disk inventory slot */
+struct SarArchiveDisk {
+    unsigned int major;
+    unsigned int minor;
+    char         name[SAR_ARCHIVE_NAME_LEN];
+};
+
+/* Interface inventory slot */
+struct SarArchiveIface {
+    char         name[MAX_IFACE_LEN];
+};
+
+/* Archive file mapped for reading */
+struct SarArchive {
+    int                     fd;
+    const char             *base;
+    size_t                  size;
+    const SarArchiveHeader *hdr;
+    unsigned int            nr_records;
+};
+
+/*
+ * Map an archive file. Records appended later are seen after mapping it
+ * again.
+ * RETURNS: 0 on success, -1 on error (errno set).
+ */
+int sar_archive_map(const char *path, SarArchive &ar);
+void sar_archive_unmap(SarArchive &ar);
+
+/* Inventory of the archive */
+const SarArchiveDisk *sar_archive_disks(const SarArchive &ar);
+const SarArchiveIface *sar_archive_ifaces(const SarArchive &ar);
+
+/* Record @i, and its per-CPU, per-disk and per-interface parts */
+const FileStats *sar_archive_record(const SarArchive &ar, unsigned int i);
+const StatsOneCpu *sar_archive_cpus(const SarArchive &ar, unsigned int i);
+const DiskStats *sar_archive_disk_stats(const SarArchive &ar, unsigned int i);
+const StatsNetDev *sar_archive_iface_stats(const SarArchive &ar, unsigned int i);
+
+/*
+ * Find the first record taken at or after @t, through the minute index.
+ * RETURNS: record number, nr_records if there is none.
+ */
+unsigned int sar_archive_find(const SarArchive &ar, time_t t);
+
+#endif     /* _SAR_STATS_H */
@@ -0,0 +1,1075 @@
+
+#include "sar_store.h"
+#include "sar.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cstddef>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fnmatch.h>
+
+#include <algorithm>
+#include <cmath>
+
+/*
+ ***************************************************************************
+ * Bit streams, most significant bit first.
+ ***************************************************************************
+ */
+
+class BitWriter {
+public:
+    BitWriter(std::string &out) : out_(out), acc_(0), nbits_(0) {}
+
+    void put(unsigned long long v, int bits)
+    {
+        if (bits > 56) {
+            put(v >> 32, bits - 32);
+            put(v & 0xffffffffULL, 32);
+            return;
+        }
+        if (bits < 64) {
+            v &= (1ULL << bits) - 1;
+        }
+        acc_ = (acc_ << bits) | v;
+        nbits_ += bits;
+        while (nbits_ >= 8) {
+            nbits_ -= 8;
+            out_.push_back((char) (acc_ >> nbits_));
+        }
+    }
+
+    /* Pad the last byte with zeros */
+    void flush()
+    {
+        if (nbits_) {
+            out_.push_back((char) (acc_ << (8 - nbits_)));
+            nbits_ = 0;
+        }
+        acc_ = 0;
+    }
+
+private:
+    std::string       &out_;
+    unsigned long long acc_;
+    int                nbits_;
+};
+
+class BitReader {
+public:
+    BitReader(const unsigned char *data, size_t len)
+        : p_(data), end_(data + len), buf_(0), avail_(0) {}
+
+    /* Next bits, at least 56 valid, without consuming them */
+    unsigned long long peek()
+    {
+        if (avail_ < 56) {
+            if (p_ + 8 <= end_) {
+                unsigned long long w;
+                memcpy(&w, p_, 8);
+                buf_ |= __builtin_bswap64(w) >> avail_;
+                p_ += (63 - avail_) >> 3;
+                avail_ |= 56;
+            }
+            else {
+                while (avail_ <= 56) {
+                    buf_ |= (unsigned long long) (p_ < end_ ? *p_ : 0) << (56 - avail_);
+                    p_++;
+                    avail_ += 8;
+                }
+            }
+        }
+        return buf_;
+    }
+
+    /* Consume @bits, at most what peek() made valid */
+    void skip(int bits)
+    {
+        buf_ = bits < 64 ? buf_ << bits : 0;
+        avail_ -= bits;
+    }
+
+    unsigned long long get(int bits)
+    {
+        if (bits > 56) {
+            unsigned long long hi = get(bits - 32);
+            return (hi << 32) | get(32);
+        }
+        if (!bits) {
+            return 0;
+        }
+        unsigned long long v = peek() >> (64 - bits);
+        skip(bits);
+        return v;
+    }
+
+private:
+    const unsigned char *p_;
+    const unsigned char *end_;
+    unsigned long long   buf_;    /* next bits, most significant first */
+    int                  avail_;
+};
+
+/*
+ ***************************************************************************
+ * Column codecs.
+ * Integers: the first value, then the zigzagged difference between
+ * consecutive deltas in a prefix-coded number of bits, so that a counter
+ * growing at a steady rate costs a bit per value.
+ * Doubles: the first value, then the XOR with the previous value, written
+ * as the meaningful bits between its leading and trailing zeros, reusing
+ * the previous window when they fit in it (Gorilla).
+ ***************************************************************************
+ */
+
+/*
+ * Prefix (value, length) and payload bits of the delta-of-delta buckets,
+ * the number of leading 1s of the prefix giving the bucket
+ */
+static const struct {
+    unsigned int prefix;
+    int          prefix_len;
+    int          bits;
+} dod_buckets[] = {
+    { 0x0, 1, 0 },
+    { 0x2, 2, 7 },
+    { 0x6, 3, 12 },
+    { 0xe, 4, 20 },
+    { 0x1e, 5, 32 },
+    { 0x1f, 5, 64 }
+};
+#define DOD_BUCKETS_NR    (sizeof(dod_buckets) / sizeof(dod_buckets[0]))
+
+static void encode_integers(const std::vector<unsigned long long> &values,
+        std::string &out)
+{
+    BitWriter bw(out);
+    unsigned long long prev = 0, prev_delta = 0;
+
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!i) {
+            bw.put(values[0], 64);
+            prev = values[0];
+            continue;
+        }
+        unsigned long long delta = values[i] - prev;
+        long long dod = (long long) (delta - prev_delta);
+        unsigned long long zz = ((unsigned long long) dod << 1) ^ (unsigned long long) (dod >> 63);
+        prev = values[i];
+        prev_delta = delta;
+
+        for (size_t b = 0; b < DOD_BUCKETS_NR; b++) {
+            if (dod_buckets[b].bits == 64 || zz < (1ULL << dod_buckets[b].bits)) {
+                bw.put(dod_buckets[b].prefix, dod_buckets[b].prefix_len);
+                bw.put(zz, dod_buckets[b].bits);
+                break;
+            }
+        }
+    }
+    bw.flush();
+}
+
+/* Decoders pass each value to @out(i, value) */
+template <typename OutFn>
+static void decode_integers(BitReader &br, unsigned int count, OutFn out)
+{
+    unsigned long long prev = 0, prev_delta = 0;
+
+    for (unsigned int i = 0; i < count; i++) {
+        if (!i) {
+            prev = br.get(64);
+            out(0, prev);
+            continue;
+        }
+        unsigned long long w = br.peek();
+        unsigned long long zz = 0;
+        if (!(w >> 63)) {
+            br.skip(1);
+        }
+        else {
+            int ones = __builtin_clzll(~w | 1);
+            size_t b = ones < (int) DOD_BUCKETS_NR ? ones : DOD_BUCKETS_NR - 1;
+            int prefix_len = dod_buckets[b].prefix_len;
+            int bits = dod_buckets[b].bits;
+            if (bits < 64) {
+                zz = (w << prefix_len) >> (64 - bits);
+                br.skip(prefix_len + bits);
+            }
+            else {
+                br.skip(prefix_len);
+                zz = br.get(bits);
+            }
+        }
+        unsigned long long dod = (zz >> 1) ^ (0ULL - (zz & 1));
+        prev_delta += dod;
+        prev += prev_delta;
+        out(i, prev);
+    }
+}
+
+static void encode_doubles(const std::vector<unsigned long long> &values,
+        std::string &out)
+{
+    BitWriter bw(out);
+    unsigned long long prev = 0;
+    int prev_lead = -1, prev_trail = 0;
+
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!i) {
+            bw.put(values[0], 64);
+            prev = values[0];
+            continue;
+        }
+        unsigned long long x = values[i] ^ prev;
+        prev = values[i];
+        if (!x) {
+            bw.put(0, 1);
+            continue;
+        }
+        int lead = __builtin_clzll(x);
+        int trail = __builtin_ctzll(x);
+        if (lead > 31) {
+            lead = 31;
+        }
+        if (prev_lead >= 0 && lead >= prev_lead && trail >= prev_trail) {
+            /* Fits in the previous window */
+            bw.put(0x2, 2);
+            bw.put(x >> prev_trail, 64 - prev_lead - prev_trail);
+        }
+        else {
+            int sig = 64 - lead - trail;
+            bw.put(0x3, 2);
+            bw.put(lead, 5);
+            bw.put(sig - 1, 6);
+            bw.put(x >> trail, sig);
+            prev_lead = lead;
+            prev_trail = trail;
+        }
+    }
+    bw.flush();
+}
+
+template <typename OutFn>
+static void decode_doubles(BitReader &br, unsigned int count, OutFn out)
+{
+    unsigned long long prev = 0;
+    int lead = 0, trail = 0;
+
+    for (unsigned int i = 0; i < count; i++) {
+        if (!i) {
+            prev = br.get(64);
+            out(0, prev);
+            continue;
+        }
+        unsigned long long w = br.peek();
+        if (!(w >> 63)) {
+            br.skip(1);
+        }
+        else {
+            if ((w >> 62) & 1) {
+                lead = (w >> 57) & 0x1f;
+                int sig = ((w >> 51) & 0x3f) + 1;
+                /* Negative only in corrupt data */
+                trail = std::max(64 - lead - sig, 0);
+                br.skip(13);
+            }
+            else {
+                br.skip(2);
+            }
+            prev ^= br.get(64 - lead - trail) << trail;
+        }
+        out(i, prev);
+    }
+}
+
+/*
+ ***************************************************************************
+ * Writer.
+ ***************************************************************************
+ */
+
+static int write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = (const char *) buf;
+    while (len) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * Walk the chunks of a store file, calling @on_series for series
+ * definitions, and @on_block for blocks.
+ * RETURNS: offset of the end of the last complete chunk.
+ */
+template <typename SeriesFn, typename BlockFn>
+static size_t walk_chunks(const unsigned char *base, size_t size,
+        SeriesFn on_series, BlockFn on_block)
+{
+    size_t off = sizeof(SAR_STORE_MAGIC) - 1;
+
+    while (off + 4 <= size) {
+        if (!memcmp(base + off, SAR_STORE_SERIES_MAGIC, 4)) {
+            SarStoreSeriesHeader sh;
+            if (off + sizeof(sh) > size) {
+                break;
+            }
+            memcpy(&sh, base + off, sizeof(sh));
+            if (off + sizeof(sh) + sh.name_len > size) {
+                break;
+            }
+            on_series(sh, std::string((const char *) base + off + sizeof(sh),
+                        sh.name_len));
+            off += sizeof(sh) + sh.name_len;
+        }
+        else if (!memcmp(base + off, SAR_STORE_BLOCK_MAGIC, 4)) {
+            /* Not aligned, after names of any length: copy it out */
+            SarStoreBlockHeader bh;
+            if (off + sizeof(bh) > size) {
+                break;
+            }
+            memcpy(&bh, base + off, sizeof(bh));
+            if (off + sizeof(bh) + bh.size > size) {
+                break;
+            }
+            on_block(bh, base + off + sizeof(bh));
+            off += sizeof(bh) + bh.size;
+        }
+        else {
+            break;
+        }
+    }
+    return off;
+}
+
+int sar_store_open(SarStore &st, const char *path)
+{
+    sar_store_close(st);
+
+    int fd;
+    if ((fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644)) < 0) {
+        return -1;
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    size_t magic_len = sizeof(SAR_STORE_MAGIC) - 1;
+    if (sb.st_size == 0) {
+        if (write_all(fd, SAR_STORE_MAGIC, magic_len) < 0) {
+            close(fd);
+            return -1;
+        }
+    }
+    else {
+        /* Reload the series, and drop a partly written last chunk */
+        void *base = MAP_FAILED;
+        if ((size_t) sb.st_size < magic_len ||
+                (base = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0)) ==
+                MAP_FAILED || memcmp(base, SAR_STORE_MAGIC, magic_len)) {
+            if (base != MAP_FAILED) {
+                munmap(base, sb.st_size);
+            }
+            close(fd);
+            errno = EINVAL;
+            return -1;
+        }
+        size_t end = walk_chunks((const unsigned char *) base, sb.st_size,
+                [&](const SarStoreSeriesHeader &sh, const std::string &name) {
+                    if (sh.id == st.series.size()) {
+                        st.ids[name] = sh.id;
+                        st.series.push_back(SarStoreSeries{name, sh.type});
+                    }
+                },
+                [](const SarStoreBlockHeader &, const unsigned char *) {});
+        munmap(base, sb.st_size);
+        if (end < (size_t) sb.st_size && ftruncate(fd, end) < 0) {
+            close(fd);
+            st.series.clear();
+            st.ids.clear();
+            return -1;
+        }
+    }
+    if (lseek(fd, 0, SEEK_END) < 0) {
+        close(fd);
+        st.series.clear();
+        st.ids.clear();
+        return -1;
+    }
+
+    st.fd = fd;
+    st.nr_written = st.series.size();
+    st.buffers.assign(st.series.size(), SarStoreBuffer());
+    st.ts.clear();
+    st.in_row = false;
+    return 0;
+}
+
+int sar_store_close(SarStore &st)
+{
+    int rc = 0;
+
+    if (st.fd >= 0) {
+        rc = sar_store_flush(st);
+        close(st.fd);
+        st.fd = -1;
+    }
+    st.series.clear();
+    st.ids.clear();
+    st.buffers.clear();
+    st.ts.clear();
+    st.nr_written = 0;
+    st.in_row = false;
+    return rc;
+}
+
+void sar_store_begin_row(SarStore &st, long long t_ms)
+{
+    st.ts.push_back(t_ms);
+    st.in_row = true;
+}
+
+static void set_value(SarStore &st, const std::string &name, unsigned int type,
+        unsigned long long value)
+{
+    if (!st.in_row) {
+        return;
+    }
+
+    unsigned int id;
+    std::unordered_map<std::string, unsigned int>::const_iterator it =
+        st.ids.find(name);
+    if (it != st.ids.end()) {
+        id = it->second;
+        if (st.series[id].type != type) {
+            return;
+        }
+    }
+    else {
+        id = st.series.size();
+        st.ids[name] = id;
+        st.series.push_back(SarStoreSeries{name, type});
+        st.buffers.push_back(SarStoreBuffer());
+    }
+
+    SarStoreBuffer &buf = st.buffers[id];
+    unsigned int row = st.ts.size() - 1;
+    if (!buf.rows.empty() && buf.rows.back() == row) {
+        buf.values.back() = value;
+    }
+    else {
+        buf.rows.push_back(row);
+        buf.values.push_back(value);
+    }
+}
+
+void sar_store_set_integer(SarStore &st, const std::string &name,
+        unsigned long long value)
+{
+    set_value(st, name, SERIES_INTEGER, value);
+}
+
+void sar_store_set_double(SarStore &st, const std::string &name, double value)
+{
+    unsigned long long bits;
+    memcpy(&bits, &value, sizeof(bits));
+    set_value(st, name, SERIES_DOUBLE, bits);
+}
+
+int sar_store_end_row(SarStore &st)
+{
+    st.in_row = false;
+    if (st.ts.size() >= st.block_rows) {
+        return sar_store_flush(st);
+    }
+    return 0;
+}
+
+static double column_value(unsigned int type, unsigned long long v)
+{
+    if (type == SERIES_DOUBLE) {
+        double d;
+        memcpy(&d, &v, sizeof(d));
+        return d;
+    }
+    return (double) (long long) v;
+}
+
+int sar_store_flush(SarStore &st)
+{
+    if (st.fd < 0 || st.ts.empty()) {
+        return 0;
+    }
+    unsigned int nr_rows = st.ts.size();
+
+    /* Definitions of the series new to the file */
+    std::string chunk;
+    for (; st.nr_written < st.series.size(); st.nr_written++) {
+        const SarStoreSeries &s = st.series[st.nr_written];
+        SarStoreSeriesHeader sh;
+        memcpy(sh.magic, SAR_STORE_SERIES_MAGIC, sizeof(sh.magic));
+        sh.id = st.nr_written;
+        sh.type = s.type;
+        sh.name_len = s.name.size();
+        chunk.append((const char *) &sh, sizeof(sh));
+        chunk.append(s.name);
+    }
+
+    /* Timestamp column, then a column per series with values */
+    std::string data;
+    std::vector<unsigned long long> ts(st.ts.begin(), st.ts.end());
+    encode_integers(ts, data);
+    unsigned int ts_length = data.size();
+
+    std::vector<SarStoreColumn> columns;
+    for (unsigned int id = 0; id < st.buffers.size(); id++) {
+        SarStoreBuffer &buf = st.buffers[id];
+        if (buf.values.empty()) {
+            continue;
+        }
+        SarStoreColumn col;
+        col.series = id;
+        col.offset = data.size();
+        col.count = buf.values.size();
+        col.min = col.max = column_value(st.series[id].type, buf.values[0]);
+        for (size_t i = 1; i < buf.values.size(); i++) {
+            double v = column_value(st.series[id].type, buf.values[i]);
+            col.min = std::min(col.min, v);
+            col.max = std::max(col.max, v);
+        }
+        /* Sparse columns start with a bitmap of the rows with a value */
+        if (col.count < nr_rows) {
+            std::string bitmap((nr_rows + 7) / 8, '\0');
+            for (size_t i = 0; i < buf.rows.size(); i++) {
+                bitmap[buf.rows[i] >> 3] |= 0x80 >> (buf.rows[i] & 7);
+            }
+            data.append(bitmap);
+        }
+        if (st.series[id].type == SERIES_DOUBLE) {
+            encode_doubles(buf.values, data);
+        }
+        else {
+            encode_integers(buf.values, data);
+        }
+        col.length = data.size() - col.offset;
+        columns.push_back(col);
+
+        buf.rows.clear();
+        buf.values.clear();
+    }
+
+    SarStoreBlockHeader bh;
+    memset(&bh, 0, sizeof(bh));
+    memcpy(bh.magic, SAR_STORE_BLOCK_MAGIC, sizeof(bh.magic));
+    bh.nr_rows = nr_rows;
+    bh.nr_columns = columns.size();
+    bh.size = columns.size() * sizeof(SarStoreColumn) + data.size();
+    bh.t_first = st.ts.front();
+    bh.t_last = st.ts.back();
+    bh.ts_length = ts_length;
+    chunk.append((const char *) &bh, sizeof(bh));
+    if (!columns.empty()) {
+        chunk.append((const char *) &columns[0],
+                columns.size() * sizeof(SarStoreColumn));
+    }
+    chunk.append(data);
+    st.ts.clear();
+
+    return write_all(st.fd, chunk.data(), chunk.size());
+}
+
+/*
+ ***************************************************************************
+ * Adapters.
+ ***************************************************************************
+ */
+
+#define FIELD(s, f)    { #f, offsetof(s, f), sizeof(((s *) 0)->f) }
+
+struct StatsField {
+    const char *name;
+    size_t      offset;
+    size_t      size;
+};
+
+static const StatsField file_stats_fields[] = {
+    FIELD(FileStats, uptime), FIELD(FileStats, uptime0),
+    FIELD(FileStats, context_swtch), FIELD(FileStats, cpu_user),
+    FIELD(FileStats, cpu_nice), FIELD(FileStats, cpu_system),
+    FIELD(FileStats, cpu_idle), FIELD(FileStats, cpu_iowait),
+    FIELD(FileStats, cpu_steal), FIELD(FileStats, irq_sum),
+    FIELD(FileStats, processes), FIELD(FileStats, pgpgin),
+    FIELD(FileStats, pgpgout), FIELD(FileStats, pswpin),
+    FIELD(FileStats, pswpout), FIELD(FileStats, frmkb),
+    FIELD(FileStats, bufkb), FIELD(FileStats, camkb),
+    FIELD(FileStats, tlmkb), FIELD(FileStats, frskb),
+    FIELD(FileStats, tlskb), FIELD(FileStats, caskb),
+    FIELD(FileStats, nr_running), FIELD(FileStats, pgfault),
+    FIELD(FileStats, pgmajfault), FIELD(FileStats, dk_drive),
+    FIELD(FileStats, dk_drive_rio), FIELD(FileStats, dk_drive_wio),
+    FIELD(FileStats, dk_drive_rblk), FIELD(FileStats, dk_drive_wblk),
+    FIELD(FileStats, file_used), FIELD(FileStats, inode_used),
+    FIELD(FileStats, super_used), FIELD(FileStats, super_max),
+    FIELD(FileStats, dquot_used), FIELD(FileStats, dquot_max),
+    FIELD(FileStats, rtsig_queued), FIELD(FileStats, rtsig_max),
+    FIELD(FileStats, sock_inuse), FIELD(FileStats, tcp_inuse),
+    FIELD(FileStats, udp_inuse), FIELD(FileStats, raw_inuse),
+    FIELD(FileStats, frag_inuse), FIELD(FileStats, dentry_stat),
+    FIELD(FileStats, load_avg_1), FIELD(FileStats, load_avg_5),
+    FIELD(FileStats, load_avg_15), FIELD(FileStats, nr_threads),
+    FIELD(FileStats, nfs_rpccnt), FIELD(FileStats, nfs_rpcretrans),
+    FIELD(FileStats, nfs_readcnt), FIELD(FileStats, nfs_writecnt),
+    FIELD(FileStats, nfs_accesscnt), FIELD(FileStats, nfs_getattcnt),
+    FIELD(FileStats, nfsd_rpccnt), FIELD(FileStats, nfsd_rpcbad),
+    FIELD(FileStats, nfsd_netcnt), FIELD(FileStats, nfsd_netudpcnt),
+    FIELD(FileStats, nfsd_nettcpcnt), FIELD(FileStats, nfsd_rchits),
+    FIELD(FileStats, nfsd_rcmisses), FIELD(FileStats, nfsd_readcnt),
+    FIELD(FileStats, nfsd_writecnt), FIELD(FileStats, nfsd_accesscnt),
+    FIELD(FileStats, nfsd_getattcnt)
+};
+
+static const StatsField cpu_fields[] = {
+    FIELD(StatsOneCpu, per_cpu_idle), FIELD(StatsOneCpu, per_cpu_iowait),
+    FIELD(StatsOneCpu, per_cpu_user), FIELD(StatsOneCpu, per_cpu_nice),
+    FIELD(StatsOneCpu, per_cpu_system), FIELD(StatsOneCpu, per_cpu_steal)
+};
+
+static const StatsField disk_fields[] = {
+    FIELD(DiskStats, rd_sect), FIELD(DiskStats, wr_sect),
+    FIELD(DiskStats, rd_ticks), FIELD(DiskStats, wr_ticks),
+    FIELD(DiskStats, tot_ticks), FIELD(DiskStats, rq_ticks),
+    FIELD(DiskStats, nr_ios)
+};
+
+static const StatsField net_fields[] = {
+    FIELD(StatsNetDev, rx_packets), FIELD(StatsNetDev, tx_packets),
+    FIELD(StatsNetDev, rx_bytes), FIELD(StatsNetDev, tx_bytes),
+    FIELD(StatsNetDev, rx_compressed), FIELD(StatsNetDev, tx_compressed),
+    FIELD(StatsNetDev, multicast), FIELD(StatsNetDev, collisions),
+    FIELD(StatsNetDev, rx_errors), FIELD(StatsNetDev, tx_errors),
+    FIELD(StatsNetDev, rx_dropped), FIELD(StatsNetDev, tx_dropped),
+    FIELD(StatsNetDev, rx_fifo_errors), FIELD(StatsNetDev, tx_fifo_errors),
+    FIELD(StatsNetDev, rx_frame_errors), FIELD(StatsNetDev, tx_carrier_errors)
+};
+
+#undef FIELD
+
+static void set_fields(SarStore &st, const std::string &prefix,
+        const void *stats, const StatsField *fields, size_t nr)
+{
+    for (size_t i = 0; i < nr; i++) {
+        const char *p = (const char *) stats + fields[i].offset;
+        unsigned long long v;
+        if (fields[i].size == sizeof(unsigned long long)) {
+            memcpy(&v, p, sizeof(v));
+        }
+        else {
+            unsigned int u;
+            memcpy(&u, p, sizeof(u));
+            v = u;
+        }
+        sar_store_set_integer(st, prefix + fields[i].name, v);
+    }
+}
+
+void sar_store_set_record(SarStore &st, const SarArchive &ar, unsigned int i)
+{
+    const FileStats *fs = sar_archive_record(ar, i);
+    if (fs->record_type != R_STATS) {
+        return;
+    }
+    set_fields(st, "stat.", fs, file_stats_fields,
+            sizeof(file_stats_fields) / sizeof(file_stats_fields[0]));
+
+    const StatsOneCpu *cpus = sar_archive_cpus(ar, i);
+    for (int c = 0; c < ar.hdr->cpu_nr; c++) {
+        char prefix[32];
+        snprintf(prefix, sizeof(prefix), "cpu%d.", c);
+        set_fields(st, prefix, &cpus[c], cpu_fields,
+                sizeof(cpu_fields) / sizeof(cpu_fields[0]));
+    }
+
+    /* Zeroed slots are devices gone at the time of the record */
+    const SarArchiveDisk *disks = sar_archive_disks(ar);
+    const DiskStats *ds = sar_archive_disk_stats(ar, i);
+    for (int d = 0; d < ar.hdr->disk_nr; d++) {
+        if (!ds[d].major && !ds[d].minor) {
+            continue;
+        }
+        set_fields(st, std::string("disk.") + disks[d].name + ".", &ds[d],
+                disk_fields, sizeof(disk_fields) / sizeof(disk_fields[0]));
+    }
+
+    const SarArchiveIface *ifaces = sar_archive_ifaces(ar);
+    const StatsNetDev *nd = sar_archive_iface_stats(ar, i);
+    for (int n = 0; n < ar.hdr->iface_nr; n++) {
+        if (!nd[n].interface[0]) {
+            continue;
+        }
+        set_fields(st, std::string("net.") + ifaces[n].name + ".", &nd[n],
+                net_fields, sizeof(net_fields) / sizeof(net_fields[0]));
+    }
+}
+
+void sar_store_set_info(SarStore &st, const SarInfo &sar_info)
+{
+    std::vector<SarInfoValue> values;
+
+    get_sar_info_values(sar_info, values);
+    for (size_t i = 0; i < values.size(); i++) {
+        if (values[i].integer) {
+            sar_store_set_integer(st, values[i].name, values[i].ivalue);
+        }
+        else {
+            sar_store_set_double(st, values[i].name, values[i].value);
+        }
+    }
+}
+
+/*
+ ***************************************************************************
+ * Reader.
+ ***************************************************************************
+ */
+
+int sar_store_map(const char *path, SarStoreReader &rd)
+{
+    sar_store_unmap(rd);
+
+    if ((rd.fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) {
+        return -1;
+    }
+    struct stat sb;
+    void *base;
+    size_t magic_len = sizeof(SAR_STORE_MAGIC) - 1;
+    if (fstat(rd.fd, &sb) < 0 || (size_t) sb.st_size < magic_len ||
+            (base = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, rd.fd, 0)) ==
+            MAP_FAILED) {
+        close(rd.fd);
+        rd.fd = -1;
+        errno = errno ? errno : EINVAL;
+        return -1;
+    }
+    rd.base = (const unsigned char *) base;
+    rd.size = sb.st_size;
+    if (memcmp(rd.base, SAR_STORE_MAGIC, magic_len)) {
+        sar_store_unmap(rd);
+        errno = EINVAL;
+        return -1;
+    }
+
+    walk_chunks(rd.base, rd.size,
+            [&](const SarStoreSeriesHeader &sh, const std::string &name) {
+                if (sh.id == rd.series.size()) {
+                    rd.ids[name] = sh.id;
+                    rd.series.push_back(SarStoreSeries{name, sh.type});
+                }
+            },
+            [&](const SarStoreBlockHeader &bh, const unsigned char *body) {
+                size_t dir_len = (size_t) bh.nr_columns * sizeof(SarStoreColumn);
+                if (dir_len > bh.size || bh.ts_length > bh.size - dir_len ||
+                        bh.nr_rows > (size_t) bh.ts_length * 8) {
+                    /* Corrupt block: skipped */
+                    return;
+                }
+                rd.blocks.push_back(SarStoreBlock());
+                SarStoreBlock &b = rd.blocks.back();
+                b.hdr = bh;
+                b.columns.resize(bh.nr_columns);
+                if (dir_len) {
+                    memcpy(&b.columns[0], body, dir_len);
+                }
+                b.data = body + dir_len;
+                b.data_len = bh.size - dir_len;
+            });
+    return 0;
+}
+
+void sar_store_unmap(SarStoreReader &rd)
+{
+    if (rd.base != NULL) {
+        munmap((void *) rd.base, rd.size);
+    }
+    if (rd.fd >= 0) {
+        close(rd.fd);
+    }
+    rd.fd = -1;
+    rd.base = NULL;
+    rd.size = 0;
+    rd.series.clear();
+    rd.ids.clear();
+    rd.blocks.clear();
+}
+
+const SarStoreColumn *sar_store_find_column(const SarStoreReader &rd,
+        size_t b, unsigned int id)
+{
+    /* Columns are sorted on series */
+    const SarStoreColumn *first = rd.blocks[b].columns.data();
+    const SarStoreColumn *last = first + rd.blocks[b].columns.size();
+    const SarStoreColumn *col = std::lower_bound(first, last, id,
+            [](const SarStoreColumn &c, unsigned int s) { return c.series < s; });
+
+    return col != last && col->series == id ? col : NULL;
+}
+
+void sar_store_decode_ts(const SarStoreReader &rd, size_t b,
+        std::vector<long long> &ts)
+{
+    const SarStoreBlock &blk = rd.blocks[b];
+    BitReader br(blk.data, blk.hdr.ts_length);
+
+    ts.resize(blk.hdr.nr_rows);
+    long long *out = ts.data();
+    decode_integers(br, blk.hdr.nr_rows,
+            [out](unsigned int i, unsigned long long v) { out[i] = v; });
+}
+
+void sar_store_decode_column(const SarStoreReader &rd, size_t b,
+        const SarStoreColumn *col, std::vector<unsigned int> &rows,
+        std::vector<double> &values)
+{
+    const SarStoreBlock &blk = rd.blocks[b];
+    unsigned int nr_rows = blk.hdr.nr_rows;
+
+    rows.clear();
+    values.clear();
+    if (col->offset > blk.data_len || col->length > blk.data_len - col->offset ||
+            col->count > nr_rows || col->series >= rd.series.size()) {
+        /* Corrupt column */
+        return;
+    }
+    const unsigned char *p = blk.data + col->offset;
+    size_t len = col->length;
+
+    if (col->count < nr_rows) {
+        size_t bitmap_len = (nr_rows + 7) / 8;
+        if (bitmap_len > len) {
+            return;
+        }
+        for (unsigned int r = 0; r < nr_rows; r++) {
+            if (p[r >> 3] & (0x80 >> (r & 7))) {
+                rows.push_back(r);
+            }
+        }
+        if (rows.size() != col->count) {
+            /* Corrupt bitmap */
+            rows.clear();
+            return;
+        }
+        p += bitmap_len;
+        len -= bitmap_len;
+    }
+
+    BitReader br(p, len);
+    values.resize(col->count);
+    double *out = values.data();
+    if (rd.series[col->series].type == SERIES_DOUBLE) {
+        decode_doubles(br, col->count,
+                [out](unsigned int i, unsigned long long v) { memcpy(&out[i], &v, sizeof(double)); });
+    }
+    else {
+        decode_integers(br, col->count,
+                [out](unsigned int i, unsigned long long v) { out[i] = (double) (long long) v; });
+    }
+}
+
+/*
+ ***************************************************************************
+ * Queries.
+ ***************************************************************************
+ */
+
+/* Current bucket of a series */
+struct QueryBucket {
+    long long           start;
+    long long           end;
+    unsigned long long  count;
+    double              value;    /* min, max, sum or last so far */
+    std::vector<double> values;    /* percentile: every value */
+};
+
+static long long bucket_start(const SarStoreQuery &q, long long t)
+{
+    return q.step_ms ? q.t_start + (t - q.t_start) / q.step_ms * q.step_ms : q.t_start;
+}
+
+static void close_bucket(const SarStoreQuery &q, QueryBucket &bucket,
+        SarStoreResult &res)
+{
+    if (!bucket.count) {
+        return;
+    }
+    res.t.push_back(bucket.start);
+    if (q.agg == SAR_AGG_AVG) {
+        res.values.push_back(bucket.value / bucket.count);
+    }
+    else if (q.agg == SAR_AGG_PERCENTILE) {
+        /* Nearest rank */
+        std::vector<double> &values = bucket.values;
+        size_t rank = (size_t) ceil(q.percentile / 100 * values.size());
+        rank = rank ? rank - 1 : 0;
+        if (rank >= values.size()) {
+            rank = values.size() - 1;
+        }
+        std::nth_element(values.begin(), values.begin() + rank, values.end());
+        res.values.push_back(values[rank]);
+        values.clear();
+    }
+    else {
+        res.values.push_back(bucket.value);
+    }
+    bucket.count = 0;
+}
+
+/* Add a value at @t, in the range of the query */
+static inline void add_to_bucket(const SarStoreQuery &q, QueryBucket &bucket,
+        SarStoreResult &res, long long t, double v)
+{
+    if (t >= bucket.end || t < bucket.start) {
+        close_bucket(q, bucket, res);
+        bucket.start = bucket_start(q, t);
+        bucket.end = q.step_ms ? bucket.start + q.step_ms : q.t_end;
+    }
+    if (!bucket.count++) {
+        bucket.value = q.agg == SAR_AGG_AVG ? 0 : v;
+    }
+    switch (q.agg) {
+    case SAR_AGG_MIN:
+        bucket.value = v < bucket.value ? v : bucket.value;
+        break;
+    case SAR_AGG_MAX:
+        bucket.value = v > bucket.value ? v : bucket.value;
+        break;
+    case SAR_AGG_AVG:
+        bucket.value += v;
+        break;
+    case SAR_AGG_LAST:
+        bucket.value = v;
+        break;
+    default:
+        bucket.values.push_back(v);
+        break;
+    }
+}
+
+int sar_store_query(const SarStoreReader &rd, const SarStoreQuery &q,
+        std::vector<SarStoreResult> &results)
+{
+    results.clear();
+    if (q.t_end <= q.t_start || q.step_ms < 0 || q.agg < SAR_AGG_MIN ||
+            q.agg > SAR_AGG_PERCENTILE || q.percentile < 0 || q.percentile > 100) {
+        return -1;
+    }
+
+    std::vector<unsigned int> ids;
+    for (unsigned int id = 0; id < rd.series.size(); id++) {
+        if (!fnmatch(q.series.c_str(), rd.series[id].name.c_str(), 0)) {
+            ids.push_back(id);
+        }
+    }
+    if (ids.empty()) {
+        return 0;
+    }
+
+    results.resize(ids.size());
+    std::vector<QueryBucket> buckets(ids.size());
+    /* Previous sample of each series, for rates */
+    std::vector<long long> prev_t(ids.size(), 0);
+    std::vector<double> prev_v(ids.size(), 0);
+    std::vector<bool> has_prev(ids.size(), false);
+    for (size_t k = 0; k < ids.size(); k++) {
+        results[k].name = rd.series[ids[k]].name;
+        buckets[k].start = buckets[k].end = q.t_start;
+        buckets[k].count = 0;
+    }
+
+    /* Blocks are in time order: skip those ending before the range */
+    std::vector<SarStoreBlock>::const_iterator it = std::lower_bound(
+            rd.blocks.begin(), rd.blocks.end(), q.t_start,
+            [](const SarStoreBlock &b, long long t) { return b.hdr.t_last < t; });
+    /* A rate needs the sample preceding the range */
+    if (q.rate && it != rd.blocks.begin()) {
+        --it;
+    }
+
+    std::vector<long long> ts;
+    std::vector<unsigned int> rows;
+    std::vector<double> values;
+    for (; it != rd.blocks.end() && it->hdr.t_first < q.t_end; ++it) {
+        size_t b = it - rd.blocks.begin();
+        bool ts_decoded = false;
+
+        for (size_t k = 0; k < ids.size(); k++) {
+            const SarStoreColumn *col = sar_store_find_column(rd, b, ids[k]);
+            if (col == NULL) {
+                continue;
+            }
+            bool rate = q.rate && rd.series[ids[k]].type == SERIES_INTEGER;
+
+            /* The min or max of a block in a single bucket is in its index */
+            if (!rate && (q.agg == SAR_AGG_MIN || q.agg == SAR_AGG_MAX) &&
+                    it->hdr.t_first >= q.t_start && it->hdr.t_last < q.t_end &&
+                    bucket_start(q, it->hdr.t_first) ==
+                    bucket_start(q, it->hdr.t_last)) {
+                add_to_bucket(q, buckets[k], results[k], it->hdr.t_first,
+                        q.agg == SAR_AGG_MIN ? col->min : col->max);
+                continue;
+            }
+
+            if (!ts_decoded) {
+                sar_store_decode_ts(rd, b, ts);
+                ts_decoded = true;
+            }
+            sar_store_decode_column(rd, b, col, rows, values);
+            bool dense = rows.empty();
+            if (!rate) {
+                for (size_t i = 0; i < values.size(); i++) {
+                    long long t = ts[dense ? i : rows[i]];
+                    if (t >= q.t_start && t < q.t_end) {
+                        add_to_bucket(q, buckets[k], results[k], t, values[i]);
+                    }
+                }
+                continue;
+            }
+            long long pt = prev_t[k];
+            double pv = prev_v[k];
+            bool has = has_prev[k];
+            for (size_t i = 0; i < values.size(); i++) {
+                long long t = ts[dense ? i : rows[i]];
+                double v = values[i];
+                bool ok = has && t > pt && v >= pv;
+                double r = ok ? (v - pv) * 1000 / (t - pt) : 0;
+                pt = t;
+                pv = v;
+                has = true;
+                if (ok && t >= q.t_start && t < q.t_end) {
+                    add_to_bucket(q, buckets[k], results[k], t, r);
+                }
+            }
+            prev_t[k] = pt;
+            prev_v[k] = pv;
+            has_prev[k] = has;
+        }
+    }
+    for (size_t k = 0; k < ids.size(); k++) {
+        close_bucket(q, buckets[k], results[k]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+#ifndef _SAR_STORE_H
+#define _SAR_STORE_H
+
+/*
+ * Columnar history store. Samples are grouped in blocks of rows, each
+ * series of a block being a column compressed on its own: integer series
+ * (counters of the raw stats) with delta-of-delta encoding, double series
+ * (rates of SarInfo) with Gorilla XOR encoding. Each block starts with
+ * its time range and a directory of its columns (offset, value range),
+ * which is the index readers use to only decode what they need.
+ *
+ * File layout: a magic number, then chunks appended in order: series
+ * definitions, each written before the first block using the series, and
+ * blocks.
+ */
+
+#include "sar_stats.h"
+#include "SarInfo.pb.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#define SAR_STORE_MAGIC    "SARTSDB1"
+#define SAR_STORE_SERIES_MAGIC    "SER1"
+#define SAR_STORE_BLOCK_MAGIC    "BLK1"
+
+/* Rows per block: an hour of 1-second samples */
+const unsigned int SAR_STORE_BLOCK_ROWS = 3600;
+
+/* Series types */
+enum {
+    SERIES_INTEGER = 0,    /* counters and integer gauges, delta-of-delta */
+    SERIES_DOUBLE          /* rates and percentages, XOR */
+};
+
+struct SarStoreSeriesHeader {
+    char         magic[4];
+    unsigned int id;
+    unsigned int type;
+    unsigned int name_len;    /* name follows, not null terminated */
+};
+
+struct SarStoreBlockHeader {
+    char         magic[4];
+    unsigned int size;    /* bytes following this header */
+    unsigned int nr_rows;
+    unsigned int nr_columns;
+    long long    t_first;    /* ms since the epoch */
+    long long    t_last;
+    unsigned int ts_length;    /* timestamp column, after the directory */
+    unsigned int pad;
+};
+
+/* Column directory entry of a block */
+struct SarStoreColumn {
+    unsigned int series;
+    unsigned int offset;    /* from the end of the directory */
+    unsigned int length;
+    unsigned int count;    /* values present, less than nr_rows if sparse */
+    double       min;
+    double       max;
+};
+
+struct SarStoreSeries {
+    std::string  name;
+    unsigned int type;
+};
+
+/* Values of a series buffered for the current block */
+struct SarStoreBuffer {
+    std::vector<unsigned int>       rows;
+    std::vector<unsigned long long> values;    /* integers, or double bits */
+};
+
+/* Store opened for appending */
+struct SarStore {
+    int                                           fd;
+    unsigned int                                  block_rows;
+    std::vector<SarStoreSeries>                   series;
+    std::unordered_map<std::string, unsigned int> ids;
+    unsigned int                                  nr_written;    /* series defined in the file */
+    /* Current block */
+    std::vector<long long>                        ts;
+    std::vector<SarStoreBuffer>                   buffers;
+    bool                                          in_row;
+
+    SarStore() : fd(-1), block_rows(SAR_STORE_BLOCK_ROWS), nr_written(0),
+        in_row(false) {}
+};
+
+/*
+ * Open a store file for appending, creating it if needed. A partly
+ * written last chunk is dropped.
+ * RETURNS: 0 on success, -1 on error.
+ */
+int sar_store_open(SarStore &st, const char *path);
+
+/* Write the current block, then close the store. RETURNS: 0, -1 on error */
+int sar_store_close(SarStore &st);
+
+/*
+ * Add a row: sar_store_begin_row(), then a value per series (a series
+ * not set in a row has no value there), then sar_store_end_row(), which
+ * writes the block once it holds block_rows rows.
+ */
+void sar_store_begin_row(SarStore &st, long long t_ms);
+void sar_store_set_integer(SarStore &st, const std::string &name,
+        unsigned long long value);
+void sar_store_set_double(SarStore &st, const std::string &name, double value);
+int sar_store_end_row(SarStore &st);
+
+/* Write the current block, even if not full. RETURNS: 0, -1 on error */
+int sar_store_flush(SarStore &st);
+
+/*
+ * Set the counters of archive record @i in the current row: "stat.<field>",
+ * "cpu<N>.<field>", "disk.<name>.<field>" and "net.<iface>.<field>".
+ */
+void sar_store_set_record(SarStore &st, const SarArchive &ar, unsigned int i);
+
+/*
+ * Set the numeric fields of @sar_info in the current row, named as by
+ * get_sar_info_values() (eg. "info.sar_disk_info.sda.await").
+ */
+void sar_store_set_info(SarStore &st, const SarInfo &sar_info);
+
+
+/*
+ * Block of a mapped store. The header and directory are copied out of the
+ * mapping, where they follow series names of any length.
+ */
+struct SarStoreBlock {
+    SarStoreBlockHeader         hdr;
+    std::vector<SarStoreColumn> columns;
+    const unsigned char        *data;    /* timestamp column, then series columns */
+    size_t                      data_len;
+};
+
+/* Store mapped for reading */
+struct SarStoreReader {
+    int                                           fd;
+    const unsigned char                          *base;
+    size_t                                        size;
+    std::vector<SarStoreSeries>                   series;
+    std::unordered_map<std::string, unsigned int> ids;
+    std::vector<SarStoreBlock>                    blocks;
+
+    SarStoreReader() : fd(-1), base(NULL), size(0) {}
+};
+
+/* RETURNS: 0 on success, -1 on error (errno set) */
+int sar_store_map(const char *path, SarStoreReader &rd);
+void sar_store_unmap(SarStoreReader &rd);
+
+/* Column of series @id in block @b, NULL if the series has no value there */
+const SarStoreColumn *sar_store_find_column(const SarStoreReader &rd,
+        size_t b, unsigned int id);
+
+/* Decode the timestamps (ms) of block @b */
+void sar_store_decode_ts(const SarStoreReader &rd, size_t b,
+        std::vector<long long> &ts);
+
+/*
+ * Decode a column of block @b: the rows it has values for (left empty if
+ * it has one for every row), and the values (integer series are converted
+ * to double). Both are left empty if the column lies outside its block,
+ * or if its bitmap does not have a row per value.
+ */
+void sar_store_decode_column(const SarStoreReader &rd, size_t b,
+        const SarStoreColumn *col, std::vector<unsigned int> &rows,
+        std::vector<double> &values);
+
+
+/* Downsampling functions */
+enum {
+    SAR_AGG_MIN = 0,
+    SAR_AGG_MAX,
+    SAR_AGG_AVG,
+    SAR_AGG_LAST,
+    SAR_AGG_PERCENTILE
+};
+
+struct SarStoreQuery {
+    /*
+     * Series selected, a shell glob on their name, eg. "disk.sdb.rd_sect"
+     * or "info.sar_disk_info.*.await" for a metric of every disk.
+     */
+    std::string series;
+    long long   t_start;    /* ms, included */
+    long long   t_end;    /* ms, excluded */
+    long long   step_ms;    /* bucket width, 0: one bucket for the range */
+    int         agg;    /* SAR_AGG_* */
+    double      percentile;    /* 0-100, for SAR_AGG_PERCENTILE */
+    /*
+     * Aggregate the per-second rate of integer series (counters) between
+     * consecutive samples rather than their values. Decreasing values
+     * (counter reset) give no rate.
+     */
+    bool        rate;
+
+    SarStoreQuery() : t_start(0), t_end(0), step_ms(0), agg(SAR_AGG_AVG),
+        percentile(99), rate(false) {}
+};
+
+/* Buckets holding no sample are left out */
+struct SarStoreResult {
+    std::string            name;
+    std::vector<long long> t;    /* bucket start */
+    std::vector<double>    values;
+};
+
+/*
+ * Downsample the selected series over a time range. Only the columns of
+ * the selected series in the blocks overlapping the range are decoded.
+ * RETURNS: 0 on success, -1 on invalid query.
+ */
+int sar_store_query(const SarStoreReader &rd, const SarStoreQuery &q,
+        std::vector<SarStoreResult> &results);
+
+#endif     /* _SAR_STORE_H */
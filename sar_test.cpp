@@ -0,0 +1,1052 @@
+#include "sar.h"
+#include "sar_store.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdint.h>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <unistd.h>
+#include <poll.h>
+#include <sched.h>
+#include <signal.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+
+/*
+ * Checks of the collectors, on fixture trees or stand-in fds, through the
+ * public API only. Run by "make test".
+ */
+
+static int g_failures;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            g_failures++; \
+        } \
+    } while (0)
+
+/* Short interval, but several uptime ticks, so that rates are defined */
+static void short_sleep_ms(int)
+{
+    poll(NULL, 0, 50);
+}
+
+/* Wall clock of the tests, moved forward by hand */
+static long long g_now_ms;
+
+static long long test_now_ms()
+{
+    return g_now_ms;
+}
+
+static void write_file(const std::string &path, const char *data)
+{
+    FILE *fp = fopen(path.c_str(), "w");
+    CHECK(fp != NULL);
+    if (fp != NULL) {
+        fputs(data, fp);
+        fclose(fp);
+    }
+}
+
+/* Create a cgroup v2 directory with the files read by the collector */
+static void make_cgroup(const std::string &path, const char *memory_current)
+{
+    mkdir(path.c_str(), 0755);
+    write_file(path + "/cpu.stat", "usage_usec 1000\nuser_usec 600\n"
+            "system_usec 400\nnr_throttled 0\nthrottled_usec 0\n");
+    write_file(path + "/memory.current", memory_current);
+    write_file(path + "/memory.stat", "anon 4096\nfile 8192\npgfault 10\n"
+            "pgmajfault 0\n");
+    write_file(path + "/io.stat", "8:0 rbytes=512 wbytes=1024 rios=1 wios=2\n");
+    write_file(path + "/cpu.pressure", "some avg10=0.00 avg60=0.00 avg300=0.00 "
+            "total=0\nfull avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+}
+
+static const SarInfo_SarCgroupInfo *find_cgroup(const SarInfo &si, const char *path)
+{
+    for (int i = 0; i < si.sar_cgroup_info_size(); i++) {
+        if (si.sar_cgroup_info(i).path() == path) {
+            return &si.sar_cgroup_info(i);
+        }
+    }
+    return NULL;
+}
+
+/* cgroup subtree in a temporary directory, walked on the rescan cadence */
+static void test_cgroups()
+{
+    char root[] = "/tmp/sar_test.XXXXXX";
+    CHECK(mkdtemp(root) != NULL);
+    make_cgroup(root, "1048576\n");
+    make_cgroup(std::string(root) + "/a", "4096\n");
+    make_cgroup(std::string(root) + "/a/b", "2048\n");
+
+    SarConfig config;
+    config.cgroup_path = root;
+    config.cgroup_rescan_sec = 60;
+    set_sar_config(config);
+    SarClock clock;
+    clock.sleep_ms = short_sleep_ms;
+    clock.now_ms = test_now_ms;
+    set_sar_clock(clock);
+    g_now_ms = 1000000;
+
+    SarInfo si;
+    get_sar_info(si);
+    CHECK(si.sar_cgroup_info_size() == 3);
+    const SarInfo_SarCgroupInfo *cg = find_cgroup(si, "a/b");
+    CHECK(cg != NULL && cg->memory_current() == 2048);
+    CHECK(cg != NULL && cg->memory_anon() == 4096 && cg->memory_file() == 8192);
+    CHECK(find_cgroup(si, "") != NULL &&
+            find_cgroup(si, "")->memory_current() == 1048576);
+
+    /* Not walked again before cgroup_rescan_sec */
+    make_cgroup(std::string(root) + "/c", "8192\n");
+    g_now_ms += 30000;
+    si.Clear();
+    get_sar_info(si);
+    CHECK(si.sar_cgroup_info_size() == 3);
+    CHECK(find_cgroup(si, "c") == NULL);
+
+    g_now_ms += 30000;
+    si.Clear();
+    get_sar_info(si);
+    CHECK(si.sar_cgroup_info_size() == 4);
+    CHECK(find_cgroup(si, "c") != NULL &&
+            find_cgroup(si, "c")->memory_current() == 8192);
+
+    std::string cmd = std::string("rm -rf ") + root;
+    CHECK(system(cmd.c_str()) == 0);
+    set_sar_config(SarConfig());
+    set_sar_clock(SarClock());
+}
+
+/* Copy of fixtures/ the clock hooks write to between the two reads */
+static std::string g_tree;
+
+static std::string read_file(const std::string &path)
+{
+    std::string data;
+    FILE *fp = fopen(path.c_str(), "r");
+    CHECK(fp != NULL);
+    if (fp != NULL) {
+        char buf[4096];
+        size_t len;
+        while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            data.append(buf, len);
+        }
+        fclose(fp);
+    }
+    return data;
+}
+
+/*
+ * One second at 100 Hz on every CPU of proc/stat (idle time), and 5 more
+ * core throttling events on cpu1
+ */
+static void tick_fixture(int)
+{
+    std::istringstream in(read_file(g_tree + "/proc/stat"));
+    std::string out, line;
+    while (std::getline(in, line)) {
+        if (!line.compare(0, 3, "cpu")) {
+            std::istringstream fields(line);
+            std::string name;
+            unsigned long long v[10] = { 0 };
+            fields >> name;
+            for (int i = 0; i < 10; i++) {
+                fields >> v[i];
+            }
+            v[3] += name == "cpu" ? 800 : 100;
+            line = name;
+            for (int i = 0; i < 10; i++) {
+                line += " " + std::to_string(v[i]);
+            }
+        }
+        out += line + "\n";
+    }
+    write_file(g_tree + "/proc/stat", out.c_str());
+    write_file(g_tree + "/sys/devices/system/cpu/cpu1/thermal_throttle/core_throttle_count",
+            "15\n");
+}
+
+/* Collect from a copy of fixtures/, in g_tree */
+static void use_fixture_tree()
+{
+    char tree[] = "/tmp/sar_test.XXXXXX";
+    CHECK(mkdtemp(tree) != NULL);
+    g_tree = tree;
+    std::string cmd = "cp -r fixtures/proc fixtures/sys " + g_tree;
+    CHECK(system(cmd.c_str()) == 0);
+
+    SarConfig config;
+    config.proc_root = g_tree + "/proc";
+    config.sys_root = g_tree + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    set_sar_config(config);
+}
+
+static void remove_fixture_tree()
+{
+    std::string cmd = "rm -rf " + g_tree;
+    CHECK(system(cmd.c_str()) == 0);
+    set_sar_config(SarConfig());
+}
+
+static const SarInfo_SarCpuInfo *find_cpu(const SarInfo &si, int cpu)
+{
+    for (int i = 0; i < si.sar_cpu_info_size(); i++) {
+        if (si.sar_cpu_info(i).cpu() == cpu) {
+            return &si.sar_cpu_info(i);
+        }
+    }
+    return NULL;
+}
+
+/* cpufreq and thermal_throttle files of the fixture sysfs tree */
+static void test_cpufreq()
+{
+    use_fixture_tree();
+    SarClock clock;
+    clock.sleep_ms = tick_fixture;
+    set_sar_clock(clock);
+
+    SarInfo si;
+    get_sar_info(si);
+    CHECK(si.sar_cpu_info_size() == 8);
+    for (int i = 0; i < 8; i++) {
+        const SarInfo_SarCpuInfo *cpu = find_cpu(si, i);
+        CHECK(cpu != NULL);
+        if (cpu == NULL) {
+            continue;
+        }
+        CHECK(cpu->cur_freq() == 2000 + i * 100);
+        CHECK(cpu->max_freq() == 3600);
+        /* Only cpu0-3 have thermal_throttle */
+        CHECK(cpu->has_core_throttle() == (i < 4));
+        CHECK(cpu->has_package_throttle() == (i < 4));
+        CHECK(cpu->core_throttle() == (i == 1 ? 5 : 0));
+        CHECK(cpu->package_throttle() == 0);
+    }
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* Pipes to and from the process of the private network namespace */
+static int g_netns_cmd[2];
+static int g_netns_ack[2];
+
+/* Number of datagrams sent on loopback by the netns process per sample */
+const int NETNS_PACKETS = 10;
+
+/*
+ * Process of the private namespace: brings lo up, then sends
+ * NETNS_PACKETS datagrams to itself on each command byte
+ */
+static void run_netns_child()
+{
+    char c = 'n';
+    int fd = -1, sfd = -1;
+    struct ifreq ifr;
+    struct sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+
+    memset(&ifr, 0, sizeof(ifr));
+    strcpy(ifr.ifr_name, "lo");
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (unshare(CLONE_NEWNET) == 0 &&
+            (fd = socket(AF_INET, SOCK_DGRAM, 0)) >= 0 &&
+            ioctl(fd, SIOCGIFFLAGS, &ifr) == 0 &&
+            (ifr.ifr_flags |= IFF_UP, ioctl(fd, SIOCSIFFLAGS, &ifr)) == 0 &&
+            bind(fd, (struct sockaddr *) &addr, sizeof(addr)) == 0 &&
+            getsockname(fd, (struct sockaddr *) &addr, &len) == 0 &&
+            (sfd = socket(AF_INET, SOCK_DGRAM, 0)) >= 0) {
+        c = 'y';
+    }
+    if (write(g_netns_ack[1], &c, 1) != 1 || c != 'y') {
+        _exit(1);
+    }
+    while (read(g_netns_cmd[0], &c, 1) == 1) {
+        char buf[64];
+        for (int i = 0; i < NETNS_PACKETS; i++) {
+            sendto(sfd, "x", 1, 0, (struct sockaddr *) &addr, sizeof(addr));
+            recv(fd, buf, sizeof(buf), 0);
+        }
+        if (write(g_netns_ack[1], &c, 1) != 1) {
+            break;
+        }
+    }
+    _exit(0);
+}
+
+/* Loopback traffic in the private namespace between the two reads */
+static void netns_traffic_sleep_ms(int ms)
+{
+    char c = 'x';
+    CHECK(write(g_netns_cmd[1], &c, 1) == 1);
+    CHECK(read(g_netns_ack[0], &c, 1) == 1);
+    short_sleep_ms(ms);
+}
+
+/* Loopback of a private network namespace, found through its pid */
+static void test_netns()
+{
+    CHECK(pipe(g_netns_cmd) == 0);
+    CHECK(pipe(g_netns_ack) == 0);
+    pid_t pid = fork();
+    CHECK(pid >= 0);
+    if (pid == 0) {
+        close(g_netns_cmd[1]);
+        close(g_netns_ack[0]);
+        run_netns_child();
+    }
+    close(g_netns_cmd[0]);
+    close(g_netns_ack[1]);
+
+    char c = 'n';
+    if (pid < 0 || read(g_netns_ack[0], &c, 1) != 1 || c != 'y') {
+        printf("sar_test: no private network namespace, netns checks skipped\n");
+    }
+    else {
+        SarConfig config;
+        config.netns_sources = NETNS_SRC_PID;
+        set_sar_config(config);
+        SarClock clock;
+        clock.sleep_ms = netns_traffic_sleep_ms;
+        set_sar_clock(clock);
+
+        SarInfo si;
+        get_sar_info(si);
+        const SarInfo_SarNetnsInfo *ns = NULL;
+        for (int i = 0; i < si.sar_netns_info_size(); i++) {
+            if (si.sar_netns_info(i).pid() == pid) {
+                ns = &si.sar_netns_info(i);
+            }
+        }
+        CHECK(ns != NULL);
+        if (ns != NULL) {
+            CHECK(ns->name().empty() && ns->inode() != 0);
+            CHECK(ns->iface_size() == 1 && ns->iface(0).name() == "lo");
+            /* Each datagram is both sent and received on lo */
+            CHECK(ns->rxpck() > 0 && ns->rxpck() == ns->txpck());
+            CHECK(ns->iface_size() == 1 && ns->iface(0).rxpck() == ns->rxpck());
+            CHECK(ns->rxbyt() > 0 && ns->rxbyt() == ns->txbyt());
+            CHECK(ns->rxerr() == 0 && ns->rxdrop() == 0);
+        }
+        set_sar_config(SarConfig());
+        set_sar_clock(SarClock());
+    }
+
+    close(g_netns_cmd[1]);
+    close(g_netns_ack[0]);
+    if (pid > 0) {
+        int status;
+        kill(pid, SIGTERM);
+        CHECK(waitpid(pid, &status, 0) == pid);
+    }
+}
+
+static bool has_value(const std::vector<SarInfoValue> &values, const char *name)
+{
+    for (size_t i = 0; i < values.size(); i++) {
+        if (values[i].name == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Names of the values of repeated entries, unique per entry */
+static void test_entry_keys()
+{
+    SarInfo si;
+    SarInfo_SarNetnsInfo *ns = si.add_sar_netns_info();
+    ns->set_name("blue");
+    ns->set_inode(4026532001ULL);
+    ns->set_pid(0);
+    ns->set_rxpck(1);
+    ns = si.add_sar_netns_info();
+    ns->set_name("red");
+    ns->set_inode(4026532002ULL);
+    ns->set_pid(0);
+    ns->set_rxpck(2);
+    for (int package = 0; package < 2; package++) {
+        SarInfo_SarCpuGroupInfo *core = si.add_sar_core_info();
+        core->set_id(0);
+        core->set_package_id(package);
+        core->set_cpu_user(package);
+    }
+    SarInfo_SarProcessInfo *proc = si.add_sar_process_info();
+    proc->set_pid(42);
+    proc->set_comm("sh");
+
+    std::vector<SarInfoValue> values;
+    get_sar_info_values(si, values);
+    CHECK(has_value(values, "info.sar_netns_info.4026532001.rxpck"));
+    CHECK(has_value(values, "info.sar_netns_info.4026532002.rxpck"));
+    CHECK(has_value(values, "info.sar_core_info.0-0.cpu_user"));
+    CHECK(has_value(values, "info.sar_core_info.1-0.cpu_user"));
+    CHECK(has_value(values, "info.sar_process_info.42.pid"));
+}
+
+/* Values of series @name in the first block of @rd, NULL if none */
+static const SarStoreColumn *decode_series(const SarStoreReader &rd,
+        const char *name, std::vector<unsigned int> &rows,
+        std::vector<double> &values)
+{
+    rows.clear();
+    values.clear();
+    std::unordered_map<std::string, unsigned int>::const_iterator it =
+        rd.ids.find(name);
+    if (it == rd.ids.end() || rd.blocks.empty()) {
+        return NULL;
+    }
+    const SarStoreColumn *col = sar_store_find_column(rd, 0, it->second);
+    if (col != NULL) {
+        sar_store_decode_column(rd, 0, col, rows, values);
+    }
+    return col;
+}
+
+/*
+ * Round trip of both column codecs: deltas of deltas in every bucket,
+ * 64-bit deltas, doubles reusing or not the previous XOR window, and a
+ * sparse column
+ */
+static void test_store_codecs()
+{
+    /* Deltas of deltas: 0, then 7, 12, 20 and 32 bits, either sign */
+    const long long dods[] = { 0, 0, 5, -60, 1000, -2000, 300000, -400000,
+        1000000000LL, -2000000000LL, 0, 1 };
+    std::vector<unsigned long long> integers;
+    long long v = 1000, delta = 0;
+    integers.push_back(v);
+    for (size_t i = 0; i < sizeof(dods) / sizeof(dods[0]); i++) {
+        delta += dods[i];
+        v += delta;
+        integers.push_back(v);
+    }
+    /* 64-bit deltas, exact as doubles */
+    integers.push_back(1ULL << 62);
+    integers.push_back(1ULL << 40);
+    integers.push_back(0);
+    integers.push_back(1ULL << 61);
+
+    const double doubles[] = { 1.5, 1.5, -1.5, 1.25, 1.375, 1.0,
+        nextafter(1.0, 2.0), -nextafter(1.0, 2.0), 0.0, -0.0, 1e300, -1e-300,
+        HUGE_VAL, 3.0, 3.0 };
+    const size_t nr_doubles = sizeof(doubles) / sizeof(doubles[0]);
+    size_t nr_rows = std::max(integers.size(), nr_doubles);
+
+    char path[] = "/tmp/sar_test.XXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    close(fd);
+    unlink(path);
+    SarStore st;
+    CHECK(sar_store_open(st, path) == 0);
+    for (size_t r = 0; r < nr_rows; r++) {
+        /* Irregular timestamps: the timestamp column too */
+        sar_store_begin_row(st, 1700000000000LL + r * 1000 + (r % 3) * 7);
+        if (r < integers.size()) {
+            sar_store_set_integer(st, "int", integers[r]);
+        }
+        if (r < nr_doubles) {
+            sar_store_set_double(st, "double", doubles[r]);
+        }
+        if (r % 3 == 1) {
+            sar_store_set_integer(st, "sparse", r * 100);
+        }
+        CHECK(sar_store_end_row(st) == 0);
+    }
+    CHECK(sar_store_close(st) == 0);
+
+    SarStoreReader rd;
+    CHECK(sar_store_map(path, rd) == 0);
+    CHECK(rd.blocks.size() == 1);
+
+    std::vector<long long> ts;
+    sar_store_decode_ts(rd, 0, ts);
+    CHECK(ts.size() == nr_rows);
+    for (size_t r = 0; r < ts.size(); r++) {
+        CHECK(ts[r] == (long long) (1700000000000LL + r * 1000 + (r % 3) * 7));
+    }
+
+    std::vector<unsigned int> rows;
+    std::vector<double> values;
+    const SarStoreColumn *col = decode_series(rd, "int", rows, values);
+    CHECK(col != NULL && values.size() == integers.size());
+    for (size_t i = 0; i < values.size() && i < integers.size(); i++) {
+        CHECK(values[i] == (double) (long long) integers[i]);
+    }
+    /* Dense up to its last value, then sparse */
+    CHECK(col != NULL && (integers.size() < nr_rows) == !rows.empty());
+
+    decode_series(rd, "double", rows, values);
+    CHECK(values.size() == nr_doubles);
+    for (size_t i = 0; i < values.size(); i++) {
+        CHECK(!memcmp(&values[i], &doubles[i], sizeof(double)));
+    }
+
+    col = decode_series(rd, "sparse", rows, values);
+    CHECK(col != NULL && rows.size() == values.size() && !rows.empty());
+    for (size_t i = 0; i < rows.size(); i++) {
+        CHECK(rows[i] % 3 == 1 && values[i] == rows[i] * 100.0);
+    }
+
+    /* A count the bitmap does not match is rejected */
+    if (col != NULL) {
+        SarStoreColumn bad = *col;
+        bad.count = col->count + 1;
+        sar_store_decode_column(rd, 0, &bad, rows, values);
+        CHECK(rows.empty() && values.empty());
+        bad.count = col->count - 1;
+        sar_store_decode_column(rd, 0, &bad, rows, values);
+        CHECK(rows.empty() && values.empty());
+    }
+
+    sar_store_unmap(rd);
+    unlink(path);
+}
+
+/* Archive slot of interface @name, -1 if none */
+static int find_archive_iface(const SarArchive &ar, const char *name)
+{
+    for (int i = 0; i < ar.hdr->iface_nr; i++) {
+        if (!strcmp(sar_archive_ifaces(ar)[i].name, name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Archive of fixture samples, one a minute, appended to again after a
+ * restart: record layout and alignment, inventory, and minute index
+ */
+static void test_archive()
+{
+    use_fixture_tree();
+    SarClock clock;
+    clock.sleep_ms = tick_fixture;
+    clock.now_ms = test_now_ms;
+    set_sar_clock(clock);
+
+    /* 01:00:10 UTC */
+    const long long day_start = 1700006400;
+    const long long t0 = day_start + 3610;
+    std::string path = g_tree + "/sa";
+    SarInfo si;
+    CHECK(sar_archive_open(path.c_str()) == 0);
+    g_now_ms = t0 * 1000;
+    get_sar_info(si);
+    CHECK(si.has_cpu_idle());
+    g_now_ms += 60000;
+    get_sar_info(si);
+    sar_archive_close();
+
+    /* Restart: a dummy record, then the next samples */
+    g_now_ms += 60000;
+    CHECK(sar_archive_open(path.c_str()) == 0);
+    g_now_ms += 60000;
+    get_sar_info(si);
+    sar_archive_close();
+
+    SarArchive ar;
+    CHECK(sar_archive_map(path.c_str(), ar) == 0);
+    if (ar.hdr == NULL) {
+        remove_fixture_tree();
+        set_sar_clock(SarClock());
+        return;
+    }
+    CHECK(ar.nr_records == 4);
+    CHECK(ar.hdr->day_start == day_start && ar.hdr->cpu_nr == 8);
+    CHECK(ar.hdr->header_size % 16 == 0 && ar.hdr->record_size % 16 == 0);
+    CHECK(ar.hdr->header_size >= sizeof(SarArchiveHeader) +
+            ar.hdr->disk_nr * sizeof(SarArchiveDisk) +
+            ar.hdr->iface_nr * sizeof(SarArchiveIface));
+
+    /* Inventory right after the header, disks then interfaces */
+    CHECK((const char *) sar_archive_disks(ar) == ar.base + sizeof(SarArchiveHeader));
+    CHECK((const char *) sar_archive_ifaces(ar) == (const char *) (sar_archive_disks(ar) +
+                ar.hdr->disk_nr));
+    int sda = -1;    /* dev8-0: no ioconf names on the fixture tree */
+    for (int i = 0; i < ar.hdr->disk_nr; i++) {
+        if (!strcmp(sar_archive_disks(ar)[i].name, "dev8-0")) {
+            sda = i;
+        }
+    }
+    int eth0 = find_archive_iface(ar, "eth0");
+    CHECK(sda >= 0 && eth0 >= 0 && find_archive_iface(ar, "docker0") >= 0);
+
+    const unsigned char types[] = { R_STATS, R_STATS, R_DUMMY, R_STATS };
+    const long long times[] = { t0, t0 + 60, t0 + 120, t0 + 180 };
+    for (unsigned int i = 0; i < ar.nr_records && i < 4; i++) {
+        const FileStats *fs = sar_archive_record(ar, i);
+        CHECK((uintptr_t) fs % 16 == 0);
+        CHECK(fs->record_type == types[i] && (long long) fs->ust_time == times[i]);
+        CHECK((const char *) sar_archive_disk_stats(ar, i) == (const char *) fs +
+                sizeof(FileStats) + ar.hdr->cpu_nr * sizeof(StatsOneCpu));
+        CHECK((const char *) sar_archive_iface_stats(ar, i) ==
+                (const char *) (sar_archive_disk_stats(ar, i) + ar.hdr->disk_nr));
+        if (sda < 0 || eth0 < 0) {
+            continue;
+        }
+        const DiskStats *ds = sar_archive_disk_stats(ar, i) + sda;
+        const StatsNetDev *nd = sar_archive_iface_stats(ar, i) + eth0;
+        if (types[i] == R_DUMMY) {
+            CHECK(ds->rd_sect == 0 && nd->rx_bytes == 0);
+        }
+        else {
+            CHECK(ds->major == 8 && ds->minor == 0 && ds->rd_sect == 1518330);
+            CHECK(!strcmp(nd->interface, "eth0") && nd->rx_bytes == 448874568ULL &&
+                    nd->tx_packets == 1107042);
+        }
+    }
+
+    CHECK(sar_archive_find(ar, day_start) == 0);
+    CHECK(sar_archive_find(ar, t0) == 0);
+    CHECK(sar_archive_find(ar, t0 + 1) == 1);
+    CHECK(sar_archive_find(ar, t0 + 60) == 1);
+    CHECK(sar_archive_find(ar, t0 + 150) == 3);
+    CHECK(sar_archive_find(ar, t0 + 180) == 3);
+    CHECK(sar_archive_find(ar, t0 + 181) == 4);
+    CHECK(sar_archive_find(ar, day_start + 86400) == 4);
+    sar_archive_unmap(ar);
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* Values of cpu0 cur_freq (MHz) written by feed_fixture() */
+static std::vector<double> g_feed;
+static size_t g_feed_next;
+
+/* As tick_fixture(), setting cpu0 scaling_cur_freq to the next value to feed */
+static void feed_fixture(int ms)
+{
+    tick_fixture(ms);
+    if (g_feed_next < g_feed.size()) {
+        std::string khz = std::to_string((long long) (g_feed[g_feed_next++] * 1000)) + "\n";
+        write_file(g_tree + "/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq",
+                khz.c_str());
+    }
+}
+
+/* Value of quantile @q of @values, of the rank used by the sketches */
+static double exact_quantile(std::vector<double> values, double q)
+{
+    std::sort(values.begin(), values.end());
+    q = std::min(std::max(q, 0.0), 1.0);
+    return values[(size_t) (q * (values.size() - 1))];
+}
+
+static bool within(double v, double exact, double alpha)
+{
+    return fabs(v - exact) <= alpha * fabs(exact) * (1 + 1e-9);
+}
+
+/*
+ * Rolling summary of a known sequence, over more than two windows: each
+ * sample against the exact statistics of the last summary_window values
+ */
+static void test_summaries()
+{
+    const double seq[] = { 5000, 100, 2000, 3000, 50, 800, 1200, 4000, 900,
+        1500, 700, 2500, 300, 3500, 1000, 1100, 600, 2200, 1800, 400, 1234.5 };
+    const size_t nr = sizeof(seq) / sizeof(seq[0]);
+    const int window = 8;
+    const double alpha = 0.01;
+    const char *series = "info.sar_cpu_info.0.cur_freq";
+
+    use_fixture_tree();
+    SarConfig config;
+    config.proc_root = g_tree + "/proc";
+    config.sys_root = g_tree + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    config.summary_series.push_back(series);
+    config.summary_window = window;
+    config.summary_accuracy = alpha;
+    set_sar_config(config);
+    SarClock clock;
+    clock.sleep_ms = feed_fixture;
+    set_sar_clock(clock);
+    g_feed.assign(seq, seq + nr);
+    g_feed_next = 0;
+
+    std::vector<double> quantiles;
+    quantiles.push_back(0);
+    quantiles.push_back(0.5);
+    quantiles.push_back(0.9);
+    quantiles.push_back(1);
+    quantiles.push_back(1.5);
+    SarInfo si;
+    for (size_t n = 1; n <= nr; n++) {
+        si.Clear();
+        get_sar_info(si);
+        std::vector<double> last(seq + (n > (size_t) window ? n - window : 0), seq + n);
+        double mean = 0, m2 = 0;
+        for (size_t i = 0; i < last.size(); i++) {
+            mean += last[i];
+        }
+        mean /= last.size();
+        for (size_t i = 0; i < last.size(); i++) {
+            m2 += (last[i] - mean) * (last[i] - mean);
+        }
+
+        SarSummary sum;
+        CHECK(get_sar_summary(series, quantiles, sum) == 0);
+        CHECK(sum.count == last.size());
+        CHECK(sum.min == *std::min_element(last.begin(), last.end()));
+        CHECK(sum.max == *std::max_element(last.begin(), last.end()));
+        CHECK(fabs(sum.mean - mean) <= 1e-9 * mean);
+        CHECK(fabs(sum.stddev - sqrt(m2 / last.size())) <= 1e-9 * mean);
+        CHECK(sum.quantiles.size() == quantiles.size());
+        for (size_t q = 0; q < sum.quantiles.size(); q++) {
+            CHECK(within(sum.quantiles[q], exact_quantile(last, quantiles[q]), alpha));
+        }
+        /* Clamped to the exact extremes, q above 1 taken as 1 */
+        for (size_t q = 0; q < sum.quantiles.size(); q++) {
+            CHECK(sum.quantiles[q] >= sum.min && sum.quantiles[q] <= sum.max);
+            CHECK(last.size() > 1 || sum.quantiles[q] == sum.min);
+        }
+        CHECK(sum.quantiles.size() == 5 && sum.quantiles[4] == sum.quantiles[3]);
+    }
+    SarSummary sum;
+    CHECK(get_sar_summary("info.cpu_idle", quantiles, sum) == -1);
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* Sketch of @values, with the buckets documented in SarInfo.proto */
+static SarInfo::SarSketch make_sketch(const std::vector<double> &values, double alpha)
+{
+    SarInfo::SarSketch sketch;
+    double gamma = (1 + alpha) / (1 - alpha);
+    std::vector<int> index[2];
+    sketch.set_relative_accuracy(alpha);
+    sketch.set_min(INFINITY);
+    sketch.set_max(-INFINITY);
+    for (size_t i = 0; i < values.size(); i++) {
+        double v = values[i];
+        sketch.set_count(sketch.count() + 1);
+        sketch.set_sum(sketch.sum() + v);
+        sketch.set_min(std::min(sketch.min(), v));
+        sketch.set_max(std::max(sketch.max(), v));
+        if (fabs(v) < 1e-9) {
+            sketch.set_zero_count(sketch.zero_count() + 1);
+        }
+        else {
+            index[v < 0].push_back((int) ceil(log(fabs(v)) / log(gamma)));
+        }
+    }
+    for (int neg = 0; neg < 2; neg++) {
+        if (index[neg].empty()) {
+            continue;
+        }
+        int lo = *std::min_element(index[neg].begin(), index[neg].end());
+        int hi = *std::max_element(index[neg].begin(), index[neg].end());
+        google::protobuf::RepeatedField<uint64_t> *counts =
+            neg ? sketch.mutable_negative_counts() : sketch.mutable_counts();
+        counts->Resize(hi - lo + 1, 0);
+        for (size_t i = 0; i < index[neg].size(); i++) {
+            counts->Set(index[neg][i] - lo, counts->Get(index[neg][i] - lo) + 1);
+        }
+        if (neg) {
+            sketch.set_negative_offset(lo);
+        }
+        else {
+            sketch.set_offset(lo);
+        }
+    }
+    return sketch;
+}
+
+/* Quantiles of @sketch against the exact ones of @values */
+static void check_sketch(const SarInfo::SarSketch &sketch,
+        const std::vector<double> &values)
+{
+    double alpha = sketch.relative_accuracy();
+    double sum = 0;
+    for (size_t i = 0; i < values.size(); i++) {
+        sum += values[i];
+    }
+    CHECK(sketch.count() == values.size());
+    CHECK(fabs(sketch.sum() - sum) <= 1e-9 * fabs(sum) + 1e-9);
+    CHECK(sketch.min() == *std::min_element(values.begin(), values.end()));
+    CHECK(sketch.max() == *std::max_element(values.begin(), values.end()));
+    for (int i = 0; i <= 20; i++) {
+        double q = i / 20.0;
+        CHECK(within(get_sar_sketch_quantile(sketch, q), exact_quantile(values, q), alpha));
+    }
+}
+
+/*
+ * Window sketch of the collector merged with sketches of overlapping,
+ * disjoint and negative buckets, against the exact quantiles of all
+ */
+static void test_sketches()
+{
+    const double seq[] = { 5000, 100, 2000, 3000, 50, 800, 1200, 4000, 900,
+        1500, 700, 2500 };
+    const size_t nr = sizeof(seq) / sizeof(seq[0]);
+    const int window = 8;
+    const double alpha = 0.02;
+
+    use_fixture_tree();
+    SarConfig config;
+    config.proc_root = g_tree + "/proc";
+    config.sys_root = g_tree + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    config.sketch_series.push_back("info.sar_cpu_info.*.cur_freq");
+    config.summary_window = window;
+    config.summary_accuracy = alpha;
+    set_sar_config(config);
+    SarClock clock;
+    clock.sleep_ms = feed_fixture;
+    set_sar_clock(clock);
+    g_feed.assign(seq, seq + nr);
+    g_feed_next = 0;
+
+    SarInfo si;
+    for (size_t n = 0; n < nr; n++) {
+        si.Clear();
+        get_sar_info(si);
+    }
+    CHECK(si.sar_sketch_size() == 1);
+    if (si.sar_sketch_size() != 1) {
+        remove_fixture_tree();
+        set_sar_clock(SarClock());
+        return;
+    }
+    /* Last window of cpu0, the other CPUs at their fixture clock */
+    std::vector<double> all(seq + nr - window, seq + nr);
+    for (int cpu = 1; cpu < 8; cpu++) {
+        all.insert(all.end(), window, 2000 + cpu * 100);
+    }
+    const SarInfo::SarSketch &collected = si.sar_sketch(0);
+    CHECK(collected.name() == "info.sar_cpu_info.*.cur_freq");
+    check_sketch(collected, all);
+
+    /* Into an empty sketch: a copy */
+    SarInfo::SarSketch merged;
+    CHECK(merge_sar_sketch(merged, collected) == 0);
+    check_sketch(merged, all);
+
+    /* Overlapping positive buckets, and negative ones and zeros */
+    std::vector<double> other;
+    for (int i = 0; i < 50; i++) {
+        other.push_back(1800 + i * 37.5);
+        other.push_back(-0.25 * (i + 1));
+    }
+    other.push_back(0);
+    other.push_back(0);
+    CHECK(merge_sar_sketch(merged, make_sketch(other, alpha)) == 0);
+    all.insert(all.end(), other.begin(), other.end());
+    check_sketch(merged, all);
+
+    /* Disjoint buckets on both sides of the positive and negative ranges */
+    std::vector<double> far;
+    for (int i = 0; i < 30; i++) {
+        far.push_back(1e6 + i * 1e4);
+        far.push_back(0.001 * (i + 1));
+        far.push_back(-1e5 * (i + 1));
+        far.push_back(-1e-6 * (i + 1));
+    }
+    CHECK(merge_sar_sketch(merged, make_sketch(far, alpha)) == 0);
+    all.insert(all.end(), far.begin(), far.end());
+    check_sketch(merged, all);
+    CHECK(merged.name() == "info.sar_cpu_info.*.cur_freq");
+
+    /* Not of the same accuracy */
+    CHECK(merge_sar_sketch(merged, make_sketch(far, alpha / 2)) == -1);
+    check_sketch(merged, all);
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* Add @bytes to the received bytes of eth0 in proc/net/dev of g_tree */
+static void add_rx_bytes(unsigned long long bytes)
+{
+    std::istringstream in(read_file(g_tree + "/proc/net/dev"));
+    std::string out, line;
+    while (std::getline(in, line)) {
+        size_t colon = line.find(':');
+        if (colon != std::string::npos && line.compare(0, colon, "  eth0") == 0) {
+            char *end;
+            unsigned long long rx = strtoull(line.c_str() + colon + 1, &end, 10);
+            line = line.substr(0, colon + 1) + " " + std::to_string(rx + bytes) + end;
+        }
+        out += line + "\n";
+    }
+    write_file(g_tree + "/proc/net/dev", out.c_str());
+}
+
+/*
+ * Windows of the rate history: sample k, a second after sample k - 1,
+ * receives 1000 * k bytes on eth0
+ */
+static void test_rates()
+{
+    use_fixture_tree();
+    SarConfig config;
+    config.proc_root = g_tree + "/proc";
+    config.sys_root = g_tree + "/sys";
+    config.net_dev_backend = NET_DEV_PROCFS;
+    config.rate_history = 6;
+    set_sar_config(config);
+    SarClock clock;
+    clock.now_ms = test_now_ms;
+    set_sar_clock(clock);
+    g_now_ms = 1700000000000LL;
+
+    SarInfo si;
+    CHECK(get_sar_rates(1000, si) == -1);
+    sar_sample();
+    CHECK(get_sar_rates(1000, si) == -1);
+    for (int k = 1; k <= 8; k++) {
+        g_now_ms += 1000;
+        tick_fixture(0);
+        add_rx_bytes(1000 * k);
+        sar_sample();
+    }
+
+    /* History of samples 3 to 8, 5 s */
+    si.Clear();
+    CHECK(get_sar_rates(1000, si) == 1000);
+    CHECK(si.rxbyt() == 8000);
+    CHECK(si.sar_cpu_info_size() == 8);
+    si.Clear();
+    CHECK(get_sar_rates(3000, si) == 3000);
+    CHECK(si.rxbyt() == 7000);
+    /* Closest sample to the window */
+    si.Clear();
+    CHECK(get_sar_rates(2400, si) == 2000);
+    CHECK(si.rxbyt() == 7500);
+    si.Clear();
+    CHECK(get_sar_rates(2600, si) == 3000);
+    /* Longest window: the span, plus half an interval */
+    si.Clear();
+    CHECK(get_sar_rates(5500, si) == 5000);
+    CHECK(si.rxbyt() == 6000);
+    CHECK(get_sar_rates(5600, si) == -1);
+    CHECK(get_sar_rates(0, si) == -1);
+
+    /* A sample in the same uptime tick: no rate against it */
+    g_now_ms += 10;
+    sar_sample();
+    CHECK(get_sar_rates(10, si) == -1);
+    si.Clear();
+    CHECK(get_sar_rates(1000, si) == 1010);
+    CHECK(si.rxbyt() == 8000);
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* More interfaces than stats slots: sampled, the extra ones dropped */
+static void test_many_ifaces()
+{
+    use_fixture_tree();
+    std::string dev = "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    "
+        "packets errs drop fifo colls carrier compressed\n";
+    for (int i = 0; i < 40; i++) {
+        dev += "  veth" + std::to_string(i) + ": 1000 10 0 0 0 0 0 0 2000 20 0 0 0 0 0 0\n";
+    }
+    write_file(g_tree + "/proc/net/dev", dev.c_str());
+    SarClock clock;
+    clock.sleep_ms = tick_fixture;
+    set_sar_clock(clock);
+
+    SarInfo si;
+    get_sar_info(si);
+    CHECK(si.has_cpu_idle() && si.sar_cpu_info_size() == 8);
+    CHECK(si.has_rxbyt() && si.rxbyt() == 0);
+
+    remove_fixture_tree();
+    set_sar_clock(SarClock());
+}
+
+/* Stand-in fds for PSI triggers: pipes, which fire EPOLLIN or EPOLLERR */
+static void test_stall_triggers()
+{
+    SarConfig config;
+    set_sar_config(config);
+    SarClock clock;
+    clock.sleep_ms = short_sleep_ms;
+    set_sar_clock(clock);
+
+    SarInfo si;
+    CHECK(get_sar_info_on_stall(si, 0) == -1);
+
+    int live[2], dead[2];
+    CHECK(pipe(live) == 0);
+    CHECK(pipe(dead) == 0);
+    CHECK(add_sar_trigger_fd(live[0]) == 0);
+    CHECK(add_sar_trigger_fd(dead[1]) == 0);
+
+    /* Nothing fired yet */
+    CHECK(get_sar_info_on_stall(si, 0) == 0);
+
+    /* A write end whose read end is closed reports EPOLLERR: dropped */
+    close(dead[0]);
+    CHECK(get_sar_info_on_stall(si, 10) == 0);
+    CHECK(get_sar_info_on_stall(si, 0) == 0);
+
+    /* The live trigger is still served, also after set_sar_config() */
+    set_sar_config(config);
+    CHECK(write(live[1], "x", 1) == 1);
+    si.Clear();
+    CHECK(get_sar_info_on_stall(si, 1000) == 1);
+    CHECK(si.has_cpu_idle());
+
+    char c;
+    CHECK(read(live[0], &c, 1) == 1);
+    CHECK(get_sar_info_on_stall(si, 0) == 0);
+
+    close(live[0]);
+    close(live[1]);
+    close(dead[1]);
+    set_sar_clock(SarClock());
+}
+
+int main()
+{
+    test_stall_triggers();
+    test_cgroups();
+    test_cpufreq();
+    test_archive();
+    test_summaries();
+    test_sketches();
+    test_rates();
+    test_many_ifaces();
+    test_netns();
+    test_entry_keys();
+    test_store_codecs();
+
+    if (g_failures) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("sar_test: all checks passed\n");
+    return 0;
+}
@@ -46,6 +46,13 @@ int main(int argc, char *argv[])
     printf("%5.2f %5.2f %5.2f\n\n", si.frmpg(), si.bufpg(), si.campg());
 
 
+    const SarInfo_SarNetProtoInfo &np = si.net_proto();
+    printf("retrans/s retrans%% lstovf/s lstdrop/s syndrop/s tcpmempr/s udprcvbuf/s\n");
+    printf(" %5.2f %5.2f %5.2f %5.2f %5.2f %5.2f %5.2f\n\n",
+            np.tcp_retrans_segs(), np.tcp_retrans_pct(), np.listen_overflows(),
+            np.listen_drops(), np.syn_drops(), np.tcp_memory_pressures(),
+            np.udp_rcvbuf_errors());
+
     printf("DEV     tps rd_sec wr_sec avgrq_sz avgqu_sz await svctm util\n");
     for (int i = 0; i < si.sar_disk_info_size(); ++i) {
         const SarInfo_SarDiskInfo &s = si.sar_disk_info(i);